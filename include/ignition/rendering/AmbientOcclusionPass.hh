@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_AMBIENTOCCLUSIONPASS_HH_
+#define IGNITION_RENDERING_AMBIENTOCCLUSIONPASS_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class AmbientOcclusionPass AmbientOcclusionPass.hh \
+     * ignition/rendering/AmbientOcclusionPass.hh
+     */
+    /// \brief A render pass that applies screen space ambient occlusion
+    /// (SSAO). Creases, corners and contact areas that receive less
+    /// ambient light are darkened based on the depth of the scene around
+    /// each pixel. The pass is only evaluated for the cameras it is added
+    /// to.
+    class IGNITION_RENDERING_VISIBLE AmbientOcclusionPass
+      : public virtual RenderPass
+    {
+      /// \brief Constructor
+      public: AmbientOcclusionPass();
+
+      /// \brief Destructor
+      public: virtual ~AmbientOcclusionPass();
+
+      /// \brief Set the distance around a surface point within which
+      /// other surfaces occlude it.
+      /// \param[in] _radius Radius in meters, must be positive
+      public: virtual void SetRadius(double _radius) = 0;
+
+      /// \brief Get the occlusion radius.
+      /// \return Radius in meters
+      public: virtual double Radius() const = 0;
+
+      /// \brief Set the number of depth samples taken per pixel. More
+      /// samples reduce noise at a higher cost.
+      /// \param[in] _count Sample count in [1, 64]
+      public: virtual void SetSampleCount(unsigned int _count) = 0;
+
+      /// \brief Get the number of depth samples taken per pixel.
+      /// \return Sample count
+      public: virtual unsigned int SampleCount() const = 0;
+
+      /// \brief Set whether the occlusion is evaluated at half the image
+      /// resolution and upsampled, which is about four times cheaper.
+      /// \param[in] _half True to evaluate at half resolution
+      public: virtual void SetHalfResolution(bool _half) = 0;
+
+      /// \brief Get whether the occlusion is evaluated at half resolution.
+      /// \return True if evaluated at half resolution
+      public: virtual bool HalfResolution() const = 0;
+
+      /// \brief Set the strength of the darkening.
+      /// \param[in] _intensity Intensity, must not be negative. 0 disables
+      /// the effect.
+      public: virtual void SetIntensity(double _intensity) = 0;
+
+      /// \brief Get the strength of the darkening.
+      /// \return Intensity
+      public: virtual double Intensity() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -21,6 +21,7 @@
 
 #include <ignition/common/Event.hh>
 #include <ignition/math/Matrix4.hh>
+#include <ignition/math/Vector4.hh>
 
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/Image.hh"
@@ -41,7 +42,19 @@ namespace ignition
       /// \brief Perspective projection
       CPT_PERSPECTIVE,
       /// \brief Orthographic projection
-      CPT_ORTHOGRAPHIC
+      CPT_ORTHOGRAPHIC,
+      /// \brief Equidistant fisheye projection, r = f * theta
+      CPT_EQUIDISTANT,
+      /// \brief Equisolid angle fisheye projection, r = 2f * sin(theta / 2)
+      CPT_EQUISOLID,
+      /// \brief Stereographic fisheye projection, r = 2f * tan(theta / 2)
+      CPT_STEREOGRAPHIC,
+      /// \brief Kannala-Brandt fisheye projection,
+      /// r = f * (theta + k1 theta^3 + k2 theta^5 + k3 theta^7 + k4 theta^9)
+      /// \sa Camera::SetProjectionCoefficients
+      CPT_KANNALA_BRANDT,
+      /// \brief Equirectangular (latitude / longitude) panoramic projection
+      CPT_EQUIRECTANGULAR
     };
 
     /// \class Camera Camera.hh ignition/rendering/Camera.hh
@@ -89,8 +102,13 @@ namespace ignition
       /// \return Angle containing the camera's horizontal field-of-view
       public: virtual math::Angle HFOV() const = 0;
 
-      /// \brief Set the camera's horizontal field-of-view
+      /// \brief Set the camera's horizontal field-of-view. Perspective and
+      /// orthographic projections are limited to less than 180 degrees.
+      /// Larger angles are only rendered by fisheye and panoramic
+      /// projection types, and render engines that do not support them
+      /// ignore such angles.
       /// \param[in] _hfov Desired horizontal field-of-view
+      /// \sa SetProjectionType
       public: virtual void SetHFOV(const math::Angle &_hfov) = 0;
 
       /// \brief Get the camera's aspect ratio
@@ -182,7 +200,12 @@ namespace ignition
       /// can be called multiple times after PostRender has been called,
       /// without rendering the scene again. Calling this function before a
       /// single image has been rendered will have undefined behavior.
+      /// The frame is copied and written asynchronously by
+      /// FrameEncoder::Instance(), which also determines what happens when
+      /// frames are saved faster than they can be written. The file format
+      /// is selected by the file extension, see FrameEncoder.
       /// \param[in] _name Name of the output file
+      /// \return True if the frame was queued to be written
       public: virtual bool SaveFrame(const std::string &_name) = 0;
 
       /// \brief Subscribes a new listener to this camera's new frame event
@@ -218,8 +241,14 @@ namespace ignition
       /// `SetProjectionMatrix` to override the provided one. To disable the
       /// custom projection matrix, just call this function again with the
       /// desired projection type.
+      /// Fisheye and panoramic projection types have no projection matrix.
+      /// They are rendered from a cubemap that is remapped to the image, and
+      /// the horizontal field of view is the angle covered by the image
+      /// width, which can then exceed 180 degrees. They are only supported
+      /// by the ogre2 render engine.
       /// \param[in] _type Camera projection type
       /// \sa SetProjectionMatrix
+      /// \sa WideAngleProjection
       public: virtual void SetProjectionType(CameraProjectionType _type) = 0;
 
       /// \brief Project point in 3d world space to 2d screen space
@@ -337,6 +366,23 @@ namespace ignition
       /// \internal
       /// \brief Notify that shadows are dirty and need to be regenerated
       public: virtual void SetShadowsDirty() = 0;
+
+      /// \brief Set the coefficients of the projection model. Only used by
+      /// CPT_KANNALA_BRANDT, where they are the k1 to k4 polynomial
+      /// coefficients.
+      /// \param[in] _coefficients Projection coefficients
+      /// \sa CameraProjectionType
+      public: virtual void SetProjectionCoefficients(
+          const math::Vector4d &/*_coefficients*/)
+      {
+      }
+
+      /// \brief Get the coefficients of the projection model
+      /// \return Projection coefficients
+      public: virtual math::Vector4d ProjectionCoefficients() const
+      {
+        return math::Vector4d::Zero;
+      }
     };
     }
   }
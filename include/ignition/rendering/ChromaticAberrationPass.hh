@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CHROMATICABERRATIONPASS_HH_
+#define IGNITION_RENDERING_CHROMATICABERRATIONPASS_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class ChromaticAberrationPass ChromaticAberrationPass.hh \
+     * ignition/rendering/ChromaticAberrationPass.hh
+     */
+    /// \brief A render pass that simulates lateral chromatic aberration,
+    /// i.e. the red and blue channels are magnified by a slightly different
+    /// amount than the green channel, which produces color fringes that grow
+    /// towards the image borders.
+    class IGNITION_RENDERING_VISIBLE ChromaticAberrationPass
+      : public virtual RenderPass
+    {
+      /// \brief Constructor
+      public: ChromaticAberrationPass();
+
+      /// \brief Destructor
+      public: virtual ~ChromaticAberrationPass();
+
+      /// \brief Set the strength of the aberration. The red channel is
+      /// scaled by (1 + _strength) and the blue channel by (1 - _strength)
+      /// around the image center.
+      /// \param[in] _strength Relative magnification difference. Negative
+      /// values swap the fringe colors. Clamped to [-0.5, 0.5].
+      public: virtual void SetStrength(double _strength) = 0;
+
+      /// \brief Get the strength of the aberration.
+      /// \return Relative magnification difference
+      public: virtual double Strength() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_DECAL_HH_
+#define IGNITION_RENDERING_DECAL_HH_
+
+#include <string>
+
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Node.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class Decal Decal.hh ignition/rendering/Decal.hh
+    /// \brief A decal projects textures onto the surfaces that lie inside
+    /// an oriented box, e.g. lane markings, floor tape, fiducial tags or
+    /// damage marks, without adding geometry to the scene. The box is
+    /// centered on the decal's origin and textures are projected along
+    /// the decal's -Z axis onto surfaces that face its +Z axis. The X and
+    /// Y axes of the decal map to the U and V axes of the textures.
+    ///
+    /// Like visuals, a decal can be given a segmentation label with the
+    /// "label" user data key. Segmentation cameras then label the pixels
+    /// covered by the decal with it.
+    class IGNITION_RENDERING_VISIBLE Decal :
+      public virtual Node
+    {
+      /// \brief Destructor
+      public: virtual ~Decal() { }
+
+      /// \brief Set the size of the projection box
+      /// \param[in] _size Width (X), height (Y) and projection depth (Z) of
+      /// the box in meters, must be positive
+      public: virtual void SetSize(const math::Vector3d &_size) = 0;
+
+      /// \brief Get the size of the projection box
+      /// \return Width, height and projection depth in meters
+      public: virtual math::Vector3d Size() const = 0;
+
+      /// \brief Set the diffuse texture. Its alpha channel masks the decal.
+      /// \param[in] _texture Path of the texture, empty to remove it
+      public: virtual void SetDiffuseTexture(const std::string &_texture) = 0;
+
+      /// \brief Get the diffuse texture
+      /// \return Path of the texture, empty if none is set
+      public: virtual std::string DiffuseTexture() const = 0;
+
+      /// \brief Set the tangent space normal map
+      /// \param[in] _texture Path of the texture, empty to remove it
+      public: virtual void SetNormalTexture(const std::string &_texture) = 0;
+
+      /// \brief Get the normal map
+      /// \return Path of the texture, empty if none is set
+      public: virtual std::string NormalTexture() const = 0;
+
+      /// \brief Set the emissive texture
+      /// \param[in] _texture Path of the texture, empty to remove it
+      public: virtual void SetEmissiveTexture(
+                  const std::string &_texture) = 0;
+
+      /// \brief Get the emissive texture
+      /// \return Path of the texture, empty if none is set
+      public: virtual std::string EmissiveTexture() const = 0;
+
+      /// \brief Set the roughness of the surface covered by the decal
+      /// \param[in] _roughness Roughness in [0, 1]
+      public: virtual void SetRoughness(double _roughness) = 0;
+
+      /// \brief Get the roughness of the surface covered by the decal
+      /// \return Roughness in [0, 1]
+      public: virtual double Roughness() const = 0;
+
+      /// \brief Set the metalness of the surface covered by the decal
+      /// \param[in] _metalness Metalness in [0, 1]
+      public: virtual void SetMetalness(double _metalness) = 0;
+
+      /// \brief Get the metalness of the surface covered by the decal
+      /// \return Metalness in [0, 1]
+      public: virtual double Metalness() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_DEPTHARTIFACTPASS_HH_
+#define IGNITION_RENDERING_DEPTHARTIFACTPASS_HH_
+
+#include <ignition/math/Angle.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class DepthArtifactPass DepthArtifactPass.hh \
+     * ignition/rendering/DepthArtifactPass.hh
+     */
+    /// \brief A render pass that adds the artifacts of real structured
+    /// light and time of flight depth sensors to the output of a depth
+    /// camera. It is only applied by depth cameras. Each artifact model is
+    /// disabled by default:
+    ///  * IR shadows: points that can not be seen from the projector of a
+    ///    structured light sensor are invalid.
+    ///  * Disparity quantization: depth is computed from a disparity that
+    ///    is rounded to a fraction of a pixel, so the depth resolution
+    ///    decreases with the square of the distance.
+    ///  * Flying pixels: pixels on depth discontinuities mix the depth of
+    ///    the foreground and background, as seen with time of flight
+    ///    sensors.
+    ///  * Multipath: the depth of concave regions, e.g. inside corners,
+    ///    is overestimated because light is reflected more than once.
+    ///  * Dropouts: points on surfaces that appear too dark or too bright,
+    ///    e.g. black or specular materials, and points on surfaces seen at
+    ///    grazing angles are invalid.
+    /// Invalid points are reported as points closer than the near clip
+    /// plane, i.e. they take the depth camera's minimum value.
+    class IGNITION_RENDERING_VISIBLE DepthArtifactPass
+      : public virtual RenderPass
+    {
+      /// \brief Constructor
+      public: DepthArtifactPass();
+
+      /// \brief Destructor
+      public: virtual ~DepthArtifactPass();
+
+      /// \brief Set the offset of the IR projector from the camera along
+      /// the camera's negative y axis, i.e. to the right of the camera.
+      /// Used by the IR shadow test and the disparity quantization.
+      /// \param[in] _baseline Projector baseline in meters, 0 to disable
+      public: virtual void SetProjectorBaseline(double _baseline) = 0;
+
+      /// \brief Get the offset of the IR projector from the camera
+      /// \return Projector baseline in meters
+      public: virtual double ProjectorBaseline() const = 0;
+
+      /// \brief Set the disparity resolution, e.g. 0.125 for a sensor that
+      /// matches the projected pattern with 1/8 pixel accuracy. Requires a
+      /// projector baseline.
+      /// \param[in] _step Disparity step in pixels, 0 to disable
+      public: virtual void SetDisparityQuantization(double _step) = 0;
+
+      /// \brief Get the disparity resolution
+      /// \return Disparity step in pixels
+      public: virtual double DisparityQuantization() const = 0;
+
+      /// \brief Set the depth difference between neighboring pixels above
+      /// which a pixel is considered to be on an edge and becomes a flying
+      /// pixel
+      /// \param[in] _threshold Depth difference in meters, 0 to disable
+      public: virtual void SetFlyingPixelThreshold(double _threshold) = 0;
+
+      /// \brief Get the depth difference above which pixels become flying
+      /// pixels
+      /// \return Depth difference in meters
+      public: virtual double FlyingPixelThreshold() const = 0;
+
+      /// \brief Set the multipath strength. The depth of a pixel is
+      /// increased by the strength times how much deeper the pixel is than
+      /// its neighbors.
+      /// \param[in] _strength Multipath strength, 0 to disable
+      public: virtual void SetMultipathStrength(double _strength) = 0;
+
+      /// \brief Get the multipath strength
+      /// \return Multipath strength
+      public: virtual double MultipathStrength() const = 0;
+
+      /// \brief Set the range of luminance of the rendered color that
+      /// returns valid depth. Pixels darker than the minimum, e.g. black
+      /// materials, or brighter than the maximum, e.g. specular highlights,
+      /// are invalid.
+      /// \param[in] _min Minimum luminance in [0, 1]
+      /// \param[in] _max Maximum luminance in [0, 1]
+      public: virtual void SetReflectanceRange(double _min, double _max) = 0;
+
+      /// \brief Get the minimum luminance that returns valid depth
+      /// \return Minimum luminance
+      public: virtual double MinReflectance() const = 0;
+
+      /// \brief Get the maximum luminance that returns valid depth
+      /// \return Maximum luminance
+      public: virtual double MaxReflectance() const = 0;
+
+      /// \brief Set the largest angle between the surface normal and the
+      /// camera ray that returns valid depth
+      /// \param[in] _angle Angle in [0, pi/2], pi/2 to disable
+      public: virtual void SetMaxIncidenceAngle(
+          const math::Angle &_angle) = 0;
+
+      /// \brief Get the largest angle between the surface normal and the
+      /// camera ray that returns valid depth
+      /// \return Max incidence angle
+      public: virtual math::Angle MaxIncidenceAngle() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -17,6 +17,7 @@
 #ifndef IGNITION_RENDERING_DEPTHCAMERA_HH_
 #define IGNITION_RENDERING_DEPTHCAMERA_HH_
 
+#include <cstdint>
 #include <string>
 
 #include <ignition/common/Event.hh>
@@ -75,6 +76,63 @@ namespace ignition
           std::function<void(const float *_pointCloud, unsigned int _width,
           unsigned int _height, unsigned int _depth,
           const std::string &_format)> _subscriber) = 0;
+
+      /// \brief Connect to the new surface normals signal. The normals are
+      /// only rendered while there is at least one connection.
+      /// \param[in] _subscriber Subscriber callback function
+      /// The arguments of the callback function are:
+      ///   _normals Surface normal of each pixel in the camera frame
+      ///            (x forward, y left, z up), facing the camera. Each normal
+      ///            is octahedral-encoded into one 32 bit value that can be
+      ///            decoded with decodeOctahedralNormal(). Pixels that do not
+      ///            see any object are 0 and have a material id of 0.
+      ///  _width Image width
+      ///  _height Image height
+      ///  _depth Image depth
+      ///  _format Image format
+      /// \return Pointer to the new Connection. This must be kept in scope
+      /// \sa encodeOctahedralNormal
+      public: virtual ignition::common::ConnectionPtr ConnectNewNormalsFrame(
+          std::function<void(const uint32_t *_normals, unsigned int _width,
+          unsigned int _height, unsigned int _depth,
+          const std::string &_format)> /*_subscriber*/)
+      {
+        return ignition::common::ConnectionPtr();
+      }
+
+      /// \brief Connect to the new material id signal. The material ids are
+      /// only rendered while there is at least one connection.
+      /// \param[in] _subscriber Subscriber callback function
+      /// The arguments of the callback function are:
+      ///   _ids 16 bit material id of each pixel. Ids are assigned to
+      ///        materials in the order they are first seen and stay the
+      ///        same for the lifetime of the camera. Pixels that do not see
+      ///        any object are 0.
+      ///  _width Image width
+      ///  _height Image height
+      ///  _depth Image depth
+      ///  _format Image format
+      /// \return Pointer to the new Connection. This must be kept in scope
+      /// \sa MaterialName
+      public: virtual ignition::common::ConnectionPtr
+          ConnectNewMaterialIdFrame(
+          std::function<void(const uint16_t *_ids, unsigned int _width,
+          unsigned int _height, unsigned int _depth,
+          const std::string &_format)> /*_subscriber*/)
+      {
+        return ignition::common::ConnectionPtr();
+      }
+
+      /// \brief Get the name of the material that a material id was
+      /// assigned to
+      /// \param[in] _id Material id found in material id frames
+      /// \return Name of the material, or an empty string if the id has not
+      /// been assigned
+      public: virtual std::string MaterialName(
+          unsigned int /*_id*/) const
+      {
+        return std::string();
+      }
     };
   }
   }
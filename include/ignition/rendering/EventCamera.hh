@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_EVENTCAMERA_HH_
+#define IGNITION_RENDERING_EVENTCAMERA_HH_
+
+#include <chrono>
+#include <functional>
+
+#include <ignition/common/Event.hh>
+#include "ignition/rendering/Camera.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \struct CameraEvent EventCamera.hh
+    /// ignition/rendering/EventCamera.hh
+    /// \brief A brightness change detected by one pixel of an event camera
+    struct IGNITION_RENDERING_VISIBLE CameraEvent
+    {
+      /// \brief Pixel column
+      public: unsigned int x = 0u;
+
+      /// \brief Pixel row
+      public: unsigned int y = 0u;
+
+      /// \brief Time at which the log intensity crossed the threshold, in
+      /// scene time
+      public: std::chrono::steady_clock::duration time =
+          std::chrono::steady_clock::duration::zero();
+
+      /// \brief True if the brightness increased, false if it decreased
+      public: bool polarity = true;
+    };
+
+    /// \class EventCamera EventCamera.hh
+    /// ignition/rendering/EventCamera.hh
+    /// \brief Event (dynamic vision) camera. Each pixel keeps a reference
+    /// log intensity and emits an event every time the log intensity of the
+    /// rendered image moves away from the reference by a contrast threshold.
+    /// The reference is then moved by the threshold.
+    ///
+    /// The log intensity of a pixel is assumed to change linearly between
+    /// two rendered frames, so events are timestamped between the scene
+    /// time of the previous update and the scene time of the current
+    /// update. The first update only initializes the reference and does not
+    /// produce events.
+    class IGNITION_RENDERING_VISIBLE EventCamera :
+      public virtual Camera
+    {
+      /// \brief Destructor
+      public: virtual ~EventCamera() { }
+
+      /// \brief Set the contrast threshold of brightness increases (ON
+      /// events)
+      /// \param[in] _threshold Threshold in log intensity, greater than 0
+      public: virtual void SetPositiveThreshold(double _threshold) = 0;
+
+      /// \brief Get the contrast threshold of brightness increases
+      /// \return Threshold in log intensity
+      public: virtual double PositiveThreshold() const = 0;
+
+      /// \brief Set the contrast threshold of brightness decreases (OFF
+      /// events)
+      /// \param[in] _threshold Threshold in log intensity, greater than 0
+      public: virtual void SetNegativeThreshold(double _threshold) = 0;
+
+      /// \brief Get the contrast threshold of brightness decreases
+      /// \return Threshold in log intensity
+      public: virtual double NegativeThreshold() const = 0;
+
+      /// \brief Set the standard deviation of the Gaussian noise added to
+      /// the contrast thresholds. A new threshold is sampled for every pixel
+      /// and frame.
+      /// \param[in] _stddev Standard deviation in log intensity
+      public: virtual void SetThresholdNoise(double _stddev) = 0;
+
+      /// \brief Get the standard deviation of the contrast threshold noise
+      /// \return Standard deviation in log intensity
+      public: virtual double ThresholdNoise() const = 0;
+
+      /// \brief Set the refractory period, i.e. the minimum time between
+      /// two events of the same pixel. Threshold crossings during the
+      /// refractory period still move the reference but are not reported.
+      /// \param[in] _period Refractory period
+      public: virtual void SetRefractoryPeriod(
+          const std::chrono::steady_clock::duration &_period) = 0;
+
+      /// \brief Get the refractory period
+      /// \return Refractory period
+      public: virtual std::chrono::steady_clock::duration
+          RefractoryPeriod() const = 0;
+
+      /// \brief Connect to the new events signal. It is emitted once per
+      /// update with the events detected since the previous update, sorted
+      /// by pixel.
+      /// \param[in] _subscriber Subscriber callback function. The callback
+      /// function arguments are: <events, event count>
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual ignition::common::ConnectionPtr ConnectNewEvents(
+          std::function<void(const CameraEvent *, unsigned int)>
+          _subscriber) = 0;
+    };
+    }
+  }
+}
+#endif
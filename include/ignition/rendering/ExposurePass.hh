@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_EXPOSUREPASS_HH_
+#define IGNITION_RENDERING_EXPOSUREPASS_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Tone mapping operators supported by ExposurePass
+    enum ToneMappingType
+    {
+      /// \brief No tone mapping. Exposed colors are clamped.
+      TMT_NONE = 0,
+
+      /// \brief Reinhard operator, c / (1 + c)
+      TMT_REINHARD = 1,
+
+      /// \brief Filmic curve fitted to the ACES reference rendering transform
+      TMT_ACES = 2
+    };
+
+    /* \class ExposurePass ExposurePass.hh \
+     * ignition/rendering/ExposurePass.hh
+     */
+    /// \brief A render pass that scales the scene radiance by an exposure
+    /// factor and tone maps the result. The exposure is given by the
+    /// exposure compensation and, if auto exposure is enabled, by the ratio
+    /// of the key value to the average scene luminance, which is computed on
+    /// the GPU every frame.
+    class IGNITION_RENDERING_VISIBLE ExposurePass
+      : public virtual RenderPass
+    {
+      /// \brief Constructor
+      public: ExposurePass();
+
+      /// \brief Destructor
+      public: virtual ~ExposurePass();
+
+      /// \brief Set the exposure compensation.
+      /// \param[in] _ev Exposure compensation in stops. The image is scaled
+      /// by 2^_ev.
+      public: virtual void SetExposureCompensation(double _ev) = 0;
+
+      /// \brief Get the exposure compensation.
+      /// \return Exposure compensation in stops.
+      public: virtual double ExposureCompensation() const = 0;
+
+      /// \brief Set whether the exposure is adjusted to the average
+      /// luminance of the image.
+      /// \param[in] _enabled True to enable auto exposure
+      public: virtual void SetAutoExposureEnabled(bool _enabled) = 0;
+
+      /// \brief Get whether auto exposure is enabled.
+      /// \return True if auto exposure is enabled
+      public: virtual bool AutoExposureEnabled() const = 0;
+
+      /// \brief Set the key value, i.e. the luminance the average scene
+      /// luminance is mapped to when auto exposure is enabled.
+      /// \param[in] _key Key value in (0, 1]. Defaults to 0.18.
+      public: virtual void SetKeyValue(double _key) = 0;
+
+      /// \brief Get the key value.
+      /// \return Key value
+      public: virtual double KeyValue() const = 0;
+
+      /// \brief Set the limits of the exposure factor computed by auto
+      /// exposure.
+      /// \param[in] _min Minimum exposure factor
+      /// \param[in] _max Maximum exposure factor
+      public: virtual void SetExposureLimits(double _min, double _max) = 0;
+
+      /// \brief Get the minimum exposure factor computed by auto exposure.
+      /// \return Minimum exposure factor
+      public: virtual double MinExposure() const = 0;
+
+      /// \brief Get the maximum exposure factor computed by auto exposure.
+      /// \return Maximum exposure factor
+      public: virtual double MaxExposure() const = 0;
+
+      /// \brief Set the tone mapping operator applied after exposure.
+      /// \param[in] _type Tone mapping operator
+      public: virtual void SetToneMapping(ToneMappingType _type) = 0;
+
+      /// \brief Get the tone mapping operator.
+      /// \return Tone mapping operator
+      public: virtual ToneMappingType ToneMapping() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_FRAMEENCODER_HH_
+#define IGNITION_RENDERING_FRAMEENCODER_HH_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <ignition/common/SingletonT.hh>
+#include <ignition/common/SuppressWarning.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/PixelFormat.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declarations.
+    class FrameEncoderPrivate;
+
+    /// \enum FrameQueuePolicy FrameEncoder.hh
+    /// ignition/rendering/FrameEncoder.hh
+    /// \brief Behavior of FrameEncoder when its queue is full
+    enum IGNITION_RENDERING_VISIBLE FrameQueuePolicy
+    {
+      /// \brief Drop the new frame and count it as dropped
+      FQP_DROP = 0,
+
+      /// \brief Block the caller until there is room in the queue
+      FQP_BLOCK = 1
+    };
+
+    /// \class FrameEncoder FrameEncoder.hh
+    /// ignition/rendering/FrameEncoder.hh
+    /// \brief Writes frames to image files on a pool of background threads
+    /// so that encoding does not stall the render thread. This is used by
+    /// Camera::SaveFrame.
+    ///
+    /// The file format is chosen from the file extension:
+    ///
+    ///   * .png: PF_L8, PF_R8G8B8, PF_B8G8R8 and PF_R8G8B8A8 are written as
+    ///     8 bit PNG, PF_L16 as 16 bit grayscale PNG. The fastest
+    ///     compression level is used to keep encoding cheap.
+    ///   * .exr: PF_FLOAT32_R, PF_FLOAT32_RGB and PF_FLOAT32_RGBA are written
+    ///     as 32 bit float OpenEXR.
+    ///   * .pfm: PF_FLOAT32_R, PF_FLOAT32_RGB and PF_FLOAT32_RGBA are written
+    ///     as Portable Float Map. The alpha channel is discarded.
+    class IGNITION_RENDERING_VISIBLE FrameEncoder :
+      public virtual common::SingletonT<FrameEncoder>
+    {
+      /// \brief Constructor
+      public: FrameEncoder();
+
+      /// \brief Destructor. Waits for all queued frames to be written.
+      public: ~FrameEncoder();
+
+      /// \brief Queue a frame to be written to a file. The frame data is
+      /// copied so the buffer can be reused as soon as this function returns.
+      /// The output directory is created on the calling thread.
+      /// \param[in] _filename Output file name. The extension selects the
+      /// file format.
+      /// \param[in] _data Pixel data, rows from top to bottom
+      /// \param[in] _width Image width in pixels
+      /// \param[in] _height Image height in pixels
+      /// \param[in] _format Pixel format of the data
+      /// \return True if the frame was queued, false if the format is not
+      /// supported, the output directory can not be created or the frame was
+      /// dropped because the queue is full
+      public: bool Enqueue(const std::string &_filename, const void *_data,
+          unsigned int _width, unsigned int _height, PixelFormat _format);
+
+      /// \brief Write a frame to a file on the calling thread.
+      /// \param[in] _filename Output file name. The extension selects the
+      /// file format.
+      /// \param[in] _data Pixel data, rows from top to bottom
+      /// \param[in] _width Image width in pixels
+      /// \param[in] _height Image height in pixels
+      /// \param[in] _format Pixel format of the data
+      /// \return True if the file was written
+      public: static bool Encode(const std::string &_filename,
+          const void *_data, unsigned int _width, unsigned int _height,
+          PixelFormat _format);
+
+      /// \brief Check if a pixel format can be written to the given file.
+      /// \param[in] _filename Output file name
+      /// \param[in] _format Pixel format
+      /// \return True if the combination is supported
+      public: static bool IsSupported(const std::string &_filename,
+          PixelFormat _format);
+
+      /// \brief Block until all queued frames have been written.
+      public: void Flush();
+
+      /// \brief Set the number of encoder threads. Takes effect after the
+      /// frames currently in the queue have been written. The default is 2.
+      /// \param[in] _count Number of threads, at least 1
+      public: void SetThreadCount(unsigned int _count);
+
+      /// \brief Get the number of encoder threads.
+      /// \return Number of threads
+      public: unsigned int ThreadCount() const;
+
+      /// \brief Set the maximum number of frames waiting to be encoded. The
+      /// default is 16.
+      /// \param[in] _size Queue size, at least 1
+      public: void SetQueueSize(unsigned int _size);
+
+      /// \brief Get the maximum number of frames waiting to be encoded.
+      /// \return Queue size
+      public: unsigned int QueueSize() const;
+
+      /// \brief Set the behavior when the queue is full. The default is
+      /// FQP_DROP.
+      /// \param[in] _policy Queue policy
+      public: void SetQueuePolicy(FrameQueuePolicy _policy);
+
+      /// \brief Get the behavior when the queue is full.
+      /// \return Queue policy
+      public: FrameQueuePolicy QueuePolicy() const;
+
+      /// \brief Get the number of frames waiting to be encoded.
+      /// \return Number of queued frames
+      public: unsigned int PendingFrameCount() const;
+
+      /// \brief Get the number of frames written to file.
+      /// \return Number of written frames
+      public: uint64_t EncodedFrameCount() const;
+
+      /// \brief Get the number of frames dropped because the queue was full.
+      /// \return Number of dropped frames
+      public: uint64_t DroppedFrameCount() const;
+
+      /// \brief Get the number of frames that could not be written.
+      /// \return Number of failed frames
+      public: uint64_t FailedFrameCount() const;
+
+      /// \brief Reset the encoded, dropped and failed frame counters.
+      public: void ResetStats();
+
+      /// \brief Private data pointer
+      IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<FrameEncoderPrivate> dataPtr;
+      IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief required SingletonT friendship
+      private: friend class ignition::common::SingletonT<FrameEncoder>;
+    };
+    }
+  }
+}
+#endif
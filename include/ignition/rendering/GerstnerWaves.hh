@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_GERSTNERWAVES_HH_
+#define IGNITION_RENDERING_GERSTNERWAVES_HH_
+
+#include <memory>
+#include <vector>
+
+#include <ignition/common/SuppressWarning.hh>
+#include <ignition/math/Vector2.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class GerstnerWavesPrivate;
+
+    /// \struct GerstnerWave GerstnerWaves.hh
+    /// ignition/rendering/GerstnerWaves.hh
+    /// \brief A single Gerstner wave component
+    struct IGNITION_RENDERING_VISIBLE GerstnerWave
+    {
+      /// \brief Wave amplitude in meters
+      public: double amplitude = 0.0;
+
+      /// \brief Wavelength in meters
+      public: double wavelength = 1.0;
+
+      /// \brief Horizontal direction of travel. Normalized when the wave is
+      /// added to GerstnerWaves.
+      public: math::Vector2d direction{1.0, 0.0};
+
+      /// \brief Steepness of the wave in [0, 1]. A value of 0 produces
+      /// rolling sine waves, higher values produce sharper crests.
+      public: double steepness = 0.0;
+
+      /// \brief Phase offset in radians
+      public: double phase = 0.0;
+    };
+
+    /// \class GerstnerWaves GerstnerWaves.hh
+    /// ignition/rendering/GerstnerWaves.hh
+    /// \brief A sum of Gerstner waves describing a water surface.
+    /// This is the CPU implementation of the wave function evaluated by the
+    /// water surface shaders, so it can be used to query the exact surface
+    /// that is rendered, e.g. for buoyancy computations.
+    ///
+    /// Each wave displaces a point x0 of the flat surface at time t as:
+    ///
+    ///   theta = k * (d . x0) - omega * t + phase
+    ///   x = x0 - steepness * amplitude * d * sin(theta)
+    ///   z = amplitude * cos(theta)
+    ///
+    /// where k = 2 * pi / wavelength and omega = sqrt(g * k) is given by the
+    /// deep water dispersion relation.
+    class IGNITION_RENDERING_VISIBLE GerstnerWaves
+    {
+      /// \brief Maximum number of wave components supported by the shaders
+      public: static const unsigned int kMaxWaveCount;
+
+      /// \brief Constructor
+      public: GerstnerWaves();
+
+      /// \brief Copy constructor
+      /// \param[in] _waves GerstnerWaves to copy.
+      public: GerstnerWaves(const GerstnerWaves &_waves);
+
+      /// \brief Move constructor. _waves is left with no waves and the
+      /// default gravity, so it can still be used.
+      /// \param[in] _waves GerstnerWaves to move.
+      public: GerstnerWaves(GerstnerWaves &&_waves);
+
+      /// \brief Destructor
+      public: virtual ~GerstnerWaves();
+
+      /// \brief Copy assignment operator.
+      /// \param[in] _waves GerstnerWaves to copy.
+      /// \return Reference to this.
+      public: GerstnerWaves &operator=(const GerstnerWaves &_waves);
+
+      /// \brief Move assignment operator.
+      /// \param[in] _waves GerstnerWaves to move.
+      /// \return Reference to this.
+      public: GerstnerWaves &operator=(GerstnerWaves &&_waves);
+
+      /// \brief Add a wave component. The wave is not added if kMaxWaveCount
+      /// components already exist or if its wavelength is not positive.
+      /// \param[in] _wave Wave to add
+      /// \return True if the wave was added
+      public: bool AddWave(const GerstnerWave &_wave);
+
+      /// \brief Get the number of wave components
+      /// \return Number of wave components
+      public: unsigned int WaveCount() const;
+
+      /// \brief Get a wave component by index
+      /// \param[in] _index Index of the wave component
+      /// \return Wave component, or a flat wave if the index is out of range
+      public: GerstnerWave Wave(unsigned int _index) const;
+
+      /// \brief Remove all wave components
+      public: void ClearWaves();
+
+      /// \brief Set the gravitational acceleration used by the dispersion
+      /// relation.
+      /// \param[in] _gravity Gravitational acceleration in m/s^2
+      public: void SetGravity(double _gravity);
+
+      /// \brief Get the gravitational acceleration used by the dispersion
+      /// relation.
+      /// \return Gravitational acceleration in m/s^2
+      public: double Gravity() const;
+
+      /// \brief Get the wavenumber (k) of a wave component
+      /// \param[in] _index Index of the wave component
+      /// \return Wavenumber in rad/m
+      public: double Wavenumber(unsigned int _index) const;
+
+      /// \brief Get the angular frequency (omega) of a wave component
+      /// \param[in] _index Index of the wave component
+      /// \return Angular frequency in rad/s
+      public: double AngularFrequency(unsigned int _index) const;
+
+      /// \brief Get the displacement of a point on the flat surface.
+      /// \param[in] _point Undisplaced horizontal position
+      /// \param[in] _time Time in seconds
+      /// \return Displacement to add to the undisplaced point
+      public: math::Vector3d Displacement(const math::Vector2d &_point,
+          double _time) const;
+
+      /// \brief Get the surface normal of the point that originates from
+      /// the given undisplaced position.
+      /// \param[in] _point Undisplaced horizontal position
+      /// \param[in] _time Time in seconds
+      /// \return Unit normal vector
+      public: math::Vector3d Normal(const math::Vector2d &_point,
+          double _time) const;
+
+      /// \brief Get the height of the surface at a horizontal position.
+      /// Since Gerstner waves also move points horizontally, this finds the
+      /// undisplaced point that ends up at the given position.
+      /// \param[in] _point Horizontal position
+      /// \param[in] _time Time in seconds
+      /// \return Height of the surface
+      public: double Height(const math::Vector2d &_point, double _time) const;
+
+      /// \brief Get the height of the surface at multiple horizontal
+      /// positions.
+      /// \param[in] _points Horizontal positions
+      /// \param[in] _time Time in seconds
+      /// \param[out] _heights Heights of the surface. Resized to the number
+      /// of points.
+      public: void Heights(const std::vector<math::Vector2d> &_points,
+          double _time, std::vector<double> &_heights) const;
+
+      /// \brief Private data pointer.
+      IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<GerstnerWavesPrivate> dataPtr;
+      IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
@@ -18,8 +18,11 @@
 #define IGNITION_RENDERING_GPURAYS_HH_
 
 #include <string>
+#include <vector>
 
 #include <ignition/common/Event.hh>
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector2.hh>
 
 #include "ignition/rendering/Image.hh"
 #include "ignition/rendering/Sensor.hh"
@@ -32,6 +35,38 @@ namespace ignition
   {
     inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
     //
+    /// \brief Enum for the echoes reported by GpuRays when the beam
+    /// footprint of a ray hits more than one surface, e.g. the edge of an
+    /// object, foliage or a fence.
+    enum IGNITION_RENDERING_VISIBLE LidarReturnMode
+    {
+      /// \brief Report the closest echo
+      LRM_FIRST     = 0,
+
+      /// \brief Report the farthest echo
+      LRM_LAST      = 1,
+
+      /// \brief Report the echo with the highest intensity
+      LRM_STRONGEST = 2,
+
+      /// \brief Report up to GpuRays::ReturnCount echoes ordered by range
+      LRM_ALL       = 3
+    };
+
+    /// \brief Enum for the model used by GpuRays to compute the intensity
+    /// of a return.
+    enum IGNITION_RENDERING_VISIBLE LidarIntensityModel
+    {
+      /// \brief The intensity is the laser retro value of the visual that
+      /// is hit, see Visual::SetUserData with the "laser_retro" key
+      LIM_RETRO    = 0,
+
+      /// \brief The intensity is computed from the near infrared
+      /// reflectance of the surface, the incidence angle of the ray and the
+      /// range, see GpuRays::SetIntensityModel
+      LIM_PHYSICAL = 1
+    };
+
     /// \class GpuRays GpuRays.hh ignition/rendering/GpuRays.hh
     /// \brief Generate depth ray data.
     class IGNITION_RENDERING_VISIBLE GpuRays :
@@ -125,7 +160,8 @@ namespace ignition
       /// \brief Set horizontal quantity of rays
       public: virtual void SetRayCount(int _samples) = 0;
 
-      /// \brief Get hoizontal range count, i.e. ray count * horz resolution
+      /// \brief Get hoizontal range count, i.e. ray count * horz resolution,
+      /// or the number of columns of the ray direction table if set.
       // \return horizontal range count
       public: virtual int RangeCount() const = 0;
 
@@ -136,7 +172,8 @@ namespace ignition
       /// \brief Set vertical quantity of rays
       public: virtual void SetVerticalRayCount(int _samples) = 0;
 
-      /// \brief Get vertical range count, i.e. ray count * vert resolution
+      /// \brief Get vertical range count, i.e. ray count * vert resolution,
+      /// or the number of rows of the ray direction table if set.
       // \return Vertical range count
       public: virtual int VerticalRangeCount() const = 0;
 
@@ -156,6 +193,8 @@ namespace ignition
       public: virtual void SetVerticalAngleMax(const double _angle) = 0;
 
       /// \brief Get the number of channels used to store the ray data.
+      /// In LRM_ALL return mode, each ray stores 3 channels per return,
+      /// i.e. 3 * ReturnCount() channels.
       /// \return Channel count.
       public: virtual unsigned int Channels() const = 0;
 
@@ -190,6 +229,292 @@ namespace ignition
       /// \return The vertical resolution.
       /// \sa VerticalRayCount()
       public: virtual double VerticalResolution() const = 0;
+
+      /// \brief Set the full angle beam divergence. Rays are sampled over
+      /// a circular footprint of this angle so that a ray can hit multiple
+      /// surfaces. A value of 0 (default) samples a single point per ray.
+      /// \param[in] _divergence Beam divergence
+      /// \sa SetReturnMode
+      public: virtual void SetBeamDivergence(
+                  const math::Angle &/*_divergence*/)
+      {
+      }
+
+      /// \brief Get the full angle beam divergence.
+      /// \return Beam divergence
+      public: virtual math::Angle BeamDivergence() const
+      {
+        return math::Angle::Zero;
+      }
+
+      /// \brief Set which echoes are reported for each ray. Samples in the
+      /// beam footprint that are closer than ReturnSeparation() to each other
+      /// are merged into one echo. The range of an echo is the mean range of
+      /// its samples and its intensity is the footprint weighted retro value.
+      /// Each reported echo occupies 3 floats: range, intensity and the
+      /// fraction of the beam footprint that contributed to the echo.
+      /// If no echo is found, the first return holds the range at the
+      /// center of the beam, i.e. the same value as in single return mode,
+      /// with zero intensity.
+      /// The default is LRM_FIRST, which matches the single return output.
+      /// \param[in] _mode Return mode
+      public: virtual void SetReturnMode(LidarReturnMode /*_mode*/)
+      {
+      }
+
+      /// \brief Get which echoes are reported for each ray
+      /// \return Return mode
+      public: virtual LidarReturnMode ReturnMode() const
+      {
+        return LRM_FIRST;
+      }
+
+      /// \brief Set the max number of echoes reported for each ray in
+      /// LRM_ALL return mode. Unused echoes are filled with range set to
+      /// +inf (or the far clip distance if clamped) and zero intensity.
+      /// \param[in] _count Number of returns in the range of [1, 8]
+      public: virtual void SetReturnCount(unsigned int /*_count*/)
+      {
+      }
+
+      /// \brief Get the max number of echoes reported for each ray in
+      /// LRM_ALL return mode.
+      /// \return Number of returns
+      public: virtual unsigned int ReturnCount() const
+      {
+        return 1u;
+      }
+
+      /// \brief Set the minimum range difference between two distinct
+      /// echoes, i.e. the range resolution of the lidar.
+      /// \param[in] _separation Separation in meters. Default is 0.1
+      public: virtual void SetReturnSeparation(double /*_separation*/)
+      {
+      }
+
+      /// \brief Get the minimum range difference between two distinct
+      /// echoes.
+      /// \return Separation in meters
+      public: virtual double ReturnSeparation() const
+      {
+        return 0.1;
+      }
+
+      /// \brief Set a table of ray directions to use instead of the
+      /// uniformly spaced rays defined by the min / max angles, ray counts
+      /// and resolutions. This supports sensors with non-uniform vertical
+      /// beam spacing, per laser azimuth offsets or non-repetitive scan
+      /// patterns. The table is stored in row major order, i.e. the ray in
+      /// column i of row j is at index j * _columns + i, and the output data
+      /// has the same layout: RangeCount() returns _columns and
+      /// VerticalRangeCount() returns the number of rows.
+      /// The table can be updated every frame for time varying patterns.
+      /// A table of the same size that samples the same cubemap faces is
+      /// only uploaded to the GPU, anything else recreates the sensor
+      /// textures.
+      /// \param[in] _angles Azimuth (X) and elevation (Y) of each ray in
+      /// radians, using the same convention as AngleMin() and
+      /// VerticalAngleMin().
+      /// \param[in] _columns Number of rays in each row. The table size
+      /// must be a non-zero multiple of this number.
+      /// \return True if the table is valid and was set.
+      public: virtual bool SetRayDirections(
+                  const std::vector<math::Vector2d> &/*_angles*/,
+                  unsigned int /*_columns*/)
+      {
+        return false;
+      }
+
+      /// \brief Get the table of ray directions
+      /// \return Azimuth (X) and elevation (Y) of each ray in radians, or
+      /// an empty vector if rays are uniformly spaced.
+      /// \sa SetRayDirections
+      public: virtual const std::vector<math::Vector2d> &RayDirections()
+                  const
+      {
+        static const std::vector<math::Vector2d> uniform;
+        return uniform;
+      }
+
+      /// \brief Remove the table of ray directions and go back to uniformly
+      /// spaced rays.
+      public: virtual void ClearRayDirections()
+      {
+      }
+
+      /// \brief Enable rolling scan mode. By default all rays are rendered
+      /// from the current pose of the sensor. In rolling scan mode, each
+      /// column of rays is measured at a different time during the scan and
+      /// the sensor pose is interpolated between ScanStartPose() and
+      /// ScanEndPose() for each column, so that the data is skewed by the
+      /// motion of the sensor like on a real spinning lidar. The first
+      /// column is measured at the start of the scan and the last column at
+      /// the end, unless the rays of a table of ray directions are given
+      /// their own times with SetRayTimes. In this mode, the third float of
+      /// each reading holds the time offset of the ray in seconds from the
+      /// start of the scan.
+      /// The scene itself is rendered once from the current sensor pose,
+      /// so the motion of other objects during the scan is not captured.
+      /// Not supported together with multiple returns.
+      /// \param[in] _enabled True to enable rolling scan mode
+      /// \sa SetScanPoses
+      public: virtual void SetRollingScanEnabled(bool /*_enabled*/)
+      {
+      }
+
+      /// \brief Get whether rolling scan mode is enabled
+      /// \return True if rolling scan mode is enabled
+      public: virtual bool RollingScanEnabled() const
+      {
+        return false;
+      }
+
+      /// \brief Set the world poses of the sensor at the start and end of
+      /// the scan. This is typically called every frame before the sensor
+      /// is updated, with the end pose set to the current pose.
+      /// \param[in] _start World pose of the sensor at the start of the scan
+      /// \param[in] _end World pose of the sensor at the end of the scan
+      public: virtual void SetScanPoses(const math::Pose3d &/*_start*/,
+                  const math::Pose3d &/*_end*/)
+      {
+      }
+
+      /// \brief Get the world pose of the sensor at the start of the scan
+      /// \return World pose
+      public: virtual math::Pose3d ScanStartPose() const
+      {
+        return math::Pose3d::Zero;
+      }
+
+      /// \brief Get the world pose of the sensor at the end of the scan
+      /// \return World pose
+      public: virtual math::Pose3d ScanEndPose() const
+      {
+        return math::Pose3d::Zero;
+      }
+
+      /// \brief Set the time it takes to complete a scan, e.g. 0.1 seconds
+      /// for a lidar spinning at 10 Hz. Used to compute the time offset of
+      /// each ray in rolling scan mode.
+      /// \param[in] _duration Scan duration in seconds
+      public: virtual void SetScanDuration(double /*_duration*/)
+      {
+      }
+
+      /// \brief Get the time it takes to complete a scan
+      /// \return Scan duration in seconds
+      public: virtual double ScanDuration() const
+      {
+        return 0.1;
+      }
+
+      /// \brief Set the time at which each ray of the table of ray
+      /// directions is measured in rolling scan mode. Without them, the
+      /// columns of the table are assumed to be measured one after another
+      /// like uniformly spaced rays, which does not hold for per laser
+      /// azimuth offsets or non-repetitive scan patterns. The times are
+      /// kept while new tables of the same size are set, and removed with
+      /// the table otherwise.
+      /// \param[in] _times Time of each ray as a fraction of the scan
+      /// duration in the range of [0, 1], in the same order as the table of
+      /// ray directions.
+      /// \return True if there is a table of ray directions of the same
+      /// size and the times were set.
+      /// \sa SetRayDirections
+      /// \sa SetRollingScanEnabled
+      public: virtual bool SetRayTimes(const std::vector<double> &/*_times*/)
+      {
+        return false;
+      }
+
+      /// \brief Get the time at which each ray of the table of ray
+      /// directions is measured in rolling scan mode
+      /// \return Time of each ray as a fraction of the scan duration, or an
+      /// empty vector if the columns are measured one after another.
+      /// \sa SetRayTimes
+      public: virtual const std::vector<double> &RayTimes() const
+      {
+        static const std::vector<double> inOrder;
+        return inOrder;
+      }
+
+      /// \brief Set the model used to compute the intensity of the returns.
+      /// The default is LIM_RETRO.
+      ///
+      /// In LIM_PHYSICAL mode, the intensity of a return at range r is
+      ///
+      ///   scale * (rho * cos(theta) + retro(theta)) * (r0 / r)^n
+      ///
+      /// where scale, r0 and n are the calibration parameters set with
+      /// SetIntensityScale, SetIntensityReferenceRange and
+      /// SetIntensityRangeExponent, and theta is the angle between the ray
+      /// and the surface normal. rho is the near infrared reflectance of the
+      /// surface in [0, 1], set with the "nir_reflectance" user data of the
+      /// visual. The user data is either a number or the path to a texture
+      /// whose red channel holds the reflectance. retro(theta) is the
+      /// return of retroreflective materials, e.g. road signs and lane
+      /// markings, relative to a white diffuse surface seen head on. It
+      /// is set with the "retroreflectivity" user data of the visual and
+      /// decreases with theta until it vanishes at an entrance angle of
+      /// 60 degrees. Visuals without user data do not return any
+      /// intensity. The intensity is still attenuated by participating
+      /// media and precipitation.
+      /// \param[in] _model Intensity model
+      public: virtual void SetIntensityModel(LidarIntensityModel /*_model*/)
+      {
+      }
+
+      /// \brief Get the model used to compute the intensity of the returns
+      /// \return Intensity model
+      public: virtual LidarIntensityModel IntensityModel() const
+      {
+        return LIM_RETRO;
+      }
+
+      /// \brief Set the intensity of a return from a white diffuse surface
+      /// seen head on at the reference range, in LIM_PHYSICAL mode.
+      /// The default is 1.
+      /// \param[in] _scale Intensity scale, must be positive
+      public: virtual void SetIntensityScale(double /*_scale*/)
+      {
+      }
+
+      /// \brief Get the intensity scale
+      /// \return Intensity scale
+      public: virtual double IntensityScale() const
+      {
+        return 1.0;
+      }
+
+      /// \brief Set the range at which the intensity of a return equals the
+      /// intensity scale times the reflectance, in LIM_PHYSICAL mode.
+      /// The default is 10 meters.
+      /// \param[in] _range Reference range in meters, must be positive
+      public: virtual void SetIntensityReferenceRange(double /*_range*/)
+      {
+      }
+
+      /// \brief Get the intensity reference range
+      /// \return Reference range in meters
+      public: virtual double IntensityReferenceRange() const
+      {
+        return 10.0;
+      }
+
+      /// \brief Set the exponent of the range falloff of the intensity, in
+      /// LIM_PHYSICAL mode. The default is 2, i.e. an extended target that
+      /// fills the beam. Use 0 for a sensor that compensates for the range.
+      /// \param[in] _exponent Range exponent, must not be negative
+      public: virtual void SetIntensityRangeExponent(double /*_exponent*/)
+      {
+      }
+
+      /// \brief Get the exponent of the range falloff of the intensity
+      /// \return Range exponent
+      public: virtual double IntensityRangeExponent() const
+      {
+        return 2.0;
+      }
     };
   }
   }
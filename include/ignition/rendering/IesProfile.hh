@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_IESPROFILE_HH_
+#define IGNITION_RENDERING_IESPROFILE_HH_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ignition/common/SuppressWarning.hh>
+#include <ignition/math/Angle.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class IesProfilePrivate;
+
+    /// \class IesProfile IesProfile.hh ignition/rendering/IesProfile.hh
+    /// \brief Photometric profile of a luminaire read from an IES LM-63
+    /// file. Only type C photometry is supported, where vertical angles are
+    /// measured from the nadir, i.e. from the direction the luminaire
+    /// points at. The profile is treated as rotationally symmetric: the
+    /// candela values of all horizontal planes are averaged.
+    ///
+    /// The beam and field angles and the spot falloff can be used to
+    /// approximate the profile with a spot light, see
+    /// SpotLight::SetIesProfile.
+    class IGNITION_RENDERING_VISIBLE IesProfile
+    {
+      /// \brief Constructor
+      public: IesProfile();
+
+      /// \brief Copy constructor
+      /// \param[in] _profile IesProfile to copy.
+      public: IesProfile(const IesProfile &_profile);
+
+      /// \brief Move constructor
+      /// \param[in] _profile IesProfile to move.
+      public: IesProfile(IesProfile &&_profile) noexcept;
+
+      /// \brief Destructor
+      public: virtual ~IesProfile();
+
+      /// \brief Copy assignment operator.
+      /// \param[in] _profile IesProfile to copy.
+      /// \return Reference to this.
+      public: IesProfile &operator=(const IesProfile &_profile);
+
+      /// \brief Move assignment operator.
+      /// \param[in] _profile IesProfile to move.
+      /// \return Reference to this.
+      public: IesProfile &operator=(IesProfile &&_profile);
+
+      /// \brief Load a profile from an IES file
+      /// \param[in] _filename Path to the IES file
+      /// \return True if the file was read and parsed successfully
+      public: bool Load(const std::string &_filename);
+
+      /// \brief Load a profile from the contents of an IES file
+      /// \param[in] _data Contents of an IES file
+      /// \return True if the data was parsed successfully
+      public: bool LoadFromString(const std::string &_data);
+
+      /// \brief Get whether a profile has been loaded successfully
+      /// \return True if the profile is valid
+      public: bool Valid() const;
+
+      /// \brief Get the vertical angles at which the candela values are
+      /// given, in ascending order.
+      /// \return Vertical angles in radians
+      public: std::vector<double> VerticalAngles() const;
+
+      /// \brief Get the luminous intensity in a direction, averaged over
+      /// all horizontal planes and linearly interpolated between vertical
+      /// angles. The candela multiplier of the file is applied.
+      /// \param[in] _angle Angle from the nadir in radians
+      /// \return Luminous intensity in candela, 0 outside of the angles
+      /// covered by the profile
+      public: double Candela(double _angle) const;
+
+      /// \brief Get the maximum luminous intensity of the profile
+      /// \return Luminous intensity in candela
+      public: double MaxCandela() const;
+
+      /// \brief Get the full beam angle, inside of which the intensity is
+      /// at least 50% of the maximum intensity.
+      /// \return Beam angle
+      public: math::Angle BeamAngle() const;
+
+      /// \brief Get the full field angle, inside of which the intensity is
+      /// at least 10% of the maximum intensity.
+      /// \return Field angle
+      public: math::Angle FieldAngle() const;
+
+      /// \brief Get the exponent of the spot light falloff curve that best
+      /// fits the profile between half the beam angle and half the field
+      /// angle, in a least squares sense.
+      /// \return Spot light falloff
+      public: double SpotFalloff() const;
+
+      /// \brief Private data pointer.
+      IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<IesProfilePrivate> dataPtr;
+      IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
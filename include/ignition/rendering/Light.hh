@@ -17,7 +17,10 @@
 #ifndef IGNITION_RENDERING_LIGHT_HH_
 #define IGNITION_RENDERING_LIGHT_HH_
 
+#include <string>
+
 #include "ignition/math/Color.hh"
+#include "ignition/math/Vector2.hh"
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/Node.hh"
 
@@ -201,6 +204,94 @@ namespace ignition
       /// \brief Set the falloff of the spotlight
       /// \param[in] _falloff New falloff of the spotlight
       public: virtual void SetFalloff(double _falloff) = 0;
+
+      /// \brief Approximate the photometric profile of an IES file. The
+      /// inner and outer angles are set to half the beam and field angles
+      /// of the profile and the falloff is fitted to the intensity in
+      /// between, see IesProfile. The intensity of the light is not changed.
+      /// \param[in] _filename Path to an IES file. An empty string clears
+      /// the profile but keeps the current angles and falloff.
+      /// \return True if the profile was loaded and applied
+      public: virtual bool SetIesProfile(const std::string &/*_filename*/)
+      {
+        return false;
+      }
+
+      /// \brief Get the path of the IES profile applied to the light
+      /// \return Path of the IES file, or an empty string if none is set
+      public: virtual std::string IesProfile() const
+      {
+        return std::string();
+      }
+    };
+
+    /// \enum AreaLightShape
+    /// \brief Shape of the emitting surface of an area light
+    enum IGNITION_RENDERING_VISIBLE AreaLightShape
+    {
+      /// \brief Rectangle
+      ALS_RECT = 0,
+
+      /// \brief Disc, or ellipse if the width and height differ
+      ALS_DISC = 1
+    };
+
+    /// \class AreaLight Light.hh ignition/rendering/Light.hh
+    /// \brief Represents a light emitted by a planar surface, e.g. a ceiling
+    /// panel or a window. The surface is centered on the light position and
+    /// emits along its direction. The emitted color can be modulated with a
+    /// texture (cookie) to project patterns such as window frames.
+    ///
+    /// Area lights do not cast shadows. Render engines may only shade a
+    /// limited number of area lights at once, in which case the brightest
+    /// ones are kept, see the documentation of the render engine.
+    class IGNITION_RENDERING_VISIBLE AreaLight :
+      public virtual Light
+    {
+      /// \brief Destructor
+      public: virtual ~AreaLight() { }
+
+      /// \brief Get the direction of the light
+      /// \return The direction of the light
+      public: virtual math::Vector3d Direction() const = 0;
+
+      /// \brief Set the direction of the light
+      /// \param[in] _x X-component of direction vector
+      /// \param[in] _y Y-component of direction vector
+      /// \param[in] _z Z-component of direction vector
+      public: virtual void SetDirection(double _x, double _y, double _z) = 0;
+
+      /// \brief Set the direction of the light
+      /// \param[in] _dir New direction vector
+      public: virtual void SetDirection(const math::Vector3d &_dir) = 0;
+
+      /// \brief Get the shape of the emitting surface
+      /// \return Shape of the light
+      public: virtual AreaLightShape Shape() const = 0;
+
+      /// \brief Set the shape of the emitting surface
+      /// \param[in] _shape Shape of the light
+      public: virtual void SetShape(AreaLightShape _shape) = 0;
+
+      /// \brief Get the size of the emitting surface
+      /// \return Width and height in meters
+      public: virtual math::Vector2d Size() const = 0;
+
+      /// \brief Set the size of the emitting surface. For discs the width
+      /// and height are the diameters along each axis.
+      /// \param[in] _size Width and height in meters, must be positive
+      public: virtual void SetSize(const math::Vector2d &_size) = 0;
+
+      /// \brief Get the texture that modulates the emitted light
+      /// \return Path of the texture, or an empty string if none is set
+      public: virtual std::string Texture() const = 0;
+
+      /// \brief Set a texture that modulates the emitted light over the
+      /// emitting surface. The texture replaces the shape mask so the shape
+      /// has no effect while a texture is set.
+      /// \param[in] _texture Path of the texture. An empty string removes
+      /// the texture.
+      public: virtual void SetTexture(const std::string &_texture) = 0;
     };
     }
   }
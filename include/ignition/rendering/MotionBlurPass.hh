@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_MOTIONBLURPASS_HH_
+#define IGNITION_RENDERING_MOTIONBLURPASS_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class MotionBlurPass MotionBlurPass.hh \
+     * ignition/rendering/MotionBlurPass.hh
+     */
+    /// \brief A render pass that blurs the image along the motion of the
+    /// camera between the previous and the current frame. The image motion
+    /// is computed by reprojecting each pixel with the camera rotation of
+    /// the previous frame. Camera translation is not taken into account
+    /// since the scene depth is not available to render passes.
+    class IGNITION_RENDERING_VISIBLE MotionBlurPass
+      : public virtual RenderPass
+    {
+      /// \brief Constructor
+      public: MotionBlurPass();
+
+      /// \brief Destructor
+      public: virtual ~MotionBlurPass();
+
+      /// \brief Set the fraction of the time between two frames during
+      /// which the shutter is open.
+      /// \param[in] _fraction Exposure fraction in [0, 1]
+      public: virtual void SetExposureFraction(double _fraction) = 0;
+
+      /// \brief Get the fraction of the time between two frames during
+      /// which the shutter is open.
+      /// \return Exposure fraction in [0, 1]
+      public: virtual double ExposureFraction() const = 0;
+
+      /// \brief Set the number of samples taken along the motion of each
+      /// pixel.
+      /// \param[in] _samples Number of samples in [1, 32]
+      public: virtual void SetSampleCount(unsigned int _samples) = 0;
+
+      /// \brief Get the number of samples taken along the motion of each
+      /// pixel.
+      /// \return Number of samples
+      public: virtual unsigned int SampleCount() const = 0;
+    };
+    }
+  }
+}
+#endif
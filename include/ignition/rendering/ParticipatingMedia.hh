@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_PARTICIPATINGMEDIA_HH_
+#define IGNITION_RENDERING_PARTICIPATINGMEDIA_HH_
+
+#include <ignition/math/Color.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/Object.hh"
+#include "ignition/rendering/RenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class ParticipatingMedia ParticipatingMedia.hh
+    /// ignition/rendering/ParticipatingMedia.hh
+    /// \brief Participating media, e.g. fog, haze or water, that fill the
+    /// scene. Light traveling through the media is absorbed and scattered
+    /// out of its path, and light scattered by the media towards a sensor
+    /// is added to what the sensor observes.
+    ///
+    /// The media have an extinction coefficient per color channel for
+    /// cameras and a separate one for infrared sensors. Their density is
+    /// uniform below a base height and, if a height falloff is set, decays
+    /// exponentially above it, which gives ground fog or, with a base
+    /// height at the water surface, an underwater volume.
+    ///
+    /// The same parameters are used by all sensors of the scene: cameras
+    /// fade objects towards the media color with distance, lidars see
+    /// their return intensity reduced by the two-way transmittance and
+    /// lose returns that are attenuated too much, and thermal cameras see
+    /// object temperatures fade towards the ambient temperature. Only one
+    /// participating media object can exist per scene.
+    class IGNITION_RENDERING_VISIBLE ParticipatingMedia :
+      public virtual Object
+    {
+      /// \brief Destructor
+      public: virtual ~ParticipatingMedia() { }
+
+      /// \brief Set the absorption coefficients of the media for the red,
+      /// green and blue color channels
+      /// \param[in] _absorption Absorption coefficients in 1/m, must not
+      /// be negative
+      public: virtual void SetAbsorption(
+                  const math::Vector3d &_absorption) = 0;
+
+      /// \brief Get the absorption coefficients of the media
+      /// \return Absorption coefficients in 1/m for the red, green and blue
+      /// color channels
+      public: virtual math::Vector3d Absorption() const = 0;
+
+      /// \brief Set the scattering coefficients of the media for the red,
+      /// green and blue color channels
+      /// \param[in] _scattering Scattering coefficients in 1/m, must not
+      /// be negative
+      public: virtual void SetScattering(
+                  const math::Vector3d &_scattering) = 0;
+
+      /// \brief Get the scattering coefficients of the media
+      /// \return Scattering coefficients in 1/m for the red, green and blue
+      /// color channels
+      public: virtual math::Vector3d Scattering() const = 0;
+
+      /// \brief Set the color of the light scattered by the media towards
+      /// cameras. This is the color a very dense, purely scattering media
+      /// appears in.
+      /// \param[in] _color Color of the in-scattered light
+      public: virtual void SetColor(const math::Color &_color) = 0;
+
+      /// \brief Get the color of the light scattered by the media towards
+      /// cameras
+      /// \return Color of the in-scattered light
+      public: virtual math::Color Color() const = 0;
+
+      /// \brief Set the extinction coefficient of the media for infrared
+      /// sensors, i.e. lidars and thermal cameras. Defaults to 0 so that
+      /// infrared sensors are only affected if a coefficient is set.
+      /// \param[in] _extinction Extinction coefficient in 1/m, must not be
+      /// negative
+      public: virtual void SetInfraredExtinction(double _extinction) = 0;
+
+      /// \brief Get the extinction coefficient of the media for infrared
+      /// sensors
+      /// \return Extinction coefficient in 1/m
+      public: virtual double InfraredExtinction() const = 0;
+
+      /// \brief Set the rate at which the density of the media decays with
+      /// height above the base height
+      /// \param[in] _falloff Height falloff in 1/m, 0 for media of uniform
+      /// density everywhere. Must not be negative.
+      public: virtual void SetHeightFalloff(double _falloff) = 0;
+
+      /// \brief Get the rate at which the density of the media decays with
+      /// height above the base height
+      /// \return Height falloff in 1/m
+      public: virtual double HeightFalloff() const = 0;
+
+      /// \brief Set the height in world frame below which the media have
+      /// their full density
+      /// \param[in] _height Base height in meters
+      public: virtual void SetBaseHeight(double _height) = 0;
+
+      /// \brief Get the height in world frame below which the media have
+      /// their full density
+      /// \return Base height in meters
+      public: virtual double BaseHeight() const = 0;
+
+      /// \brief Get the fraction of light that travels between two points
+      /// in world frame without being absorbed or scattered, for the red,
+      /// green and blue color channels
+      /// \param[in] _from Start point in world frame
+      /// \param[in] _to End point in world frame
+      /// \return Transmittance of each color channel in the range [0, 1]
+      public: virtual math::Vector3d Transmittance(
+                  const math::Vector3d &_from,
+                  const math::Vector3d &_to) const = 0;
+
+      /// \brief Get the fraction of infrared light that travels between
+      /// two points in world frame without being absorbed or scattered
+      /// \param[in] _from Start point in world frame
+      /// \param[in] _to End point in world frame
+      /// \return Infrared transmittance in the range [0, 1]
+      public: virtual double InfraredTransmittance(
+                  const math::Vector3d &_from,
+                  const math::Vector3d &_to) const = 0;
+    };
+    }
+  }
+}
+#endif
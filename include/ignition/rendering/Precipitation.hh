@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_PRECIPITATION_HH_
+#define IGNITION_RENDERING_PRECIPITATION_HH_
+
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/Object.hh"
+#include "ignition/rendering/RenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Kind of particles that fall in a precipitation
+    enum IGNITION_RENDERING_VISIBLE PrecipitationType
+    {
+      /// \brief Rain drops
+      PT_RAIN = 0,
+
+      /// \brief Snow flakes
+      PT_SNOW = 1
+    };
+
+    /// \class Precipitation Precipitation.hh
+    /// ignition/rendering/Precipitation.hh
+    /// \brief Rain or snow falling in the scene.
+    ///
+    /// The precipitation is parameterized by its rate, i.e. the depth of
+    /// liquid water that falls per hour. The size and fall speed of the
+    /// particles, their number, the extinction of light traveling through
+    /// them and the wetness of surfaces are derived from the rate with
+    /// empirical relations and can be queried.
+    ///
+    /// The particles are not simulated. Each sensor of the scene generates
+    /// the particles around itself procedurally on the GPU, so the
+    /// precipitation follows every sensor and its cost does not depend on
+    /// the number of sensors or on the size of the world: cameras render
+    /// streaks or flakes in front of the objects they see, lidars get
+    /// early returns scattered by the particles and lose returns that are
+    /// attenuated too much, and both see upward facing surfaces darkened
+    /// by the wetness. Only one precipitation can exist per scene.
+    class IGNITION_RENDERING_VISIBLE Precipitation :
+      public virtual Object
+    {
+      /// \brief Destructor
+      public: virtual ~Precipitation() { }
+
+      /// \brief Set the kind of particles that fall
+      /// \param[in] _type Precipitation type
+      public: virtual void SetType(PrecipitationType _type) = 0;
+
+      /// \brief Get the kind of particles that fall
+      /// \return Precipitation type
+      public: virtual PrecipitationType Type() const = 0;
+
+      /// \brief Set the precipitation rate. For snow this is the liquid
+      /// water equivalent of the snow that falls.
+      /// \param[in] _rate Rate in mm/h, must not be negative. Typical
+      /// values are 2.5 for light, 10 for moderate and 50 for heavy rain,
+      /// and 0.5 to 5 for snow.
+      public: virtual void SetRate(double _rate) = 0;
+
+      /// \brief Get the precipitation rate
+      /// \return Rate in mm/h
+      public: virtual double Rate() const = 0;
+
+      /// \brief Set the wind velocity that carries the particles sideways
+      /// \param[in] _velocity Wind velocity in world frame in m/s
+      public: virtual void SetWindVelocity(
+                  const math::Vector3d &_velocity) = 0;
+
+      /// \brief Get the wind velocity that carries the particles sideways
+      /// \return Wind velocity in world frame in m/s
+      public: virtual math::Vector3d WindVelocity() const = 0;
+
+      /// \brief Set the laser retro-reflectivity of the particles, i.e.
+      /// the intensity of the early returns lidars get from them. Defaults
+      /// to 0 like the laser retro of visuals.
+      /// \param[in] _retro Laser retro-reflectivity
+      public: virtual void SetLaserRetro(double _retro) = 0;
+
+      /// \brief Get the laser retro-reflectivity of the particles
+      /// \return Laser retro-reflectivity
+      public: virtual double LaserRetro() const = 0;
+
+      /// \brief Get the diameter of the particles, i.e. the median volume
+      /// diameter of rain drops or the diameter of snow flakes
+      /// \return Particle diameter in meters
+      public: virtual double ParticleDiameter() const = 0;
+
+      /// \brief Get the terminal speed at which the particles fall
+      /// \return Fall speed in m/s
+      public: virtual double FallSpeed() const = 0;
+
+      /// \brief Get the extinction coefficient of the precipitation, which
+      /// is the same for visible light and lidars since the particles are
+      /// much larger than the wavelengths
+      /// \return Extinction coefficient in 1/m
+      public: virtual double Extinction() const = 0;
+
+      /// \brief Get the wetness of upward facing surfaces, which darkens
+      /// them in camera images and reduces their lidar returns
+      /// \return Wetness in the range [0, 1]
+      public: virtual double Wetness() const = 0;
+    };
+    }
+  }
+}
+#endif
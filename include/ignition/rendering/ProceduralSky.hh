@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_PROCEDURALSKY_HH_
+#define IGNITION_RENDERING_PROCEDURALSKY_HH_
+
+#include <ignition/math/Color.hh>
+#include <ignition/math/Vector2.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/Object.hh"
+#include "ignition/rendering/RenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class ProceduralSky ProceduralSky.hh
+    /// ignition/rendering/ProceduralSky.hh
+    /// \brief An analytic atmospheric sky rendered behind the scene. The
+    /// sky color is computed per pixel from Rayleigh and Mie single
+    /// scattering of sunlight, and includes the sun disc and an optional
+    /// cloud layer that drifts with the wind over scene time.
+    ///
+    /// The sky drives the rest of the scene's outdoor lighting so that it
+    /// stays consistent with the sky as the sun moves: the direction and
+    /// color of the sun light, the scene's ambient light and the
+    /// environment captured by reflection probes. Only one sky can exist
+    /// per scene, and it should be created before cameras first render.
+    class IGNITION_RENDERING_VISIBLE ProceduralSky :
+      public virtual Object
+    {
+      /// \brief Destructor
+      public: virtual ~ProceduralSky() { }
+
+      /// \brief Set the direction towards the sun in world frame. The sun
+      /// is below the horizon if the direction's z component is negative.
+      /// \param[in] _direction Direction towards the sun, must not be zero
+      public: virtual void SetSunDirection(
+                  const math::Vector3d &_direction) = 0;
+
+      /// \brief Get the direction towards the sun in world frame
+      /// \return Unit vector pointing towards the sun
+      public: virtual math::Vector3d SunDirection() const = 0;
+
+      /// \brief Set the turbidity of the atmosphere, i.e. the amount of
+      /// haze. 1 is a perfectly clear sky and values around 10 give a
+      /// hazy sky.
+      /// \param[in] _turbidity Turbidity, must be at least 1
+      public: virtual void SetTurbidity(double _turbidity) = 0;
+
+      /// \brief Get the turbidity of the atmosphere
+      /// \return Turbidity
+      public: virtual double Turbidity() const = 0;
+
+      /// \brief Set the fraction of the sky covered by clouds. Clouds also
+      /// dim the sun light.
+      /// \param[in] _cover Cloud cover in the range [0, 1], 0 disables
+      /// the cloud layer
+      public: virtual void SetCloudCover(double _cover) = 0;
+
+      /// \brief Get the fraction of the sky covered by clouds
+      /// \return Cloud cover in the range [0, 1]
+      public: virtual double CloudCover() const = 0;
+
+      /// \brief Set the velocity of the cloud layer in the world XY plane
+      /// \param[in] _velocity Wind velocity in m/s
+      public: virtual void SetWindVelocity(
+                  const math::Vector2d &_velocity) = 0;
+
+      /// \brief Get the velocity of the cloud layer
+      /// \return Wind velocity in m/s
+      public: virtual math::Vector2d WindVelocity() const = 0;
+
+      /// \brief Set the directional light that represents the sun. The
+      /// sky sets the light's direction and colors whenever the sun or
+      /// the atmosphere changes.
+      /// \param[in] _light Sun light, nullptr to stop updating a light
+      public: virtual void SetSunLight(DirectionalLightPtr _light) = 0;
+
+      /// \brief Get the directional light that represents the sun
+      /// \return Sun light, nullptr if not set
+      public: virtual DirectionalLightPtr SunLight() const = 0;
+
+      /// \brief Get the color of the sky in a given direction as it
+      /// appears in rendered images, excluding the sun disc and clouds
+      /// \param[in] _direction View direction in world frame
+      /// \return Sky color
+      public: virtual math::Color SkyColor(
+                  const math::Vector3d &_direction) const = 0;
+
+      /// \brief Get the color of the sun light after extinction by the
+      /// atmosphere and clouds. This is the color given to the sun light.
+      /// \return Linear sun light color, black if the sun is below the
+      /// horizon
+      public: virtual math::Color SunColor() const = 0;
+
+      /// \brief Get the ambient light color received from the sky by an
+      /// upward facing surface. This is the scene's ambient light while
+      /// the sky exists.
+      /// \return Linear ambient light color
+      public: virtual math::Color AmbientColor() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_RADARSENSOR_HH_
+#define IGNITION_RENDERING_RADARSENSOR_HH_
+
+#include <functional>
+
+#include <ignition/common/Event.hh>
+#include <ignition/math/Angle.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/GpuRays.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \struct RadarDetection RadarSensor.hh
+    /// ignition/rendering/RadarSensor.hh
+    /// \brief A target detected in one range / angle resolution cell of a
+    /// radar sensor
+    struct IGNITION_RENDERING_VISIBLE RadarDetection
+    {
+      /// \brief Range to the target in meters
+      public: double range = 0.0;
+
+      /// \brief Azimuth of the target in radians, positive to the left of
+      /// the sensor X axis
+      public: double azimuth = 0.0;
+
+      /// \brief Elevation of the target in radians, positive above the
+      /// sensor XY plane
+      public: double elevation = 0.0;
+
+      /// \brief Radial (Doppler) velocity of the target relative to the
+      /// sensor in m/s, positive when the target moves away from the sensor
+      public: double radialVelocity = 0.0;
+
+      /// \brief Radar cross section of the target in m^2
+      public: double rcs = 0.0;
+    };
+
+    /// \class RadarSensor RadarSensor.hh ignition/rendering/RadarSensor.hh
+    /// \brief Imaging radar built on top of the gpu rays sensor. The cone of
+    /// the radar is configured with the GpuRays angles and ray counts, and
+    /// the rays are grouped into range / azimuth / elevation resolution
+    /// cells. Each cell that is hit by at least one ray is reported as one
+    /// detection.
+    ///
+    /// The radar cross section of a visual is read from its
+    /// "radar_cross_section" user data in m^2, the same way the gpu rays
+    /// read the "laser_retro" user data. Values are clamped to [0, 2000].
+    /// Visuals with no radar cross section are not detected.
+    ///
+    /// The renderer does not know how objects move, so the radial velocity
+    /// is computed from the velocities given with SetVisualVelocity and
+    /// SetLinearVelocity. A detection belongs to a moving visual if it lies
+    /// inside the world bounding box of the visual.
+    class IGNITION_RENDERING_VISIBLE RadarSensor :
+      public virtual GpuRays
+    {
+      /// \brief Destructor
+      public: virtual ~RadarSensor() { }
+
+      /// \brief Set the range resolution, i.e. the size of a resolution
+      /// cell along the range.
+      /// \param[in] _resolution Resolution in meters, greater than 0.
+      /// Default is 0.5
+      public: virtual void SetRangeResolution(double _resolution) = 0;
+
+      /// \brief Get the range resolution
+      /// \return Resolution in meters
+      public: virtual double RangeResolution() const = 0;
+
+      /// \brief Set the angular resolution, i.e. the size of a resolution
+      /// cell in both azimuth and elevation. Use a ray spacing smaller than
+      /// this so that each cell is sampled by several rays.
+      /// \param[in] _resolution Resolution, greater than 0. Default is 2
+      /// degrees
+      public: virtual void SetAngleResolution(
+                  const math::Angle &_resolution) = 0;
+
+      /// \brief Get the angular resolution
+      /// \return Resolution
+      public: virtual math::Angle AngleResolution() const = 0;
+
+      /// \brief Set the clutter rate, i.e. the mean number of false
+      /// detections added to each frame. The number of false detections is
+      /// Poisson distributed and they are spread uniformly over the cone and
+      /// range of the sensor with a radar cross section of up to 1 m^2.
+      /// \param[in] _rate Mean false detection count, greater than or equal
+      /// to 0. Default is 0
+      public: virtual void SetClutterRate(double _rate) = 0;
+
+      /// \brief Get the clutter rate
+      /// \return Mean false detection count per frame
+      public: virtual double ClutterRate() const = 0;
+
+      /// \brief Set the linear velocity of the sensor in the world frame.
+      /// Static objects are seen moving with the opposite velocity.
+      /// \param[in] _velocity Velocity in m/s
+      public: virtual void SetLinearVelocity(
+                  const math::Vector3d &_velocity) = 0;
+
+      /// \brief Get the linear velocity of the sensor in the world frame
+      /// \return Velocity in m/s
+      public: virtual math::Vector3d LinearVelocity() const = 0;
+
+      /// \brief Set the linear velocity of a visual in the world frame. This
+      /// is typically called every frame for the visuals that move.
+      /// \param[in] _visualId Id of the visual
+      /// \param[in] _velocity Velocity in m/s
+      public: virtual void SetVisualVelocity(unsigned int _visualId,
+                  const math::Vector3d &_velocity) = 0;
+
+      /// \brief Get the linear velocity of a visual in the world frame
+      /// \param[in] _visualId Id of the visual
+      /// \return Velocity in m/s, or zero if it was not set
+      public: virtual math::Vector3d VisualVelocity(
+                  unsigned int _visualId) const = 0;
+
+      /// \brief Remove all visual velocities. All visuals are then
+      /// considered static.
+      public: virtual void ClearVisualVelocities() = 0;
+
+      /// \brief Connect to the new detections signal. It is emitted once
+      /// per update with the detections of the frame sorted by range.
+      /// \param[in] _subscriber Subscriber callback function. The callback
+      /// function arguments are: <detections, detection count>
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual ignition::common::ConnectionPtr ConnectNewDetections(
+          std::function<void(const RadarDetection *, unsigned int)>
+          _subscriber) = 0;
+    };
+    }
+  }
+}
+#endif
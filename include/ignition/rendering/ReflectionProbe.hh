@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_REFLECTIONPROBE_HH_
+#define IGNITION_RENDERING_REFLECTIONPROBE_HH_
+
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/Object.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class ReflectionProbe ReflectionProbe.hh
+    /// ignition/rendering/ReflectionProbe.hh
+    /// \brief A reflection probe captures the scene around a point into a
+    /// cubemap that is shared by all materials within the probe's area.
+    /// Reflections are parallax corrected against the area, i.e. the area
+    /// should match the walls of a room or the bounds of the local
+    /// environment so that nearby surfaces appear at the correct place in
+    /// reflections. Materials with an explicit environment map keep using
+    /// it. All other materials use the probe whose area contains the
+    /// object that the material is applied to, or the closest probe if no
+    /// area contains it.
+    ///
+    /// Static probes are captured once and then cached until Capture is
+    /// called. Dynamic probes are recaptured at most at the update rate,
+    /// based on the scene time. All probes are recaptured when the
+    /// lighting of the scene's procedural sky changes, and the sky is
+    /// captured behind the scene.
+    class IGNITION_RENDERING_VISIBLE ReflectionProbe :
+      public virtual Object
+    {
+      /// \brief Destructor
+      public: virtual ~ReflectionProbe() { }
+
+      /// \brief Set the position in world coordinates that the scene is
+      /// captured from. The position should be within the probe's area.
+      /// \param[in] _position Capture position
+      public: virtual void SetCapturePosition(
+                  const math::Vector3d &_position) = 0;
+
+      /// \brief Get the position that the scene is captured from
+      /// \return Capture position in world coordinates
+      public: virtual math::Vector3d CapturePosition() const = 0;
+
+      /// \brief Set the volume in world coordinates that the probe
+      /// applies to and that reflections are projected onto.
+      /// \param[in] _area Axis aligned volume, must not be empty
+      public: virtual void SetArea(const math::AxisAlignedBox &_area) = 0;
+
+      /// \brief Get the volume that the probe applies to
+      /// \return Axis aligned volume in world coordinates
+      public: virtual math::AxisAlignedBox Area() const = 0;
+
+      /// \brief Set the width and height of each face of the cubemap
+      /// \param[in] _resolution Face size in pixels
+      public: virtual void SetResolution(unsigned int _resolution) = 0;
+
+      /// \brief Get the width and height of each face of the cubemap
+      /// \return Face size in pixels
+      public: virtual unsigned int Resolution() const = 0;
+
+      /// \brief Set the near clip distance used when capturing the scene
+      /// \param[in] _near Near clip distance in meters
+      public: virtual void SetNearClipPlane(double _near) = 0;
+
+      /// \brief Get the near clip distance used when capturing the scene
+      /// \return Near clip distance in meters
+      public: virtual double NearClipPlane() const = 0;
+
+      /// \brief Set the far clip distance used when capturing the scene
+      /// \param[in] _far Far clip distance in meters
+      public: virtual void SetFarClipPlane(double _far) = 0;
+
+      /// \brief Get the far clip distance used when capturing the scene
+      /// \return Far clip distance in meters
+      public: virtual double FarClipPlane() const = 0;
+
+      /// \brief Set whether the probe is static. Static probes are
+      /// captured once and reused until Capture is called.
+      /// \param[in] _static True to make the probe static
+      public: virtual void SetStatic(bool _static) = 0;
+
+      /// \brief Get whether the probe is static
+      /// \return True if the probe is static
+      public: virtual bool Static() const = 0;
+
+      /// \brief Set the maximum rate at which a dynamic probe is
+      /// recaptured. Ignored by static probes.
+      /// \param[in] _hz Update rate in Hz, 0 to recapture every frame
+      public: virtual void SetUpdateRate(double _hz) = 0;
+
+      /// \brief Get the maximum rate at which a dynamic probe is
+      /// recaptured
+      /// \return Update rate in Hz, 0 if recaptured every frame
+      public: virtual double UpdateRate() const = 0;
+
+      /// \brief Request the probe to be recaptured the next time the
+      /// scene is rendered, e.g. after a static probe's surroundings
+      /// changed.
+      public: virtual void Capture() = 0;
+
+      /// \brief Get the number of times the scene has been captured by
+      /// this probe
+      /// \return Number of captures
+      public: virtual unsigned int CaptureCount() const = 0;
+    };
+    }
+  }
+}
+#endif
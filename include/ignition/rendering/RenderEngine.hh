@@ -18,7 +18,9 @@
 #define IGNITION_RENDERING_RENDERENGINE_HH_
 
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/RenderTypes.hh"
 #include "ignition/rendering/Export.hh"
@@ -178,6 +180,31 @@ namespace ignition
 
       /// \brief Get the render pass system for this engine.
       public: virtual RenderPassSystemPtr RenderPassSystem() const = 0;
+
+      /// \brief Get the mutex that guards the resources shared by all the
+      /// scenes of this render-engine, e.g. the graphics device, the
+      /// material and mesh managers and the stream of GPU commands. Scenes
+      /// hold it while they render a frame. See Scene for the threading
+      /// model.
+      /// The default implementation returns a mutex shared by all the
+      /// render-engines that do not provide their own.
+      /// \return Shared resource mutex
+      public: virtual std::recursive_mutex &SharedResourceMutex() const
+      {
+        static std::recursive_mutex mutex;
+        return mutex;
+      }
+
+      /// \brief Get the thread that scenes must be rendered from. Some
+      /// graphics APIs, e.g. OpenGL, have a context that is current on a
+      /// single thread. Scenes can then only be rendered from that thread,
+      /// although other threads may still populate them.
+      /// \return Id of the thread scenes must be rendered from, or a default
+      /// constructed id if scenes may be rendered from any thread
+      public: virtual std::thread::id GraphicsContextThread() const
+      {
+        return std::thread::id();
+      }
     };
     }
   }
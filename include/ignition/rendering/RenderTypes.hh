@@ -46,15 +46,22 @@ namespace ignition
     template <class T>
     using shared_ptr = std::shared_ptr<T>;
 
+    class AmbientOcclusionPass;
+    class AreaLight;
     class ArrowVisual;
     class AxisVisual;
     class BoundingBoxCamera;
     class Camera;
     class Capsule;
+    class ChromaticAberrationPass;
     class COMVisual;
+    class DepthArtifactPass;
+    class Decal;
     class DepthCamera;
+    class EventCamera;
     class DirectionalLight;
     class DistortionPass;
+    class ExposurePass;
     class GaussianNoisePass;
     class Geometry;
     class GizmoVisual;
@@ -71,27 +78,39 @@ namespace ignition
     class Marker;
     class Material;
     class Mesh;
+    class MotionBlurPass;
     class Node;
     class Object;
     class ObjectFactory;
+    class ParticipatingMedia;
     class ParticleEmitter;
     class PointLight;
+    class Precipitation;
+    class ProceduralSky;
+    class RadarSensor;
     class RayQuery;
+    class ReflectionProbe;
     class RenderEngine;
     class RenderPass;
     class RenderPassSystem;
     class RenderTarget;
     class RenderTexture;
     class RenderWindow;
+    class RollingShutterPass;
     class Scene;
     class SegmentationCamera;
     class Sensor;
     class ShaderParams;
+    class ShaderPass;
+    class SonarSensor;
     class SpotLight;
+    class StereoCamera;
     class SubMesh;
     class Text;
     class ThermalCamera;
     class Visual;
+    class VignettePass;
+    class WaterSurface;
     class WireBox;
 
     /// \typedef ArrowVisualPtr
@@ -106,6 +125,10 @@ namespace ignition
     /// \brief Shared pointer to Camera
     typedef shared_ptr<Camera> CameraPtr;
 
+    /// \typedef DecalPtr
+    /// \brief Shared pointer to Decal
+    typedef shared_ptr<Decal> DecalPtr;
+
     /// \typedef DepthCameraPtr
     /// \brief Shared pointer to DepthCamera
     typedef shared_ptr<DepthCamera> DepthCameraPtr;
@@ -122,6 +145,10 @@ namespace ignition
     /// \brief Shared pointer to Segmentation Camera
     typedef shared_ptr<SegmentationCamera> SegmentationCameraPtr;
 
+    /// \typedef EventCameraPtr
+    /// \brief Shared pointer to EventCamera
+    typedef shared_ptr<EventCamera> EventCameraPtr;
+
     /// \typedef GpuRaysPtr
     /// \brief Shared pointer to GpuRays
     typedef shared_ptr<GpuRays> GpuRaysPtr;
@@ -130,10 +157,26 @@ namespace ignition
     /// \brief Shared pointer to DirectionalLight
     typedef shared_ptr<DirectionalLight> DirectionalLightPtr;
 
+    /// \typedef AmbientOcclusionPassPtr
+    /// \brief Shared pointer to AmbientOcclusionPass
+    typedef shared_ptr<AmbientOcclusionPass> AmbientOcclusionPassPtr;
+
+    /// \typedef DepthArtifactPassPtr
+    /// \brief Shared pointer to DepthArtifactPass
+    typedef shared_ptr<DepthArtifactPass> DepthArtifactPassPtr;
+
     /// \typedef DistortionPassPtr
     /// \brief Shared pointer to DistortionPass
     typedef shared_ptr<DistortionPass> DistortionPassPtr;
 
+    /// \typedef ChromaticAberrationPassPtr
+    /// \brief Shared pointer to ChromaticAberrationPass
+    typedef shared_ptr<ChromaticAberrationPass> ChromaticAberrationPassPtr;
+
+    /// \typedef ExposurePassPtr
+    /// \brief Shared pointer to ExposurePass
+    typedef shared_ptr<ExposurePass> ExposurePassPtr;
+
     /// \typedef GaussianNoisePassPtr
     /// \brief Shared pointer to GaussianNoisePass
     typedef shared_ptr<GaussianNoisePass> GaussianNoisePassPtr;
@@ -210,6 +253,10 @@ namespace ignition
     /// \brief Shared pointer to ObjectFactory
     typedef shared_ptr<ObjectFactory> ObjectFactoryPtr;
 
+    /// \typedef ParticipatingMediaPtr
+    /// \brief Shared pointer to ParticipatingMedia
+    typedef shared_ptr<ParticipatingMedia> ParticipatingMediaPtr;
+
     /// \typedef ParticleEmitterPtr
     /// \brief Shared pointer to ParticleEmitter
     typedef shared_ptr<ParticleEmitter> ParticleEmitterPtr;
@@ -218,10 +265,38 @@ namespace ignition
     /// \brief Shared pointer to PointLight
     typedef shared_ptr<PointLight> PointLightPtr;
 
+    /// \typedef PrecipitationPtr
+    /// \brief Shared pointer to Precipitation
+    typedef shared_ptr<Precipitation> PrecipitationPtr;
+
+    /// \typedef ProceduralSkyPtr
+    /// \brief Shared pointer to ProceduralSky
+    typedef shared_ptr<ProceduralSky> ProceduralSkyPtr;
+
+    /// \typedef RadarSensorPtr
+    /// \brief Shared pointer to RadarSensor
+    typedef shared_ptr<RadarSensor> RadarSensorPtr;
+
     /// \typedef RayQueryPtr
     /// \brief Shared pointer to RayQuery
     typedef shared_ptr<RayQuery> RayQueryPtr;
 
+    /// \typedef ReflectionProbePtr
+    /// \brief Shared pointer to ReflectionProbe
+    typedef shared_ptr<ReflectionProbe> ReflectionProbePtr;
+
+    /// \typedef MotionBlurPassPtr
+    /// \brief Shared pointer to MotionBlurPass
+    typedef shared_ptr<MotionBlurPass> MotionBlurPassPtr;
+
+    /// \typedef RollingShutterPassPtr
+    /// \brief Shared pointer to RollingShutterPass
+    typedef shared_ptr<RollingShutterPass> RollingShutterPassPtr;
+
+    /// \typedef VignettePassPtr
+    /// \brief Shared pointer to VignettePass
+    typedef shared_ptr<VignettePass> VignettePassPtr;
+
     /// \typedef RenderPassPtr
     /// \brief Shared pointer to RenderPass
     typedef shared_ptr<RenderPass> RenderPassPtr;
@@ -252,10 +327,26 @@ namespace ignition
     /// \brief Shared pointer to ShaderParams
     typedef shared_ptr<ShaderParams> ShaderParamsPtr;
 
+    /// \typedef ShaderPassPtr
+    /// \brief Shared pointer to ShaderPass
+    typedef shared_ptr<ShaderPass> ShaderPassPtr;
+
+    /// \typedef SonarSensorPtr
+    /// \brief Shared pointer to SonarSensor
+    typedef shared_ptr<SonarSensor> SonarSensorPtr;
+
     /// \typedef SpotLightPtr
     /// \brief Shared pointer to SpotLight
     typedef shared_ptr<SpotLight> SpotLightPtr;
 
+    /// \typedef AreaLightPtr
+    /// \brief Shared pointer to AreaLight
+    typedef shared_ptr<AreaLight> AreaLightPtr;
+
+    /// \typedef StereoCameraPtr
+    /// \brief Shared pointer to StereoCamera
+    typedef shared_ptr<StereoCamera> StereoCameraPtr;
+
     /// \typedef SubMeshPtr
     /// \brief Shared pointer to SubMesh
     typedef shared_ptr<SubMesh> SubMeshPtr;
@@ -268,6 +359,10 @@ namespace ignition
     /// \brief Shared pointer to Visual
     typedef shared_ptr<Visual> VisualPtr;
 
+    /// \typedef WaterSurfacePtr
+    /// \brief Shared pointer to WaterSurface
+    typedef shared_ptr<WaterSurface> WaterSurfacePtr;
+
     /// \typedef WireBoxPtr
     /// \brief Shared pointer to WireBox
     typedef shared_ptr<WireBox> WireBoxPtr;
@@ -284,6 +379,10 @@ namespace ignition
     /// \brief Shared pointer to const Camera
     typedef shared_ptr<const Camera> ConstCameraPtr;
 
+    /// \typedef const DecalPtr
+    /// \brief Shared pointer to const Decal
+    typedef shared_ptr<const Decal> ConstDecalPtr;
+
     /// \typedef const DepthCameraPtr
     /// \brief Shared pointer to const DepthCamera
     typedef shared_ptr<const DepthCamera> ConstDepthCameraPtr;
@@ -300,6 +399,10 @@ namespace ignition
     /// \brief Shared pointer to const Segmentation Camera
     typedef shared_ptr<const SegmentationCamera> ConstSegmentationCameraPtr;
 
+    /// \typedef const EventCameraPtr
+    /// \brief Shared pointer to const EventCamera
+    typedef shared_ptr<const EventCamera> ConstEventCameraPtr;
+
     /// \typedef const GpuRaysPtr
     /// \brief Shared pointer to const GpuRays
     typedef shared_ptr<const GpuRays> ConstGpuRaysPtr;
@@ -360,6 +463,10 @@ namespace ignition
     /// \brief Shared pointer to const ObjectFactory
     typedef shared_ptr<const ObjectFactory> ConstObjectFactoryPtr;
 
+    /// \typedef const ParticipatingMediaPtr
+    /// \brief Shared pointer to const ParticipatingMedia
+    typedef shared_ptr<const ParticipatingMedia> ConstParticipatingMediaPtr;
+
     /// \typedef const ParticleEmitterPtr
     /// \brief Shared pointer to const ParticleEmitter
     typedef shared_ptr<const ParticleEmitter> ConstParticleEmitterPtr;
@@ -368,10 +475,26 @@ namespace ignition
     /// \brief Shared pointer to const PointLight
     typedef shared_ptr<const PointLight> ConstPointLightPtr;
 
+    /// \typedef const PrecipitationPtr
+    /// \brief Shared pointer to const Precipitation
+    typedef shared_ptr<const Precipitation> ConstPrecipitationPtr;
+
+    /// \typedef const ProceduralSkyPtr
+    /// \brief Shared pointer to const ProceduralSky
+    typedef shared_ptr<const ProceduralSky> ConstProceduralSkyPtr;
+
+    /// \typedef const RadarSensorPtr
+    /// \brief Shared pointer to const RadarSensor
+    typedef shared_ptr<const RadarSensor> ConstRadarSensorPtr;
+
     /// \typedef RayQueryPtr
     /// \brief Shared pointer to RayQuery
     typedef shared_ptr<const RayQuery> ConstRayQueryPtr;
 
+    /// \typedef const ReflectionProbePtr
+    /// \brief Shared pointer to const ReflectionProbe
+    typedef shared_ptr<const ReflectionProbe> ConstReflectionProbePtr;
+
     /// \typedef const RenderPassPtr
     /// \brief Shared pointer to const RenderPass
     typedef shared_ptr<const RenderPass> ConstRenderPassPtr;
@@ -403,10 +526,22 @@ namespace ignition
     /// \brief Shared pointer to const ShaderParams
     typedef shared_ptr<const ShaderParams> ConstShaderParamsPtr;
 
+    /// \typedef const SonarSensorPtr
+    /// \brief Shared pointer to const SonarSensor
+    typedef shared_ptr<const SonarSensor> ConstSonarSensorPtr;
+
     /// \typedef const SpotLightPtr
     /// \brief Shared pointer to const SpotLight
     typedef shared_ptr<const SpotLight> ConstSpotLightPtr;
 
+    /// \typedef const AreaLightPtr
+    /// \brief Shared pointer to const AreaLight
+    typedef shared_ptr<const AreaLight> ConstAreaLightPtr;
+
+    /// \typedef const StereoCameraPtr
+    /// \brief Shared pointer to const StereoCamera
+    typedef shared_ptr<const StereoCamera> ConstStereoCameraPtr;
+
     /// \typedef const SubMeshPtr
     /// \brief Shared pointer to const SubMesh
     typedef shared_ptr<const SubMesh> ConstSubMeshPtr;
@@ -415,6 +550,10 @@ namespace ignition
     /// \brief Shared pointer to const SubMesh
     typedef shared_ptr<const Text> ConstTextPtr;
 
+    /// \typedef const WaterSurfacePtr
+    /// \brief Shared pointer to const WaterSurface
+    typedef shared_ptr<const WaterSurface> ConstWaterSurfacePtr;
+
     /// \typedef const VisualPtr
     /// \brief Shared pointer to const Visual
     typedef shared_ptr<const Visual> ConstVisualPtr;
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_ROLLINGSHUTTERPASS_HH_
+#define IGNITION_RENDERING_ROLLINGSHUTTERPASS_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class RollingShutterPass RollingShutterPass.hh \
+     * ignition/rendering/RollingShutterPass.hh
+     */
+    /// \brief A render pass that simulates a rolling shutter sensor, which
+    /// reads out image rows sequentially from top to bottom. The bottom row
+    /// is captured with the current camera pose and rows above it with
+    /// poses interpolated towards the camera pose of the previous frame.
+    /// Only camera rotation is taken into account.
+    class IGNITION_RENDERING_VISIBLE RollingShutterPass
+      : public virtual RenderPass
+    {
+      /// \brief Constructor
+      public: RollingShutterPass();
+
+      /// \brief Destructor
+      public: virtual ~RollingShutterPass();
+
+      /// \brief Set the time it takes to read out all rows, as a fraction
+      /// of the time between two frames.
+      /// \param[in] _fraction Readout fraction in [0, 1]
+      public: virtual void SetReadoutFraction(double _fraction) = 0;
+
+      /// \brief Get the time it takes to read out all rows, as a fraction
+      /// of the time between two frames.
+      /// \return Readout fraction in [0, 1]
+      public: virtual double ReadoutFraction() const = 0;
+    };
+    }
+  }
+}
+#endif
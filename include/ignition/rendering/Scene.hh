@@ -20,6 +20,7 @@
 #include <array>
 #include <string>
 #include <limits>
+#include <thread>
 
 #include <ignition/common/Material.hh>
 #include <ignition/common/Mesh.hh>
@@ -46,6 +47,60 @@ namespace ignition
     /// \brief Manages a single scene-graph. This class updates scene-wide
     /// properties and holds the root scene node. A Scene also serves as a
     /// factory for all scene objects.
+    ///
+    /// # Threading model
+    ///
+    /// Each scene is owned by one thread, by default the one that created
+    /// it, see SetOwnerThread. The scene and all the objects it creates,
+    /// i.e. nodes, visuals, geometries, materials and sensors, must only be
+    /// used from the owner thread. Different scenes of the same
+    /// render-engine may be owned by different threads and updated
+    /// concurrently.
+    ///
+    /// All scenes of a render-engine share its resources, e.g. the
+    /// graphics device and the stream of GPU commands, which are guarded
+    /// by RenderEngine::SharedResourceMutex:
+    ///
+    ///   * Frames of different scenes do not overlap. The scene holds the
+    ///     mutex from PreRender to PostRender, so the sensor updates and
+    ///     read backs of a frame run while other threads wait. In legacy
+    ///     mode, i.e. when SetCameraPassCountPerGpuFlush is 0, every camera
+    ///     pass ends a frame and the mutex is released at the end of the
+    ///     first pass after PreRender. Later passes hold it again until they
+    ///     end.
+    ///   * A thread that creates, destroys or modifies objects of its scene
+    ///     while other threads may be rendering must hold the mutex, e.g.
+    ///
+    /// \code
+    ///   {
+    ///     std::lock_guard<std::recursive_mutex> lock(
+    ///         scene->Engine()->SharedResourceMutex());
+    ///     VisualPtr visual = scene->CreateVisual();
+    ///     ...
+    ///   }
+    /// \endcode
+    ///
+    ///   * Creating and destroying scenes locks the mutex internally and may
+    ///     happen from any thread, as long as the scene being destroyed is
+    ///     no longer in use.
+    ///
+    /// CPU work of different scenes, e.g. processing sensor data outside of
+    /// sensor callbacks, runs in parallel. Rendering itself is serialized
+    /// because the scenes submit to the same GPU.
+    ///
+    /// Rendering from multiple threads only works if the render engine
+    /// allows it, see RenderEngine::GraphicsContextThread. With OpenGL
+    /// this is only the case when the application manages the context
+    /// itself, e.g. the useCurrentGLContext option of ogre2, otherwise use
+    /// another graphics API such as Metal. If it is not allowed, rendering
+    /// a scene from a thread other than the graphics context thread fails.
+    /// Scenes owned by other threads may still be populated and modified
+    /// by their owner, but must be handed back to the graphics context
+    /// thread to be rendered.
+    ///
+    /// Debug builds assert that a scene is rendered and creates objects
+    /// from its owner thread, and that no other thread holds the mutex at
+    /// that time.
     class IGNITION_RENDERING_VISIBLE Scene
     {
       /// \brief Destructor
@@ -1287,6 +1342,292 @@ namespace ignition
       /// use of this scene after its destruction will result in undefined
       /// behavior.
       public: virtual void Destroy() = 0;
+
+      /// \brief Transfer the ownership of the scene to another thread. The
+      /// scene and its objects must only be used from the owner thread. See
+      /// the threading model in the class documentation. Render engines
+      /// that do not support it ignore the call. If the render engine only
+      /// renders from its graphics context thread, a scene handed to another
+      /// thread fails to render there, see
+      /// RenderEngine::GraphicsContextThread.
+      /// \param[in] _thread Id of the new owner thread
+      public: virtual void SetOwnerThread(std::thread::id /*_thread*/)
+      {
+      }
+
+      /// \brief Get the thread that owns the scene
+      /// \return Id of the owner thread, by default the thread that
+      /// created the scene. A default constructed id if the render engine
+      /// does not keep track of it.
+      public: virtual std::thread::id OwnerThread() const
+      {
+        return std::thread::id();
+      }
+
+      /// \brief Create new water surface geometry. The surface is flat until
+      /// waves are set using WaterSurface::SetWaves.
+      /// \return The created water surface or null if the render engine does
+      /// not support water surfaces.
+      public: virtual WaterSurfacePtr CreateWaterSurface()
+      {
+        return WaterSurfacePtr();
+      }
+
+      /// \brief Create new stereo camera. A unique ID and name will
+      /// automatically be assigned to the camera.
+      /// \return The created camera
+      public: virtual StereoCameraPtr CreateStereoCamera()
+      {
+        return StereoCameraPtr();
+      }
+
+      /// \brief Create new stereo camera with the given ID.
+      /// A unique name will automatically be assigned to the camera.
+      /// If the given ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new camera
+      /// \return The created camera
+      public: virtual StereoCameraPtr CreateStereoCamera(
+                  unsigned int /*_id*/)
+      {
+        return StereoCameraPtr();
+      }
+
+      /// \brief Create new stereo camera with the given name.
+      /// A unique ID will automatically be assigned to the camera.
+      /// If the given name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new camera
+      /// \return The created camera
+      public: virtual StereoCameraPtr CreateStereoCamera(
+                  const std::string &/*_name*/)
+      {
+        return StereoCameraPtr();
+      }
+
+      /// \brief Create new stereo camera with the given name and ID. If
+      /// either the given ID or name is already in use, will return NULL.
+      /// \param[in] _id ID of the new camera
+      /// \param[in] _name Name of the new camera
+      /// \return The created camera
+      public: virtual StereoCameraPtr CreateStereoCamera(
+                  unsigned int /*_id*/, const std::string &/*_name*/)
+      {
+        return StereoCameraPtr();
+      }
+
+      /// \brief Create new event camera. A unique ID and name will
+      /// automatically be assigned to the camera.
+      /// \return The created camera
+      public: virtual EventCameraPtr CreateEventCamera()
+      {
+        return EventCameraPtr();
+      }
+
+      /// \brief Create new event camera with the given ID.
+      /// A unique name will automatically be assigned to the camera.
+      /// If the given ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new camera
+      /// \return The created camera
+      public: virtual EventCameraPtr CreateEventCamera(
+                  unsigned int /*_id*/)
+      {
+        return EventCameraPtr();
+      }
+
+      /// \brief Create new event camera with the given name.
+      /// A unique ID will automatically be assigned to the camera.
+      /// If the given name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new camera
+      /// \return The created camera
+      public: virtual EventCameraPtr CreateEventCamera(
+                  const std::string &/*_name*/)
+      {
+        return EventCameraPtr();
+      }
+
+      /// \brief Create new event camera with the given name and ID. If
+      /// either the given ID or name is already in use, will return NULL.
+      /// \param[in] _id ID of the new camera
+      /// \param[in] _name Name of the new camera
+      /// \return The created camera
+      public: virtual EventCameraPtr CreateEventCamera(
+                  unsigned int /*_id*/, const std::string &/*_name*/)
+      {
+        return EventCameraPtr();
+      }
+
+      /// \brief Create new reflection probe. Materials in the scene that
+      /// do not have an environment map reflect the scene captured by the
+      /// nearest probe. This feature is render engine dependent.
+      /// \return The created reflection probe, or nullptr if reflection
+      /// probes are not supported
+      public: virtual ReflectionProbePtr CreateReflectionProbe()
+      {
+        return ReflectionProbePtr();
+      }
+
+      /// \brief Create a procedural sky that is rendered behind the scene
+      /// and drives the sun light and ambient light. Only one procedural
+      /// sky can exist per scene, and it should be created before cameras
+      /// first render. This feature is render engine dependent.
+      /// \return The created procedural sky, or nullptr if the scene
+      /// already has a sky or procedural skies are not supported
+      public: virtual ProceduralSkyPtr CreateProceduralSky()
+      {
+        return ProceduralSkyPtr();
+      }
+
+      /// \brief Create participating media, i.e. fog, haze or water, that
+      /// fill the scene and attenuate light between objects and the
+      /// sensors that observe them. Only one participating media object
+      /// can exist per scene. This feature is render engine dependent.
+      /// \return The created participating media, or nullptr if the scene
+      /// already has participating media or they are not supported
+      public: virtual ParticipatingMediaPtr CreateParticipatingMedia()
+      {
+        return ParticipatingMediaPtr();
+      }
+
+      /// \brief Create new area light. A unique ID and name will
+      /// automatically be assigned to the light.
+      /// \return The created light
+      public: virtual AreaLightPtr CreateAreaLight()
+      {
+        return AreaLightPtr();
+      }
+
+      /// \brief Create new area light with the given ID. A unique name
+      /// will automatically be assigned to the light. If the given ID is
+      /// already in use, NULL will be returned.
+      /// \param[in] _id ID of the new light
+      /// \return The created light
+      public: virtual AreaLightPtr CreateAreaLight(
+                  unsigned int /*_id*/)
+      {
+        return AreaLightPtr();
+      }
+
+      /// \brief Create new area light with the given name. A unique ID
+      /// will automatically be assigned to the light. If the given name is
+      /// already in use, NULL will be returned.
+      /// \param[in] _name Name of the new light
+      /// \return The created light
+      public: virtual AreaLightPtr CreateAreaLight(
+                  const std::string &/*_name*/)
+      {
+        return AreaLightPtr();
+      }
+
+      /// \brief Create new area light with the given name. If either the
+      /// given ID or name is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new light
+      /// \param[in] _name Name of the new light
+      /// \return The created light
+      public: virtual AreaLightPtr CreateAreaLight(
+                  unsigned int /*_id*/, const std::string &/*_name*/)
+      {
+        return AreaLightPtr();
+      }
+
+      /// \brief Create a decal that projects textures onto the surfaces
+      /// inside its box. This feature is render engine dependent.
+      /// \return The created decal, or nullptr if decals are not supported
+      public: virtual DecalPtr CreateDecal()
+      {
+        return DecalPtr();
+      }
+
+      /// \brief Create new radar sensor. A unique ID and name will
+      /// automatically be assigned to the radar sensor.
+      /// \return The created radar sensor
+      public: virtual RadarSensorPtr CreateRadarSensor()
+      {
+        return RadarSensorPtr();
+      }
+
+      /// \brief Create new radar sensor with the given ID. A unique name
+      /// will automatically be assigned to the radar sensor. If the given
+      /// ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new radar sensor
+      /// \return The created radar sensor
+      public: virtual RadarSensorPtr CreateRadarSensor(unsigned int /*_id*/)
+      {
+        return RadarSensorPtr();
+      }
+
+      /// \brief Create new radar sensor with the given name. A unique ID
+      /// will automatically be assigned to the radar sensor. If the given
+      /// name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new radar sensor
+      /// \return The created radar sensor
+      public: virtual RadarSensorPtr CreateRadarSensor(
+                  const std::string &/*_name*/)
+      {
+        return RadarSensorPtr();
+      }
+
+      /// \brief Create new radar sensor with the given name and ID. If
+      /// either the given ID or name is already in use, NULL will be
+      /// returned.
+      /// \param[in] _id ID of the new radar sensor
+      /// \param[in] _name Name of the new radar sensor
+      /// \return The created radar sensor
+      public: virtual RadarSensorPtr CreateRadarSensor(
+                  unsigned int /*_id*/, const std::string &/*_name*/)
+      {
+        return RadarSensorPtr();
+      }
+
+      /// \brief Create new sonar sensor. A unique ID and name will
+      /// automatically be assigned to the sonar sensor.
+      /// \return The created sonar sensor
+      public: virtual SonarSensorPtr CreateSonarSensor()
+      {
+        return SonarSensorPtr();
+      }
+
+      /// \brief Create new sonar sensor with the given ID. A unique name
+      /// will automatically be assigned to the sonar sensor. If the given
+      /// ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new sonar sensor
+      /// \return The created sonar sensor
+      public: virtual SonarSensorPtr CreateSonarSensor(unsigned int /*_id*/)
+      {
+        return SonarSensorPtr();
+      }
+
+      /// \brief Create new sonar sensor with the given name. A unique ID
+      /// will automatically be assigned to the sonar sensor. If the given
+      /// name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new sonar sensor
+      /// \return The created sonar sensor
+      public: virtual SonarSensorPtr CreateSonarSensor(
+                  const std::string &/*_name*/)
+      {
+        return SonarSensorPtr();
+      }
+
+      /// \brief Create new sonar sensor with the given name and ID. If
+      /// either the given ID or name is already in use, NULL will be
+      /// returned.
+      /// \param[in] _id ID of the new sonar sensor
+      /// \param[in] _name Name of the new sonar sensor
+      /// \return The created sonar sensor
+      public: virtual SonarSensorPtr CreateSonarSensor(
+                  unsigned int /*_id*/, const std::string &/*_name*/)
+      {
+        return SonarSensorPtr();
+      }
+
+      /// \brief Create a precipitation, i.e. rain or snow, that falls in
+      /// the scene and is observed consistently by all its sensors. Only
+      /// one precipitation can exist per scene. This feature is render
+      /// engine dependent.
+      /// \return The created precipitation, or nullptr if the scene
+      /// already has a precipitation or it is not supported
+      public: virtual PrecipitationPtr CreatePrecipitation()
+      {
+        return PrecipitationPtr();
+      }
     };
     }
   }
@@ -124,6 +124,9 @@ namespace ignition
       /// \internal
       public: void ClearDirty();
 
+      /// \brief Remove all params
+      public: void Clear();
+
       /// \brief private implementation
       private: std::unique_ptr<ShaderParamsPrivate> dataPtr;
     };
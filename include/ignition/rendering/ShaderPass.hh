@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_SHADERPASS_HH_
+#define IGNITION_RENDERING_SHADERPASS_HH_
+
+#include <string>
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderPass.hh"
+#include "ignition/rendering/RenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class ShaderPass ShaderPass.hh \
+     * ignition/rendering/ShaderPass.hh
+     */
+    /// \brief A render pass that runs a user provided fragment shader over
+    /// the render target. This allows prototyping post-processing effects
+    /// without adding a new render pass to the library.
+    ///
+    /// The fragment shader receives the texture coordinates of the full
+    /// screen quad and has access to the following textures:
+    ///
+    ///   * RT: Color output of the previous pass in the chain
+    ///   * previousRT: Value of RT in the previous frame
+    ///   * depthTexture: Scene depth, only valid if the depth input is
+    ///     enabled. See SetDepthInputEnabled.
+    ///
+    /// In GLSL, the shader needs to declare:
+    ///
+    ///   in block { vec2 uv0; } inPs;
+    ///
+    /// Uniforms are set through FragmentShaderParams(). As with materials,
+    /// parameters named after an engine auto constant such as
+    /// "near_clip_distance" are bound automatically.
+    class IGNITION_RENDERING_VISIBLE ShaderPass
+      : public virtual RenderPass
+    {
+      /// \brief Constructor
+      public: ShaderPass();
+
+      /// \brief Destructor
+      public: virtual ~ShaderPass();
+
+      /// \brief Set the path to the fragment shader.
+      /// \param[in] _path Path to the fragment shader file
+      public: virtual void SetFragmentShader(const std::string &_path) = 0;
+
+      /// \brief Get the path to the fragment shader.
+      /// \return Path to the fragment shader file
+      public: virtual std::string FragmentShader() const = 0;
+
+      /// \brief Get the parameters of the fragment shader.
+      /// \return Fragment shader parameters
+      public: virtual ShaderParamsPtr FragmentShaderParams() = 0;
+
+      /// \brief Enable the depthTexture input. This requires an additional
+      /// depth only render of the scene so it is disabled by default. Must
+      /// be set before the pass is added to a camera.
+      /// \param[in] _enabled True to enable the depth input
+      public: virtual void SetDepthInputEnabled(bool _enabled) = 0;
+
+      /// \brief Get whether the depthTexture input is enabled.
+      /// \return True if the depth input is enabled
+      public: virtual bool DepthInputEnabled() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_SONARSENSOR_HH_
+#define IGNITION_RENDERING_SONARSENSOR_HH_
+
+#include <functional>
+
+#include <ignition/common/Event.hh>
+#include <ignition/math/Angle.hh>
+
+#include "ignition/rendering/Camera.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class SonarSensor SonarSensor.hh ignition/rendering/SonarSensor.hh
+    /// \brief Imaging sonar, e.g. a forward looking or side scan sonar. The
+    /// output is a polar image of backscattered intensity with one column
+    /// per beam and one row per range bin.
+    ///
+    /// The horizontal aperture of the sonar is given by HFOV() and the
+    /// vertical aperture by VerticalFOV(). The scene is rendered at
+    /// ImageWidth() x ImageHeight() and each rendered pixel contributes to
+    /// the range bin of its range in the beams that see it, weighted by the
+    /// horizontal and vertical beam patterns.
+    ///
+    /// The acoustic reflectivity of a visual is read from its
+    /// "acoustic_reflectivity" user data, in the range of [0, 1]. Visuals
+    /// with no reflectivity are not seen. Surfaces scatter following
+    /// Lambert's law, so the intensity of a pixel is proportional to the
+    /// reflectivity times the cosine of the angle between the surface
+    /// normal and the beam, divided by the square of the range, and it is
+    /// attenuated by the absorption of the water on the way to the surface
+    /// and back.
+    class IGNITION_RENDERING_VISIBLE SonarSensor :
+      public virtual Camera
+    {
+      /// \brief Destructor
+      public: virtual ~SonarSensor() { }
+
+      /// \brief Set the number of beams. The beams are evenly spaced over
+      /// the horizontal aperture. Beam 0 is on the left.
+      /// \param[in] _count Beam count, greater than 0. Default is 256
+      public: virtual void SetBeamCount(unsigned int _count) = 0;
+
+      /// \brief Get the number of beams
+      /// \return Beam count
+      public: virtual unsigned int BeamCount() const = 0;
+
+      /// \brief Set the number of range bins. The bins evenly split the
+      /// range between the near and far clip planes. Bin 0 is the closest.
+      /// \param[in] _count Range bin count, greater than 0. Default is 512
+      public: virtual void SetRangeBinCount(unsigned int _count) = 0;
+
+      /// \brief Get the number of range bins
+      /// \return Range bin count
+      public: virtual unsigned int RangeBinCount() const = 0;
+
+      /// \brief Set the vertical aperture, i.e. the -3 dB width of the
+      /// vertical beam pattern
+      /// \param[in] _fov Vertical aperture in (0, pi). Default is 20 degrees
+      public: virtual void SetVerticalFOV(const math::Angle &_fov) = 0;
+
+      /// \brief Get the vertical aperture
+      /// \return Vertical aperture
+      public: virtual math::Angle VerticalFOV() const = 0;
+
+      /// \brief Set the -3 dB width of the horizontal beam pattern of each
+      /// beam. Both beam patterns follow the sinc^2 response of a uniform
+      /// line array.
+      /// \param[in] _width Beam width, greater than 0. Default is 1 degree
+      public: virtual void SetBeamWidth(const math::Angle &_width) = 0;
+
+      /// \brief Get the horizontal beam width
+      /// \return Beam width
+      public: virtual math::Angle BeamWidth() const = 0;
+
+      /// \brief Set the absorption of the water. The intensity of a return
+      /// is attenuated by this value times twice the range.
+      /// \param[in] _attenuation Absorption in dB/m, greater than or equal
+      /// to 0. Default is 0
+      public: virtual void SetAttenuation(double _attenuation) = 0;
+
+      /// \brief Get the absorption of the water
+      /// \return Absorption in dB/m
+      public: virtual double Attenuation() const = 0;
+
+      /// \brief Set the amount of speckle noise. The intensity of each cell
+      /// of the polar image is multiplied by a random factor that follows
+      /// an exponential distribution with a mean of 1, which is the
+      /// intensity distribution of fully developed speckle.
+      /// \param[in] _speckle Amount of speckle in the range of [0, 1], where
+      /// 0 disables the noise and 1 is fully developed speckle. Default is 0
+      public: virtual void SetSpeckleNoise(double _speckle) = 0;
+
+      /// \brief Get the amount of speckle noise
+      /// \return Amount of speckle in the range of [0, 1]
+      public: virtual double SpeckleNoise() const = 0;
+
+      /// \brief Connect to the new sonar frame signal
+      /// \param[in] _subscriber Subscriber callback function. The callback
+      /// function arguments are: <intensities, beam count, range bin count>.
+      /// The intensity of bin j of beam i is at index j * beam count + i.
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual ignition::common::ConnectionPtr ConnectNewSonarFrame(
+          std::function<void(const float *, unsigned int, unsigned int)>
+          _subscriber) = 0;
+    };
+    }
+  }
+}
+#endif
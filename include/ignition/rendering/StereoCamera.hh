@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_STEREOCAMERA_HH_
+#define IGNITION_RENDERING_STEREOCAMERA_HH_
+
+#include <functional>
+#include <string>
+
+#include <ignition/common/Event.hh>
+#include "ignition/rendering/Camera.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    /// \class StereoCamera StereoCamera.hh
+    /// ignition/rendering/StereoCamera.hh
+    /// \brief Poseable rectified stereo camera pair. Both eyes are rendered
+    /// in a single pass that shares culling and shadow maps.
+    ///
+    /// The pose of the camera is the pose of the left eye. The right eye is
+    /// offset by the baseline along the negative y axis, i.e. to the right,
+    /// and both eyes share the same orientation, image size and field of
+    /// view. The disparity map is expressed in left image pixels, so a
+    /// point at depth z along the optical axis has a disparity of
+    /// fx * baseline / z, where fx is the focal length in pixels.
+    class IGNITION_RENDERING_VISIBLE StereoCamera :
+      public virtual Camera
+    {
+      /// \brief Destructor
+      public: virtual ~StereoCamera() { }
+
+      /// \brief Set the distance between the optical centers of the left
+      /// and right eyes
+      /// \param[in] _baseline Baseline in meters
+      public: virtual void SetBaseline(double _baseline) = 0;
+
+      /// \brief Get the distance between the optical centers of the left
+      /// and right eyes
+      /// \return Baseline in meters
+      public: virtual double Baseline() const = 0;
+
+      /// \brief Enable or disable the ground truth disparity output. The
+      /// disparity map is computed on the GPU from the depth of the left
+      /// eye.
+      /// \param[in] _enable True to compute the disparity map
+      public: virtual void SetDisparityEnabled(bool _enable) = 0;
+
+      /// \brief Check if the ground truth disparity output is enabled
+      /// \return True if the disparity map is computed
+      public: virtual bool DisparityEnabled() const = 0;
+
+      /// \brief Get the horizontal focal length used to compute disparity
+      /// \return Focal length in pixels
+      public: virtual double FocalLength() const = 0;
+
+      /// \brief Get the last disparity map. Pixels that do not see any
+      /// geometry have a disparity of 0.
+      /// \return Disparity in pixels as a float array of image width by
+      /// image height values, or null if disparity is not enabled or
+      /// nothing was rendered yet.
+      public: virtual const float *DisparityData() const = 0;
+
+      /// \brief Connect to the new stereo image pair signal
+      /// \param[in] _subscriber Subscriber callback function. The
+      /// arguments of the callback function are:
+      ///   _left Left image data
+      ///   _right Right image data
+      ///   _width Width of each image
+      ///   _height Height of each image
+      ///   _channels Number of channels
+      ///   _format Image format
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual ignition::common::ConnectionPtr ConnectNewStereoFrame(
+          std::function<void(const unsigned char *_left,
+          const unsigned char *_right, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &_format)> _subscriber) = 0;
+
+      /// \brief Connect to the new disparity map signal
+      /// \param[in] _subscriber Subscriber callback function. The
+      /// arguments of the callback function are the disparity data, width,
+      /// height, number of channels and format.
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual ignition::common::ConnectionPtr ConnectNewDisparityFrame(
+          std::function<void(const float *, unsigned int, unsigned int,
+          unsigned int, const std::string &)> _subscriber) = 0;
+    };
+    }
+  }
+}
+#endif
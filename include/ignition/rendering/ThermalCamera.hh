@@ -118,6 +118,66 @@ namespace ignition
       public: virtual ignition::common::ConnectionPtr ConnectNewThermalFrame(
           std::function<void(const uint16_t *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) = 0;
+
+      /// \brief Enable or disable the radiometric thermal model. When
+      /// enabled, the apparent temperature of each pixel is computed from the
+      /// radiance emitted by the object (scaled by its emissivity), the
+      /// radiance reflected from the surroundings and the radiance emitted by
+      /// the atmosphere between the object and the sensor. The emissivity of
+      /// a heat source can be set through the Visual class using SetUserData
+      /// with the key "emissivity" and a value in the range [0, 1].
+      /// Objects without an emissivity default to 1 (ideal black body).
+      /// \param[in] _enabled True to enable the radiometric model
+      /// \sa RadiometricModelEnabled
+      public: virtual void SetRadiometricModelEnabled(bool /*_enabled*/)
+      {
+      }
+
+      /// \brief Get whether the radiometric thermal model is enabled
+      /// \return True if the radiometric model is enabled
+      /// \sa SetRadiometricModelEnabled
+      public: virtual bool RadiometricModelEnabled() const
+      {
+        return false;
+      }
+
+      /// \brief Set the reflected apparent temperature, i.e. the temperature
+      /// of the surroundings that is reflected by non-black body surfaces.
+      /// This is only used when the radiometric model is enabled. If not set,
+      /// the ambient temperature is used.
+      /// \param[in] _temp Reflected apparent temperature in kelvin
+      /// \sa ReflectedTemperature
+      public: virtual void SetReflectedTemperature(float /*_temp*/)
+      {
+      }
+
+      /// \brief Get the reflected apparent temperature
+      /// \return Reflected apparent temperature in kelvin
+      /// \sa SetReflectedTemperature
+      public: virtual float ReflectedTemperature() const
+      {
+        return this->AmbientTemperature();
+      }
+
+      /// \brief Set the atmospheric extinction coefficient used to compute
+      /// the atmospheric transmission over distance, i.e.
+      /// transmission = exp(-coefficient * distance). The atmosphere itself
+      /// is assumed to be at ambient temperature. This is only used when the
+      /// radiometric model is enabled. Defaults to 0 (no attenuation).
+      /// \param[in] _coefficient Extinction coefficient in 1/meters
+      /// \sa AtmosphericExtinctionCoefficient
+      public: virtual void SetAtmosphericExtinctionCoefficient(
+          float /*_coefficient*/)
+      {
+      }
+
+      /// \brief Get the atmospheric extinction coefficient
+      /// \return Extinction coefficient in 1/meters
+      /// \sa SetAtmosphericExtinctionCoefficient
+      public: virtual float AtmosphericExtinctionCoefficient() const
+      {
+        return 0.0f;
+      }
     };
   }
   }
@@ -17,6 +17,7 @@
 #ifndef IGNITION_RENDERING_UTILS_HH_
 #define IGNITION_RENDERING_UTILS_HH_
 
+#include <cstdint>
 #include <vector>
 
 #include <ignition/math/Helpers.hh>
@@ -97,6 +98,23 @@ namespace ignition
     ignition::math::AxisAlignedBox transformAxisAlignedBox(
         const ignition::math::AxisAlignedBox &_box,
         const ignition::math::Pose3d &_pose);
+
+    /// \brief Encode a unit vector, e.g. a surface normal, into 32 bits
+    /// using an octahedral mapping. The vector is projected onto an
+    /// octahedron that is unfolded into a square, and both coordinates on
+    /// the square are quantized to 16 bits. The first coordinate is stored
+    /// in the lower 16 bits.
+    /// \param[in] _v Vector to encode. It does not have to be normalized.
+    /// \return Encoded vector, or 0 if _v is a zero vector.
+    IGNITION_RENDERING_VISIBLE
+    uint32_t encodeOctahedralNormal(const math::Vector3d &_v);
+
+    /// \brief Decode a unit vector encoded by encodeOctahedralNormal(). Depth
+    /// cameras use the same encoding for their normals output.
+    /// \param[in] _encoded Encoded vector
+    /// \return Unit vector
+    IGNITION_RENDERING_VISIBLE
+    math::Vector3d decodeOctahedralNormal(uint32_t _encoded);
     }
   }
 }
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_VIGNETTEPASS_HH_
+#define IGNITION_RENDERING_VIGNETTEPASS_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class VignettePass VignettePass.hh \
+     * ignition/rendering/VignettePass.hh
+     */
+    /// \brief A render pass that darkens the image towards its corners to
+    /// simulate lens vignetting. Distances are normalized so that the
+    /// image center is at 0 and the corners are at 1.
+    class IGNITION_RENDERING_VISIBLE VignettePass
+      : public virtual RenderPass
+    {
+      /// \brief Constructor
+      public: VignettePass();
+
+      /// \brief Destructor
+      public: virtual ~VignettePass();
+
+      /// \brief Set the amount of light lost at the image corners.
+      /// \param[in] _intensity Intensity in [0, 1]. 0 disables the effect
+      /// and 1 makes the corners black.
+      public: virtual void SetIntensity(double _intensity) = 0;
+
+      /// \brief Get the vignetting intensity.
+      /// \return Intensity in [0, 1]
+      public: virtual double Intensity() const = 0;
+
+      /// \brief Set the normalized distance from the image center at which
+      /// the image starts to darken.
+      /// \param[in] _radius Radius in [0, 1]
+      public: virtual void SetRadius(double _radius) = 0;
+
+      /// \brief Get the normalized distance at which the image starts to
+      /// darken.
+      /// \return Radius in [0, 1]
+      public: virtual double Radius() const = 0;
+
+      /// \brief Set the normalized width of the transition from the
+      /// unaffected center to full darkening.
+      /// \param[in] _smoothness Width of the transition, must be positive
+      public: virtual void SetSmoothness(double _smoothness) = 0;
+
+      /// \brief Get the normalized width of the darkening transition.
+      /// \return Width of the transition
+      public: virtual double Smoothness() const = 0;
+    };
+    }
+  }
+}
+#endif
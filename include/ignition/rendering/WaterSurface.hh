@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_WATERSURFACE_HH_
+#define IGNITION_RENDERING_WATERSURFACE_HH_
+
+#include <vector>
+
+#include <ignition/math/Vector2.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Geometry.hh"
+#include "ignition/rendering/GerstnerWaves.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class WaterSurface WaterSurface.hh ignition/rendering/WaterSurface.hh
+    /// \brief A water surface animated by a sum of Gerstner waves.
+    /// The surface is rendered as a flat grid that is displaced on the GPU.
+    /// The grid is tessellated in concentric levels of detail centered
+    /// on the camera that is rendering it, so the vertex density is highest
+    /// close to the camera. The height of the rendered surface can be queried
+    /// on the CPU using Heights, which evaluates the same wave function as the
+    /// shaders.
+    class IGNITION_RENDERING_VISIBLE WaterSurface :
+      public virtual Geometry
+    {
+      /// \brief Destructor
+      public: virtual ~WaterSurface() { }
+
+      /// \brief Set the waves of the water surface
+      /// \param[in] _waves Wave components
+      public: virtual void SetWaves(const GerstnerWaves &_waves) = 0;
+
+      /// \brief Get the waves of the water surface
+      /// \return Wave components
+      public: virtual const GerstnerWaves &Waves() const = 0;
+
+      /// \brief Set the size of the water surface in the local xy plane.
+      /// The surface is centered at the origin of its parent visual.
+      /// \param[in] _size Size in meters
+      public: virtual void SetSize(const math::Vector2d &_size) = 0;
+
+      /// \brief Get the size of the water surface
+      /// \return Size in meters
+      public: virtual math::Vector2d Size() const = 0;
+
+      /// \brief Set the time used to animate the waves
+      /// \param[in] _time Time in seconds
+      public: virtual void SetTime(double _time) = 0;
+
+      /// \brief Get the time used to animate the waves
+      /// \return Time in seconds
+      public: virtual double Time() const = 0;
+
+      /// \brief Set the number of level of detail rings around the camera.
+      /// Each level doubles the vertex spacing of the previous one.
+      /// \param[in] _levels Number of levels in [1, 16]
+      public: virtual void SetLodLevels(unsigned int _levels) = 0;
+
+      /// \brief Get the number of level of detail rings around the camera.
+      /// \return Number of levels
+      public: virtual unsigned int LodLevels() const = 0;
+
+      /// \brief Set the number of grid cells along each side of a level of
+      /// detail. Must be a multiple of 4.
+      /// \param[in] _cells Number of cells
+      public: virtual void SetTessellation(unsigned int _cells) = 0;
+
+      /// \brief Get the number of grid cells along each side of a level of
+      /// detail.
+      /// \return Number of cells
+      public: virtual unsigned int Tessellation() const = 0;
+
+      /// \brief Get the height of the water surface at a set of positions
+      /// in world coordinates. The surface is assumed to be level, i.e. only
+      /// the yaw of the parent visual is taken into account.
+      /// \param[in] _points Positions in world coordinates. Only the x and y
+      /// coordinates are used.
+      /// \param[in] _time Time in seconds
+      /// \param[out] _heights World z coordinate of the surface at each
+      /// point.
+      public: virtual void Heights(const std::vector<math::Vector3d> &_points,
+          double _time, std::vector<double> &_heights) const = 0;
+    };
+    }
+  }
+}
+#endif
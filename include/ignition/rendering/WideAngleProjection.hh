@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_WIDEANGLEPROJECTION_HH_
+#define IGNITION_RENDERING_WIDEANGLEPROJECTION_HH_
+
+#include <memory>
+
+#include <ignition/common/SuppressWarning.hh>
+#include <ignition/math/Angle.hh>
+#include <ignition/math/Vector2.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/Vector4.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class WideAngleProjectionPrivate;
+
+    /// \class WideAngleProjection WideAngleProjection.hh
+    /// ignition/rendering/WideAngleProjection.hh
+    /// \brief Maps image pixels to rays and back for the perspective,
+    /// fisheye and panoramic camera projection types.
+    ///
+    /// Fisheye models map the angle theta between a ray and the optical axis
+    /// to a distance r from the image center. The focal length f is chosen
+    /// so that a ray at half of the horizontal field of view ends up at the
+    /// left and right edges of the image. The equirectangular projection
+    /// maps longitude and latitude linearly to image columns and rows with
+    /// the same angular resolution in both directions.
+    ///
+    /// Rays are expressed in the camera frame: x forward, y left and z up.
+    /// Pixel coordinates have their origin at the top left corner of the
+    /// image, so the center of the first pixel is at (0.5, 0.5).
+    class IGNITION_RENDERING_VISIBLE WideAngleProjection
+    {
+      /// \brief Constructor
+      public: WideAngleProjection();
+
+      /// \brief Constructor
+      /// \param[in] _type Projection type
+      /// \param[in] _width Image width in pixels
+      /// \param[in] _height Image height in pixels
+      /// \param[in] _hfov Horizontal field of view
+      public: WideAngleProjection(CameraProjectionType _type,
+          unsigned int _width, unsigned int _height,
+          const math::Angle &_hfov);
+
+      /// \brief Copy constructor
+      /// \param[in] _projection WideAngleProjection to copy.
+      public: WideAngleProjection(const WideAngleProjection &_projection);
+
+      /// \brief Move constructor
+      /// \param[in] _projection WideAngleProjection to move.
+      public: WideAngleProjection(WideAngleProjection &&_projection) noexcept;
+
+      /// \brief Destructor
+      public: virtual ~WideAngleProjection();
+
+      /// \brief Copy assignment operator.
+      /// \param[in] _projection WideAngleProjection to copy.
+      /// \return Reference to this.
+      public: WideAngleProjection &operator=(
+          const WideAngleProjection &_projection);
+
+      /// \brief Move assignment operator.
+      /// \param[in] _projection WideAngleProjection to move.
+      /// \return Reference to this.
+      public: WideAngleProjection &operator=(
+          WideAngleProjection &&_projection);
+
+      /// \brief Check if a projection type is a fisheye or panoramic
+      /// projection that has to be rendered from a cubemap.
+      /// \param[in] _type Projection type
+      /// \return True for fisheye and panoramic projection types
+      public: static bool IsWideAngle(CameraProjectionType _type);
+
+      /// \brief Set the projection type
+      /// \param[in] _type Projection type
+      public: void SetType(CameraProjectionType _type);
+
+      /// \brief Get the projection type
+      /// \return Projection type
+      public: CameraProjectionType Type() const;
+
+      /// \brief Set the image size
+      /// \param[in] _width Image width in pixels
+      /// \param[in] _height Image height in pixels
+      public: void SetImageSize(unsigned int _width, unsigned int _height);
+
+      /// \brief Get the image width
+      /// \return Image width in pixels
+      public: unsigned int ImageWidth() const;
+
+      /// \brief Get the image height
+      /// \return Image height in pixels
+      public: unsigned int ImageHeight() const;
+
+      /// \brief Set the horizontal field of view, i.e. the angle covered by
+      /// the width of the image
+      /// \param[in] _hfov Horizontal field of view
+      public: void SetHFOV(const math::Angle &_hfov);
+
+      /// \brief Get the horizontal field of view
+      /// \return Horizontal field of view
+      public: math::Angle HFOV() const;
+
+      /// \brief Set the k1 to k4 coefficients of the Kannala-Brandt model
+      /// \param[in] _coefficients Polynomial coefficients
+      public: void SetCoefficients(const math::Vector4d &_coefficients);
+
+      /// \brief Get the k1 to k4 coefficients of the Kannala-Brandt model
+      /// \return Polynomial coefficients
+      public: math::Vector4d Coefficients() const;
+
+      /// \brief Get the focal length of perspective and fisheye projections.
+      /// For the equirectangular projection this is the number of pixels
+      /// per radian.
+      /// \return Focal length in pixels, or 0 if the projection is invalid
+      public: double FocalLength() const;
+
+      /// \brief Get the direction of the ray through a point of the image
+      /// \param[in] _pixel Position in the image in pixels
+      /// \param[out] _ray Unit direction of the ray in the camera frame
+      /// \return False if no ray maps to the position, e.g. outside of the
+      /// image circle of a fisheye projection
+      public: bool PixelToRay(const math::Vector2d &_pixel,
+          math::Vector3d &_ray) const;
+
+      /// \brief Get the position in the image of a ray
+      /// \param[in] _ray Direction of the ray in the camera frame. Does not
+      /// need to be normalized.
+      /// \param[out] _pixel Position in the image in pixels
+      /// \return False if the ray can not be projected or does not fall
+      /// inside the image
+      public: bool RayToPixel(const math::Vector3d &_ray,
+          math::Vector2d &_pixel) const;
+
+      /// \brief Private data pointer.
+      IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<WideAngleProjectionPrivate> dataPtr;
+      IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
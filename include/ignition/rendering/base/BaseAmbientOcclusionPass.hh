@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEAMBIENTOCCLUSIONPASS_HH_
+#define IGNITION_RENDERING_BASE_BASEAMBIENTOCCLUSIONPASS_HH_
+
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/AmbientOcclusionPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseAmbientOcclusionPass BaseAmbientOcclusionPass.hh \
+     * ignition/rendering/base/BaseAmbientOcclusionPass.hh
+     */
+    /// \brief Base ambient occlusion render pass.
+    template <class T>
+    class BaseAmbientOcclusionPass :
+      public virtual AmbientOcclusionPass,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseAmbientOcclusionPass();
+
+      /// \brief Destructor
+      public: virtual ~BaseAmbientOcclusionPass();
+
+      // Documentation inherited.
+      public: void SetRadius(double _radius) override;
+
+      // Documentation inherited.
+      public: double Radius() const override;
+
+      // Documentation inherited.
+      public: void SetSampleCount(unsigned int _count) override;
+
+      // Documentation inherited.
+      public: unsigned int SampleCount() const override;
+
+      // Documentation inherited.
+      public: void SetHalfResolution(bool _half) override;
+
+      // Documentation inherited.
+      public: bool HalfResolution() const override;
+
+      // Documentation inherited.
+      public: void SetIntensity(double _intensity) override;
+
+      // Documentation inherited.
+      public: double Intensity() const override;
+
+      /// \brief Occlusion radius in meters
+      protected: double radius = 0.5;
+
+      /// \brief Number of depth samples per pixel
+      protected: unsigned int sampleCount = 16u;
+
+      /// \brief Whether the occlusion is evaluated at half resolution
+      protected: bool halfResolution = true;
+
+      /// \brief Strength of the darkening
+      protected: double intensity = 1.0;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseAmbientOcclusionPass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseAmbientOcclusionPass<T>::BaseAmbientOcclusionPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseAmbientOcclusionPass<T>::~BaseAmbientOcclusionPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAmbientOcclusionPass<T>::SetRadius(double _radius)
+    {
+      if (_radius <= 0.0 || !std::isfinite(_radius))
+      {
+        ignerr << "Ambient occlusion radius must be positive. Received: "
+               << _radius << std::endl;
+        return;
+      }
+      this->radius = _radius;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseAmbientOcclusionPass<T>::Radius() const
+    {
+      return this->radius;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAmbientOcclusionPass<T>::SetSampleCount(unsigned int _count)
+    {
+      this->sampleCount = math::clamp(_count, 1u, 64u);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseAmbientOcclusionPass<T>::SampleCount() const
+    {
+      return this->sampleCount;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAmbientOcclusionPass<T>::SetHalfResolution(bool _half)
+    {
+      this->halfResolution = _half;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseAmbientOcclusionPass<T>::HalfResolution() const
+    {
+      return this->halfResolution;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAmbientOcclusionPass<T>::SetIntensity(double _intensity)
+    {
+      if (_intensity < 0.0 || !std::isfinite(_intensity))
+      {
+        ignerr << "Ambient occlusion intensity must not be negative. "
+               << "Received: " << _intensity << std::endl;
+        return;
+      }
+      this->intensity = _intensity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseAmbientOcclusionPass<T>::Intensity() const
+    {
+      return this->intensity;
+    }
+    }
+  }
+}
+#endif
@@ -17,6 +17,8 @@
 #ifndef IGNITION_RENDERING_BASE_BASECAMERA_HH_
 #define IGNITION_RENDERING_BASE_BASECAMERA_HH_
 
+#include <cmath>
+#include <mutex>
 #include <string>
 
 #include <ignition/math/Matrix3.hh>
@@ -27,9 +29,11 @@
 #include <ignition/common/SuppressWarning.hh>
 
 #include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/FrameEncoder.hh"
 #include "ignition/rendering/Image.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/WideAngleProjection.hh"
 #include "ignition/rendering/base/BaseRenderTarget.hh"
 
 namespace ignition
@@ -125,6 +129,13 @@ namespace ignition
       public: virtual void SetProjectionType(
           CameraProjectionType _type) override;
 
+      // Documentation inherited.
+      public: virtual void SetProjectionCoefficients(
+          const math::Vector4d &_coefficients) override;
+
+      // Documentation inherited.
+      public: virtual math::Vector4d ProjectionCoefficients() const override;
+
       // Documentation inherited.
       public: virtual math::Vector2i Project(const math::Vector3d &_pt) const
                   override;
@@ -253,12 +264,20 @@ namespace ignition
       /// \brief Offset distance between camera and target node being followed
       protected: math::Vector3d followOffset;
 
+      /// \brief Get the model that maps image pixels to rays for the
+      /// current projection type, image size and field of view
+      /// \return Projection model
+      protected: WideAngleProjection ProjectionModel() const;
+
       /// \brief Custom projection matrix
       protected: math::Matrix4d projectionMatrix;
 
       /// \brief Camera projection type
       protected: CameraProjectionType projectionType = CPT_PERSPECTIVE;
 
+      /// \brief Coefficients of the projection model
+      protected: math::Vector4d projectionCoefficients = math::Vector4d::Zero;
+
       friend class BaseDepthCamera<T>;
     };
 
@@ -413,6 +432,12 @@ namespace ignition
     template <class T>
     void BaseCamera<T>::Update()
     {
+      // frames of scenes rendered from different threads must not overlap,
+      // also in legacy mode where the scene does not bracket its frames.
+      // See the threading model in Scene
+      std::lock_guard<std::recursive_mutex> lock(
+          this->Scene()->Engine()->SharedResourceMutex());
+
       this->Scene()->PreRender();
       this->Render();
       this->PostRender();
@@ -439,9 +464,12 @@ namespace ignition
 
     //////////////////////////////////////////////////
     template <class T>
-    bool BaseCamera<T>::SaveFrame(const std::string &/*_name*/)
+    bool BaseCamera<T>::SaveFrame(const std::string &_name)
     {
-      return false;
+      Image image = this->CreateImage();
+      this->Copy(image);
+      return FrameEncoder::Instance()->Enqueue(_name, image.Data(),
+          image.Width(), image.Height(), image.Format());
     }
 
     //////////////////////////////////////////////////
@@ -554,11 +582,13 @@ namespace ignition
         result(2, 3) = -(_far + _near) * invd;
         result(3, 3) = 1.0;
       }
-      else
+      else if (!WideAngleProjection::IsWideAngle(this->projectionType))
       {
         ignerr << "Unknown camera projection type: " << this->projectionType
                << std::endl;
       }
+      // fisheye and panoramic projections can not be expressed as a matrix.
+      // Project() uses the projection model instead
 
       return result;
     }
@@ -603,11 +633,48 @@ namespace ignition
       return this->projectionType;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetProjectionCoefficients(
+        const math::Vector4d &_coefficients)
+    {
+      this->projectionCoefficients = _coefficients;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector4d BaseCamera<T>::ProjectionCoefficients() const
+    {
+      return this->projectionCoefficients;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    WideAngleProjection BaseCamera<T>::ProjectionModel() const
+    {
+      WideAngleProjection projection(this->ProjectionType(),
+          this->ImageWidth(), this->ImageHeight(), this->HFOV());
+      projection.SetCoefficients(this->ProjectionCoefficients());
+      return projection;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     math::Vector2i BaseCamera<T>::Project(const math::Vector3d &_pt) const
     {
       math::Vector2i screenPos;
+      if (WideAngleProjection::IsWideAngle(this->projectionType))
+      {
+        // points that are not visible end up outside of the image
+        math::Vector3d ray = this->WorldPose().Rot().RotateVectorReverse(
+            _pt - this->WorldPose().Pos());
+        math::Vector2d pixel(-1.0, -1.0);
+        this->ProjectionModel().RayToPixel(ray, pixel);
+        screenPos.X() = static_cast<int>(std::floor(pixel.X()));
+        screenPos.Y() = static_cast<int>(std::floor(pixel.Y()));
+        return screenPos;
+      }
+
       math::Matrix4d m = this->ProjectionMatrix() *  this->ViewMatrix();
       math::Vector3d pos =  m * _pt;
       double w = m(3, 0) * _pt.X() + m(3, 1) * _pt.Y() + m(3, 2) * _pt.Z()
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASECHROMATICABERRATIONPASS_HH_
+#define IGNITION_RENDERING_BASE_BASECHROMATICABERRATIONPASS_HH_
+
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/ChromaticAberrationPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseChromaticAberrationPass BaseChromaticAberrationPass.hh \
+     * ignition/rendering/base/BaseChromaticAberrationPass.hh
+     */
+    /// \brief Base chromatic aberration render pass.
+    template <class T>
+    class BaseChromaticAberrationPass :
+      public virtual ChromaticAberrationPass,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseChromaticAberrationPass();
+
+      /// \brief Destructor
+      public: virtual ~BaseChromaticAberrationPass();
+
+      // Documentation inherited.
+      public: void SetStrength(double _strength) override;
+
+      // Documentation inherited.
+      public: double Strength() const override;
+
+      /// \brief Relative magnification difference between color channels
+      protected: double strength = 0.005;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseChromaticAberrationPass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseChromaticAberrationPass<T>::BaseChromaticAberrationPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseChromaticAberrationPass<T>::~BaseChromaticAberrationPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseChromaticAberrationPass<T>::SetStrength(double _strength)
+    {
+      this->strength = math::clamp(_strength, -0.5, 0.5);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseChromaticAberrationPass<T>::Strength() const
+    {
+      return this->strength;
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEDECAL_HH_
+#define IGNITION_RENDERING_BASE_BASEDECAL_HH_
+
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/Decal.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class BaseDecal BaseDecal.hh ignition/rendering/base/BaseDecal.hh
+    /// \brief Base decal. Keeps and validates the decal properties.
+    template <class T>
+    class BaseDecal :
+      public virtual Decal,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseDecal();
+
+      /// \brief Destructor
+      public: virtual ~BaseDecal();
+
+      // Documentation inherited
+      public: virtual void SetSize(const math::Vector3d &_size) override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d Size() const override;
+
+      // Documentation inherited
+      public: virtual void SetDiffuseTexture(const std::string &_texture)
+                  override;
+
+      // Documentation inherited
+      public: virtual std::string DiffuseTexture() const override;
+
+      // Documentation inherited
+      public: virtual void SetNormalTexture(const std::string &_texture)
+                  override;
+
+      // Documentation inherited
+      public: virtual std::string NormalTexture() const override;
+
+      // Documentation inherited
+      public: virtual void SetEmissiveTexture(const std::string &_texture)
+                  override;
+
+      // Documentation inherited
+      public: virtual std::string EmissiveTexture() const override;
+
+      // Documentation inherited
+      public: virtual void SetRoughness(double _roughness) override;
+
+      // Documentation inherited
+      public: virtual double Roughness() const override;
+
+      // Documentation inherited
+      public: virtual void SetMetalness(double _metalness) override;
+
+      // Documentation inherited
+      public: virtual double Metalness() const override;
+
+      /// \brief Size of the projection box in meters
+      protected: math::Vector3d size = math::Vector3d::One;
+
+      /// \brief Path of the diffuse texture
+      protected: std::string diffuseTexture;
+
+      /// \brief Path of the normal map
+      protected: std::string normalTexture;
+
+      /// \brief Path of the emissive texture
+      protected: std::string emissiveTexture;
+
+      /// \brief Roughness of the covered surface
+      protected: double roughness = 1.0;
+
+      /// \brief Metalness of the covered surface
+      protected: double metalness = 0.0;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseDecal<T>::BaseDecal()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseDecal<T>::~BaseDecal()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDecal<T>::SetSize(const math::Vector3d &_size)
+    {
+      if (!_size.IsFinite() ||
+          _size.X() <= 0.0 || _size.Y() <= 0.0 || _size.Z() <= 0.0)
+      {
+        ignerr << "Decal size must be positive: " << _size << std::endl;
+        return;
+      }
+      this->size = _size;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseDecal<T>::Size() const
+    {
+      return this->size;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDecal<T>::SetDiffuseTexture(const std::string &_texture)
+    {
+      this->diffuseTexture = _texture;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseDecal<T>::DiffuseTexture() const
+    {
+      return this->diffuseTexture;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDecal<T>::SetNormalTexture(const std::string &_texture)
+    {
+      this->normalTexture = _texture;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseDecal<T>::NormalTexture() const
+    {
+      return this->normalTexture;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDecal<T>::SetEmissiveTexture(const std::string &_texture)
+    {
+      this->emissiveTexture = _texture;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseDecal<T>::EmissiveTexture() const
+    {
+      return this->emissiveTexture;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDecal<T>::SetRoughness(double _roughness)
+    {
+      if (_roughness < 0.0 || _roughness > 1.0)
+      {
+        ignerr << "Decal roughness must be in [0, 1]: " << _roughness
+               << std::endl;
+        return;
+      }
+      this->roughness = _roughness;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseDecal<T>::Roughness() const
+    {
+      return this->roughness;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDecal<T>::SetMetalness(double _metalness)
+    {
+      if (_metalness < 0.0 || _metalness > 1.0)
+      {
+        ignerr << "Decal metalness must be in [0, 1]: " << _metalness
+               << std::endl;
+        return;
+      }
+      this->metalness = _metalness;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseDecal<T>::Metalness() const
+    {
+      return this->metalness;
+    }
+    }
+  }
+}
+#endif
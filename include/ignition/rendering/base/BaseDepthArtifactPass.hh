@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEDEPTHARTIFACTPASS_HH_
+#define IGNITION_RENDERING_BASE_BASEDEPTHARTIFACTPASS_HH_
+
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/DepthArtifactPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseDepthArtifactPass BaseDepthArtifactPass.hh \
+     * ignition/rendering/base/BaseDepthArtifactPass.hh
+     */
+    /// \brief Base depth artifact render pass.
+    template <class T>
+    class BaseDepthArtifactPass :
+      public virtual DepthArtifactPass,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseDepthArtifactPass();
+
+      /// \brief Destructor
+      public: virtual ~BaseDepthArtifactPass();
+
+      // Documentation inherited.
+      public: void SetProjectorBaseline(double _baseline) override;
+
+      // Documentation inherited.
+      public: double ProjectorBaseline() const override;
+
+      // Documentation inherited.
+      public: void SetDisparityQuantization(double _step) override;
+
+      // Documentation inherited.
+      public: double DisparityQuantization() const override;
+
+      // Documentation inherited.
+      public: void SetFlyingPixelThreshold(double _threshold) override;
+
+      // Documentation inherited.
+      public: double FlyingPixelThreshold() const override;
+
+      // Documentation inherited.
+      public: void SetMultipathStrength(double _strength) override;
+
+      // Documentation inherited.
+      public: double MultipathStrength() const override;
+
+      // Documentation inherited.
+      public: void SetReflectanceRange(double _min, double _max) override;
+
+      // Documentation inherited.
+      public: double MinReflectance() const override;
+
+      // Documentation inherited.
+      public: double MaxReflectance() const override;
+
+      // Documentation inherited.
+      public: void SetMaxIncidenceAngle(const math::Angle &_angle) override;
+
+      // Documentation inherited.
+      public: math::Angle MaxIncidenceAngle() const override;
+
+      /// \brief Check that a parameter is finite and not negative
+      /// \param[in] _value Value to check
+      /// \param[in] _name Name of the parameter, used in the error message
+      /// \return True if the value is valid
+      private: bool ValidParameter(double _value, const char *_name) const;
+
+      /// \brief Projector offset along the camera's negative y axis
+      protected: double projectorBaseline = 0.0;
+
+      /// \brief Disparity step in pixels
+      protected: double disparityQuantization = 0.0;
+
+      /// \brief Depth difference above which pixels become flying pixels
+      protected: double flyingPixelThreshold = 0.0;
+
+      /// \brief Multipath strength
+      protected: double multipathStrength = 0.0;
+
+      /// \brief Minimum luminance that returns valid depth
+      protected: double minReflectance = 0.0;
+
+      /// \brief Maximum luminance that returns valid depth
+      protected: double maxReflectance = 1.0;
+
+      /// \brief Largest incidence angle that returns valid depth
+      protected: math::Angle maxIncidenceAngle = math::Angle::HalfPi;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseDepthArtifactPass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseDepthArtifactPass<T>::BaseDepthArtifactPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseDepthArtifactPass<T>::~BaseDepthArtifactPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseDepthArtifactPass<T>::ValidParameter(double _value,
+        const char *_name) const
+    {
+      if (_value < 0.0 || !std::isfinite(_value))
+      {
+        ignerr << "Depth artifact " << _name << " must be a finite value "
+               << "greater than or equal to 0. Ignoring value of " << _value
+               << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthArtifactPass<T>::SetProjectorBaseline(double _baseline)
+    {
+      if (!std::isfinite(_baseline))
+      {
+        ignerr << "Depth artifact projector baseline must be finite"
+               << std::endl;
+        return;
+      }
+      this->projectorBaseline = _baseline;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseDepthArtifactPass<T>::ProjectorBaseline() const
+    {
+      return this->projectorBaseline;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthArtifactPass<T>::SetDisparityQuantization(double _step)
+    {
+      if (this->ValidParameter(_step, "disparity quantization"))
+        this->disparityQuantization = _step;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseDepthArtifactPass<T>::DisparityQuantization() const
+    {
+      return this->disparityQuantization;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthArtifactPass<T>::SetFlyingPixelThreshold(double _threshold)
+    {
+      if (this->ValidParameter(_threshold, "flying pixel threshold"))
+        this->flyingPixelThreshold = _threshold;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseDepthArtifactPass<T>::FlyingPixelThreshold() const
+    {
+      return this->flyingPixelThreshold;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthArtifactPass<T>::SetMultipathStrength(double _strength)
+    {
+      if (this->ValidParameter(_strength, "multipath strength"))
+        this->multipathStrength = _strength;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseDepthArtifactPass<T>::MultipathStrength() const
+    {
+      return this->multipathStrength;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthArtifactPass<T>::SetReflectanceRange(double _min,
+        double _max)
+    {
+      if (_min > _max)
+      {
+        ignerr << "Depth artifact minimum reflectance [" << _min << "] "
+               << "is greater than the maximum [" << _max << "]"
+               << std::endl;
+        return;
+      }
+      this->minReflectance = math::clamp(_min, 0.0, 1.0);
+      this->maxReflectance = math::clamp(_max, 0.0, 1.0);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseDepthArtifactPass<T>::MinReflectance() const
+    {
+      return this->minReflectance;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseDepthArtifactPass<T>::MaxReflectance() const
+    {
+      return this->maxReflectance;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthArtifactPass<T>::SetMaxIncidenceAngle(
+        const math::Angle &_angle)
+    {
+      this->maxIncidenceAngle = math::Angle(
+          math::clamp(_angle.Radian(), 0.0, IGN_PI * 0.5));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Angle BaseDepthArtifactPass<T>::MaxIncidenceAngle() const
+    {
+      return this->maxIncidenceAngle;
+    }
+    }
+  }
+}
+#endif
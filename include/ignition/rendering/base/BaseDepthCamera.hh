@@ -50,6 +50,17 @@ namespace ignition
       public: virtual ignition::common::ConnectionPtr ConnectNewRGBPointCloud(
           std::function<void(const float *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber);
+
+      public: virtual ignition::common::ConnectionPtr ConnectNewNormalsFrame(
+          std::function<void(const uint32_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>  _subscriber);
+
+      public: virtual ignition::common::ConnectionPtr
+          ConnectNewMaterialIdFrame(
+          std::function<void(const uint16_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>  _subscriber);
+
+      public: virtual std::string MaterialName(unsigned int _id) const;
     };
 
     //////////////////////////////////////////////////
@@ -94,6 +105,32 @@ namespace ignition
     {
       return nullptr;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ignition::common::ConnectionPtr BaseDepthCamera<T>::ConnectNewNormalsFrame(
+          std::function<void(const uint32_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>)
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ignition::common::ConnectionPtr
+        BaseDepthCamera<T>::ConnectNewMaterialIdFrame(
+          std::function<void(const uint16_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>)
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseDepthCamera<T>::MaterialName(unsigned int) const
+    {
+      return std::string();
+    }
   }
   }
 }
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEEVENTCAMERA_HH_
+#define IGNITION_RENDERING_BASE_BASEEVENTCAMERA_HH_
+
+#include <chrono>
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+
+#include "ignition/rendering/base/BaseCamera.hh"
+#include "ignition/rendering/EventCamera.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+
+    template <class T>
+    class BaseEventCamera :
+      public virtual EventCamera,
+      public virtual BaseCamera<T>,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseEventCamera();
+
+      /// \brief Destructor
+      public: virtual ~BaseEventCamera();
+
+      // Documentation inherited
+      public: virtual void SetPositiveThreshold(double _threshold) override;
+
+      // Documentation inherited
+      public: virtual double PositiveThreshold() const override;
+
+      // Documentation inherited
+      public: virtual void SetNegativeThreshold(double _threshold) override;
+
+      // Documentation inherited
+      public: virtual double NegativeThreshold() const override;
+
+      // Documentation inherited
+      public: virtual void SetThresholdNoise(double _stddev) override;
+
+      // Documentation inherited
+      public: virtual double ThresholdNoise() const override;
+
+      // Documentation inherited
+      public: virtual void SetRefractoryPeriod(
+          const std::chrono::steady_clock::duration &_period) override;
+
+      // Documentation inherited
+      public: virtual std::chrono::steady_clock::duration
+          RefractoryPeriod() const override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewEvents(
+          std::function<void(const CameraEvent *, unsigned int)>
+          _subscriber) override;
+
+      /// \brief Check that a contrast threshold is valid
+      /// \param[in] _threshold Threshold to check
+      /// \return True if the threshold is finite and greater than 0
+      private: bool ValidThreshold(double _threshold) const;
+
+      /// \brief Contrast threshold of brightness increases
+      protected: double positiveThreshold = 0.2;
+
+      /// \brief Contrast threshold of brightness decreases
+      protected: double negativeThreshold = 0.2;
+
+      /// \brief Standard deviation of the contrast threshold noise
+      protected: double thresholdNoise = 0.0;
+
+      /// \brief Minimum time between two events of the same pixel
+      protected: std::chrono::steady_clock::duration refractoryPeriod =
+          std::chrono::steady_clock::duration::zero();
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseEventCamera<T>::BaseEventCamera()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseEventCamera<T>::~BaseEventCamera()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseEventCamera<T>::ValidThreshold(double _threshold) const
+    {
+      if (_threshold <= 0.0 || !std::isfinite(_threshold))
+      {
+        ignerr << "Event camera contrast threshold must be a finite value "
+               << "greater than 0. Ignoring threshold of " << _threshold
+               << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseEventCamera<T>::SetPositiveThreshold(double _threshold)
+    {
+      if (this->ValidThreshold(_threshold))
+        this->positiveThreshold = _threshold;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseEventCamera<T>::PositiveThreshold() const
+    {
+      return this->positiveThreshold;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseEventCamera<T>::SetNegativeThreshold(double _threshold)
+    {
+      if (this->ValidThreshold(_threshold))
+        this->negativeThreshold = _threshold;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseEventCamera<T>::NegativeThreshold() const
+    {
+      return this->negativeThreshold;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseEventCamera<T>::SetThresholdNoise(double _stddev)
+    {
+      if (_stddev < 0.0 || !std::isfinite(_stddev))
+      {
+        ignerr << "Event camera threshold noise must be a finite value "
+               << "greater than or equal to 0. Ignoring noise of "
+               << _stddev << std::endl;
+        return;
+      }
+      this->thresholdNoise = _stddev;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseEventCamera<T>::ThresholdNoise() const
+    {
+      return this->thresholdNoise;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseEventCamera<T>::SetRefractoryPeriod(
+        const std::chrono::steady_clock::duration &_period)
+    {
+      if (_period < std::chrono::steady_clock::duration::zero())
+      {
+        ignerr << "Event camera refractory period can not be negative"
+               << std::endl;
+        return;
+      }
+      this->refractoryPeriod = _period;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::chrono::steady_clock::duration
+        BaseEventCamera<T>::RefractoryPeriod() const
+    {
+      return this->refractoryPeriod;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ignition::common::ConnectionPtr BaseEventCamera<T>::ConnectNewEvents(
+        std::function<void(const CameraEvent *, unsigned int)>)
+    {
+      return nullptr;
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEEXPOSUREPASS_HH_
+#define IGNITION_RENDERING_BASE_BASEEXPOSUREPASS_HH_
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ExposurePass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseExposurePass BaseExposurePass.hh \
+     * ignition/rendering/base/BaseExposurePass.hh
+     */
+    /// \brief Base exposure and tone mapping render pass.
+    template <class T>
+    class BaseExposurePass :
+      public virtual ExposurePass,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseExposurePass();
+
+      /// \brief Destructor
+      public: virtual ~BaseExposurePass();
+
+      // Documentation inherited.
+      public: void SetExposureCompensation(double _ev) override;
+
+      // Documentation inherited.
+      public: double ExposureCompensation() const override;
+
+      // Documentation inherited.
+      public: void SetAutoExposureEnabled(bool _enabled) override;
+
+      // Documentation inherited.
+      public: bool AutoExposureEnabled() const override;
+
+      // Documentation inherited.
+      public: void SetKeyValue(double _key) override;
+
+      // Documentation inherited.
+      public: double KeyValue() const override;
+
+      // Documentation inherited.
+      public: void SetExposureLimits(double _min, double _max) override;
+
+      // Documentation inherited.
+      public: double MinExposure() const override;
+
+      // Documentation inherited.
+      public: double MaxExposure() const override;
+
+      // Documentation inherited.
+      public: void SetToneMapping(ToneMappingType _type) override;
+
+      // Documentation inherited.
+      public: ToneMappingType ToneMapping() const override;
+
+      /// \brief Exposure compensation in stops
+      protected: double exposureCompensation = 0.0;
+
+      /// \brief True if auto exposure is enabled
+      protected: bool autoExposure = false;
+
+      /// \brief Luminance the average scene luminance is mapped to
+      protected: double keyValue = 0.18;
+
+      /// \brief Minimum exposure factor computed by auto exposure
+      protected: double minExposure = 1.0 / 16.0;
+
+      /// \brief Maximum exposure factor computed by auto exposure
+      protected: double maxExposure = 16.0;
+
+      /// \brief Tone mapping operator
+      protected: ToneMappingType toneMapping = TMT_NONE;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseExposurePass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseExposurePass<T>::BaseExposurePass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseExposurePass<T>::~BaseExposurePass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseExposurePass<T>::SetExposureCompensation(double _ev)
+    {
+      this->exposureCompensation = _ev;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseExposurePass<T>::ExposureCompensation() const
+    {
+      return this->exposureCompensation;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseExposurePass<T>::SetAutoExposureEnabled(bool _enabled)
+    {
+      this->autoExposure = _enabled;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseExposurePass<T>::AutoExposureEnabled() const
+    {
+      return this->autoExposure;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseExposurePass<T>::SetKeyValue(double _key)
+    {
+      if (_key <= 0.0 || _key > 1.0)
+      {
+        ignerr << "Key value must be in (0, 1]. Received: " << _key
+               << std::endl;
+        return;
+      }
+      this->keyValue = _key;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseExposurePass<T>::KeyValue() const
+    {
+      return this->keyValue;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseExposurePass<T>::SetExposureLimits(double _min, double _max)
+    {
+      if (_min <= 0.0 || _max < _min)
+      {
+        ignerr << "Invalid exposure limits [" << _min << ", " << _max
+               << "]. The minimum must be positive and not larger than "
+               << "the maximum." << std::endl;
+        return;
+      }
+      this->minExposure = _min;
+      this->maxExposure = _max;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseExposurePass<T>::MinExposure() const
+    {
+      return this->minExposure;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseExposurePass<T>::MaxExposure() const
+    {
+      return this->maxExposure;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseExposurePass<T>::SetToneMapping(ToneMappingType _type)
+    {
+      this->toneMapping = _type;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ToneMappingType BaseExposurePass<T>::ToneMapping() const
+    {
+      return this->toneMapping;
+    }
+    }
+  }
+}
+#endif
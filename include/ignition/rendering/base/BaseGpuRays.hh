@@ -17,7 +17,9 @@
 #ifndef IGNITION_RENDERING_BASE_BASEGPURAYS_HH_
 #define IGNITION_RENDERING_BASE_BASEGPURAYS_HH_
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include <ignition/common/Event.hh>
 #include <ignition/common/Console.hh>
@@ -151,6 +153,99 @@ namespace ignition
       // Documentation inherited.
       public: virtual double VerticalResolution() const override;
 
+      // Documentation inherited.
+      public: virtual void SetBeamDivergence(
+                  const math::Angle &_divergence) override;
+
+      // Documentation inherited.
+      public: virtual math::Angle BeamDivergence() const override;
+
+      // Documentation inherited.
+      public: virtual void SetReturnMode(LidarReturnMode _mode) override;
+
+      // Documentation inherited.
+      public: virtual LidarReturnMode ReturnMode() const override;
+
+      // Documentation inherited.
+      public: virtual void SetReturnCount(unsigned int _count) override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ReturnCount() const override;
+
+      // Documentation inherited.
+      public: virtual void SetReturnSeparation(double _separation) override;
+
+      // Documentation inherited.
+      public: virtual double ReturnSeparation() const override;
+
+      // Documentation inherited.
+      public: virtual bool SetRayDirections(
+                  const std::vector<math::Vector2d> &_angles,
+                  unsigned int _columns) override;
+
+      // Documentation inherited.
+      public: virtual const std::vector<math::Vector2d> &RayDirections()
+                  const override;
+
+      // Documentation inherited.
+      public: virtual bool SetRayTimes(const std::vector<double> &_times)
+                  override;
+
+      // Documentation inherited.
+      public: virtual const std::vector<double> &RayTimes() const override;
+
+      // Documentation inherited.
+      public: virtual void ClearRayDirections() override;
+
+      // Documentation inherited.
+      public: virtual void SetRollingScanEnabled(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool RollingScanEnabled() const override;
+
+      // Documentation inherited.
+      public: virtual void SetScanPoses(const math::Pose3d &_start,
+                  const math::Pose3d &_end) override;
+
+      // Documentation inherited.
+      public: virtual math::Pose3d ScanStartPose() const override;
+
+      // Documentation inherited.
+      public: virtual math::Pose3d ScanEndPose() const override;
+
+      // Documentation inherited.
+      public: virtual void SetScanDuration(double _duration) override;
+
+      // Documentation inherited.
+      public: virtual double ScanDuration() const override;
+
+      // Documentation inherited.
+      public: virtual void SetIntensityModel(LidarIntensityModel _model)
+                  override;
+
+      // Documentation inherited.
+      public: virtual LidarIntensityModel IntensityModel() const override;
+
+      // Documentation inherited.
+      public: virtual void SetIntensityScale(double _scale) override;
+
+      // Documentation inherited.
+      public: virtual double IntensityScale() const override;
+
+      // Documentation inherited.
+      public: virtual void SetIntensityReferenceRange(double _range)
+                  override;
+
+      // Documentation inherited.
+      public: virtual double IntensityReferenceRange() const override;
+
+      // Documentation inherited.
+      public: virtual void SetIntensityRangeExponent(double _exponent)
+                  override;
+
+      // Documentation inherited.
+      public: virtual double IntensityRangeExponent() const override;
+
       /// \brief maximum value used for data outside sensor range
       public: float dataMaxVal = ignition::math::INF_D;
 
@@ -200,6 +295,61 @@ namespace ignition
       /// \brief Number of channels used to store the data
       protected: unsigned int channels = 1u;
 
+      /// \brief Full angle beam divergence
+      protected: math::Angle beamDivergence;
+
+      /// \brief Echoes reported for each ray
+      protected: LidarReturnMode returnMode = LRM_FIRST;
+
+      /// \brief Max number of echoes reported in LRM_ALL return mode
+      protected: unsigned int returnCount = 1u;
+
+      /// \brief Minimum range difference between two distinct echoes
+      protected: double returnSeparation = 0.1;
+
+      /// \brief Max value of returnCount
+      protected: const unsigned int kMaxReturnCount = 8u;
+
+      /// \brief Azimuth and elevation of each ray. Empty if rays are
+      /// uniformly spaced
+      protected: std::vector<math::Vector2d> rayDirections;
+
+      /// \brief Number of rays in each row of rayDirections
+      protected: unsigned int rayDirectionColumns = 0u;
+
+      /// \brief Time of each ray of rayDirections as a fraction of the
+      /// scan duration. Empty if the columns are measured in order
+      protected: std::vector<double> rayTimes;
+
+      /// \brief True if rayDirections changed since it was last used by
+      /// the render engine
+      protected: bool rayDirectionsDirty = false;
+
+      /// \brief True if rolling scan mode is enabled
+      protected: bool rollingScan = false;
+
+      /// \brief World pose of the sensor at the start of the scan
+      protected: math::Pose3d scanStartPose;
+
+      /// \brief World pose of the sensor at the end of the scan
+      protected: math::Pose3d scanEndPose;
+
+      /// \brief Scan duration in seconds
+      protected: double scanDuration = 0.1;
+
+      /// \brief Model used to compute the intensity of the returns
+      protected: LidarIntensityModel intensityModel = LIM_RETRO;
+
+      /// \brief Intensity of a white diffuse surface seen head on at the
+      /// reference range
+      protected: double intensityScale = 1.0;
+
+      /// \brief Range in meters at which the intensity is not attenuated
+      protected: double intensityReferenceRange = 10.0;
+
+      /// \brief Exponent of the range falloff of the intensity
+      protected: double intensityRangeExponent = 2.0;
+
       private: friend class OgreScene;
     };
 
@@ -360,6 +510,8 @@ namespace ignition
     //////////////////////////////////////////////////
     int BaseGpuRays<T>::RangeCount() const
     {
+      if (!this->rayDirections.empty())
+        return static_cast<int>(this->rayDirectionColumns);
       return static_cast<int>(this->RayCount() * this->hResolution);
     }
 
@@ -381,6 +533,11 @@ namespace ignition
     //////////////////////////////////////////////////
     int BaseGpuRays<T>::VerticalRangeCount() const
     {
+      if (!this->rayDirections.empty())
+      {
+        return static_cast<int>(
+            this->rayDirections.size() / this->rayDirectionColumns);
+      }
       return static_cast<int>(this->VerticalRayCount() * this->vResolution);
     }
 
@@ -446,6 +603,266 @@ namespace ignition
     {
       return this->vResolution;
     }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetBeamDivergence(const math::Angle &_divergence)
+    {
+      this->beamDivergence = std::abs(_divergence.Radian());
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    math::Angle BaseGpuRays<T>::BeamDivergence() const
+    {
+      return this->beamDivergence;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetReturnMode(LidarReturnMode _mode)
+    {
+      this->returnMode = _mode;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    LidarReturnMode BaseGpuRays<T>::ReturnMode() const
+    {
+      return this->returnMode;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetReturnCount(unsigned int _count)
+    {
+      if (_count < 1u || _count > this->kMaxReturnCount)
+      {
+        ignwarn << "Return count [" << _count << "] must be in the range of "
+                << "[1, " << this->kMaxReturnCount << "]. Clamping."
+                << std::endl;
+      }
+      this->returnCount = std::clamp(_count, 1u, this->kMaxReturnCount);
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    unsigned int BaseGpuRays<T>::ReturnCount() const
+    {
+      return this->returnCount;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetReturnSeparation(double _separation)
+    {
+      this->returnSeparation = std::abs(_separation);
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    double BaseGpuRays<T>::ReturnSeparation() const
+    {
+      return this->returnSeparation;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    bool BaseGpuRays<T>::SetRayDirections(
+        const std::vector<math::Vector2d> &_angles, unsigned int _columns)
+    {
+      if (_angles.empty() || _columns == 0u || _angles.size() % _columns != 0u)
+      {
+        ignerr << "Unable to set ray directions. The table size ["
+               << _angles.size() << "] must be a non-zero multiple of the "
+               << "number of columns [" << _columns << "]" << std::endl;
+        return false;
+      }
+      if (_angles.size() != this->rayDirections.size())
+        this->rayTimes.clear();
+      this->rayDirections = _angles;
+      this->rayDirectionColumns = _columns;
+      this->rayDirectionsDirty = true;
+      return true;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    bool BaseGpuRays<T>::SetRayTimes(const std::vector<double> &_times)
+    {
+      if (this->rayDirections.empty() ||
+          _times.size() != this->rayDirections.size())
+      {
+        ignerr << "Unable to set ray times. The number of times ["
+               << _times.size() << "] must match the size of the table of "
+               << "ray directions [" << this->rayDirections.size() << "]"
+               << std::endl;
+        return false;
+      }
+      for (double time : _times)
+      {
+        if (time < 0.0 || time > 1.0)
+        {
+          ignerr << "Unable to set ray times. Times must be in the range of "
+                 << "[0, 1], got [" << time << "]" << std::endl;
+          return false;
+        }
+      }
+      this->rayTimes = _times;
+      this->rayDirectionsDirty = true;
+      return true;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    const std::vector<double> &BaseGpuRays<T>::RayTimes() const
+    {
+      return this->rayTimes;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    const std::vector<math::Vector2d> &BaseGpuRays<T>::RayDirections() const
+    {
+      return this->rayDirections;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::ClearRayDirections()
+    {
+      if (this->rayDirections.empty())
+        return;
+      this->rayDirections.clear();
+      this->rayDirectionColumns = 0u;
+      this->rayTimes.clear();
+      this->rayDirectionsDirty = true;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetRollingScanEnabled(bool _enabled)
+    {
+      this->rollingScan = _enabled;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    bool BaseGpuRays<T>::RollingScanEnabled() const
+    {
+      return this->rollingScan;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetScanPoses(const math::Pose3d &_start,
+        const math::Pose3d &_end)
+    {
+      this->scanStartPose = _start;
+      this->scanEndPose = _end;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    math::Pose3d BaseGpuRays<T>::ScanStartPose() const
+    {
+      return this->scanStartPose;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    math::Pose3d BaseGpuRays<T>::ScanEndPose() const
+    {
+      return this->scanEndPose;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetScanDuration(double _duration)
+    {
+      this->scanDuration = std::max(0.0, _duration);
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    double BaseGpuRays<T>::ScanDuration() const
+    {
+      return this->scanDuration;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetIntensityModel(LidarIntensityModel _model)
+    {
+      this->intensityModel = _model;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    LidarIntensityModel BaseGpuRays<T>::IntensityModel() const
+    {
+      return this->intensityModel;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetIntensityScale(double _scale)
+    {
+      if (_scale <= 0.0)
+      {
+        ignerr << "Intensity scale [" << _scale << "] must be positive"
+               << std::endl;
+        return;
+      }
+      this->intensityScale = _scale;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    double BaseGpuRays<T>::IntensityScale() const
+    {
+      return this->intensityScale;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetIntensityReferenceRange(double _range)
+    {
+      if (_range <= 0.0)
+      {
+        ignerr << "Intensity reference range [" << _range
+               << "] must be positive" << std::endl;
+        return;
+      }
+      this->intensityReferenceRange = _range;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    double BaseGpuRays<T>::IntensityReferenceRange() const
+    {
+      return this->intensityReferenceRange;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetIntensityRangeExponent(double _exponent)
+    {
+      if (_exponent < 0.0)
+      {
+        ignerr << "Intensity range exponent [" << _exponent
+               << "] must not be negative" << std::endl;
+        return;
+      }
+      this->intensityRangeExponent = _exponent;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    double BaseGpuRays<T>::IntensityRangeExponent() const
+    {
+      return this->intensityRangeExponent;
+    }
     }
   }
 }
@@ -17,6 +17,11 @@
 #ifndef IGNITION_RENDERING_BASE_BASELIGHT_HH_
 #define IGNITION_RENDERING_BASE_BASELIGHT_HH_
 
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/IesProfile.hh"
 #include "ignition/rendering/Light.hh"
 
 namespace ignition
@@ -116,7 +121,60 @@ namespace ignition
 
       public: virtual void SetFalloff(double _falloff) = 0;
 
+      // Documentation inherited
+      public: virtual bool SetIesProfile(const std::string &_filename)
+                  override;
+
+      // Documentation inherited
+      public: virtual std::string IesProfile() const override;
+
       protected: virtual void Reset();
+
+      /// \brief Path of the IES profile applied to the light
+      protected: std::string iesProfile;
+    };
+
+    template <class T>
+    class BaseAreaLight :
+      public virtual AreaLight,
+      public virtual T
+    {
+      protected: BaseAreaLight();
+
+      public: virtual ~BaseAreaLight();
+
+      public: virtual void SetDirection(double _x, double _y, double _z);
+
+      public: virtual void SetDirection(const math::Vector3d &_dir) = 0;
+
+      // Documentation inherited
+      public: virtual AreaLightShape Shape() const override;
+
+      // Documentation inherited
+      public: virtual void SetShape(AreaLightShape _shape) override;
+
+      // Documentation inherited
+      public: virtual math::Vector2d Size() const override;
+
+      // Documentation inherited
+      public: virtual void SetSize(const math::Vector2d &_size) override;
+
+      // Documentation inherited
+      public: virtual std::string Texture() const override;
+
+      // Documentation inherited
+      public: virtual void SetTexture(const std::string &_texture) override;
+
+      protected: virtual void Reset();
+
+      /// \brief Shape of the emitting surface
+      protected: AreaLightShape shape = ALS_RECT;
+
+      /// \brief Size of the emitting surface in meters
+      protected: math::Vector2d size{1.0, 1.0};
+
+      /// \brief Path of the texture modulating the emitted light
+      protected: std::string texture;
     };
 
     //////////////////////////////////////////////////
@@ -243,6 +301,121 @@ namespace ignition
       this->SetOuterAngle(IGN_PI / 4.0);
       this->SetFalloff(1.0);
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseSpotLight<T>::SetIesProfile(const std::string &_filename)
+    {
+      if (_filename.empty())
+      {
+        this->iesProfile.clear();
+        return true;
+      }
+
+      rendering::IesProfile profile;
+      if (!profile.Load(_filename))
+        return false;
+
+      double beam = profile.BeamAngle().Radian();
+      double field = profile.FieldAngle().Radian();
+      if (field <= 0.0)
+      {
+        ignerr << "IES profile has no lit directions: " << _filename
+               << std::endl;
+        return false;
+      }
+
+      this->SetInnerAngle(beam * 0.5);
+      this->SetOuterAngle(field * 0.5);
+      this->SetFalloff(profile.SpotFalloff());
+      this->iesProfile = _filename;
+      return true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseSpotLight<T>::IesProfile() const
+    {
+      return this->iesProfile;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseAreaLight<T>::BaseAreaLight()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseAreaLight<T>::~BaseAreaLight()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAreaLight<T>::SetDirection(double _x, double _y, double _z)
+    {
+      this->SetDirection(math::Vector3d(_x, _y, _z));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    AreaLightShape BaseAreaLight<T>::Shape() const
+    {
+      return this->shape;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAreaLight<T>::SetShape(AreaLightShape _shape)
+    {
+      this->shape = _shape;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector2d BaseAreaLight<T>::Size() const
+    {
+      return this->size;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAreaLight<T>::SetSize(const math::Vector2d &_size)
+    {
+      if (_size.X() <= 0.0 || _size.Y() <= 0.0)
+      {
+        ignerr << "Area light size must be positive: " << _size << std::endl;
+        return;
+      }
+      this->size = _size;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseAreaLight<T>::Texture() const
+    {
+      return this->texture;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAreaLight<T>::SetTexture(const std::string &_texture)
+    {
+      this->texture = _texture;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseAreaLight<T>::Reset()
+    {
+      T::Reset();
+      this->SetCastShadows(false);
+      this->SetDirection(0, 0, -1);
+      this->SetShape(ALS_RECT);
+      this->SetSize(math::Vector2d(1.0, 1.0));
+      this->SetTexture("");
+    }
     }
   }
 }
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEMOTIONBLURPASS_HH_
+#define IGNITION_RENDERING_BASE_BASEMOTIONBLURPASS_HH_
+
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/MotionBlurPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseMotionBlurPass BaseMotionBlurPass.hh \
+     * ignition/rendering/base/BaseMotionBlurPass.hh
+     */
+    /// \brief Base motion blur render pass.
+    template <class T>
+    class BaseMotionBlurPass :
+      public virtual MotionBlurPass,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseMotionBlurPass();
+
+      /// \brief Destructor
+      public: virtual ~BaseMotionBlurPass();
+
+      // Documentation inherited.
+      public: void SetExposureFraction(double _fraction) override;
+
+      // Documentation inherited.
+      public: double ExposureFraction() const override;
+
+      // Documentation inherited.
+      public: void SetSampleCount(unsigned int _samples) override;
+
+      // Documentation inherited.
+      public: unsigned int SampleCount() const override;
+
+      /// \brief Fraction of the frame time the shutter is open
+      protected: double exposureFraction = 0.5;
+
+      /// \brief Number of samples along the motion of each pixel
+      protected: unsigned int sampleCount = 8u;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseMotionBlurPass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseMotionBlurPass<T>::BaseMotionBlurPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseMotionBlurPass<T>::~BaseMotionBlurPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseMotionBlurPass<T>::SetExposureFraction(double _fraction)
+    {
+      this->exposureFraction = math::clamp(_fraction, 0.0, 1.0);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseMotionBlurPass<T>::ExposureFraction() const
+    {
+      return this->exposureFraction;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseMotionBlurPass<T>::SetSampleCount(unsigned int _samples)
+    {
+      this->sampleCount = math::clamp(_samples, 1u, 32u);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseMotionBlurPass<T>::SampleCount() const
+    {
+      return this->sampleCount;
+    }
+    }
+  }
+}
+#endif
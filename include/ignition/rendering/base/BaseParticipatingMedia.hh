@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEPARTICIPATINGMEDIA_HH_
+#define IGNITION_RENDERING_BASE_BASEPARTICIPATINGMEDIA_HH_
+
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ParticipatingMedia.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class BaseParticipatingMedia BaseParticipatingMedia.hh
+    /// ignition/rendering/base/BaseParticipatingMedia.hh
+    /// \brief Base participating media. Evaluates the transmittance of the
+    /// media on the CPU. Render engines evaluate the same model in the
+    /// shaders of each sensor.
+    template <class T>
+    class BaseParticipatingMedia :
+        public virtual ParticipatingMedia,
+        public T
+    {
+      /// \brief Constructor
+      protected: BaseParticipatingMedia();
+
+      /// \brief Destructor
+      public: virtual ~BaseParticipatingMedia() override;
+
+      // Documentation inherited
+      public: virtual void SetAbsorption(
+                  const math::Vector3d &_absorption) override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d Absorption() const override;
+
+      // Documentation inherited
+      public: virtual void SetScattering(
+                  const math::Vector3d &_scattering) override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d Scattering() const override;
+
+      // Documentation inherited
+      public: virtual void SetColor(const math::Color &_color) override;
+
+      // Documentation inherited
+      public: virtual math::Color Color() const override;
+
+      // Documentation inherited
+      public: virtual void SetInfraredExtinction(double _extinction)
+                  override;
+
+      // Documentation inherited
+      public: virtual double InfraredExtinction() const override;
+
+      // Documentation inherited
+      public: virtual void SetHeightFalloff(double _falloff) override;
+
+      // Documentation inherited
+      public: virtual double HeightFalloff() const override;
+
+      // Documentation inherited
+      public: virtual void SetBaseHeight(double _height) override;
+
+      // Documentation inherited
+      public: virtual double BaseHeight() const override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d Transmittance(
+                  const math::Vector3d &_from,
+                  const math::Vector3d &_to) const override;
+
+      // Documentation inherited
+      public: virtual double InfraredTransmittance(
+                  const math::Vector3d &_from,
+                  const math::Vector3d &_to) const override;
+
+      /// \brief Get the density of the media integrated over a segment,
+      /// relative to the full density below the base height
+      /// \param[in] _from Start point in world frame
+      /// \param[in] _to End point in world frame
+      /// \return Equivalent length of media at full density in meters
+      protected: double DensityLength(const math::Vector3d &_from,
+                     const math::Vector3d &_to) const;
+
+      /// \brief Get the density of the media integrated from the base
+      /// height up to a height relative to it, per unit of height
+      /// \param[in] _height Height relative to the base height
+      /// \return Integrated relative density
+      protected: double HeightIntegral(double _height) const;
+
+      /// \brief Absorption coefficients in 1/m
+      protected: math::Vector3d absorption;
+
+      /// \brief Scattering coefficients in 1/m
+      protected: math::Vector3d scattering = math::Vector3d(0.02, 0.02, 0.02);
+
+      /// \brief Color of the in-scattered light
+      protected: math::Color color = math::Color(0.7f, 0.7f, 0.7f);
+
+      /// \brief Infrared extinction coefficient in 1/m
+      protected: double infraredExtinction = 0.0;
+
+      /// \brief Height falloff in 1/m
+      protected: double heightFalloff = 0.0;
+
+      /// \brief Base height in meters
+      protected: double baseHeight = 0.0;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseParticipatingMedia<T>::BaseParticipatingMedia()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseParticipatingMedia<T>::~BaseParticipatingMedia()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseParticipatingMedia<T>::SetAbsorption(
+        const math::Vector3d &_absorption)
+    {
+      if (!_absorption.IsFinite() || _absorption.Min() < 0.0)
+      {
+        ignerr << "Media absorption must be finite and non-negative"
+               << std::endl;
+        return;
+      }
+      this->absorption = _absorption;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseParticipatingMedia<T>::Absorption() const
+    {
+      return this->absorption;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseParticipatingMedia<T>::SetScattering(
+        const math::Vector3d &_scattering)
+    {
+      if (!_scattering.IsFinite() || _scattering.Min() < 0.0)
+      {
+        ignerr << "Media scattering must be finite and non-negative"
+               << std::endl;
+        return;
+      }
+      this->scattering = _scattering;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseParticipatingMedia<T>::Scattering() const
+    {
+      return this->scattering;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseParticipatingMedia<T>::SetColor(const math::Color &_color)
+    {
+      this->color = _color;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Color BaseParticipatingMedia<T>::Color() const
+    {
+      return this->color;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseParticipatingMedia<T>::SetInfraredExtinction(double _extinction)
+    {
+      if (!std::isfinite(_extinction) || _extinction < 0.0)
+      {
+        ignerr << "Media infrared extinction must be finite and "
+               << "non-negative" << std::endl;
+        return;
+      }
+      this->infraredExtinction = _extinction;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseParticipatingMedia<T>::InfraredExtinction() const
+    {
+      return this->infraredExtinction;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseParticipatingMedia<T>::SetHeightFalloff(double _falloff)
+    {
+      if (!std::isfinite(_falloff) || _falloff < 0.0)
+      {
+        ignerr << "Media height falloff must be finite and non-negative"
+               << std::endl;
+        return;
+      }
+      this->heightFalloff = _falloff;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseParticipatingMedia<T>::HeightFalloff() const
+    {
+      return this->heightFalloff;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseParticipatingMedia<T>::SetBaseHeight(double _height)
+    {
+      if (!std::isfinite(_height))
+      {
+        ignerr << "Media base height must be finite" << std::endl;
+        return;
+      }
+      this->baseHeight = _height;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseParticipatingMedia<T>::BaseHeight() const
+    {
+      return this->baseHeight;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseParticipatingMedia<T>::Transmittance(
+        const math::Vector3d &_from, const math::Vector3d &_to) const
+    {
+      math::Vector3d extinction = this->absorption + this->scattering;
+      double length = this->DensityLength(_from, _to);
+      return math::Vector3d(
+          std::exp(-extinction.X() * length),
+          std::exp(-extinction.Y() * length),
+          std::exp(-extinction.Z() * length));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseParticipatingMedia<T>::InfraredTransmittance(
+        const math::Vector3d &_from, const math::Vector3d &_to) const
+    {
+      return std::exp(-this->infraredExtinction *
+          this->DensityLength(_from, _to));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseParticipatingMedia<T>::DensityLength(
+        const math::Vector3d &_from, const math::Vector3d &_to) const
+    {
+      double length = _from.Distance(_to);
+      double z0 = _from.Z() - this->baseHeight;
+      double z1 = _to.Z() - this->baseHeight;
+
+      // the mean density over the segment is the height integral of the
+      // density divided by the height difference. Use the density at the
+      // start point for segments that are close to horizontal.
+      if (std::abs(z1 - z0) < 1e-4)
+      {
+        if (z0 <= 0.0)
+          return length;
+        return length * std::exp(-this->heightFalloff * z0);
+      }
+      return length * (this->HeightIntegral(z1) -
+          this->HeightIntegral(z0)) / (z1 - z0);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseParticipatingMedia<T>::HeightIntegral(double _height) const
+    {
+      // full density below the base height and exponential decay above it
+      if (_height <= 0.0 || this->heightFalloff <= 0.0)
+        return _height;
+      return (1.0 - std::exp(-this->heightFalloff * _height)) /
+          this->heightFalloff;
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEPRECIPITATION_HH_
+#define IGNITION_RENDERING_BASE_BASEPRECIPITATION_HH_
+
+#include <algorithm>
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/Precipitation.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class BasePrecipitation BasePrecipitation.hh
+    /// ignition/rendering/base/BasePrecipitation.hh
+    /// \brief Base precipitation. Derives the properties of the particles
+    /// from the precipitation rate. Render engines generate the particles
+    /// from these properties in the shaders of each sensor.
+    template <class T>
+    class BasePrecipitation :
+        public virtual Precipitation,
+        public T
+    {
+      /// \brief Constructor
+      protected: BasePrecipitation();
+
+      /// \brief Destructor
+      public: virtual ~BasePrecipitation() override;
+
+      // Documentation inherited
+      public: virtual void SetType(PrecipitationType _type) override;
+
+      // Documentation inherited
+      public: virtual PrecipitationType Type() const override;
+
+      // Documentation inherited
+      public: virtual void SetRate(double _rate) override;
+
+      // Documentation inherited
+      public: virtual double Rate() const override;
+
+      // Documentation inherited
+      public: virtual void SetWindVelocity(
+                  const math::Vector3d &_velocity) override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d WindVelocity() const override;
+
+      // Documentation inherited
+      public: virtual void SetLaserRetro(double _retro) override;
+
+      // Documentation inherited
+      public: virtual double LaserRetro() const override;
+
+      // Documentation inherited
+      public: virtual double ParticleDiameter() const override;
+
+      // Documentation inherited
+      public: virtual double FallSpeed() const override;
+
+      // Documentation inherited
+      public: virtual double Extinction() const override;
+
+      // Documentation inherited
+      public: virtual double Wetness() const override;
+
+      /// \brief Kind of particles
+      protected: PrecipitationType type = PT_RAIN;
+
+      /// \brief Rate in mm/h
+      protected: double rate = 10.0;
+
+      /// \brief Wind velocity in world frame in m/s
+      protected: math::Vector3d windVelocity;
+
+      /// \brief Laser retro-reflectivity of the particles
+      protected: double laserRetro = 0.0;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BasePrecipitation<T>::BasePrecipitation()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BasePrecipitation<T>::~BasePrecipitation()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BasePrecipitation<T>::SetType(PrecipitationType _type)
+    {
+      this->type = _type;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    PrecipitationType BasePrecipitation<T>::Type() const
+    {
+      return this->type;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BasePrecipitation<T>::SetRate(double _rate)
+    {
+      if (!std::isfinite(_rate) || _rate < 0.0)
+      {
+        ignerr << "Precipitation rate must be finite and non-negative"
+               << std::endl;
+        return;
+      }
+      this->rate = _rate;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BasePrecipitation<T>::Rate() const
+    {
+      return this->rate;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BasePrecipitation<T>::SetWindVelocity(
+        const math::Vector3d &_velocity)
+    {
+      if (!_velocity.IsFinite())
+      {
+        ignerr << "Precipitation wind velocity must be finite" << std::endl;
+        return;
+      }
+      this->windVelocity = _velocity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BasePrecipitation<T>::WindVelocity() const
+    {
+      return this->windVelocity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BasePrecipitation<T>::SetLaserRetro(double _retro)
+    {
+      if (!std::isfinite(_retro) || _retro < 0.0)
+      {
+        ignerr << "Precipitation laser retro must be finite and "
+               << "non-negative" << std::endl;
+        return;
+      }
+      this->laserRetro = _retro;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BasePrecipitation<T>::LaserRetro() const
+    {
+      return this->laserRetro;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BasePrecipitation<T>::ParticleDiameter() const
+    {
+      // median volume diameter of the exponential size distributions of
+      // Marshall-Palmer for rain and Sekhon-Srivastava for snow, in mm
+      double diameter = this->type == PT_SNOW ?
+          1.44 * std::pow(this->rate, 0.48) :
+          0.89 * std::pow(this->rate, 0.21);
+      return diameter * 1e-3;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BasePrecipitation<T>::FallSpeed() const
+    {
+      // terminal speed of rain drops (Atlas et al.) and of aggregate snow
+      // flakes (Locatelli-Hobbs), with diameters in mm
+      double diameter = this->ParticleDiameter() * 1e3;
+      if (this->type == PT_SNOW)
+        return 0.8 * std::pow(diameter, 0.16);
+      return std::max(0.0, 9.65 - 10.3 * std::exp(-0.6 * diameter));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BasePrecipitation<T>::Extinction() const
+    {
+      // approximate fits of the visibility observed in rain and snow,
+      // in 1/km. Snow attenuates much more than rain of the same liquid
+      // water rate because there are more and larger particles.
+      double extinction = this->type == PT_SNOW ?
+          3.9 * std::pow(this->rate, 0.75) :
+          1.076 * std::pow(this->rate, 0.67);
+      return extinction * 1e-3;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BasePrecipitation<T>::Wetness() const
+    {
+      // surfaces are soaked within minutes of moderate rain. Snow wets
+      // surfaces only as far as it melts on them.
+      double wetness = 1.0 - std::exp(-this->rate / 2.5);
+      if (this->type == PT_SNOW)
+        wetness *= 0.3;
+      return wetness;
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,419 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEPROCEDURALSKY_HH_
+#define IGNITION_RENDERING_BASE_BASEPROCEDURALSKY_HH_
+
+#include <algorithm>
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/ProceduralSky.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class BaseProceduralSky BaseProceduralSky.hh
+    /// ignition/rendering/base/BaseProceduralSky.hh
+    /// \brief Base procedural sky. Evaluates the analytic daylight model
+    /// of Preetham et al. with the scattering terms of Hoffman and
+    /// Preetham on the CPU. Render engines pass the scattering
+    /// coefficients to a shader that evaluates the same model per pixel,
+    /// and use the sun and ambient colors to light the scene.
+    template <class T>
+    class BaseProceduralSky :
+        public virtual ProceduralSky,
+        public T
+    {
+      /// \brief Constructor
+      protected: BaseProceduralSky();
+
+      /// \brief Destructor
+      public: virtual ~BaseProceduralSky() override;
+
+      // Documentation inherited
+      public: virtual void SetSunDirection(
+                  const math::Vector3d &_direction) override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d SunDirection() const override;
+
+      // Documentation inherited
+      public: virtual void SetTurbidity(double _turbidity) override;
+
+      // Documentation inherited
+      public: virtual double Turbidity() const override;
+
+      // Documentation inherited
+      public: virtual void SetCloudCover(double _cover) override;
+
+      // Documentation inherited
+      public: virtual double CloudCover() const override;
+
+      // Documentation inherited
+      public: virtual void SetWindVelocity(
+                  const math::Vector2d &_velocity) override;
+
+      // Documentation inherited
+      public: virtual math::Vector2d WindVelocity() const override;
+
+      // Documentation inherited
+      public: virtual void SetSunLight(DirectionalLightPtr _light) override;
+
+      // Documentation inherited
+      public: virtual DirectionalLightPtr SunLight() const override;
+
+      // Documentation inherited
+      public: virtual math::Color SkyColor(
+                  const math::Vector3d &_direction) const override;
+
+      // Documentation inherited
+      public: virtual math::Color SunColor() const override;
+
+      // Documentation inherited
+      public: virtual math::Color AmbientColor() const override;
+
+      /// \brief Recompute the scattering coefficients, sun color and
+      /// ambient color after the sun or the atmosphere changed
+      protected: void UpdateScattering();
+
+      /// \brief Get the fraction of sunlight that reaches the observer
+      /// along a view direction
+      /// \param[in] _direction Unit view direction
+      /// \return Extinction factor for each color channel
+      protected: math::Vector3d Extinction(
+                     const math::Vector3d &_direction) const;
+
+      /// \brief Get the linear sky color in a view direction
+      /// \param[in] _direction Unit view direction
+      /// \return Linear sky color, excluding the sun disc and clouds
+      protected: math::Vector3d LinearSkyColor(
+                     const math::Vector3d &_direction) const;
+
+      /// \brief Direction towards the sun
+      protected: math::Vector3d sunDirection =
+                     math::Vector3d(0.5, 0.0, 0.866).Normalized();
+
+      /// \brief Turbidity of the atmosphere
+      protected: double turbidity = 2.0;
+
+      /// \brief Fraction of the sky covered by clouds
+      protected: double cloudCover = 0.0;
+
+      /// \brief Velocity of the cloud layer in m/s
+      protected: math::Vector2d windVelocity;
+
+      /// \brief Light that represents the sun
+      protected: DirectionalLightPtr sunLight;
+
+      /// \brief Total Rayleigh scattering coefficients
+      protected: math::Vector3d betaR;
+
+      /// \brief Total Mie scattering coefficients
+      protected: math::Vector3d betaM;
+
+      /// \brief Sun irradiance
+      protected: double sunE = 0.0;
+
+      /// \brief Anisotropy of the Mie scattering phase function
+      protected: double mieG = 0.8;
+
+      /// \brief Exposure that maps scattered radiance to [0, 1]
+      protected: double exposure = 0.5;
+
+      /// \brief Linear sun light color
+      protected: math::Color sunColor;
+
+      /// \brief Linear ambient light color
+      protected: math::Color ambientColor;
+
+      /// \brief True if the sun light and ambient light have to be updated
+      protected: bool lightingDirty = true;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseProceduralSky<T>::BaseProceduralSky()
+    {
+      this->UpdateScattering();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseProceduralSky<T>::~BaseProceduralSky()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseProceduralSky<T>::SetSunDirection(
+        const math::Vector3d &_direction)
+    {
+      if (!_direction.IsFinite() || math::equal(_direction.Length(), 0.0))
+      {
+        ignerr << "Sun direction must be finite and non-zero" << std::endl;
+        return;
+      }
+      this->sunDirection = _direction.Normalized();
+      this->UpdateScattering();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseProceduralSky<T>::SunDirection() const
+    {
+      return this->sunDirection;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseProceduralSky<T>::SetTurbidity(double _turbidity)
+    {
+      if (!std::isfinite(_turbidity) || _turbidity < 1.0)
+      {
+        ignerr << "Sky turbidity must be at least 1" << std::endl;
+        return;
+      }
+      this->turbidity = _turbidity;
+      this->UpdateScattering();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseProceduralSky<T>::Turbidity() const
+    {
+      return this->turbidity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseProceduralSky<T>::SetCloudCover(double _cover)
+    {
+      if (!std::isfinite(_cover))
+      {
+        ignerr << "Cloud cover must be finite" << std::endl;
+        return;
+      }
+      this->cloudCover = math::clamp(_cover, 0.0, 1.0);
+      this->UpdateScattering();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseProceduralSky<T>::CloudCover() const
+    {
+      return this->cloudCover;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseProceduralSky<T>::SetWindVelocity(
+        const math::Vector2d &_velocity)
+    {
+      if (!std::isfinite(_velocity.X()) || !std::isfinite(_velocity.Y()))
+      {
+        ignerr << "Wind velocity must be finite" << std::endl;
+        return;
+      }
+      this->windVelocity = _velocity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector2d BaseProceduralSky<T>::WindVelocity() const
+    {
+      return this->windVelocity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseProceduralSky<T>::SetSunLight(DirectionalLightPtr _light)
+    {
+      this->sunLight = _light;
+      this->lightingDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    DirectionalLightPtr BaseProceduralSky<T>::SunLight() const
+    {
+      return this->sunLight;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Color BaseProceduralSky<T>::SkyColor(
+        const math::Vector3d &_direction) const
+    {
+      math::Vector3d dir = _direction.Normalized();
+      if (!dir.IsFinite() || math::equal(dir.Length(), 0.0))
+        return math::Color::Black;
+
+      // rendered images are sRGB encoded
+      math::Vector3d c = this->LinearSkyColor(dir);
+      return math::Color(
+          static_cast<float>(std::pow(c.X(), 1.0 / 2.2)),
+          static_cast<float>(std::pow(c.Y(), 1.0 / 2.2)),
+          static_cast<float>(std::pow(c.Z(), 1.0 / 2.2)));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Color BaseProceduralSky<T>::SunColor() const
+    {
+      return this->sunColor;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Color BaseProceduralSky<T>::AmbientColor() const
+    {
+      return this->ambientColor;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseProceduralSky<T>::UpdateScattering()
+    {
+      // constants of the model, see "A Practical Analytic Model for
+      // Daylight" by Preetham et al. and the sky shader of three.js
+      const math::Vector3d totalRayleigh(5.804542996261093e-6,
+          1.3562911419845635e-5, 3.0265902468824876e-5);
+      const math::Vector3d mieConst(1.8399918514433978e14,
+          2.7798023919660528e14, 4.0790479543861094e14);
+      const double cutoffAngle = 1.6110731556870734;
+      const double steepness = 1.5;
+      const double solarIrradiance = 1000.0;
+      const double mieCoefficient = 0.005;
+
+      double sunZ = math::clamp(this->sunDirection.Z(), -1.0, 1.0);
+      this->sunE = solarIrradiance * std::max(0.0,
+          1.0 - std::exp(-(cutoffAngle - std::acos(sunZ)) / steepness));
+
+      // fade out the Rayleigh scattering once the sun is below the horizon
+      double sunFade = 1.0 - math::clamp(
+          1.0 - std::exp(sunZ * 400000.0 / 450000.0), 0.0, 1.0);
+      this->betaR = totalRayleigh * sunFade;
+
+      double c = 0.2 * this->turbidity * 10e-18;
+      this->betaM = mieConst * (0.434 * c * mieCoefficient);
+
+      // sun light, softened so that it does not turn fully red at sunset
+      // and faded out as the sun disc sinks below the horizon
+      math::Vector3d fex = this->Extinction(this->sunDirection);
+      double horizonFade = math::clamp((sunZ + 0.02) / 0.07, 0.0, 1.0);
+      double sunScale = horizonFade * (1.0 - 0.7 * this->cloudCover);
+      this->sunColor = math::Color(
+          static_cast<float>(std::pow(fex.X(), 1.0 / 2.2) * sunScale),
+          static_cast<float>(std::pow(fex.Y(), 1.0 / 2.2) * sunScale),
+          static_cast<float>(std::pow(fex.Z(), 1.0 / 2.2) * sunScale));
+
+      // ambient light received by an upward facing surface, i.e. the
+      // cosine weighted mean of the sky over the upper hemisphere
+      const int zenithSteps = 6;
+      const int azimuthSteps = 12;
+      const double dZenith = 0.5 * IGN_PI / zenithSteps;
+      const double dAzimuth = 2.0 * IGN_PI / azimuthSteps;
+      math::Vector3d ambient;
+      for (int i = 0; i < zenithSteps; ++i)
+      {
+        double zenith = (i + 0.5) * dZenith;
+        double weight = std::cos(zenith) * std::sin(zenith) *
+            dZenith * dAzimuth / IGN_PI;
+        for (int j = 0; j < azimuthSteps; ++j)
+        {
+          double azimuth = j * dAzimuth;
+          math::Vector3d dir(std::sin(zenith) * std::cos(azimuth),
+              std::sin(zenith) * std::sin(azimuth), std::cos(zenith));
+          ambient += this->LinearSkyColor(dir) * weight;
+        }
+      }
+
+      // clouds scatter the sky light and make it grey
+      double luminance = 0.2126 * ambient.X() + 0.7152 * ambient.Y() +
+          0.0722 * ambient.Z();
+      ambient = ambient * (1.0 - this->cloudCover) +
+          math::Vector3d(luminance, luminance, luminance) * this->cloudCover;
+      this->ambientColor = math::Color(static_cast<float>(ambient.X()),
+          static_cast<float>(ambient.Y()), static_cast<float>(ambient.Z()));
+
+      this->lightingDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseProceduralSky<T>::Extinction(
+        const math::Vector3d &_direction) const
+    {
+      // optical length of the atmosphere along the view direction
+      const double rayleighZenithLength = 8.4e3;
+      const double mieZenithLength = 1.25e3;
+      double zenithAngle = std::acos(math::clamp(_direction.Z(), 0.0, 1.0));
+      double inverse = 1.0 / (std::cos(zenithAngle) + 0.15 *
+          std::pow(93.885 - IGN_RTOD(zenithAngle), -1.253));
+      double sR = rayleighZenithLength * inverse;
+      double sM = mieZenithLength * inverse;
+
+      math::Vector3d tau = this->betaR * sR + this->betaM * sM;
+      return math::Vector3d(std::exp(-tau.X()), std::exp(-tau.Y()),
+          std::exp(-tau.Z()));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseProceduralSky<T>::LinearSkyColor(
+        const math::Vector3d &_direction) const
+    {
+      math::Vector3d fex = this->Extinction(_direction);
+
+      double cosTheta = _direction.Dot(this->sunDirection);
+      double rc = cosTheta * 0.5 + 0.5;
+      double rayleighPhase = 3.0 / (16.0 * IGN_PI) * (1.0 + rc * rc);
+      double g2 = this->mieG * this->mieG;
+      double miePhase = 1.0 / (4.0 * IGN_PI) * (1.0 - g2) /
+          std::pow(1.0 - 2.0 * this->mieG * cosTheta + g2, 1.5);
+
+      double sunLow = math::clamp(
+          std::pow(1.0 - this->sunDirection.Z(), 5.0), 0.0, 1.0);
+      const math::Vector3d offset(0.0, 0.0003, 0.00075);
+
+      math::Vector3d result;
+      for (unsigned int i = 0; i < 3u; ++i)
+      {
+        double betaSum = this->betaR[i] + this->betaM[i];
+        double scatter = 0.0;
+        if (betaSum > 0.0)
+        {
+          scatter = this->sunE * (this->betaR[i] * rayleighPhase +
+              this->betaM[i] * miePhase) / betaSum;
+        }
+        double lin = std::pow(scatter * (1.0 - fex[i]), 1.5);
+        lin *= (1.0 - sunLow) + sunLow * std::sqrt(scatter * fex[i]);
+        double l0 = 0.1 * fex[i];
+        double radiance = (lin + l0) * 0.04 + offset[i];
+        result[i] = 1.0 - std::exp(-this->exposure * radiance);
+      }
+      return result;
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASERADARSENSOR_HH_
+#define IGNITION_RENDERING_BASE_BASERADARSENSOR_HH_
+
+#include <cmath>
+#include <map>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/RadarSensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+
+    template <class T>
+    class BaseRadarSensor :
+      public virtual RadarSensor,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseRadarSensor();
+
+      /// \brief Destructor
+      public: virtual ~BaseRadarSensor();
+
+      // Documentation inherited
+      public: virtual void SetRangeResolution(double _resolution) override;
+
+      // Documentation inherited
+      public: virtual double RangeResolution() const override;
+
+      // Documentation inherited
+      public: virtual void SetAngleResolution(
+          const math::Angle &_resolution) override;
+
+      // Documentation inherited
+      public: virtual math::Angle AngleResolution() const override;
+
+      // Documentation inherited
+      public: virtual void SetClutterRate(double _rate) override;
+
+      // Documentation inherited
+      public: virtual double ClutterRate() const override;
+
+      // Documentation inherited
+      public: virtual void SetLinearVelocity(
+          const math::Vector3d &_velocity) override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d LinearVelocity() const override;
+
+      // Documentation inherited
+      public: virtual void SetVisualVelocity(unsigned int _visualId,
+          const math::Vector3d &_velocity) override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d VisualVelocity(
+          unsigned int _visualId) const override;
+
+      // Documentation inherited
+      public: virtual void ClearVisualVelocities() override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewDetections(
+          std::function<void(const RadarDetection *, unsigned int)>
+          _subscriber) override;
+
+      /// \brief Size of a resolution cell along the range
+      protected: double rangeResolution = 0.5;
+
+      /// \brief Size of a resolution cell in azimuth and elevation
+      protected: math::Angle angleResolution = IGN_DTOR(2.0);
+
+      /// \brief Mean number of false detections per frame
+      protected: double clutterRate = 0.0;
+
+      /// \brief Linear velocity of the sensor in the world frame
+      protected: math::Vector3d linearVelocity;
+
+      /// \brief Linear velocities of moving visuals in the world frame,
+      /// indexed by visual id
+      protected: std::map<unsigned int, math::Vector3d> visualVelocities;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseRadarSensor<T>::BaseRadarSensor()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseRadarSensor<T>::~BaseRadarSensor()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRadarSensor<T>::SetRangeResolution(double _resolution)
+    {
+      if (_resolution <= 0.0 || !std::isfinite(_resolution))
+      {
+        ignerr << "Radar range resolution must be a finite value greater "
+               << "than 0. Ignoring resolution of " << _resolution
+               << std::endl;
+        return;
+      }
+      this->rangeResolution = _resolution;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseRadarSensor<T>::RangeResolution() const
+    {
+      return this->rangeResolution;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRadarSensor<T>::SetAngleResolution(
+        const math::Angle &_resolution)
+    {
+      if (_resolution.Radian() <= 0.0 ||
+          !std::isfinite(_resolution.Radian()))
+      {
+        ignerr << "Radar angle resolution must be a finite value greater "
+               << "than 0. Ignoring resolution of " << _resolution
+               << std::endl;
+        return;
+      }
+      this->angleResolution = _resolution;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Angle BaseRadarSensor<T>::AngleResolution() const
+    {
+      return this->angleResolution;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRadarSensor<T>::SetClutterRate(double _rate)
+    {
+      if (_rate < 0.0 || !std::isfinite(_rate))
+      {
+        ignerr << "Radar clutter rate must be a finite value greater than "
+               << "or equal to 0. Ignoring rate of " << _rate << std::endl;
+        return;
+      }
+      this->clutterRate = _rate;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseRadarSensor<T>::ClutterRate() const
+    {
+      return this->clutterRate;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRadarSensor<T>::SetLinearVelocity(
+        const math::Vector3d &_velocity)
+    {
+      this->linearVelocity = _velocity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseRadarSensor<T>::LinearVelocity() const
+    {
+      return this->linearVelocity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRadarSensor<T>::SetVisualVelocity(unsigned int _visualId,
+        const math::Vector3d &_velocity)
+    {
+      this->visualVelocities[_visualId] = _velocity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseRadarSensor<T>::VisualVelocity(
+        unsigned int _visualId) const
+    {
+      auto it = this->visualVelocities.find(_visualId);
+      if (it == this->visualVelocities.end())
+        return math::Vector3d::Zero;
+      return it->second;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRadarSensor<T>::ClearVisualVelocities()
+    {
+      this->visualVelocities.clear();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ignition::common::ConnectionPtr BaseRadarSensor<T>::ConnectNewDetections(
+        std::function<void(const RadarDetection *, unsigned int)>)
+    {
+      return nullptr;
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEREFLECTIONPROBE_HH_
+#define IGNITION_RENDERING_BASE_BASEREFLECTIONPROBE_HH_
+
+#include <chrono>
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ReflectionProbe.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class BaseReflectionProbe BaseReflectionProbe.hh
+    /// ignition/rendering/base/BaseReflectionProbe.hh
+    /// \brief Base reflection probe. Keeps the probe properties and decides
+    /// when the probe needs to be captured.
+    template <class T>
+    class BaseReflectionProbe :
+        public virtual ReflectionProbe,
+        public T
+    {
+      /// \brief Constructor
+      protected: BaseReflectionProbe();
+
+      /// \brief Destructor
+      public: virtual ~BaseReflectionProbe() override;
+
+      // Documentation inherited
+      public: virtual void SetCapturePosition(
+                  const math::Vector3d &_position) override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d CapturePosition() const override;
+
+      // Documentation inherited
+      public: virtual void SetArea(const math::AxisAlignedBox &_area)
+                  override;
+
+      // Documentation inherited
+      public: virtual math::AxisAlignedBox Area() const override;
+
+      // Documentation inherited
+      public: virtual void SetResolution(unsigned int _resolution) override;
+
+      // Documentation inherited
+      public: virtual unsigned int Resolution() const override;
+
+      // Documentation inherited
+      public: virtual void SetNearClipPlane(double _near) override;
+
+      // Documentation inherited
+      public: virtual double NearClipPlane() const override;
+
+      // Documentation inherited
+      public: virtual void SetFarClipPlane(double _far) override;
+
+      // Documentation inherited
+      public: virtual double FarClipPlane() const override;
+
+      // Documentation inherited
+      public: virtual void SetStatic(bool _static) override;
+
+      // Documentation inherited
+      public: virtual bool Static() const override;
+
+      // Documentation inherited
+      public: virtual void SetUpdateRate(double _hz) override;
+
+      // Documentation inherited
+      public: virtual double UpdateRate() const override;
+
+      // Documentation inherited
+      public: virtual void Capture() override;
+
+      // Documentation inherited
+      public: virtual unsigned int CaptureCount() const override;
+
+      /// \brief Check if the probe has to be captured
+      /// \param[in] _time Current scene time
+      /// \return True if the probe has never been captured, a capture was
+      /// requested or the update period of a dynamic probe has elapsed
+      protected: bool NeedsCapture(
+                     const std::chrono::steady_clock::duration &_time) const;
+
+      /// \brief Record that the probe has been captured
+      /// \param[in] _time Current scene time
+      protected: void MarkCaptured(
+                     const std::chrono::steady_clock::duration &_time);
+
+      /// \brief Position that the scene is captured from
+      protected: math::Vector3d capturePosition;
+
+      /// \brief Volume that the probe applies to
+      protected: math::AxisAlignedBox area = math::AxisAlignedBox(
+                     math::Vector3d(-5, -5, -5), math::Vector3d(5, 5, 5));
+
+      /// \brief Size of each cubemap face in pixels
+      protected: unsigned int resolution = 256u;
+
+      /// \brief Near clip distance used when capturing
+      protected: double nearClip = 0.1;
+
+      /// \brief Far clip distance used when capturing
+      protected: double farClip = 500.0;
+
+      /// \brief True if the probe is only captured once
+      protected: bool isStatic = true;
+
+      /// \brief Max update rate of a dynamic probe, 0 for every frame
+      protected: double updateRate = 0.0;
+
+      /// \brief True if a capture was requested
+      protected: bool captureRequested = true;
+
+      /// \brief Number of captures so far
+      protected: unsigned int captureCount = 0u;
+
+      /// \brief Scene time of the last capture
+      protected: std::chrono::steady_clock::duration lastCaptureTime{0};
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseReflectionProbe<T>::BaseReflectionProbe()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseReflectionProbe<T>::~BaseReflectionProbe()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::SetCapturePosition(
+        const math::Vector3d &_position)
+    {
+      if (!_position.IsFinite())
+      {
+        ignerr << "Reflection probe capture position must be finite"
+               << std::endl;
+        return;
+      }
+      this->capturePosition = _position;
+      this->captureRequested = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseReflectionProbe<T>::CapturePosition() const
+    {
+      return this->capturePosition;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::SetArea(const math::AxisAlignedBox &_area)
+    {
+      math::Vector3d size = _area.Size();
+      if (!_area.Min().IsFinite() || !_area.Max().IsFinite() ||
+          size.X() <= 0.0 || size.Y() <= 0.0 || size.Z() <= 0.0)
+      {
+        ignerr << "Reflection probe area must be a finite, non-empty box"
+               << std::endl;
+        return;
+      }
+      this->area = _area;
+      this->captureRequested = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::AxisAlignedBox BaseReflectionProbe<T>::Area() const
+    {
+      return this->area;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::SetResolution(unsigned int _resolution)
+    {
+      if (_resolution == 0u)
+      {
+        ignerr << "Reflection probe resolution must be greater than 0"
+               << std::endl;
+        return;
+      }
+      this->resolution = _resolution;
+      this->captureRequested = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseReflectionProbe<T>::Resolution() const
+    {
+      return this->resolution;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::SetNearClipPlane(double _near)
+    {
+      if (!std::isfinite(_near) || _near <= 0.0 || _near >= this->farClip)
+      {
+        ignerr << "Reflection probe near clip plane must be greater than 0 "
+               << "and less than the far clip plane" << std::endl;
+        return;
+      }
+      this->nearClip = _near;
+      this->captureRequested = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseReflectionProbe<T>::NearClipPlane() const
+    {
+      return this->nearClip;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::SetFarClipPlane(double _far)
+    {
+      if (!std::isfinite(_far) || _far <= this->nearClip)
+      {
+        ignerr << "Reflection probe far clip plane must be greater than "
+               << "the near clip plane" << std::endl;
+        return;
+      }
+      this->farClip = _far;
+      this->captureRequested = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseReflectionProbe<T>::FarClipPlane() const
+    {
+      return this->farClip;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::SetStatic(bool _static)
+    {
+      this->isStatic = _static;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseReflectionProbe<T>::Static() const
+    {
+      return this->isStatic;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::SetUpdateRate(double _hz)
+    {
+      if (!std::isfinite(_hz) || _hz < 0.0)
+      {
+        ignerr << "Reflection probe update rate must not be negative"
+               << std::endl;
+        return;
+      }
+      this->updateRate = _hz;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseReflectionProbe<T>::UpdateRate() const
+    {
+      return this->updateRate;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::Capture()
+    {
+      this->captureRequested = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseReflectionProbe<T>::CaptureCount() const
+    {
+      return this->captureCount;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseReflectionProbe<T>::NeedsCapture(
+        const std::chrono::steady_clock::duration &_time) const
+    {
+      if (this->captureRequested || this->captureCount == 0u)
+        return true;
+      if (this->isStatic)
+        return false;
+      if (this->updateRate <= 0.0)
+        return true;
+
+      // scene time went backwards, e.g. simulation was reset
+      if (_time < this->lastCaptureTime)
+        return true;
+
+      double elapsed = std::chrono::duration<double>(
+          _time - this->lastCaptureTime).count();
+      return elapsed >= 1.0 / this->updateRate;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseReflectionProbe<T>::MarkCaptured(
+        const std::chrono::steady_clock::duration &_time)
+    {
+      this->captureRequested = false;
+      this->lastCaptureTime = _time;
+      ++this->captureCount;
+    }
+    }
+  }
+}
+#endif
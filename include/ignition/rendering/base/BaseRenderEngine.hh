@@ -18,6 +18,7 @@
 #define IGNITION_RENDERING_BASE_BASERENDERENGINE_HH_
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <ignition/common/SuppressWarning.hh>
@@ -97,6 +98,10 @@ namespace ignition
       // Documentation Inherited
       public: virtual RenderPassSystemPtr RenderPassSystem() const override;
 
+      // Documentation inherited.
+      public: virtual std::recursive_mutex &SharedResourceMutex() const
+          override;
+
       protected: virtual void PrepareScene(ScenePtr _scene);
 
       protected: virtual unsigned int NextSceneId();
@@ -131,6 +136,10 @@ namespace ignition
 
       /// \brief Render pass system for this render engine.
       protected: RenderPassSystemPtr renderPassSystem;
+
+      /// \brief Guards the resources shared by all scenes, including the
+      /// scene store
+      protected: mutable std::recursive_mutex sharedResourceMutex;
       IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
     };
     }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEROLLINGSHUTTERPASS_HH_
+#define IGNITION_RENDERING_BASE_BASEROLLINGSHUTTERPASS_HH_
+
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/RollingShutterPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseRollingShutterPass BaseRollingShutterPass.hh \
+     * ignition/rendering/base/BaseRollingShutterPass.hh
+     */
+    /// \brief Base rolling shutter render pass.
+    template <class T>
+    class BaseRollingShutterPass :
+      public virtual RollingShutterPass,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseRollingShutterPass();
+
+      /// \brief Destructor
+      public: virtual ~BaseRollingShutterPass();
+
+      // Documentation inherited.
+      public: void SetReadoutFraction(double _fraction) override;
+
+      // Documentation inherited.
+      public: double ReadoutFraction() const override;
+
+      /// \brief Fraction of the frame time it takes to read out all rows
+      protected: double readoutFraction = 0.5;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseRollingShutterPass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseRollingShutterPass<T>::BaseRollingShutterPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseRollingShutterPass<T>::~BaseRollingShutterPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRollingShutterPass<T>::SetReadoutFraction(double _fraction)
+    {
+      this->readoutFraction = math::clamp(_fraction, 0.0, 1.0);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseRollingShutterPass<T>::ReadoutFraction() const
+    {
+      return this->readoutFraction;
+    }
+    }
+  }
+}
+#endif
@@ -20,6 +20,7 @@
 #include <array>
 #include <set>
 #include <string>
+#include <thread>
 
 #include <ignition/common/Console.hh>
 #include <ignition/common/SuppressWarning.hh>
@@ -303,6 +304,16 @@ namespace ignition
       public: virtual SpotLightPtr CreateSpotLight(unsigned int _id,
                   const std::string &_name) override;
 
+      public: virtual AreaLightPtr CreateAreaLight() override;
+
+      public: virtual AreaLightPtr CreateAreaLight(unsigned int _id) override;
+
+      public: virtual AreaLightPtr CreateAreaLight(const std::string &_name)
+                      override;
+
+      public: virtual AreaLightPtr CreateAreaLight(unsigned int _id,
+                  const std::string &_name) override;
+
       public: virtual CameraPtr CreateCamera() override;
 
       public: virtual CameraPtr CreateCamera(unsigned int _id) override;
@@ -368,6 +379,36 @@ namespace ignition
       public: virtual SegmentationCameraPtr CreateSegmentationCamera(
         const unsigned int _id, const std::string &_name) override;
 
+      // Documentation inherited.
+      public: virtual StereoCameraPtr CreateStereoCamera() override;
+
+      // Documentation inherited.
+      public: virtual StereoCameraPtr CreateStereoCamera(
+        const unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual StereoCameraPtr CreateStereoCamera(
+        const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual StereoCameraPtr CreateStereoCamera(
+        const unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual EventCameraPtr CreateEventCamera() override;
+
+      // Documentation inherited.
+      public: virtual EventCameraPtr CreateEventCamera(
+        const unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual EventCameraPtr CreateEventCamera(
+        const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual EventCameraPtr CreateEventCamera(
+        const unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited.
       public: virtual GpuRaysPtr CreateGpuRays() override;
 
@@ -382,6 +423,36 @@ namespace ignition
       public: virtual GpuRaysPtr CreateGpuRays(const unsigned int _id,
                   const std::string &_name) override;
 
+      // Documentation inherited.
+      public: virtual RadarSensorPtr CreateRadarSensor() override;
+
+      // Documentation inherited.
+      public: virtual RadarSensorPtr CreateRadarSensor(
+                  const unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual RadarSensorPtr CreateRadarSensor(
+                  const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual RadarSensorPtr CreateRadarSensor(
+                  const unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual SonarSensorPtr CreateSonarSensor() override;
+
+      // Documentation inherited.
+      public: virtual SonarSensorPtr CreateSonarSensor(
+                  const unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual SonarSensorPtr CreateSonarSensor(
+                  const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual SonarSensorPtr CreateSonarSensor(
+                  const unsigned int _id, const std::string &_name) override;
+
       public: virtual VisualPtr CreateVisual() override;
 
       public: virtual VisualPtr CreateVisual(unsigned int _id) override;
@@ -531,6 +602,9 @@ namespace ignition
       public: virtual HeightmapPtr CreateHeightmap(
           const HeightmapDescriptor &_desc) override;
 
+      // Documentation inherited.
+      public: virtual WaterSurfacePtr CreateWaterSurface() override;
+
       // Documentation inherited.
       public: virtual WireBoxPtr CreateWireBox() override;
 
@@ -550,6 +624,22 @@ namespace ignition
 
       public: virtual RayQueryPtr CreateRayQuery() override;
 
+      // Documentation inherited.
+      public: virtual ReflectionProbePtr CreateReflectionProbe() override;
+
+      // Documentation inherited.
+      public: virtual ProceduralSkyPtr CreateProceduralSky() override;
+
+      // Documentation inherited.
+      public: virtual ParticipatingMediaPtr CreateParticipatingMedia()
+                  override;
+
+      // Documentation inherited.
+      public: virtual PrecipitationPtr CreatePrecipitation() override;
+
+      // Documentation inherited.
+      public: virtual DecalPtr CreateDecal() override;
+
       // Documentation inherited.
       public: virtual ParticleEmitterPtr CreateParticleEmitter() override;
 
@@ -590,6 +680,19 @@ namespace ignition
       // Documentation inherited.
       public: virtual bool LegacyAutoGpuFlush() const override;
 
+      // Documentation inherited.
+      public: virtual void SetOwnerThread(std::thread::id _thread) override;
+
+      // Documentation inherited.
+      public: virtual std::thread::id OwnerThread() const override;
+
+      /// \brief Check that the calling thread may use the scene, i.e. that
+      /// it is the owner thread and that no other thread holds the shared
+      /// resource mutex of the render-engine. Only enforced in debug builds.
+      /// \param[in] _caller Name of the calling function, used in the
+      /// assertion message
+      protected: void CheckThreadAccess(const char *_caller) const;
+
       protected: virtual unsigned int CreateObjectId();
 
       protected: virtual std::string CreateObjectName(unsigned int _id,
@@ -610,6 +713,20 @@ namespace ignition
       protected: virtual SpotLightPtr CreateSpotLightImpl(unsigned int _id,
                      const std::string &_name) = 0;
 
+      /// \brief Implementation for creating an area light.
+      /// \param[in] _id Unique id.
+      /// \param[in] _name Name of the area light.
+      /// \return Pointer to the created area light.
+      protected: virtual AreaLightPtr CreateAreaLightImpl(unsigned int _id,
+                     const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "AreaLight not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return AreaLightPtr();
+                 }
+
       protected: virtual CameraPtr CreateCameraImpl(unsigned int _id,
                      const std::string &_name) = 0;
 
@@ -661,6 +778,38 @@ namespace ignition
                    return SegmentationCameraPtr();
                  }
 
+      /// \brief Implementation for creating a stereo camera.
+      /// \param[in] _id Unique id
+      /// \param[in] _name Name of stereo camera
+      /// \return Pointer to stereo camera
+      protected: virtual StereoCameraPtr CreateStereoCameraImpl(
+                     unsigned int _id,
+                     const std::string &_name)
+                 {
+                   // The following two lines will avoid doxygen warnings
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "Stereo camera not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return StereoCameraPtr();
+                 }
+
+      /// \brief Implementation for creating a event camera.
+      /// \param[in] _id Unique id
+      /// \param[in] _name Name of event camera
+      /// \return Pointer to event camera
+      protected: virtual EventCameraPtr CreateEventCameraImpl(
+                     unsigned int _id,
+                     const std::string &_name)
+                 {
+                   // The following two lines will avoid doxygen warnings
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "Event camera not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return EventCameraPtr();
+                 }
+
       /// \brief Implementation for creating GpuRays sensor.
       /// \param[in] _id Unique id
       /// \param[in] _name Name of GpuRays sensor
@@ -674,6 +823,36 @@ namespace ignition
                    return GpuRaysPtr();
                  }
 
+      /// \brief Implementation for creating a radar sensor.
+      /// \param[in] _id Unique id
+      /// \param[in] _name Name of radar sensor
+      /// \return Pointer to radar sensor
+      protected: virtual RadarSensorPtr CreateRadarSensorImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   // The following two lines will avoid doxygen warnings
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "Radar sensor not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return RadarSensorPtr();
+                 }
+
+      /// \brief Implementation for creating a sonar sensor.
+      /// \param[in] _id Unique id
+      /// \param[in] _name Name of sonar sensor
+      /// \return Pointer to sonar sensor
+      protected: virtual SonarSensorPtr CreateSonarSensorImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   // The following two lines will avoid doxygen warnings
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "Sonar sensor not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return SonarSensorPtr();
+                 }
+
       protected: virtual VisualPtr CreateVisualImpl(unsigned int _id,
                      const std::string &_name) = 0;
 
@@ -752,6 +931,13 @@ namespace ignition
                      const std::string &_name,
                      const HeightmapDescriptor &_desc) = 0;
 
+      /// \brief Implementation for creating a water surface geometry
+      /// \param[in] _id Unique object id.
+      /// \param[in] _name Unique object name.
+      /// \return Pointer to a water surface geometry.
+      protected: virtual WaterSurfacePtr CreateWaterSurfaceImpl(
+                     unsigned int _id, const std::string &_name);
+
       /// \brief Implementation for creating a wire box geometry
       /// \param[in] _id unique object id.
       /// \param[in] _name unique object name.
@@ -783,6 +969,76 @@ namespace ignition
       protected: virtual RayQueryPtr CreateRayQueryImpl(
                      unsigned int _id, const std::string &_name) = 0;
 
+      /// \brief Implementation for creating a reflection probe.
+      /// \param[in] _id Unique id.
+      /// \param[in] _name Name of the reflection probe.
+      /// \return Pointer to the created reflection probe.
+      protected: virtual ReflectionProbePtr CreateReflectionProbeImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "ReflectionProbe not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return ReflectionProbePtr();
+                 }
+
+      /// \brief Implementation for creating a procedural sky.
+      /// \param[in] _id Unique id.
+      /// \param[in] _name Name of the procedural sky.
+      /// \return Pointer to the created procedural sky.
+      protected: virtual ProceduralSkyPtr CreateProceduralSkyImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "ProceduralSky not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return ProceduralSkyPtr();
+                 }
+
+      /// \brief Implementation for creating participating media.
+      /// \param[in] _id Unique id.
+      /// \param[in] _name Name of the participating media.
+      /// \return Pointer to the created participating media.
+      protected: virtual ParticipatingMediaPtr CreateParticipatingMediaImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "ParticipatingMedia not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return ParticipatingMediaPtr();
+                 }
+
+      /// \brief Implementation for creating a precipitation.
+      /// \param[in] _id Unique id.
+      /// \param[in] _name Name of the precipitation.
+      /// \return Pointer to the created precipitation.
+      protected: virtual PrecipitationPtr CreatePrecipitationImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "Precipitation not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return PrecipitationPtr();
+                 }
+
+      /// \brief Implementation for creating a decal.
+      /// \param[in] _id Unique id.
+      /// \param[in] _name Name of the decal.
+      /// \return Pointer to the created decal.
+      protected: virtual DecalPtr CreateDecalImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   ignerr << "Decal not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return DecalPtr();
+                 }
+
       /// \brief Implementation for creating a ParticleEmitter.
       /// \param[in] _id Unique id.
       /// \param[in] _name Name of ParticleEmitter.
@@ -856,6 +1112,9 @@ namespace ignition
 
       private: unsigned int nextObjectId;
 
+      /// \brief Thread that owns the scene
+      private: std::thread::id ownerThread;
+
       IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
       private: NodeStorePtr nodes;
       IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASESHADERPASS_HH_
+#define IGNITION_RENDERING_BASE_BASESHADERPASS_HH_
+
+#include <memory>
+#include <string>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+
+#include "ignition/rendering/ShaderParams.hh"
+#include "ignition/rendering/ShaderPass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseShaderPass BaseShaderPass.hh \
+     * ignition/rendering/base/BaseShaderPass.hh
+     */
+    /// \brief Base user shader render pass.
+    template <class T>
+    class BaseShaderPass :
+      public virtual ShaderPass,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseShaderPass();
+
+      /// \brief Destructor
+      public: virtual ~BaseShaderPass();
+
+      // Documentation inherited.
+      public: void SetFragmentShader(const std::string &_path) override;
+
+      // Documentation inherited.
+      public: std::string FragmentShader() const override;
+
+      // Documentation inherited.
+      public: ShaderParamsPtr FragmentShaderParams() override;
+
+      // Documentation inherited.
+      public: void SetDepthInputEnabled(bool _enabled) override;
+
+      // Documentation inherited.
+      public: bool DepthInputEnabled() const override;
+
+      /// \brief Path to the fragment shader
+      protected: std::string fragmentShaderPath;
+
+      /// \brief Fragment shader parameters
+      protected: ShaderParamsPtr fragmentShaderParams;
+
+      /// \brief True if the depth texture is provided to the shader
+      protected: bool depthInputEnabled = false;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseShaderPass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseShaderPass<T>::BaseShaderPass()
+      : fragmentShaderParams(std::make_shared<ShaderParams>())
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseShaderPass<T>::~BaseShaderPass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseShaderPass<T>::SetFragmentShader(const std::string &_path)
+    {
+      if (!common::exists(_path))
+      {
+        ignerr << "Fragment shader path does not exist: " << _path
+               << std::endl;
+        return;
+      }
+      this->fragmentShaderPath = _path;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseShaderPass<T>::FragmentShader() const
+    {
+      return this->fragmentShaderPath;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ShaderParamsPtr BaseShaderPass<T>::FragmentShaderParams()
+    {
+      return this->fragmentShaderParams;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseShaderPass<T>::SetDepthInputEnabled(bool _enabled)
+    {
+      this->depthInputEnabled = _enabled;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseShaderPass<T>::DepthInputEnabled() const
+    {
+      return this->depthInputEnabled;
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASESONARSENSOR_HH_
+#define IGNITION_RENDERING_BASE_BASESONARSENSOR_HH_
+
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/base/BaseCamera.hh"
+#include "ignition/rendering/SonarSensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+
+    template <class T>
+    class BaseSonarSensor :
+      public virtual SonarSensor,
+      public virtual BaseCamera<T>,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseSonarSensor();
+
+      /// \brief Destructor
+      public: virtual ~BaseSonarSensor();
+
+      // Documentation inherited
+      public: virtual void SetBeamCount(unsigned int _count) override;
+
+      // Documentation inherited
+      public: virtual unsigned int BeamCount() const override;
+
+      // Documentation inherited
+      public: virtual void SetRangeBinCount(unsigned int _count) override;
+
+      // Documentation inherited
+      public: virtual unsigned int RangeBinCount() const override;
+
+      // Documentation inherited
+      public: virtual void SetVerticalFOV(const math::Angle &_fov) override;
+
+      // Documentation inherited
+      public: virtual math::Angle VerticalFOV() const override;
+
+      // Documentation inherited
+      public: virtual void SetBeamWidth(const math::Angle &_width) override;
+
+      // Documentation inherited
+      public: virtual math::Angle BeamWidth() const override;
+
+      // Documentation inherited
+      public: virtual void SetAttenuation(double _attenuation) override;
+
+      // Documentation inherited
+      public: virtual double Attenuation() const override;
+
+      // Documentation inherited
+      public: virtual void SetSpeckleNoise(double _speckle) override;
+
+      // Documentation inherited
+      public: virtual double SpeckleNoise() const override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewSonarFrame(
+          std::function<void(const float *, unsigned int, unsigned int)>
+          _subscriber) override;
+
+      /// \brief Number of beams
+      protected: unsigned int beamCount = 256u;
+
+      /// \brief Number of range bins
+      protected: unsigned int rangeBinCount = 512u;
+
+      /// \brief Vertical aperture
+      protected: math::Angle verticalFov = IGN_DTOR(20.0);
+
+      /// \brief Horizontal beam width
+      protected: math::Angle beamWidth = IGN_DTOR(1.0);
+
+      /// \brief Absorption of the water in dB/m
+      protected: double attenuation = 0.0;
+
+      /// \brief Amount of speckle noise
+      protected: double speckleNoise = 0.0;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseSonarSensor<T>::BaseSonarSensor()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseSonarSensor<T>::~BaseSonarSensor()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSonarSensor<T>::SetBeamCount(unsigned int _count)
+    {
+      if (_count == 0u)
+      {
+        ignerr << "Sonar beam count must be greater than 0" << std::endl;
+        return;
+      }
+      this->beamCount = _count;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseSonarSensor<T>::BeamCount() const
+    {
+      return this->beamCount;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSonarSensor<T>::SetRangeBinCount(unsigned int _count)
+    {
+      if (_count == 0u)
+      {
+        ignerr << "Sonar range bin count must be greater than 0"
+               << std::endl;
+        return;
+      }
+      this->rangeBinCount = _count;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseSonarSensor<T>::RangeBinCount() const
+    {
+      return this->rangeBinCount;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSonarSensor<T>::SetVerticalFOV(const math::Angle &_fov)
+    {
+      if (!(_fov.Radian() > 0.0 && _fov.Radian() < IGN_PI))
+      {
+        ignerr << "Sonar vertical aperture must be in the range of "
+               << "(0, pi). Ignoring aperture of " << _fov << std::endl;
+        return;
+      }
+      this->verticalFov = _fov;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Angle BaseSonarSensor<T>::VerticalFOV() const
+    {
+      return this->verticalFov;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSonarSensor<T>::SetBeamWidth(const math::Angle &_width)
+    {
+      if (_width.Radian() <= 0.0 || !std::isfinite(_width.Radian()))
+      {
+        ignerr << "Sonar beam width must be a finite value greater than 0. "
+               << "Ignoring width of " << _width << std::endl;
+        return;
+      }
+      this->beamWidth = _width;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Angle BaseSonarSensor<T>::BeamWidth() const
+    {
+      return this->beamWidth;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSonarSensor<T>::SetAttenuation(double _attenuation)
+    {
+      if (_attenuation < 0.0 || !std::isfinite(_attenuation))
+      {
+        ignerr << "Sonar attenuation must be a finite value greater than "
+               << "or equal to 0. Ignoring attenuation of " << _attenuation
+               << std::endl;
+        return;
+      }
+      this->attenuation = _attenuation;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseSonarSensor<T>::Attenuation() const
+    {
+      return this->attenuation;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSonarSensor<T>::SetSpeckleNoise(double _speckle)
+    {
+      if (!(_speckle >= 0.0 && _speckle <= 1.0))
+      {
+        ignerr << "Sonar speckle noise must be in the range of [0, 1]. "
+               << "Ignoring speckle noise of " << _speckle << std::endl;
+        return;
+      }
+      this->speckleNoise = _speckle;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseSonarSensor<T>::SpeckleNoise() const
+    {
+      return this->speckleNoise;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ignition::common::ConnectionPtr BaseSonarSensor<T>::ConnectNewSonarFrame(
+        std::function<void(const float *, unsigned int, unsigned int)>)
+    {
+      return nullptr;
+    }
+    }
+  }
+}
+#endif
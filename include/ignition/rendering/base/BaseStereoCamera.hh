@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASESTEREOCAMERA_HH_
+#define IGNITION_RENDERING_BASE_BASESTEREOCAMERA_HH_
+
+#include <cmath>
+#include <string>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+
+#include "ignition/rendering/base/BaseCamera.hh"
+#include "ignition/rendering/StereoCamera.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+
+    template <class T>
+    class BaseStereoCamera :
+      public virtual StereoCamera,
+      public virtual BaseCamera<T>,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseStereoCamera();
+
+      /// \brief Destructor
+      public: virtual ~BaseStereoCamera();
+
+      // Documentation inherited
+      public: virtual void SetBaseline(double _baseline) override;
+
+      // Documentation inherited
+      public: virtual double Baseline() const override;
+
+      // Documentation inherited
+      public: virtual void SetDisparityEnabled(bool _enable) override;
+
+      // Documentation inherited
+      public: virtual bool DisparityEnabled() const override;
+
+      // Documentation inherited
+      public: virtual double FocalLength() const override;
+
+      // Documentation inherited
+      public: virtual const float *DisparityData() const override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewStereoFrame(
+          std::function<void(const unsigned char *, const unsigned char *,
+          unsigned int, unsigned int, unsigned int,
+          const std::string &)> _subscriber) override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewDisparityFrame(
+          std::function<void(const float *, unsigned int, unsigned int,
+          unsigned int, const std::string &)> _subscriber) override;
+
+      /// \brief Distance between the left and right eyes in meters
+      protected: double baseline = 0.12;
+
+      /// \brief True if the disparity map is computed
+      protected: bool disparityEnabled = false;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseStereoCamera<T>::BaseStereoCamera()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseStereoCamera<T>::~BaseStereoCamera()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseStereoCamera<T>::SetBaseline(double _baseline)
+    {
+      if (_baseline < 0.0 || !std::isfinite(_baseline))
+      {
+        ignerr << "Stereo camera baseline must be a finite value greater "
+               << "than or equal to 0. Ignoring baseline of " << _baseline
+               << std::endl;
+        return;
+      }
+      this->baseline = _baseline;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseStereoCamera<T>::Baseline() const
+    {
+      return this->baseline;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseStereoCamera<T>::SetDisparityEnabled(bool _enable)
+    {
+      this->disparityEnabled = _enable;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseStereoCamera<T>::DisparityEnabled() const
+    {
+      return this->disparityEnabled;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseStereoCamera<T>::FocalLength() const
+    {
+      return this->ImageWidth() / (2.0 * std::tan(this->HFOV().Radian() / 2.0));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    const float *BaseStereoCamera<T>::DisparityData() const
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ignition::common::ConnectionPtr BaseStereoCamera<T>::ConnectNewStereoFrame(
+          std::function<void(const unsigned char *, const unsigned char *,
+          unsigned int, unsigned int, unsigned int, const std::string &)>)
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    ignition::common::ConnectionPtr
+        BaseStereoCamera<T>::ConnectNewDisparityFrame(
+          std::function<void(const float *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>)
+    {
+      return nullptr;
+    }
+    }
+  }
+}
+#endif
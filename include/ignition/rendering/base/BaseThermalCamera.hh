@@ -17,6 +17,7 @@
 #ifndef IGNITION_RENDERING_BASE_BASETHERMALCAMERA_HH_
 #define IGNITION_RENDERING_BASE_BASETHERMALCAMERA_HH_
 
+#include <algorithm>
 #include <string>
 
 #include "ignition/rendering/base/BaseCamera.hh"
@@ -77,6 +78,25 @@ namespace ignition
       // Documentation inherited.
       public: virtual void SetHeatSourceTemperatureRange(float _range) override;
 
+      // Documentation inherited.
+      public: virtual void SetRadiometricModelEnabled(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool RadiometricModelEnabled() const override;
+
+      // Documentation inherited.
+      public: virtual void SetReflectedTemperature(float _temp) override;
+
+      // Documentation inherited.
+      public: virtual float ReflectedTemperature() const override;
+
+      // Documentation inherited.
+      public: virtual void SetAtmosphericExtinctionCoefficient(
+          float _coefficient) override;
+
+      // Documentation inherited.
+      public: virtual float AtmosphericExtinctionCoefficient() const override;
+
       // Documentation inherted.
       public: virtual ignition::common::ConnectionPtr ConnectNewThermalFrame(
           std::function<void(const uint16_t *, unsigned int, unsigned int,
@@ -99,6 +119,19 @@ namespace ignition
 
       /// \brief Range of heat source temperature variation
       protected: float heatSourceTempRange = 0.0f;
+
+      /// \brief True if the radiometric thermal model is enabled
+      protected: bool radiometric = false;
+
+      /// \brief Reflected apparent temperature
+      protected: float reflectedTemp = 0.0f;
+
+      /// \brief True if the reflected apparent temperature has been set.
+      /// Otherwise the ambient temperature is used.
+      protected: bool reflectedTempSet = false;
+
+      /// \brief Atmospheric extinction coefficient in 1/meters
+      protected: float extinctionCoeff = 0.0f;
     };
 
     //////////////////////////////////////////////////
@@ -197,6 +230,52 @@ namespace ignition
       return this->heatSourceTempRange;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseThermalCamera<T>::SetRadiometricModelEnabled(bool _enabled)
+    {
+      this->radiometric = _enabled;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseThermalCamera<T>::RadiometricModelEnabled() const
+    {
+      return this->radiometric;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseThermalCamera<T>::SetReflectedTemperature(float _temp)
+    {
+      this->reflectedTemp = _temp;
+      this->reflectedTempSet = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    float BaseThermalCamera<T>::ReflectedTemperature() const
+    {
+      if (!this->reflectedTempSet)
+        return this->ambient;
+      return this->reflectedTemp;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseThermalCamera<T>::SetAtmosphericExtinctionCoefficient(
+        float _coefficient)
+    {
+      this->extinctionCoeff = std::max(0.0f, _coefficient);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    float BaseThermalCamera<T>::AtmosphericExtinctionCoefficient() const
+    {
+      return this->extinctionCoeff;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     common::ConnectionPtr BaseThermalCamera<T>::ConnectNewThermalFrame(
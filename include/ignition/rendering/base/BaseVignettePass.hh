@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEVIGNETTEPASS_HH_
+#define IGNITION_RENDERING_BASE_BASEVIGNETTEPASS_HH_
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/VignettePass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseVignettePass BaseVignettePass.hh \
+     * ignition/rendering/base/BaseVignettePass.hh
+     */
+    /// \brief Base vignette render pass.
+    template <class T>
+    class BaseVignettePass :
+      public virtual VignettePass,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseVignettePass();
+
+      /// \brief Destructor
+      public: virtual ~BaseVignettePass();
+
+      // Documentation inherited.
+      public: void SetIntensity(double _intensity) override;
+
+      // Documentation inherited.
+      public: double Intensity() const override;
+
+      // Documentation inherited.
+      public: void SetRadius(double _radius) override;
+
+      // Documentation inherited.
+      public: double Radius() const override;
+
+      // Documentation inherited.
+      public: void SetSmoothness(double _smoothness) override;
+
+      // Documentation inherited.
+      public: double Smoothness() const override;
+
+      /// \brief Amount of light lost at the image corners
+      protected: double intensity = 0.5;
+
+      /// \brief Normalized distance at which the image starts to darken
+      protected: double radius = 0.5;
+
+      /// \brief Normalized width of the darkening transition
+      protected: double smoothness = 0.5;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseVignettePass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseVignettePass<T>::BaseVignettePass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseVignettePass<T>::~BaseVignettePass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseVignettePass<T>::SetIntensity(double _intensity)
+    {
+      this->intensity = math::clamp(_intensity, 0.0, 1.0);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseVignettePass<T>::Intensity() const
+    {
+      return this->intensity;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseVignettePass<T>::SetRadius(double _radius)
+    {
+      this->radius = math::clamp(_radius, 0.0, 1.0);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseVignettePass<T>::Radius() const
+    {
+      return this->radius;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseVignettePass<T>::SetSmoothness(double _smoothness)
+    {
+      if (_smoothness <= 0.0)
+      {
+        ignerr << "Vignette smoothness must be positive. Received: "
+               << _smoothness << std::endl;
+        return;
+      }
+      this->smoothness = _smoothness;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseVignettePass<T>::Smoothness() const
+    {
+      return this->smoothness;
+    }
+    }
+  }
+}
+#endif
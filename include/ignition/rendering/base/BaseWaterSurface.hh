@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEWATERSURFACE_HH_
+#define IGNITION_RENDERING_BASE_BASEWATERSURFACE_HH_
+
+#include <algorithm>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Pose3.hh>
+
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+#include "ignition/rendering/WaterSurface.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Base implementation of a water surface geometry
+    template <class T>
+    class BaseWaterSurface :
+      public virtual WaterSurface,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseWaterSurface();
+
+      /// \brief Destructor
+      public: virtual ~BaseWaterSurface();
+
+      // Documentation inherited
+      public: virtual void SetWaves(const GerstnerWaves &_waves) override;
+
+      // Documentation inherited
+      public: virtual const GerstnerWaves &Waves() const override;
+
+      // Documentation inherited
+      public: virtual void SetSize(const math::Vector2d &_size) override;
+
+      // Documentation inherited
+      public: virtual math::Vector2d Size() const override;
+
+      // Documentation inherited
+      public: virtual void SetTime(double _time) override;
+
+      // Documentation inherited
+      public: virtual double Time() const override;
+
+      // Documentation inherited
+      public: virtual void SetLodLevels(unsigned int _levels) override;
+
+      // Documentation inherited
+      public: virtual unsigned int LodLevels() const override;
+
+      // Documentation inherited
+      public: virtual void SetTessellation(unsigned int _cells) override;
+
+      // Documentation inherited
+      public: virtual unsigned int Tessellation() const override;
+
+      // Documentation inherited
+      public: virtual void Heights(const std::vector<math::Vector3d> &_points,
+          double _time, std::vector<double> &_heights) const override;
+
+      // Documentation inherited
+      public: virtual GeometryPtr Clone() const override;
+
+      /// \brief Wave components
+      protected: GerstnerWaves waves;
+
+      /// \brief Size of the water surface
+      protected: math::Vector2d size{100.0, 100.0};
+
+      /// \brief Time used to animate the waves
+      protected: double time = 0.0;
+
+      /// \brief Number of level of detail rings
+      protected: unsigned int lodLevels = 5u;
+
+      /// \brief Number of grid cells along each side of a level of detail
+      protected: unsigned int tessellation = 64u;
+
+      /// \brief Flag to indicate the grid needs to be rebuilt
+      protected: bool gridDirty = true;
+
+      /// \brief Flag to indicate the wave parameters have changed
+      protected: bool wavesDirty = true;
+    };
+
+    /////////////////////////////////////////////////
+    template <class T>
+    BaseWaterSurface<T>::BaseWaterSurface()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    BaseWaterSurface<T>::~BaseWaterSurface()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseWaterSurface<T>::SetWaves(const GerstnerWaves &_waves)
+    {
+      this->waves = _waves;
+      this->wavesDirty = true;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    const GerstnerWaves &BaseWaterSurface<T>::Waves() const
+    {
+      return this->waves;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseWaterSurface<T>::SetSize(const math::Vector2d &_size)
+    {
+      this->size = _size;
+      this->gridDirty = true;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    math::Vector2d BaseWaterSurface<T>::Size() const
+    {
+      return this->size;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseWaterSurface<T>::SetTime(double _time)
+    {
+      this->time = _time;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BaseWaterSurface<T>::Time() const
+    {
+      return this->time;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseWaterSurface<T>::SetLodLevels(unsigned int _levels)
+    {
+      this->lodLevels = std::min(std::max(1u, _levels), 16u);
+      this->gridDirty = true;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseWaterSurface<T>::LodLevels() const
+    {
+      return this->lodLevels;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseWaterSurface<T>::SetTessellation(unsigned int _cells)
+    {
+      // the inner boundary of each level needs to be aligned with the grid
+      // of the next coarser level
+      unsigned int cells = std::max(4u, _cells - _cells % 4u);
+      if (cells != _cells)
+      {
+        ignwarn << "Water surface tessellation must be a multiple of 4. "
+                << "Using [" << cells << "] instead of [" << _cells << "]"
+                << std::endl;
+      }
+      this->tessellation = cells;
+      this->gridDirty = true;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseWaterSurface<T>::Tessellation() const
+    {
+      return this->tessellation;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseWaterSurface<T>::Heights(
+        const std::vector<math::Vector3d> &_points, double _time,
+        std::vector<double> &_heights) const
+    {
+      math::Pose3d pose;
+      VisualPtr parent = this->Parent();
+      if (parent)
+        pose = parent->WorldPose();
+
+      // transform points to the local frame of the water surface. Only yaw
+      // is considered since the surface is assumed to be level.
+      math::Quaterniond yaw(0, 0, pose.Rot().Yaw());
+      std::vector<math::Vector2d> localPoints(_points.size());
+      for (unsigned int i = 0; i < _points.size(); ++i)
+      {
+        math::Vector3d p = yaw.RotateVectorReverse(_points[i] - pose.Pos());
+        localPoints[i].Set(p.X(), p.Y());
+      }
+
+      this->waves.Heights(localPoints, _time, _heights);
+      for (auto &h : _heights)
+        h += pose.Pos().Z();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    GeometryPtr BaseWaterSurface<T>::Clone() const
+    {
+      if (!this->Scene())
+      {
+        ignerr << "Cloning a WaterSurface failed because the water surface to "
+          << "be cloned does not belong to a scene.\n";
+        return nullptr;
+      }
+
+      auto result = this->Scene()->CreateWaterSurface();
+      if (result)
+      {
+        result->SetWaves(this->Waves());
+        result->SetSize(this->Size());
+        result->SetTime(this->Time());
+        result->SetLodLevels(this->LodLevels());
+        result->SetTessellation(this->Tessellation());
+      }
+      return result;
+    }
+    }
+  }
+}
+#endif
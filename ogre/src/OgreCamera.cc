@@ -69,6 +69,10 @@ void OgreCamera::Destroy()
 //////////////////////////////////////////////////
 math::Angle OgreCamera::HFOV() const
 {
+  // wide angle projections may cover more than 180 degrees
+  if (WideAngleProjection::IsWideAngle(this->ProjectionType()))
+    return BaseCamera::HFOV();
+
   double vfov = this->ogreCamera->getFOVy().valueRadians();
   double hFOV = 2.0 * atan(tan(vfov / 2.0) * this->AspectRatio());
   return math::Angle(hFOV);
@@ -77,8 +81,17 @@ math::Angle OgreCamera::HFOV() const
 //////////////////////////////////////////////////
 void OgreCamera::SetHFOV(const math::Angle &_angle)
 {
-  BaseCamera::SetHFOV(_angle);
   double angle = _angle.Radian();
+  // only perspective and orthographic projections are supported, see
+  // SetProjectionType
+  if (angle >= IGN_PI)
+  {
+    ignwarn << "Horizontal field of view must be less than 180 degrees "
+            << "with the ogre render engine. Ignoring "
+            << _angle.Degree() << " degrees." << std::endl;
+    return;
+  }
+  BaseCamera::SetHFOV(_angle);
   double vfov = 2.0 * atan(tan(angle / 2.0) / this->AspectRatio());
   this->ogreCamera->setFOVy(Ogre::Radian(vfov));
 }
@@ -298,6 +311,15 @@ void OgreCamera::SetProjectionMatrix(const math::Matrix4d &_matrix)
 //////////////////////////////////////////////////
 void OgreCamera::SetProjectionType(CameraProjectionType _type)
 {
+  // keep the projection type that is rendered so that Project and the
+  // projection matrix agree with the image
+  if (WideAngleProjection::IsWideAngle(_type))
+  {
+    ignwarn << "Fisheye and panoramic projections are not supported by "
+            << "the ogre render engine. Using a perspective projection."
+            << std::endl;
+    _type = CPT_PERSPECTIVE;
+  }
   BaseCamera::SetProjectionType(_type);
   switch (this->projectionType)
   {
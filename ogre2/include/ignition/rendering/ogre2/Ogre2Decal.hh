@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2DECAL_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2DECAL_HH_
+
+#include <memory>
+#include <string>
+
+#include "ignition/rendering/base/BaseDecal.hh"
+#include "ignition/rendering/ogre2/Ogre2Node.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace Ogre
+{
+  class Decal;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2DecalPrivate;
+
+    /// \class Ogre2Decal Ogre2Decal.hh ignition/rendering/ogre2/Ogre2Decal.hh
+    /// \brief Ogre2.x implementation of the decal class. Each decal wraps
+    /// an Ogre decal, which is shaded by the Forward+ clustered pass of Pbs
+    /// and Terra materials, so the cost of a pixel only depends on the
+    /// decals that overlap it. The textures of all decals are packed into
+    /// texture arrays owned by the scene. Segmentation cameras label the
+    /// visible surfaces inside the box of up to 16 labeled decals, whatever
+    /// the alpha of the diffuse texture.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2Decal :
+      public BaseDecal<Ogre2Node>
+    {
+      /// \brief Constructor
+      protected: Ogre2Decal();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2Decal();
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      // Documentation inherited
+      public: virtual void SetSize(const math::Vector3d &_size) override;
+
+      // Documentation inherited
+      public: virtual void SetDiffuseTexture(const std::string &_texture)
+                  override;
+
+      // Documentation inherited
+      public: virtual void SetNormalTexture(const std::string &_texture)
+                  override;
+
+      // Documentation inherited
+      public: virtual void SetEmissiveTexture(const std::string &_texture)
+                  override;
+
+      // Documentation inherited
+      public: virtual void SetRoughness(double _roughness) override;
+
+      // Documentation inherited
+      public: virtual void SetMetalness(double _metalness) override;
+
+      /// \internal
+      /// \brief Get the ogre decal
+      /// \return Ogre decal, nullptr if the decal has been destroyed
+      public: Ogre::Decal *OgreDecal() const;
+
+      // Documentation inherited
+      protected: virtual void Init() override;
+
+      /// \brief Scale the node that holds the ogre decal to the size of
+      /// the projection box
+      private: void UpdateScale();
+
+      /// \brief Private data pointer
+      private: std::unique_ptr<Ogre2DecalPrivate> dataPtr;
+
+      /// \brief Only the ogre scene can instantiate this class
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
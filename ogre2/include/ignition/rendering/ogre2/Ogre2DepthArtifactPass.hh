@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2DEPTHARTIFACTPASS_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2DEPTHARTIFACTPASS_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseDepthArtifactPass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderPass.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2DepthArtifactPassPrivate;
+
+    /* \class Ogre2DepthArtifactPass Ogre2DepthArtifactPass.hh \
+     * ignition/rendering/ogre2/Ogre2DepthArtifactPass.hh
+     */
+    /// \brief Ogre2 Implementation of a depth artifact render pass. The pass
+    /// only works with depth cameras.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2DepthArtifactPass :
+      public BaseDepthArtifactPass<Ogre2RenderPass>
+    {
+      /// \brief Constructor
+      public: Ogre2DepthArtifactPass();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2DepthArtifactPass();
+
+      // Documentation inherited
+      public: void PreRender() override;
+
+      // Documentation inherited
+      public: void CreateRenderPass() override;
+
+      /// \brief Set the clip planes of the depth camera. The Ogre camera
+      /// clip planes are extended past these by the depth camera so they
+      /// can not be used to check if a point is valid.
+      /// \param[in] _near Near clip plane distance
+      /// \param[in] _far Far clip plane distance
+      public: void SetDepthRange(double _near, double _far);
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<Ogre2DepthArtifactPassPrivate> dataPtr;
+    };
+    }
+  }
+}
+#endif
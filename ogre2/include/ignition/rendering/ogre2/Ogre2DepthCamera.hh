@@ -94,6 +94,12 @@ namespace ignition
           std::function<void(const float *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) override;
 
+      /// \brief Save the last depth image. Depth values are written in
+      /// meters as single channel floating point image, e.g. .pfm
+      /// \param[in] _name Name of the output file
+      /// \return True if the frame was queued to be written
+      public: virtual bool SaveFrame(const std::string &_name) override;
+
       /// \brief Connect a to the new rgb point cloud signal
       /// \param[in] _subscriber Subscriber callback function
       /// \return Pointer to the new Connection. This must be kept in scope
@@ -101,6 +107,27 @@ namespace ignition
           std::function<void(const float *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) override;
 
+      /// \brief Connect to the new surface normals signal. Normals are not
+      /// rendered with wide angle projections.
+      /// \param[in] _subscriber Subscriber callback function
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual ignition::common::ConnectionPtr ConnectNewNormalsFrame(
+          std::function<void(const uint32_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>  _subscriber) override;
+
+      /// \brief Connect to the new material id signal. Material ids are not
+      /// rendered with wide angle projections.
+      /// \param[in] _subscriber Subscriber callback function
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual ignition::common::ConnectionPtr
+          ConnectNewMaterialIdFrame(
+          std::function<void(const uint16_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>  _subscriber) override;
+
+      // Documentation inherited
+      public: virtual std::string MaterialName(unsigned int _id) const
+          override;
+
       /// \brief Implementation of the render call
       public: virtual void Render() override;
 
@@ -141,6 +168,14 @@ namespace ignition
       /// \brief Create the camera.
       protected: void CreateCamera();
 
+      /// \brief Create the texture and compositor workspace used to render
+      /// surface normals and material ids
+      private: void CreateNormalIdTexture();
+
+      /// \brief Destroy the texture and compositor workspace used to render
+      /// surface normals and material ids
+      private: void DestroyNormalIdTexture();
+
       /// \brief Notifies us that the shadow node definition is about to be
       /// updated. This means our compositor workspace must be destroyed
       /// because the shadow node definition it's using will become a
@@ -20,6 +20,7 @@
 
 #include <string>
 #include <memory>
+#include <set>
 
 #include "ignition/rendering/RenderTypes.hh"
 #include "ignition/rendering/base/BaseGpuRays.hh"
@@ -61,7 +62,11 @@ namespace ignition
     /// rays are generated based on the specified vertical and horizontal
     /// min/max angles and no. of samples. Each ray is a direction vector that
     /// is used to sample/lookup the range data stored in the faces of the
-    /// cubemap.
+    /// cubemap. In multi-return mode, each ray samples a block of directions
+    /// covering its beam footprint and the samples are grouped into echoes
+    /// in the shader, so the second pass texture holds one texel per echo.
+    /// In rolling scan mode, the second pass moves each ray to the sensor
+    /// pose at the time of the ray before sampling the cubemap.
     class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2GpuRays :
       public BaseGpuRays<Ogre2Sensor>
     {
@@ -101,6 +106,14 @@ namespace ignition
       // Documentation inherited.
       public: virtual RenderTargetPtr RenderTarget() const override;
 
+      // Documentation inherited.
+      public: virtual unsigned int Channels() const override;
+
+      /// \brief Get the key of the visual user data that is rendered into
+      /// the retro channel of the range data
+      /// \return User data key. Default is "laser_retro"
+      protected: virtual std::string RetroUserDataKey() const;
+
       /// \brief Set the number of samples in the width and height for the
       /// first pass texture.
       /// \param[in] _w Number of samples in the horizontal sweep
@@ -133,10 +146,36 @@ namespace ignition
       /// \brief Update the 2nd pass render target
       private: void UpdateRenderTarget2ndPass();
 
+      /// \brief Destroy the textures, materials and compositors created by
+      /// CreateGpuRaysTextures so that they can be recreated
+      private: void DestroyGpuRaysTextures();
+
       /// \brief Create texture that store cubemap uv coordinates and
       /// cubemap face index data
       private: void CreateSampleTexture();
 
+      /// \brief Compute the cubemap uv coordinates and face index of the
+      /// direction sampled by each texel of the sample texture
+      /// \param[out] _data RGBA float data of the sample texture
+      /// \param[out] _faces Cubemap faces that are sampled
+      private: void ComputeSampleData(float *_data,
+          std::set<unsigned int> &_faces);
+
+      /// \brief Upload data to the sample texture
+      /// \param[in] _data RGBA float data of the sample texture
+      private: void UploadSampleTexture(const float *_data);
+
+      /// \brief Upload a new table of ray directions to the existing sample
+      /// texture.
+      /// \return False if the textures need to be recreated instead, i.e.
+      /// the table size changed or it samples a cubemap face that is not
+      /// rendered.
+      private: bool UpdateSampleTexture();
+
+      /// \brief Update the scan poses used by the 2nd pass shader in
+      /// rolling scan mode
+      private: void UpdateRollingScan();
+
       /// \brief Set up 1st pass material, texture, and compositor
       private: void Setup1stPass();
 
@@ -18,6 +18,7 @@
 #define IGNITION_RENDERING_OGRE2_OGRE2LIGHT_HH_
 
 #include <memory>
+#include <string>
 
 #include "ignition/rendering/base/BaseLight.hh"
 #include "ignition/rendering/ogre2/Ogre2Node.hh"
@@ -210,6 +211,49 @@ namespace ignition
       /// \brief Only an ogre scene can create an ogre spot light
       private: friend class Ogre2Scene;
     };
+
+    /// \brief Ogre 2.x implementation of the area light class. Uses the
+    /// approximate area lights of ogre, which are shaded in the forward
+    /// pass and never cast shadows. Disc shapes and textures are applied
+    /// through the area light mask texture array managed by Ogre2Scene.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2AreaLight :
+      public BaseAreaLight<Ogre2Light>
+    {
+      /// \brief Constructor
+      protected: Ogre2AreaLight();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2AreaLight();
+
+      // Documentation inherited.
+      public: virtual math::Vector3d Direction() const override;
+
+      // Documentation Inherited
+      public: virtual void SetDirection(const math::Vector3d &_dir) override;
+
+      // Documentation Inherited
+      public: virtual void SetShape(AreaLightShape _shape) override;
+
+      // Documentation Inherited
+      public: virtual void SetSize(const math::Vector2d &_size) override;
+
+      // Documentation Inherited
+      public: virtual void SetTexture(const std::string &_texture) override;
+
+      // Documentation Inherited
+      public: virtual bool CastShadows() const override;
+
+      /// \brief Area lights never cast shadows, this function has no
+      /// effect.
+      /// \param[in] _castShadows Ignored
+      public: virtual void SetCastShadows(bool _castShadows) override;
+
+      // Documentation Inherited
+      public: virtual void Destroy() override;
+
+      /// \brief Only an ogre scene can create an ogre area light
+      private: friend class Ogre2Scene;
+    };
     }
   }
 }
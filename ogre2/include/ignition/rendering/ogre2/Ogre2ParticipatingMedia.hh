@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2PARTICIPATINGMEDIA_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2PARTICIPATINGMEDIA_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseParticipatingMedia.hh"
+#include "ignition/rendering/ogre2/Ogre2Object.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace Ogre
+{
+  class Camera;
+  class Pass;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2ParticipatingMediaPrivate;
+
+    /// \class Ogre2ParticipatingMedia Ogre2ParticipatingMedia.hh
+    /// ignition/rendering/ogre2/Ogre2ParticipatingMedia.hh
+    /// \brief Ogre2.x implementation of the participating media class.
+    /// The media are applied on the GPU by the shaders that already
+    /// reconstruct view space positions from depth: a pass added to the
+    /// compositor of each camera, the first pass of GpuRays and the
+    /// thermal camera shader. All of them receive the same uniforms from
+    /// this class.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2ParticipatingMedia :
+      public BaseParticipatingMedia<Ogre2Object>
+    {
+      /// \brief Constructor
+      protected: Ogre2ParticipatingMedia();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2ParticipatingMedia();
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      /// \internal
+      /// \brief Get whether the media have been destroyed
+      /// \return True if the media have been destroyed
+      public: bool IsDestroyed() const;
+
+      /// \internal
+      /// \brief Set the media uniforms of a shader that renders from the
+      /// given camera. Uniforms that the shader does not declare are
+      /// skipped. See participating_media_fs.glsl for their description.
+      /// \param[in] _pass Ogre pass whose fragment program is updated
+      /// \param[in] _camera Camera whose view space the shader works in
+      public: void SetShaderParams(Ogre::Pass *_pass,
+                  const Ogre::Camera *_camera) const;
+
+      /// \internal
+      /// \brief Set the media uniforms of a shader so that it applies no
+      /// media
+      /// \param[in] _pass Ogre pass whose fragment program is updated
+      public: static void ClearShaderParams(Ogre::Pass *_pass);
+
+      /// \brief Private data pointer
+      private: std::unique_ptr<Ogre2ParticipatingMediaPrivate> dataPtr;
+
+      /// \brief Only the ogre scene can instantiate this class
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2PRECIPITATION_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2PRECIPITATION_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BasePrecipitation.hh"
+#include "ignition/rendering/ogre2/Ogre2Object.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace Ogre
+{
+  class Camera;
+  class Pass;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2PrecipitationPrivate;
+
+    /// \class Ogre2Precipitation Ogre2Precipitation.hh
+    /// ignition/rendering/ogre2/Ogre2Precipitation.hh
+    /// \brief Ogre2.x implementation of the precipitation class.
+    /// The particles are generated procedurally by the shaders of each
+    /// sensor, i.e. a pass added to the compositor of each camera and the
+    /// first pass of GpuRays, from the uniforms set by this class. There
+    /// is no particle system in the ogre scene.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2Precipitation :
+      public BasePrecipitation<Ogre2Object>
+    {
+      /// \brief Constructor
+      protected: Ogre2Precipitation();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2Precipitation();
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      /// \internal
+      /// \brief Get whether the precipitation has been destroyed
+      /// \return True if the precipitation has been destroyed
+      public: bool IsDestroyed() const;
+
+      /// \internal
+      /// \brief Set the precipitation uniforms of a shader that renders
+      /// from the given camera. Uniforms that the shader does not declare
+      /// are skipped. See precipitation_fs.glsl for their description.
+      /// \param[in] _pass Ogre pass whose fragment program is updated
+      /// \param[in] _camera Camera whose view space the shader works in
+      public: void SetShaderParams(Ogre::Pass *_pass,
+                  const Ogre::Camera *_camera) const;
+
+      /// \internal
+      /// \brief Set the precipitation uniforms of a shader so that it
+      /// applies no precipitation
+      /// \param[in] _pass Ogre pass whose fragment program is updated
+      public: static void ClearShaderParams(Ogre::Pass *_pass);
+
+      /// \brief Private data pointer
+      private: std::unique_ptr<Ogre2PrecipitationPrivate> dataPtr;
+
+      /// \brief Only the ogre scene can instantiate this class
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2PROCEDURALSKY_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2PROCEDURALSKY_HH_
+
+#include <memory>
+#include <string>
+
+#include "ignition/rendering/base/BaseProceduralSky.hh"
+#include "ignition/rendering/ogre2/Ogre2Object.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2ProceduralSkyPrivate;
+
+    /// \class Ogre2ProceduralSky Ogre2ProceduralSky.hh
+    /// ignition/rendering/ogre2/Ogre2ProceduralSky.hh
+    /// \brief Ogre2.x implementation of the procedural sky class. The sky
+    /// is drawn by a quad pass in the compositor of each camera, after
+    /// opaque objects, using a material shared by all cameras of the
+    /// scene.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2ProceduralSky :
+      public BaseProceduralSky<Ogre2Object>
+    {
+      /// \brief Constructor
+      protected: Ogre2ProceduralSky();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2ProceduralSky();
+
+      // Documentation inherited
+      public: virtual void Init() override;
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      /// \internal
+      /// \brief Update the sky material and, if the sun or the atmosphere
+      /// changed, the sun light and the scene's ambient light. Called by
+      /// the scene before cameras render.
+      /// \return True if the lighting of the scene changed
+      public: bool UpdateForRender();
+
+      /// \internal
+      /// \brief Get the name of the ogre material that renders the sky
+      /// \return Material name
+      public: std::string OgreMaterialName() const;
+
+      /// \brief Private data pointer
+      private: std::unique_ptr<Ogre2ProceduralSkyPrivate> dataPtr;
+
+      /// \brief Only the ogre scene can instantiate this class
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
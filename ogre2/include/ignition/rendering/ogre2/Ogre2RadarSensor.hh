@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2RADARSENSOR_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2RADARSENSOR_HH_
+
+#include <memory>
+#include <string>
+
+#include <ignition/common/Event.hh>
+
+#include "ignition/rendering/base/BaseRadarSensor.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+#include "ignition/rendering/ogre2/Ogre2GpuRays.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class Ogre2RadarSensorPrivate;
+
+    /// \brief Radar sensor built on top of the ogre2 gpu rays. The range
+    /// and radar cross section of each ray are rendered by the gpu rays
+    /// passes, with the radar cross section in place of the laser retro
+    /// value. The rays are then grouped into resolution cells on the CPU
+    /// and only the resulting detection list is published.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2RadarSensor :
+      public BaseRadarSensor<Ogre2GpuRays>
+    {
+      /// \brief Constructor
+      protected: Ogre2RadarSensor();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2RadarSensor();
+
+      // Documentation inherited
+      public: virtual void PostRender() override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewDetections(
+          std::function<void(const RadarDetection *, unsigned int)>
+          _subscriber) override;
+
+      // Documentation inherited
+      protected: virtual std::string RetroUserDataKey() const override;
+
+      /// \brief Group the rays of the last frame into resolution cells and
+      /// add clutter to build the detection list
+      private: void UpdateDetections();
+
+      /// \internal
+      /// \brief Pointer to private data.
+      private: std::unique_ptr<Ogre2RadarSensorPrivate> dataPtr;
+
+      /// \brief Only the scene can create a radar sensor
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
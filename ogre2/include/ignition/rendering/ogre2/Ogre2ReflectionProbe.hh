@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2REFLECTIONPROBE_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2REFLECTIONPROBE_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseReflectionProbe.hh"
+#include "ignition/rendering/ogre2/Ogre2Object.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace Ogre
+{
+  class CubemapProbe;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2ReflectionProbePrivate;
+
+    /// \class Ogre2ReflectionProbe Ogre2ReflectionProbe.hh
+    /// ignition/rendering/ogre2/Ogre2ReflectionProbe.hh
+    /// \brief Ogre2.x implementation of the reflection probe class. Each
+    /// probe wraps a manual Ogre cubemap probe that the scene assigns to
+    /// the Pbs datablocks of nearby objects.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2ReflectionProbe :
+      public BaseReflectionProbe<Ogre2Object>
+    {
+      /// \brief Constructor
+      protected: Ogre2ReflectionProbe();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2ReflectionProbe();
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      /// \internal
+      /// \brief Capture the scene into the cubemap if the probe needs
+      /// to be captured. Called by the scene before cameras render.
+      /// \return True if the scene was captured
+      public: bool UpdateCapture();
+
+      /// \internal
+      /// \brief Get the ogre cubemap probe
+      /// \return Ogre cubemap probe, nullptr if the probe has not been
+      /// captured yet
+      public: Ogre::CubemapProbe *OgreCubemapProbe() const;
+
+      /// \brief Create the ogre cubemap probe or recreate its texture and
+      /// workspace if the resolution or the clip planes changed
+      private: void UpdateOgreProbe();
+
+      /// \brief Private data pointer
+      private: std::unique_ptr<Ogre2ReflectionProbePrivate> dataPtr;
+
+      /// \brief Only the ogre scene can instantiate this class
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
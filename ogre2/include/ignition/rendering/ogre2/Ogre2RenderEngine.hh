@@ -20,6 +20,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <ignition/common/SingletonT.hh>
@@ -125,6 +126,16 @@ namespace ignition
       /// \return The graphics API enum class
       public: rendering::GraphicsAPI GraphicsAPI() const;
 
+      /// \brief Get the thread that scenes must be rendered from. An OpenGL
+      /// context is current on a single thread, so unless the application
+      /// manages the context itself (useCurrentGLContext), OpenGL scenes
+      /// can only be rendered from the thread that loaded the engine.
+      /// Metal has no such restriction.
+      /// \return Id of the thread that loaded the engine, or a default
+      /// constructed id if scenes may be rendered from any thread
+      public: virtual std::thread::id GraphicsContextThread() const
+          override;
+
       /// \brief Create a scene
       /// \param[in] _id Unique scene Id
       /// \param[in] _name Name of scene
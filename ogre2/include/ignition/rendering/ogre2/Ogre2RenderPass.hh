@@ -24,6 +24,11 @@
 #include "ignition/rendering/ogre2/Export.hh"
 #include "ignition/rendering/ogre2/Ogre2Object.hh"
 
+namespace Ogre
+{
+  class Camera;
+}
+
 namespace ignition
 {
   namespace rendering
@@ -68,9 +73,28 @@ namespace ignition
       /// \brief Create the render pass using ogre compositor
       public: virtual void CreateRenderPass();
 
+      /// \brief Set the camera that renders the image this pass is applied
+      /// to. This is set by the render target before each frame.
+      /// \param[in] _camera Ogre camera
+      public: void SetCamera(Ogre::Camera *_camera);
+
+      /// \brief Get the camera that renders the image this pass is applied
+      /// to.
+      /// \return Ogre camera, or nullptr if not set
+      public: Ogre::Camera *Camera() const;
+
       /// \brief Name of the ogre compositor node definition
       protected: std::string ogreCompositorNodeDefName;
 
+      /// \brief Camera that renders the image this pass is applied to. The
+      /// camera is not owned by the pass. Ogre2RenderTarget::PreRender sets
+      /// it before each frame, so it is only valid while the frame of that
+      /// target is rendered: a pass added to several targets sees the camera
+      /// of the target being rendered, and the camera may be destroyed
+      /// between frames. It is nullptr until the first frame and after the
+      /// pass is destroyed.
+      protected: Ogre::Camera *ogreCamera = nullptr;
+
       /// \brief Pointer to private data class
       private: std::unique_ptr<Ogre2RenderPassPrivate> dataPtr;
     };
@@ -28,14 +28,17 @@ namespace ignition
   {
     inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
     //
+    class Ogre2AreaLight;
     class Ogre2ArrowVisual;
     class Ogre2AxisVisual;
     class Ogre2BoundingBoxCamera;
     class Ogre2Camera;
     class Ogre2Capsule;
     class Ogre2COMVisual;
+    class Ogre2Decal;
     class Ogre2DepthCamera;
     class Ogre2DirectionalLight;
+    class Ogre2EventCamera;
     class Ogre2Geometry;
     class Ogre2GizmoVisual;
     class Ogre2GpuRays;
@@ -52,9 +55,14 @@ namespace ignition
     class Ogre2MeshFactory;
     class Ogre2Node;
     class Ogre2Object;
+    class Ogre2ParticipatingMedia;
     class Ogre2ParticleEmitter;
     class Ogre2PointLight;
+    class Ogre2Precipitation;
+    class Ogre2ProceduralSky;
+    class Ogre2RadarSensor;
     class Ogre2RayQuery;
+    class Ogre2ReflectionProbe;
     class Ogre2RenderEngine;
     class Ogre2RenderTarget;
     class Ogre2RenderTargetMaterial;
@@ -63,10 +71,13 @@ namespace ignition
     class Ogre2Scene;
     class Ogre2SegmentationCamera;
     class Ogre2Sensor;
+    class Ogre2SonarSensor;
     class Ogre2SpotLight;
+    class Ogre2StereoCamera;
     class Ogre2SubMesh;
     class Ogre2ThermalCamera;
     class Ogre2Visual;
+    class Ogre2WaterSurface;
     class Ogre2WireBox;
 
     typedef BaseGeometryStore<Ogre2Geometry>      Ogre2GeometryStore;
@@ -79,14 +90,17 @@ namespace ignition
 
     typedef BaseMaterialMap<Ogre2Material>        Ogre2MaterialMap;
 
+    typedef shared_ptr<Ogre2AreaLight>            Ogre2AreaLightPtr;
     typedef shared_ptr<Ogre2ArrowVisual>          Ogre2ArrowVisualPtr;
     typedef shared_ptr<Ogre2AxisVisual>           Ogre2AxisVisualPtr;
     typedef shared_ptr<Ogre2BoundingBoxCamera>    Ogre2BoundingBoxCameraPtr;
     typedef shared_ptr<Ogre2Camera>               Ogre2CameraPtr;
     typedef shared_ptr<Ogre2Capsule>              Ogre2CapsulePtr;
     typedef shared_ptr<Ogre2COMVisual>            Ogre2COMVisualPtr;
+    typedef shared_ptr<Ogre2Decal>                Ogre2DecalPtr;
     typedef shared_ptr<Ogre2DepthCamera>          Ogre2DepthCameraPtr;
     typedef shared_ptr<Ogre2DirectionalLight>     Ogre2DirectionalLightPtr;
+    typedef shared_ptr<Ogre2EventCamera>          Ogre2EventCameraPtr;
     typedef shared_ptr<Ogre2Geometry>             Ogre2GeometryPtr;
     typedef shared_ptr<Ogre2GizmoVisual>          Ogre2GizmoVisualPtr;
     typedef shared_ptr<Ogre2GpuRays>              Ogre2GpuRaysPtr;
@@ -103,9 +117,14 @@ namespace ignition
     typedef shared_ptr<Ogre2MeshFactory>          Ogre2MeshFactoryPtr;
     typedef shared_ptr<Ogre2Node>                 Ogre2NodePtr;
     typedef shared_ptr<Ogre2Object>               Ogre2ObjectPtr;
+    typedef shared_ptr<Ogre2ParticipatingMedia>   Ogre2ParticipatingMediaPtr;
     typedef shared_ptr<Ogre2ParticleEmitter>      Ogre2ParticleEmitterPtr;
     typedef shared_ptr<Ogre2PointLight>           Ogre2PointLightPtr;
+    typedef shared_ptr<Ogre2Precipitation>        Ogre2PrecipitationPtr;
+    typedef shared_ptr<Ogre2ProceduralSky>        Ogre2ProceduralSkyPtr;
+    typedef shared_ptr<Ogre2RadarSensor>          Ogre2RadarSensorPtr;
     typedef shared_ptr<Ogre2RayQuery>             Ogre2RayQueryPtr;
+    typedef shared_ptr<Ogre2ReflectionProbe>      Ogre2ReflectionProbePtr;
     typedef shared_ptr<Ogre2RenderEngine>         Ogre2RenderEnginePtr;
     typedef shared_ptr<Ogre2RenderTarget>         Ogre2RenderTargetPtr;
     typedef shared_ptr<Ogre2RenderTexture>        Ogre2RenderTexturePtr;
@@ -114,10 +133,13 @@ namespace ignition
     typedef shared_ptr<Ogre2SegmentationCamera>
       Ogre2SegmentationCameraPtr;
     typedef shared_ptr<Ogre2Sensor>               Ogre2SensorPtr;
+    typedef shared_ptr<Ogre2SonarSensor>          Ogre2SonarSensorPtr;
     typedef shared_ptr<Ogre2SpotLight>            Ogre2SpotLightPtr;
+    typedef shared_ptr<Ogre2StereoCamera>         Ogre2StereoCameraPtr;
     typedef shared_ptr<Ogre2SubMesh>              Ogre2SubMeshPtr;
     typedef shared_ptr<Ogre2ThermalCamera>        Ogre2ThermalCameraPtr;
     typedef shared_ptr<Ogre2Visual>               Ogre2VisualPtr;
+    typedef shared_ptr<Ogre2WaterSurface>         Ogre2WaterSurfacePtr;
     typedef shared_ptr<Ogre2WireBox>              Ogre2WireBoxPtr;
 
     typedef shared_ptr<Ogre2GeometryStore>        Ogre2GeometryStorePtr;
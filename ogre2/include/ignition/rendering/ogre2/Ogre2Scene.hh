@@ -40,6 +40,10 @@
 
 namespace Ogre
 {
+  class Camera;
+  class CubemapProbe;
+  class ParallaxCorrectedCubemap;
+  class Pass;
   class Root;
   class SceneManager;
 }
@@ -109,6 +113,9 @@ namespace ignition
       // Documentation inherited.
       public: virtual bool LegacyAutoGpuFlush() const override;
 
+      // Documentation inherited.
+      public: virtual void SetOwnerThread(std::thread::id _thread) override;
+
       /// \brief Get a pointer to the ogre scene manager
       /// \return Pointer to the ogre scene manager
       public: virtual Ogre::SceneManager *OgreSceneManager() const;
@@ -191,6 +198,18 @@ namespace ignition
       /// \return True if the number of shadow casting lights changed
       /// \sa ShadowsDirty
       public: bool ShadowsDirty() const;
+
+      /// \internal
+      /// \brief Mark the area lights dirty so the area light mask texture
+      /// array is rebuilt before the next frame. This is set when the
+      /// shape or texture of an area light changes.
+      public: void SetAreaLightsDirty();
+
+      /// \internal
+      /// \brief Mark the decals dirty so the decal texture arrays are
+      /// rebuilt before the next frame. This is set when a decal is
+      /// created or destroyed, or when its textures change.
+      public: void SetDecalsDirty();
       /// \endcond
 
       // Documentation inherited
@@ -227,6 +246,10 @@ namespace ignition
       protected: virtual SpotLightPtr CreateSpotLightImpl(unsigned int _id,
                      const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual AreaLightPtr CreateAreaLightImpl(unsigned int _id,
+                     const std::string &_name) override;
+
       // Documentation inherited
       protected: virtual CameraPtr CreateCameraImpl(unsigned int _id,
                      const std::string &_name) override;
@@ -247,10 +270,26 @@ namespace ignition
       protected: virtual SegmentationCameraPtr CreateSegmentationCameraImpl(
                      unsigned int _id, const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual StereoCameraPtr CreateStereoCameraImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited
+      protected: virtual EventCameraPtr CreateEventCameraImpl(
+                     unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited
       protected: virtual GpuRaysPtr CreateGpuRaysImpl(unsigned int _id,
                      const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual RadarSensorPtr CreateRadarSensorImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited
+      protected: virtual SonarSensorPtr CreateSonarSensorImpl(
+                     unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited
       protected: virtual VisualPtr CreateVisualImpl(unsigned int _id,
                      const std::string &_name) override;
@@ -307,6 +346,10 @@ namespace ignition
                    const std::string &_name, const HeightmapDescriptor &_desc)
                    override;
 
+      // Documentation inherited
+      protected: virtual WaterSurfacePtr CreateWaterSurfaceImpl(
+                     unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited
       protected: virtual GridPtr CreateGridImpl(unsigned int _id,
                      const std::string &_name) override;
@@ -345,6 +388,26 @@ namespace ignition
       protected: virtual ParticleEmitterPtr CreateParticleEmitterImpl(
                      unsigned int _id, const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual ReflectionProbePtr CreateReflectionProbeImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited
+      protected: virtual ProceduralSkyPtr CreateProceduralSkyImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited
+      protected: virtual ParticipatingMediaPtr CreateParticipatingMediaImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited
+      protected: virtual PrecipitationPtr CreatePrecipitationImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited
+      protected: virtual DecalPtr CreateDecalImpl(
+                     unsigned int _id, const std::string &_name) override;
+
       /// \brief Helper function to initialize an ogre2 object
       /// \param[in] _object Ogre2 object that will be initialized
       /// \param[in] _id Unique Id to assign to the object
@@ -363,6 +426,98 @@ namespace ignition
       public: const std::vector<std::weak_ptr<Ogre2Heightmap>> &Heightmaps()
           const;
 
+      /// \internal
+      /// \brief Return all decals in the scene
+      public: const std::vector<std::weak_ptr<Ogre2Decal>> &Decals() const;
+
+      /// \internal
+      /// \brief Get the ogre object that owns the cubemap probes of the
+      /// scene's reflection probes. It is created on first use.
+      /// \return Ogre parallax corrected cubemap
+      public: Ogre::ParallaxCorrectedCubemap *OgreParallaxCorrectedCubemap();
+
+      /// \internal
+      /// \brief Stop all materials from using a cubemap probe, e.g.
+      /// before the probe is destroyed
+      /// \param[in] _probe Ogre cubemap probe
+      public: void ClearReflectionProbe(Ogre::CubemapProbe *_probe);
+
+      /// \internal
+      /// \brief Get the name of the workspace definition that reflection
+      /// probes capture the scene with. The definition also renders the
+      /// procedural sky if the scene has one.
+      /// \return Workspace definition name
+      public: std::string ReflectionProbeWorkspaceDefName();
+
+      /// \internal
+      /// \brief Get the name of the ogre material that renders the
+      /// scene's procedural sky
+      /// \return Material name, empty if the scene has no procedural sky
+      public: std::string ProceduralSkyMaterialName() const;
+
+      /// \internal
+      /// \brief Get whether the scene has participating media
+      /// \return True if the scene has participating media
+      public: bool HasParticipatingMedia() const;
+
+      /// \internal
+      /// \brief Set the participating media uniforms of a sensor shader
+      /// that renders from the given camera. The uniforms disable the
+      /// media if the scene has none.
+      /// \param[in] _pass Ogre pass whose fragment program is updated
+      /// \param[in] _camera Camera the shader renders from
+      public: void SetParticipatingMediaParams(Ogre::Pass *_pass,
+                  const Ogre::Camera *_camera) const;
+
+      /// \internal
+      /// \brief Get whether the scene has a precipitation
+      /// \return True if the scene has a precipitation
+      public: bool HasPrecipitation() const;
+
+      /// \internal
+      /// \brief Set the precipitation uniforms of a sensor shader that
+      /// renders from the given camera. The uniforms disable the
+      /// precipitation if the scene has none.
+      /// \param[in] _pass Ogre pass whose fragment program is updated
+      /// \param[in] _camera Camera the shader renders from
+      public: void SetPrecipitationParams(Ogre::Pass *_pass,
+                  const Ogre::Camera *_camera) const;
+
+      /// \brief Create the workspace definition used to capture
+      /// reflection probes if it does not exist yet
+      /// \param[in] _wsDefName Name of the workspace definition
+      /// \param[in] _skyMaterialName Material drawn behind the scene,
+      /// empty to clear to the background color only
+      private: void CreateReflectionProbeWorkspaceDef(
+                  const std::string &_wsDefName,
+                  const std::string &_skyMaterialName);
+
+      /// \brief Update the procedural sky, the lighting it drives and the
+      /// reflection probes that captured it. Done before the scene graph
+      /// is updated for rendering.
+      private: void UpdateProceduralSky();
+
+      /// \brief Capture the reflection probes that need to be captured and
+      /// assign the nearest probe to the Pbs datablocks of each item.
+      /// Done once per frame, before the first camera renders.
+      private: void UpdateReflectionProbes();
+
+      /// \brief Update the area lights before rendering. Rebuilds the area
+      /// light mask texture array if needed and enforces the area light
+      /// budget: ogre only shades a limited number of area lights, so when
+      /// the scene has more, only the brightest ones (intensity times
+      /// emitting area) are made visible and the rest are hidden.
+      private: void UpdateAreaLights();
+
+      /// \brief Rebuild the texture array holding the shape masks and
+      /// textures of the area lights and assign a slice to each light.
+      private: void UpdateAreaLightMasks();
+
+      /// \brief Rebuild the diffuse, normal and emissive texture arrays of
+      /// the decals if they are dirty, and assign a slice of each array to
+      /// each decal.
+      private: void UpdateDecals();
+
       /// \brief Create a compositor shadow node with the same number of shadow
       /// textures as the number of shadow casting lights
       protected: void UpdateShadowNode();
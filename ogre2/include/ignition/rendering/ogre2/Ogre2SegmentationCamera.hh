@@ -72,6 +72,9 @@ namespace ignition
         std::function<void(const uint8_t *, unsigned int, unsigned int,
         unsigned int, const std::string &)>  _subscriber) override;
 
+      // Documentation inherited
+      public: virtual bool SaveFrame(const std::string &_name) override;
+
       // Documentation inherited
       public: virtual void Render() override;
 
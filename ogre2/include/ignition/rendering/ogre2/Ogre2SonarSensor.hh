@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2SONARSENSOR_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2SONARSENSOR_HH_
+
+#ifdef _WIN32
+  // Ensure that Winsock2.h is included before Windows.h, which can get
+  // pulled in by anybody (e.g., Boost).
+  #include <Winsock2.h>
+#endif
+
+#include <memory>
+#include <string>
+
+#include <ignition/common/Event.hh>
+
+#include "ignition/rendering/base/BaseSonarSensor.hh"
+#include "ignition/rendering/ogre2/Ogre2Includes.hh"
+#include "ignition/rendering/ogre2/Ogre2Sensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class Ogre2SonarSensorPrivate;
+
+    /// \brief Imaging sonar that forms its beams on the GPU. A scene pass
+    /// renders the range and backscatter of every pixel, a quad pass
+    /// gathers them into the polar beam x range bin image, and only the
+    /// polar image is read back.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2SonarSensor :
+      public BaseSonarSensor<Ogre2Sensor>
+    {
+      /// \brief Constructor
+      protected: Ogre2SonarSensor();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2SonarSensor();
+
+      // Documentation inherited
+      public: virtual void Init() override;
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      // Documentation inherited
+      public: virtual void PreRender() override;
+
+      // Documentation inherited
+      public: virtual void PostRender() override;
+
+      // Documentation inherited
+      public: virtual void Render() override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewSonarFrame(
+          std::function<void(const float *, unsigned int, unsigned int)>
+          _subscriber) override;
+
+      /// \brief Get a pointer to the render target.
+      /// \return Pointer to the render target
+      protected: virtual RenderTargetPtr RenderTarget() const override;
+
+      /// \brief Create the camera.
+      protected: void CreateCamera();
+
+      /// \brief Create dummy render texture. Needed to satisfy inheritance
+      protected: virtual void CreateRenderTexture();
+
+      /// \brief Create the polar image texture and the compositor workspace
+      /// that renders into it
+      protected: void CreateSonarTexture();
+
+      /// \brief Destroy the texture, material and workspace created by
+      /// CreateSonarTexture
+      private: void DestroySonarTexture();
+
+      /// \brief Set the uniforms of the beam forming material for the next
+      /// frame
+      private: void UpdateSonarMaterial();
+
+      /// \brief Pointer to the ogre camera
+      protected: Ogre::Camera *ogreCamera = nullptr;
+
+      /// \internal
+      /// \brief Pointer to private data.
+      private: std::unique_ptr<Ogre2SonarSensorPrivate> dataPtr;
+
+      /// \brief Make scene our friend so it can create a sonar sensor
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2STEREOCAMERA_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2STEREOCAMERA_HH_
+
+#ifdef _WIN32
+  // Ensure that Winsock2.h is included before Windows.h, which can get
+  // pulled in by anybody (e.g., Boost).
+  #include <Winsock2.h>
+#endif
+
+#include <memory>
+#include <string>
+
+#include <ignition/common/Event.hh>
+
+#include "ignition/rendering/base/BaseStereoCamera.hh"
+#include "ignition/rendering/ogre2/Ogre2Includes.hh"
+#include "ignition/rendering/ogre2/Ogre2Sensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class Ogre2StereoCameraPrivate;
+
+    /// \brief Stereo camera that renders both eyes with a single instanced
+    /// stereo scene pass into a side by side target. Culling and shadow
+    /// maps are computed once for both eyes.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2StereoCamera :
+      public BaseStereoCamera<Ogre2Sensor>
+    {
+      /// \brief Constructor
+      protected: Ogre2StereoCamera();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2StereoCamera();
+
+      // Documentation inherited
+      public: virtual void Init() override;
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      // Documentation inherited
+      public: virtual void PreRender() override;
+
+      // Documentation inherited
+      public: virtual void PostRender() override;
+
+      // Documentation inherited
+      public: virtual void Render() override;
+
+      // Documentation inherited
+      public: virtual void SetDisparityEnabled(bool _enable) override;
+
+      // Documentation inherited
+      public: virtual const float *DisparityData() const override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewStereoFrame(
+          std::function<void(const unsigned char *, const unsigned char *,
+          unsigned int, unsigned int, unsigned int,
+          const std::string &)> _subscriber) override;
+
+      // Documentation inherited
+      public: virtual ignition::common::ConnectionPtr ConnectNewDisparityFrame(
+          std::function<void(const float *, unsigned int, unsigned int,
+          unsigned int, const std::string &)> _subscriber) override;
+
+      // Documentation inherited
+      public: virtual bool SaveFrame(const std::string &_name) override;
+
+      /// \brief Get a pointer to the render target.
+      /// \return Pointer to the render target
+      protected: virtual RenderTargetPtr RenderTarget() const override;
+
+      /// \brief Create the camera and the camera used to cull both eyes.
+      protected: void CreateCamera();
+
+      /// \brief Create dummy render texture. Needed to satisfy inheritance
+      protected: virtual void CreateRenderTexture();
+
+      /// \brief Create the stereo and disparity textures and the
+      /// compositor workspace that renders into them
+      protected: void CreateStereoTexture();
+
+      /// \brief Destroy the textures, material and workspace created by
+      /// CreateStereoTexture
+      private: void DestroyStereoTexture();
+
+      /// \brief Update the eye transforms and projection, and fit the cull
+      /// camera frustum around both eyes
+      private: void UpdateEyes();
+
+      /// \brief Pointer to the ogre camera
+      protected: Ogre::Camera *ogreCamera = nullptr;
+
+      /// \internal
+      /// \brief Pointer to private data.
+      private: std::unique_ptr<Ogre2StereoCameraPrivate> dataPtr;
+
+      /// \brief Make scene our friend so it can create a camera
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
@@ -80,6 +80,12 @@ namespace ignition
           std::function<void(const uint16_t *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) override;
 
+      /// \brief Save the last thermal image. Temperatures are written as
+      /// 16 bit values scaled by the linear resolution, e.g. .png
+      /// \param[in] _name Name of the output file
+      /// \return True if the frame was queued to be written
+      public: virtual bool SaveFrame(const std::string &_name) override;
+
       /// \brief Implementation of the render call
       public: virtual void Render() override;
 
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2VIGNETTEPASS_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2VIGNETTEPASS_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseVignettePass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderPass.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2VignettePassPrivate;
+
+    /* \class Ogre2VignettePass Ogre2VignettePass.hh \
+     * ignition/rendering/ogre2/Ogre2VignettePass.hh
+     */
+    /// \brief Ogre2 Implementation of a vignette render pass.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2VignettePass :
+      public BaseVignettePass<Ogre2RenderPass>
+    {
+      /// \brief Constructor
+      public: Ogre2VignettePass();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2VignettePass();
+
+      // Documentation inherited
+      public: void PreRender() override;
+
+      // Documentation inherited
+      public: void CreateRenderPass() override;
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<Ogre2VignettePassPrivate> dataPtr;
+    };
+    }
+  }
+}
+#endif
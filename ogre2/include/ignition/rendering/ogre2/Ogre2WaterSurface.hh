@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2WATERSURFACE_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2WATERSURFACE_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseWaterSurface.hh"
+#include "ignition/rendering/ogre2/Ogre2Geometry.hh"
+
+namespace Ogre
+{
+  class MovableObject;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+      // Forward declaration
+      class Ogre2WaterSurfacePrivate;
+
+      /// \brief Ogre 2.x implementation of a water surface geometry.
+      /// The surface is rendered with a low level material that displaces a
+      /// camera centered grid in the vertex shader. The material can not be
+      /// replaced by the user.
+      class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2WaterSurface
+        : public BaseWaterSurface<Ogre2Geometry>
+      {
+        /// \brief Constructor
+        protected: Ogre2WaterSurface();
+
+        /// \brief Destructor
+        public: virtual ~Ogre2WaterSurface();
+
+        // Documentation inherited.
+        public: virtual void Init() override;
+
+        // Documentation inherited.
+        public: virtual void Destroy() override;
+
+        // Documentation inherited.
+        public: virtual Ogre::MovableObject *OgreObject() const override;
+
+        // Documentation inherited.
+        public: virtual void PreRender() override;
+
+        // Documentation inherited.
+        public: virtual MaterialPtr Material() const override;
+
+        // Documentation inherited.
+        public: virtual void
+          SetMaterial(MaterialPtr _material, bool _unique) override;
+
+        /// \brief Rebuild the level of detail grid mesh
+        private: void UpdateGrid();
+
+        /// \brief Upload the wave parameters to the vertex shader
+        private: void UpdateWaves();
+
+        /// \brief Water surface should only be created by scene.
+        private: friend class Ogre2Scene;
+
+        /// \brief Private data class
+        private: std::unique_ptr<Ogre2WaterSurfacePrivate> dataPtr;
+      };
+    }
+  }
+}
+#endif
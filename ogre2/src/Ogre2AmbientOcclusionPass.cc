@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/ogre2/Ogre2AmbientOcclusionPass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
+#include <OgreCamera.h>
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data for the Ogre2AmbientOcclusionPass class
+class ignition::rendering::Ogre2AmbientOcclusionPassPrivate
+{
+  /// \brief Material that evaluates the occlusion from depth
+  public: Ogre::Material *occlusionMat = nullptr;
+
+  /// \brief Material that blurs the occlusion and darkens the image
+  public: Ogre::Material *applyMat = nullptr;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2AmbientOcclusionPass::Ogre2AmbientOcclusionPass()
+  : dataPtr(std::make_unique<Ogre2AmbientOcclusionPassPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2AmbientOcclusionPass::~Ogre2AmbientOcclusionPass()
+{
+}
+
+//////////////////////////////////////////////////
+void Ogre2AmbientOcclusionPass::SetHalfResolution(bool _half)
+{
+  if (_half == this->halfResolution)
+    return;
+
+  BaseAmbientOcclusionPass::SetHalfResolution(_half);
+
+  // the resolution of the occlusion texture is part of the node
+  // definition. Clearing its name makes the render target create a new
+  // one and rebuild its compositor chain.
+  this->ogreCompositorNodeDefName.clear();
+}
+
+//////////////////////////////////////////////////
+void Ogre2AmbientOcclusionPass::PreRender()
+{
+  if (!this->dataPtr->occlusionMat || !this->dataPtr->applyMat ||
+      !this->ogreCamera)
+  {
+    return;
+  }
+
+  if (!this->enabled)
+    return;
+
+  // The projection params linearize the depth buffer into view space
+  // depth and the projection scale maps view space positions to the image
+  const Ogre::Matrix4 &proj = this->ogreCamera->getProjectionMatrix();
+  Ogre::Vector2 projectionParams = this->ogreCamera->getProjectionParamsAB();
+  Ogre::Vector2 projectionScale(proj[0][0], proj[1][1]);
+
+  // These parameters are declared in
+  // media/materials/scripts/camera_effects.material and
+  // media/materials/programs/GLSL/ambient_occlusion_fs.glsl
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      this->dataPtr->occlusionMat->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+  psParams->setNamedConstant("projectionParams", projectionParams);
+  psParams->setNamedConstant("projectionScale", projectionScale);
+  psParams->setNamedConstant("radius",
+      static_cast<Ogre::Real>(this->radius));
+  psParams->setNamedConstant("sampleCount",
+      static_cast<int>(this->sampleCount));
+  psParams->setNamedConstant("intensity",
+      static_cast<Ogre::Real>(this->intensity));
+
+  // media/materials/programs/GLSL/ambient_occlusion_apply_fs.glsl
+  psParams = this->dataPtr->applyMat->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+  psParams->setNamedConstant("projectionParams", projectionParams);
+}
+
+//////////////////////////////////////////////////
+void Ogre2AmbientOcclusionPass::CreateRenderPass()
+{
+  // the node definition only needs to be created once per resolution
+  if (!this->ogreCompositorNodeDefName.empty())
+    return;
+
+  static int ambientOcclusionNodeCounter = 0;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  std::string nodeDefName = "AmbientOcclusionNode_"
+      + std::to_string(ambientOcclusionNodeCounter);
+
+  if (ogreCompMgr->hasNodeDefinition(nodeDefName))
+    return;
+
+  // The materials are defined in script (camera_effects.material).
+  // clone the materials. They are kept when the node definition is
+  // recreated for a different resolution.
+  if (!this->dataPtr->occlusionMat)
+  {
+    Ogre::Material *mats[2] = {nullptr, nullptr};
+    const std::string matNames[2] =
+        {"AmbientOcclusion", "AmbientOcclusionApply"};
+    for (unsigned int i = 0; i < 2u; ++i)
+    {
+      Ogre::MaterialPtr ogreMat =
+          Ogre::MaterialManager::getSingleton().getByName(matNames[i]);
+      if (!ogreMat)
+      {
+        ignerr << "Ambient occlusion material not found: '" << matNames[i]
+               << "'" << std::endl;
+        return;
+      }
+      if (!ogreMat->isLoaded())
+        ogreMat->load();
+      mats[i] = ogreMat->clone(matNames[i] + "_" +
+          std::to_string(ambientOcclusionNodeCounter)).get();
+    }
+    this->dataPtr->occlusionMat = mats[0];
+    this->dataPtr->applyMat = mats[1];
+  }
+
+  // create the compositor node definition
+  //
+  // compositor_node AmbientOcclusionNode
+  // {
+  //   in 0 rt_input
+  //   in 1 rt_output
+  //
+  //   texture rt_depth target_width target_height PFG_D32_FLOAT
+  //   texture rt_ao target_width_scaled 0.5 target_height_scaled 0.5
+  //       PFG_R8_UNORM
+  //
+  //   target rt_depth
+  //   {
+  //     pass render_scene
+  //     {
+  //       load { all clear }
+  //       rq_first 0
+  //       rq_last 2
+  //     }
+  //   }
+  //   target rt_ao
+  //   {
+  //     pass render_quad
+  //     {
+  //       material AmbientOcclusion_0
+  //       input 0 rt_depth
+  //     }
+  //   }
+  //   target rt_output
+  //   {
+  //     pass render_quad
+  //     {
+  //       material AmbientOcclusionApply_0
+  //       input 0 rt_input
+  //       input 1 rt_ao
+  //       input 2 rt_depth
+  //     }
+  //   }
+  //   out 0 rt_output
+  //   out 1 rt_input
+  // }
+  this->ogreCompositorNodeDefName = nodeDefName;
+  ambientOcclusionNodeCounter++;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+
+  // Input texture
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName("rt_output", 1,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  // the depth of opaque objects. The depth buffer of the base scene pass
+  // can not be sampled by later nodes, so the opaque render queues are
+  // rendered again without shading.
+  std::string depthTexName = "rt_depth";
+  Ogre::TextureDefinitionBase::TextureDefinition *depthTexDef =
+      nodeDef->addTextureDefinition(depthTexName);
+  depthTexDef->textureType = Ogre::TextureTypes::Type2D;
+  depthTexDef->width = 0;
+  depthTexDef->height = 0;
+  depthTexDef->widthFactor = 1;
+  depthTexDef->heightFactor = 1;
+  depthTexDef->format = Ogre::PFG_D32_FLOAT;
+  depthTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+  depthTexDef->depthBufferFormat = Ogre::PFG_UNKNOWN;
+  Ogre::RenderTargetViewDef *rtvDepth =
+      nodeDef->addRenderTextureView(depthTexName);
+  rtvDepth->setForTextureDefinition(depthTexName, depthTexDef);
+
+  // the occlusion, 1 for unoccluded pixels
+  float factor = this->halfResolution ? 0.5f : 1.0f;
+  std::string aoTexName = "rt_ao";
+  Ogre::TextureDefinitionBase::TextureDefinition *aoTexDef =
+      nodeDef->addTextureDefinition(aoTexName);
+  aoTexDef->textureType = Ogre::TextureTypes::Type2D;
+  aoTexDef->width = 0;
+  aoTexDef->height = 0;
+  aoTexDef->widthFactor = factor;
+  aoTexDef->heightFactor = factor;
+  aoTexDef->format = Ogre::PFG_R8_UNORM;
+  aoTexDef->depthBufferId = Ogre::DepthBuffer::POOL_NO_DEPTH;
+  Ogre::RenderTargetViewDef *rtvAo =
+      nodeDef->addRenderTextureView(aoTexName);
+  rtvAo->setForTextureDefinition(aoTexName, aoTexDef);
+
+  nodeDef->setNumTargetPass(3);
+
+  Ogre::CompositorTargetDef *depthTargetDef =
+      nodeDef->addTargetPass(depthTexName);
+  depthTargetDef->setNumPasses(1);
+  {
+    // scene pass. The visibility mask of the render target is applied by
+    // Ogre2RenderTargetCompositorListener
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        depthTargetDef->addPass(Ogre::PASS_SCENE));
+    passScene->setAllLoadActions(Ogre::LoadAction::Clear);
+    passScene->mIncludeOverlays = false;
+    passScene->mFirstRQ = 0u;
+    passScene->mLastRQ = 2u;
+  }
+
+  Ogre::CompositorTargetDef *aoTargetDef =
+      nodeDef->addTargetPass(aoTexName);
+  aoTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        aoTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->setAllLoadActions(Ogre::LoadAction::DontCare);
+    passQuad->mMaterialName = this->dataPtr->occlusionMat->getName();
+    passQuad->addQuadTextureSource(0, depthTexName);
+  }
+
+  // rt_output target
+  Ogre::CompositorTargetDef *outputTargetDef =
+      nodeDef->addTargetPass("rt_output");
+  outputTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        outputTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = this->dataPtr->applyMat->getName();
+    passQuad->addQuadTextureSource(0, "rt_input");
+    passQuad->addQuadTextureSource(1, aoTexName);
+    passQuad->addQuadTextureSource(2, depthTexName);
+  }
+
+  nodeDef->mapOutputChannel(0, "rt_output");
+  nodeDef->mapOutputChannel(1, "rt_input");
+}
+
+IGN_RENDERING_REGISTER_RENDER_PASS(Ogre2AmbientOcclusionPass,
+    AmbientOcclusionPass)
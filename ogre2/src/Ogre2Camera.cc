@@ -15,6 +15,8 @@
  *
  */
 
+#include <ignition/common/Console.hh>
+
 #include "ignition/rendering/ogre2/Ogre2Camera.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
@@ -22,6 +24,8 @@
 #include "ignition/rendering/ogre2/Ogre2SelectionBuffer.hh"
 #include "ignition/rendering/Utils.hh"
 
+#include "Ogre2WideAngleRenderer.hh"
+
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
@@ -35,6 +39,8 @@
 /// \brief Private data for the Ogre2Camera class
 class ignition::rendering::Ogre2CameraPrivate
 {
+  /// \brief Renders fisheye and panoramic projections
+  public: Ogre2WideAngleRenderer wideAngle;
 };
 
 using namespace ignition;
@@ -58,6 +64,8 @@ void Ogre2Camera::Destroy()
   if (!this->ogreCamera || !this->Scene()->IsInitialized())
     return;
 
+  this->dataPtr->wideAngle.Destroy();
+
   Ogre::SceneManager *ogreSceneManager;
   ogreSceneManager = this->scene->OgreSceneManager();
   if (ogreSceneManager == nullptr)
@@ -74,6 +82,10 @@ void Ogre2Camera::Destroy()
 //////////////////////////////////////////////////
 math::Angle Ogre2Camera::HFOV() const
 {
+  // the ogre camera only renders the cube faces of wide angle projections
+  if (WideAngleProjection::IsWideAngle(this->ProjectionType()))
+    return BaseCamera::HFOV();
+
   double vfov = this->ogreCamera->getFOVy().valueRadians();
   double hFOV = 2.0 * atan(tan(vfov / 2.0) * this->AspectRatio());
   return math::Angle(hFOV);
@@ -84,6 +96,18 @@ void Ogre2Camera::SetHFOV(const math::Angle &_angle)
 {
   BaseCamera::SetHFOV(_angle);
   double angle = _angle.Radian();
+  // wide angle projections may cover more than 180 degrees. The frustum
+  // of perspective projections keeps its last valid field of view
+  if (angle >= IGN_PI)
+  {
+    if (!WideAngleProjection::IsWideAngle(this->ProjectionType()))
+    {
+      ignwarn << "Horizontal field of view of 180 degrees or more is only "
+              << "supported by fisheye and panoramic projections."
+              << std::endl;
+    }
+    return;
+  }
   double vfov = 2.0 * atan(tan(angle / 2.0) / this->AspectRatio());
   this->ogreCamera->setFOVy(Ogre::Radian(vfov));
 }
@@ -147,7 +171,21 @@ void Ogre2Camera::SetMaterial(const MaterialPtr &_material)
 //////////////////////////////////////////////////
 void Ogre2Camera::Render()
 {
-  this->renderTexture->Render();
+  if (!WideAngleProjection::IsWideAngle(this->ProjectionType()))
+  {
+    this->renderTexture->Render();
+    return;
+  }
+
+  this->dataPtr->wideAngle.SetNearestFiltering(false);
+  this->dataPtr->wideAngle.SetRotatePoints(false);
+  this->dataPtr->wideAngle.SetInvalidColor(Ogre::ColourValue::Black);
+  this->dataPtr->wideAngle.Render(this->Name(), this->scene,
+      this->ogreCamera, this->renderTexture->RenderTarget(),
+      this->ProjectionModel(), [this]()
+      {
+        this->renderTexture->Render();
+      });
 }
 
 //////////////////////////////////////////////////
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreCamera.h>
+#include <OgreSceneNode.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+#include "Ogre2CameraMotion.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+void Ogre2CameraMotion::Update(Ogre::Camera *_camera)
+{
+  if (!_camera)
+    return;
+
+  // the derived orientation of the camera may not be updated yet when
+  // render passes are updated, so compute it from its parent node
+  Ogre::Quaternion orientation = _camera->getOrientation();
+  Ogre::SceneNode *node = _camera->getParentSceneNode();
+  if (node)
+    orientation = node->_getDerivedOrientationUpdated() * orientation;
+
+  if (!this->hasPrevOrientation)
+  {
+    this->prevOrientation = orientation;
+    this->hasPrevOrientation = true;
+  }
+
+  // rotation from the view space of the current frame to the view space of
+  // the previous frame
+  Ogre::Quaternion rot = this->prevOrientation.Inverse() * orientation;
+  const Ogre::Matrix4 &proj = _camera->getProjectionMatrix();
+  this->reprojection = proj * Ogre::Matrix4(rot) * proj.inverse();
+
+  this->prevOrientation = orientation;
+}
+
+//////////////////////////////////////////////////
+const Ogre::Matrix4 &Ogre2CameraMotion::Reprojection() const
+{
+  return this->reprojection;
+}
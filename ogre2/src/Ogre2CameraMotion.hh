@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2CAMERAMOTION_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2CAMERAMOTION_HH_
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreMatrix4.h>
+#include <OgreQuaternion.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+#include "ignition/rendering/config.hh"
+
+namespace Ogre
+{
+  class Camera;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Helper class used by render passes that need the image
+    /// motion caused by the camera rotation between two consecutive frames.
+    class Ogre2CameraMotion
+    {
+      /// \brief Update the motion with the current camera orientation.
+      /// Must be called once per frame.
+      /// \param[in] _camera Camera that rendered the current frame
+      public: void Update(Ogre::Camera *_camera);
+
+      /// \brief Get the matrix that maps a position in clip space of the
+      /// current frame to the clip space of the previous frame, assuming
+      /// the camera only rotated in between. Since the mapping is then
+      /// independent of the depth, any depth can be used in the input.
+      /// \return Reprojection matrix
+      public: const Ogre::Matrix4 &Reprojection() const;
+
+      /// \brief Camera orientation in the previous frame
+      private: Ogre::Quaternion prevOrientation;
+
+      /// \brief True once the previous orientation has been set
+      private: bool hasPrevOrientation = false;
+
+      /// \brief Current to previous clip space reprojection
+      private: Ogre::Matrix4 reprojection = Ogre::Matrix4::IDENTITY;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/ogre2/Ogre2ChromaticAberrationPass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data for the Ogre2ChromaticAberrationPass class
+class ignition::rendering::Ogre2ChromaticAberrationPassPrivate
+{
+  /// \brief Pointer to the chromatic aberration ogre material
+  public: Ogre::Material *chromaticAberrationMat = nullptr;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2ChromaticAberrationPass::Ogre2ChromaticAberrationPass()
+  : dataPtr(std::make_unique<Ogre2ChromaticAberrationPassPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2ChromaticAberrationPass::~Ogre2ChromaticAberrationPass()
+{
+}
+
+//////////////////////////////////////////////////
+void Ogre2ChromaticAberrationPass::PreRender()
+{
+  if (!this->dataPtr->chromaticAberrationMat)
+    return;
+
+  if (!this->enabled)
+    return;
+
+  // These parameters are declared in
+  // media/materials/scripts/camera_effects.material and
+  // media/materials/programs/GLSL/chromatic_aberration_fs.glsl
+  Ogre::Pass *pass =
+      this->dataPtr->chromaticAberrationMat->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+  psParams->setNamedConstant("strength",
+      static_cast<Ogre::Real>(this->strength));
+}
+
+//////////////////////////////////////////////////
+void Ogre2ChromaticAberrationPass::CreateRenderPass()
+{
+  // the node definition only needs to be created once
+  if (!this->ogreCompositorNodeDefName.empty())
+    return;
+
+  static int chromaticAberrationNodeCounter = 0;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  std::string nodeDefName = "ChromaticAberrationNode_"
+      + std::to_string(chromaticAberrationNodeCounter);
+
+  if (ogreCompMgr->hasNodeDefinition(nodeDefName))
+    return;
+
+  // The material is defined in script (camera_effects.material).
+  // clone the material
+  std::string matName = "ChromaticAberration";
+  Ogre::MaterialPtr ogreMat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!ogreMat)
+  {
+    ignerr << "Chromatic aberration material not found: '" << matName << "'"
+           << std::endl;
+    return;
+  }
+  if (!ogreMat->isLoaded())
+    ogreMat->load();
+  std::string materialName = matName + "_" +
+      std::to_string(chromaticAberrationNodeCounter);
+  this->dataPtr->chromaticAberrationMat = ogreMat->clone(materialName).get();
+
+  // create the compositor node definition. See Ogre2GaussianNoisePass for
+  // the equivalent ogre compositor script
+  this->ogreCompositorNodeDefName = nodeDefName;
+  chromaticAberrationNodeCounter++;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+
+  // Input texture
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName("rt_output", 1,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  // rt_output target
+  nodeDef->setNumTargetPass(1);
+  Ogre::CompositorTargetDef *outputTargetDef =
+      nodeDef->addTargetPass("rt_output");
+  outputTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        outputTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = materialName;
+    passQuad->addQuadTextureSource(0, "rt_input");
+  }
+  nodeDef->mapOutputChannel(0, "rt_output");
+  nodeDef->mapOutputChannel(1, "rt_input");
+}
+
+IGN_RENDERING_REGISTER_RENDER_PASS(Ogre2ChromaticAberrationPass,
+    ChromaticAberrationPass)
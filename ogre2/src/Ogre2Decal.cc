@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Decal.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreDecal.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data class for Ogre2Decal
+class ignition::rendering::Ogre2DecalPrivate
+{
+  /// \brief Ogre decal
+  public: Ogre::Decal *ogreDecal = nullptr;
+
+  /// \brief Node holding the ogre decal. Ogre decals project along their
+  /// local Y axis, so the node is rotated to project along the decal's Z
+  /// axis instead, and scaled to the size of the projection box.
+  public: Ogre::SceneNode *decalNode = nullptr;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2Decal::Ogre2Decal()
+    : dataPtr(new Ogre2DecalPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2Decal::~Ogre2Decal()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::Destroy()
+{
+  if (!this->dataPtr->decalNode)
+    return;
+
+  Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
+  if (this->dataPtr->ogreDecal)
+  {
+    ogreSceneManager->destroyDecal(this->dataPtr->ogreDecal);
+    this->dataPtr->ogreDecal = nullptr;
+  }
+  ogreSceneManager->destroySceneNode(this->dataPtr->decalNode);
+  this->dataPtr->decalNode = nullptr;
+
+  // the scene drops decals without an ogre decal
+  this->scene->SetDecalsDirty();
+
+  BaseDecal<Ogre2Node>::Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::Init()
+{
+  Ogre2Node::Init();
+  if (!this->ogreNode)
+    return;
+
+  Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
+  this->dataPtr->decalNode = this->ogreNode->createChildSceneNode();
+  this->dataPtr->decalNode->setOrientation(
+      Ogre::Quaternion(Ogre::Degree(90), Ogre::Vector3::UNIT_X));
+
+  this->dataPtr->ogreDecal = ogreSceneManager->createDecal();
+  this->dataPtr->decalNode->attachObject(this->dataPtr->ogreDecal);
+  this->dataPtr->ogreDecal->setRoughness(
+      static_cast<float>(this->roughness));
+  this->dataPtr->ogreDecal->setMetalness(
+      static_cast<float>(this->metalness));
+
+  this->UpdateScale();
+  this->scene->SetDecalsDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::SetSize(const math::Vector3d &_size)
+{
+  BaseDecal<Ogre2Node>::SetSize(_size);
+  this->UpdateScale();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::SetDiffuseTexture(const std::string &_texture)
+{
+  if (_texture == this->diffuseTexture)
+    return;
+  BaseDecal<Ogre2Node>::SetDiffuseTexture(_texture);
+  this->scene->SetDecalsDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::SetNormalTexture(const std::string &_texture)
+{
+  if (_texture == this->normalTexture)
+    return;
+  BaseDecal<Ogre2Node>::SetNormalTexture(_texture);
+  this->scene->SetDecalsDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::SetEmissiveTexture(const std::string &_texture)
+{
+  if (_texture == this->emissiveTexture)
+    return;
+  BaseDecal<Ogre2Node>::SetEmissiveTexture(_texture);
+  this->scene->SetDecalsDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::SetRoughness(double _roughness)
+{
+  BaseDecal<Ogre2Node>::SetRoughness(_roughness);
+  if (this->dataPtr->ogreDecal)
+  {
+    this->dataPtr->ogreDecal->setRoughness(
+        static_cast<float>(this->roughness));
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::SetMetalness(double _metalness)
+{
+  BaseDecal<Ogre2Node>::SetMetalness(_metalness);
+  if (this->dataPtr->ogreDecal)
+  {
+    this->dataPtr->ogreDecal->setMetalness(
+        static_cast<float>(this->metalness));
+  }
+}
+
+//////////////////////////////////////////////////
+Ogre::Decal *Ogre2Decal::OgreDecal() const
+{
+  return this->dataPtr->ogreDecal;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Decal::UpdateScale()
+{
+  if (!this->dataPtr->decalNode)
+    return;
+
+  // the node is rotated so its Y axis is the decal's Z axis and its Z
+  // axis is the decal's -Y axis
+  this->dataPtr->decalNode->setScale(
+      static_cast<Ogre::Real>(this->size.X()),
+      static_cast<Ogre::Real>(this->size.Z()),
+      static_cast<Ogre::Real>(this->size.Y()));
+}
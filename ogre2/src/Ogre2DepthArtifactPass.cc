@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <string>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Rand.hh>
+
+#include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/ogre2/Ogre2DepthArtifactPass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <OgreCamera.h>
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data for the Ogre2DepthArtifactPass class
+class ignition::rendering::Ogre2DepthArtifactPassPrivate
+{
+  /// \brief Pointer to the depth artifact ogre material
+  public: Ogre::Material *depthArtifactMat = nullptr;
+
+  /// \brief Near clip plane of the depth camera
+  public: double near = 0.0;
+
+  /// \brief Far clip plane of the depth camera
+  public: double far = 1.0;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2DepthArtifactPass::Ogre2DepthArtifactPass()
+  : dataPtr(std::make_unique<Ogre2DepthArtifactPassPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2DepthArtifactPass::~Ogre2DepthArtifactPass()
+{
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthArtifactPass::SetDepthRange(double _near, double _far)
+{
+  this->dataPtr->near = _near;
+  this->dataPtr->far = _far;
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthArtifactPass::PreRender()
+{
+  if (!this->dataPtr->depthArtifactMat || !this->ogreCamera)
+    return;
+
+  if (!this->enabled)
+    return;
+
+  Ogre::Vector3 offsets(ignition::math::Rand::DblUniform(0.0, 1.0),
+                        ignition::math::Rand::DblUniform(0.0, 1.0),
+                        ignition::math::Rand::DblUniform(0.0, 1.0));
+
+  // An incidence angle of 90 degrees disables the check
+  double cosMaxIncidence = std::cos(this->maxIncidenceAngle.Radian());
+  if (this->maxIncidenceAngle.Radian() >= IGN_PI * 0.5)
+    cosMaxIncidence = 0.0;
+
+  // These parameters are declared in
+  // media/materials/scripts/depth_camera.material and
+  // media/materials/programs/GLSL/depth_artifact_fs.glsl
+  Ogre::Pass *pass =
+      this->dataPtr->depthArtifactMat->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+  psParams->setNamedConstant("tanHalfFovY", static_cast<Ogre::Real>(
+      std::tan(this->ogreCamera->getFOVy().valueRadians() * 0.5)));
+  psParams->setNamedConstant("near",
+      static_cast<Ogre::Real>(this->dataPtr->near));
+  psParams->setNamedConstant("far",
+      static_cast<Ogre::Real>(this->dataPtr->far));
+  psParams->setNamedConstant("offsets", offsets);
+  psParams->setNamedConstant("baseline",
+      static_cast<Ogre::Real>(this->projectorBaseline));
+  psParams->setNamedConstant("disparityStep",
+      static_cast<Ogre::Real>(this->disparityQuantization));
+  psParams->setNamedConstant("flyingThreshold",
+      static_cast<Ogre::Real>(this->flyingPixelThreshold));
+  psParams->setNamedConstant("multipathStrength",
+      static_cast<Ogre::Real>(this->multipathStrength));
+  psParams->setNamedConstant("minReflectance",
+      static_cast<Ogre::Real>(this->minReflectance));
+  psParams->setNamedConstant("maxReflectance",
+      static_cast<Ogre::Real>(this->maxReflectance));
+  psParams->setNamedConstant("cosMaxIncidence",
+      static_cast<Ogre::Real>(cosMaxIncidence));
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthArtifactPass::CreateRenderPass()
+{
+  // the node definition only needs to be created once
+  if (!this->ogreCompositorNodeDefName.empty())
+    return;
+
+  static int depthArtifactNodeCounter = 0;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  std::string nodeDefName = "DepthArtifactNode_"
+      + std::to_string(depthArtifactNodeCounter);
+
+  if (ogreCompMgr->hasNodeDefinition(nodeDefName))
+    return;
+
+  // The material is defined in script (depth_camera.material).
+  // clone the material
+  std::string matName = "DepthArtifact";
+  Ogre::MaterialPtr ogreMat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!ogreMat)
+  {
+    ignerr << "Depth artifact material not found: '" << matName << "'"
+           << std::endl;
+    return;
+  }
+  if (!ogreMat->isLoaded())
+    ogreMat->load();
+  std::string materialName = matName + "_" +
+      std::to_string(depthArtifactNodeCounter);
+  this->dataPtr->depthArtifactMat = ogreMat->clone(materialName).get();
+
+  // create the compositor node definition. See Ogre2GaussianNoisePass for
+  // the equivalent ogre compositor script
+  this->ogreCompositorNodeDefName = nodeDefName;
+  depthArtifactNodeCounter++;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+
+  // Input texture
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName("rt_output", 1,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  // rt_output target
+  nodeDef->setNumTargetPass(1);
+  Ogre::CompositorTargetDef *outputTargetDef =
+      nodeDef->addTargetPass("rt_output");
+  outputTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        outputTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->setAllLoadActions(Ogre::LoadAction::Clear);
+
+    passQuad->mMaterialName = materialName;
+    passQuad->addQuadTextureSource(0, "rt_input");
+  }
+  nodeDef->mapOutputChannel(0, "rt_output");
+  nodeDef->mapOutputChannel(1, "rt_input");
+}
+
+IGN_RENDERING_REGISTER_RENDER_PASS(Ogre2DepthArtifactPass, DepthArtifactPass)
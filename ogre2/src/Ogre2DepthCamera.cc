@@ -38,6 +38,7 @@
 #include "ignition/rendering/RenderTypes.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2DepthCamera.hh"
+#include "ignition/rendering/ogre2/Ogre2DepthArtifactPass.hh"
 #include "ignition/rendering/ogre2/Ogre2GaussianNoisePass.hh"
 #include "ignition/rendering/ogre2/Ogre2Includes.hh"
 #include "ignition/rendering/ogre2/Ogre2ParticleEmitter.hh"
@@ -47,7 +48,9 @@
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
 #include "ignition/rendering/ogre2/Ogre2Sensor.hh"
 
+#include "Ogre2NormalIdMaterialSwitcher.hh"
 #include "Ogre2ParticleNoiseListener.hh"
+#include "Ogre2WideAngleRenderer.hh"
 
 namespace ignition
 {
@@ -140,6 +143,43 @@ class ignition::rendering::Ogre2DepthCameraPrivate
               unsigned int, unsigned int, unsigned int,
               const std::string &)> newDepthFrame;
 
+  /// \brief Event used to signal surface normals
+  public: ignition::common::EventT<void(const uint32_t *,
+              unsigned int, unsigned int, unsigned int,
+              const std::string &)> newNormalsFrame;
+
+  /// \brief Event used to signal material ids
+  public: ignition::common::EventT<void(const uint16_t *,
+              unsigned int, unsigned int, unsigned int,
+              const std::string &)> newMaterialIdFrame;
+
+  /// \brief Texture with octahedral-encoded normals in the rg channels and
+  /// material ids in the b channel
+  public: Ogre::TextureGpu *ogreNormalIdTexture = nullptr;
+
+  /// \brief Normal and material id compositor workspace definition
+  public: std::string ogreNormalIdWorkspaceDef;
+
+  /// \brief Normal and material id compositor workspace
+  public: Ogre::CompositorWorkspace *ogreNormalIdWorkspace = nullptr;
+
+  /// \brief Switches item materials while rendering normals and material
+  /// ids. Also keeps track of the material ids.
+  public: std::unique_ptr<Ogre2NormalIdMaterialSwitcher> normalIdSwitcher;
+
+  /// \brief True if normals or material ids are rendered this frame
+  public: bool renderNormalId = false;
+
+  /// \brief True if the user was warned that normals and material ids are
+  /// not rendered with wide angle projections
+  public: bool normalIdWarned = false;
+
+  /// \brief Outgoing normals data, used by newNormalsFrame event.
+  public: uint32_t *normalsImage = nullptr;
+
+  /// \brief Outgoing material id data, used by newMaterialIdFrame event.
+  public: uint16_t *materialIdImage = nullptr;
+
   /// \brief standard deviation of particle noise
   public: double particleStddev = 0.01;
 
@@ -156,6 +196,9 @@ class ignition::rendering::Ogre2DepthCameraPrivate
 
   /// \brief Name of shadow compositor node
   public: const std::string kShadowNodeName = "PbsMaterialsShadowNode";
+
+  /// \brief Renders fisheye and panoramic projections
+  public: Ogre2WideAngleRenderer wideAngle;
 };
 
 using namespace ignition;
@@ -300,9 +343,24 @@ void Ogre2DepthCamera::Destroy()
     this->dataPtr->pointCloudImage = nullptr;
   }
 
+  if (this->dataPtr->normalsImage)
+  {
+    delete [] this->dataPtr->normalsImage;
+    this->dataPtr->normalsImage = nullptr;
+  }
+
+  if (this->dataPtr->materialIdImage)
+  {
+    delete [] this->dataPtr->materialIdImage;
+    this->dataPtr->materialIdImage = nullptr;
+  }
+
   if (!this->ogreCamera)
     return;
 
+  this->dataPtr->wideAngle.Destroy();
+  this->DestroyNormalIdTexture();
+
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
@@ -489,20 +547,23 @@ void Ogre2DepthCamera::CreateDepthTexture()
       static_cast<float>(this->dataPtr->dataMinVal));
 
   // create background material is specified
+  // a procedural sky takes precedence over the skybox cubemap
   MaterialPtr backgroundMaterial = this->Scene()->BackgroundMaterial();
-  bool validBackground = backgroundMaterial &&
+  std::string skyMatName = this->scene->ProceduralSkyMaterialName();
+  bool validSkybox = skyMatName.empty() && backgroundMaterial &&
       !backgroundMaterial->EnvironmentMap().empty();
+  if (validSkybox)
+    skyMatName = this->dataPtr->kSkyboxMaterialName + "_" + this->Name();
+  bool validBackground = !skyMatName.empty();
 
   // let depth camera shader know if there is background material
   // This is needed for manual clipping of color pixel values.
   psParams->setNamedConstant("hasBackground",
       static_cast<int>(validBackground));
 
-  if (validBackground)
+  if (validSkybox)
   {
     Ogre::MaterialManager &matManager = Ogre::MaterialManager::getSingleton();
-    std::string skyMatName = this->dataPtr->kSkyboxMaterialName + "_"
-        + this->Name();
     auto mat = matManager.getByName(skyMatName);
     if (!mat)
     {
@@ -744,8 +805,7 @@ void Ogre2DepthCamera::CreateDepthTexture()
         Ogre::CompositorPassQuadDef *passQuad =
             static_cast<Ogre::CompositorPassQuadDef *>(
             colorTargetDef->addPass(Ogre::PASS_QUAD));
-        passQuad->mMaterialName = this->dataPtr->kSkyboxMaterialName + "_"
-            + this->Name();
+        passQuad->mMaterialName = skyMatName;
         passQuad->mFrustumCorners =
             Ogre::CompositorPassQuadDef::CAMERA_DIRECTION;
       }
@@ -973,35 +1033,77 @@ void Ogre2DepthCamera::CreateWorkspaceInstance()
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::Render()
 {
-  // GL_DEPTH_CLAMP was disabled in later version of ogre2.2
-  // however our shaders rely on clamped values so enable it for this sensor
-  auto engine = Ogre2RenderEngine::Instance();
-  std::string renderSystemName =
-      engine->OgreRoot()->getRenderSystem()->getFriendlyName();
-  bool useGL = renderSystemName.find("OpenGL") != std::string::npos;
+  auto renderFace = [this]()
+  {
+    // GL_DEPTH_CLAMP was disabled in later version of ogre2.2
+    // however our shaders rely on clamped values so enable it for this
+    // sensor
+    auto engine = Ogre2RenderEngine::Instance();
+    std::string renderSystemName =
+        engine->OgreRoot()->getRenderSystem()->getFriendlyName();
+    bool useGL = renderSystemName.find("OpenGL") != std::string::npos;
 #ifndef _WIN32
-  if (useGL)
-    glEnable(GL_DEPTH_CLAMP);
+    if (useGL)
+      glEnable(GL_DEPTH_CLAMP);
 #endif
 
-  this->scene->StartRendering(this->ogreCamera);
+    this->scene->StartRendering(this->ogreCamera);
 
-  // update the compositors
-  this->dataPtr->ogreCompositorWorkspace->_validateFinalTarget();
-  this->dataPtr->ogreCompositorWorkspace->_beginUpdate(false);
-  this->dataPtr->ogreCompositorWorkspace->_update();
-  this->dataPtr->ogreCompositorWorkspace->_endUpdate(false);
+    // update the compositors
+    this->dataPtr->ogreCompositorWorkspace->_validateFinalTarget();
+    this->dataPtr->ogreCompositorWorkspace->_beginUpdate(false);
+    this->dataPtr->ogreCompositorWorkspace->_update();
+    this->dataPtr->ogreCompositorWorkspace->_endUpdate(false);
 
-  Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
-  swappedTargets.reserve(2u);
-  this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
+    Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
+    swappedTargets.reserve(2u);
+    this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
 
-  this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+    this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
 
 #ifndef _WIN32
-  if (useGL)
-    glDisable(GL_DEPTH_CLAMP);
+    if (useGL)
+      glDisable(GL_DEPTH_CLAMP);
 #endif
+  };
+
+  if (!WideAngleProjection::IsWideAngle(this->ProjectionType()))
+  {
+    renderFace();
+
+    // normals and material ids are rendered by the same camera in a
+    // separate scene pass, with the material switcher listening to it
+    if (this->dataPtr->renderNormalId)
+    {
+      this->ogreCamera->addListener(this->dataPtr->normalIdSwitcher.get());
+      this->scene->StartRendering(this->ogreCamera);
+
+      this->dataPtr->ogreNormalIdWorkspace->_validateFinalTarget();
+      this->dataPtr->ogreNormalIdWorkspace->_beginUpdate(false);
+      this->dataPtr->ogreNormalIdWorkspace->_update();
+      this->dataPtr->ogreNormalIdWorkspace->_endUpdate(false);
+
+      Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
+      swappedTargets.reserve(2u);
+      this->dataPtr->ogreNormalIdWorkspace->_swapFinalTarget(swappedTargets);
+
+      this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+      this->ogreCamera->removeListener(
+          this->dataPtr->normalIdSwitcher.get());
+    }
+    return;
+  }
+
+  // points are packed in the rgba channels and have to be rotated from the
+  // frame of each cube face to the camera frame
+  float maxVal = this->dataPtr->dataMaxVal;
+  this->dataPtr->wideAngle.SetNearestFiltering(true);
+  this->dataPtr->wideAngle.SetRotatePoints(true);
+  this->dataPtr->wideAngle.SetInvalidColor(
+      Ogre::ColourValue(maxVal, maxVal, maxVal, 0.0f));
+  this->dataPtr->wideAngle.Render(this->Name(), this->scene,
+      this->ogreCamera, this->dataPtr->ogreDepthTexture[1],
+      this->ProjectionModel(), renderFace);
 }
 
 //////////////////////////////////////////////////
@@ -1013,6 +1115,30 @@ void Ogre2DepthCamera::PreRender()
   if (!this->dataPtr->ogreCompositorWorkspace)
     this->CreateWorkspaceInstance();
 
+  // normals and material ids are only rendered if someone is listening
+  bool normalIdRequested =
+      this->dataPtr->newNormalsFrame.ConnectionCount() > 0u ||
+      this->dataPtr->newMaterialIdFrame.ConnectionCount() > 0u;
+  this->dataPtr->renderNormalId = false;
+  if (normalIdRequested)
+  {
+    if (WideAngleProjection::IsWideAngle(this->ProjectionType()))
+    {
+      if (!this->dataPtr->normalIdWarned)
+      {
+        ignwarn << "Normals and material ids are not supported by depth "
+                << "cameras with wide angle projections" << std::endl;
+        this->dataPtr->normalIdWarned = true;
+      }
+    }
+    else
+    {
+      if (!this->dataPtr->ogreNormalIdTexture)
+        this->CreateNormalIdTexture();
+      this->dataPtr->renderNormalId = true;
+    }
+  }
+
   // update depth camera render passes
   Ogre2RenderTarget::UpdateRenderPassChain(
       this->dataPtr->ogreCompositorWorkspace,
@@ -1025,7 +1151,17 @@ void Ogre2DepthCamera::PreRender()
       false);
 
   for (auto &pass : this->dataPtr->renderPasses)
+  {
+    // the artifact pass needs the clip planes before they are extended
+    auto artifactPass =
+        std::dynamic_pointer_cast<Ogre2DepthArtifactPass>(pass);
+    if (artifactPass)
+    {
+      artifactPass->SetDepthRange(this->NearClipPlane(),
+          this->FarClipPlane());
+    }
     pass->PreRender();
+  }
 
 
   // add the particle noise listener again if worksapce is recreated due to
@@ -1149,6 +1285,44 @@ void Ogre2DepthCamera::PostRender()
     // }
   }
 
+  // normals and material ids
+  if (this->dataPtr->renderNormalId)
+  {
+    Ogre::Image2 normalIdImage;
+    normalIdImage.convertFromTexture(
+        this->dataPtr->ogreNormalIdTexture, 0u, 0u);
+    Ogre::TextureBox normalIdBox = normalIdImage.getData(0);
+    const uint16_t *normalIdData =
+        static_cast<const uint16_t *>(normalIdBox.data);
+
+    if (!this->dataPtr->normalsImage)
+      this->dataPtr->normalsImage = new uint32_t[len];
+    if (!this->dataPtr->materialIdImage)
+      this->dataPtr->materialIdImage = new uint16_t[len];
+
+    // split the rgba16 texture into the compact outputs. The texture box
+    // may not be a contiguous region of a texture
+    for (unsigned int i = 0; i < height; ++i)
+    {
+      const uint16_t *row = normalIdData +
+          i * normalIdBox.bytesPerRow / sizeof(uint16_t);
+      for (unsigned int j = 0; j < width; ++j)
+      {
+        const uint16_t *pixel = row + j * 4u;
+        unsigned int index = i * width + j;
+        this->dataPtr->normalsImage[index] =
+            static_cast<uint32_t>(pixel[0]) |
+            (static_cast<uint32_t>(pixel[1]) << 16);
+        this->dataPtr->materialIdImage[index] = pixel[2];
+      }
+    }
+
+    this->dataPtr->newNormalsFrame(
+        this->dataPtr->normalsImage, width, height, 1, "UINT32");
+    this->dataPtr->newMaterialIdFrame(
+        this->dataPtr->materialIdImage, width, height, 1, "UINT16");
+  }
+
   // Uncomment to debug depth output
   // igndbg << "wxh: " << width << " x " << height << std::endl;
   // for (unsigned int i = 0; i < height; ++i)
@@ -1175,6 +1349,13 @@ ignition::common::ConnectionPtr Ogre2DepthCamera::ConnectNewDepthFrame(
   return this->dataPtr->newDepthFrame.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+bool Ogre2DepthCamera::SaveFrame(const std::string &_name)
+{
+  return FrameEncoder::Instance()->Enqueue(_name, this->dataPtr->depthImage,
+      this->ImageWidth(), this->ImageHeight(), PF_FLOAT32_R);
+}
+
 //////////////////////////////////////////////////
 ignition::common::ConnectionPtr Ogre2DepthCamera::ConnectNewRgbPointCloud(
     std::function<void(const float *, unsigned int, unsigned int,
@@ -1183,6 +1364,143 @@ ignition::common::ConnectionPtr Ogre2DepthCamera::ConnectNewRgbPointCloud(
   return this->dataPtr->newRgbPointCloud.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr Ogre2DepthCamera::ConnectNewNormalsFrame(
+    std::function<void(const uint32_t *, unsigned int, unsigned int,
+      unsigned int, const std::string &)>  _subscriber)
+{
+  return this->dataPtr->newNormalsFrame.Connect(_subscriber);
+}
+
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr Ogre2DepthCamera::ConnectNewMaterialIdFrame(
+    std::function<void(const uint16_t *, unsigned int, unsigned int,
+      unsigned int, const std::string &)>  _subscriber)
+{
+  return this->dataPtr->newMaterialIdFrame.Connect(_subscriber);
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2DepthCamera::MaterialName(unsigned int _id) const
+{
+  if (!this->dataPtr->normalIdSwitcher)
+    return std::string();
+  return this->dataPtr->normalIdSwitcher->MaterialName(_id);
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::CreateNormalIdTexture()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  this->dataPtr->normalIdSwitcher =
+      std::make_unique<Ogre2NormalIdMaterialSwitcher>(this->scene);
+
+  // Programmatically create the compositor node. It is equivalent to the
+  // following:
+  //
+  // compositor_node NormalId
+  // {
+  //   in 0 rt0
+  //
+  //   target rt0
+  //   {
+  //     pass render_scene
+  //     {
+  //       load { all clear }
+  //       clear_colour 0 0 0 0
+  //       visibility_mask 0xFFFFFFFF & ~particles
+  //     }
+  //   }
+  // }
+  std::string wsDefName = "DepthCameraNormalIdWorkspace_" + this->Name();
+  std::string nodeDefName = wsDefName + "/Node";
+  this->dataPtr->ogreNormalIdWorkspaceDef = wsDefName;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+  nodeDef->addTextureSourceName(
+      "rt0", 0u, Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  nodeDef->setNumTargetPass(1u);
+  Ogre::CompositorTargetDef *targetDef = nodeDef->addTargetPass("rt0");
+  targetDef->setNumPasses(1u);
+  {
+    // scene pass
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        targetDef->addPass(Ogre::PASS_SCENE));
+    passScene->setAllLoadActions(Ogre::LoadAction::Clear);
+    passScene->setAllClearColours(Ogre::ColourValue::ZERO);
+    passScene->mVisibilityMask = IGN_VISIBILITY_ALL
+        & ~Ogre2ParticleEmitter::kParticleVisibilityFlags;
+    passScene->mIncludeOverlays = false;
+  }
+
+  Ogre::CompositorWorkspaceDef *workDef =
+      ogreCompMgr->addWorkspaceDefinition(wsDefName);
+  workDef->connectExternal(0, nodeDefName, 0);
+
+  this->dataPtr->ogreNormalIdTexture =
+      textureMgr->createOrRetrieveTexture(this->Name() + "_normalId",
+        Ogre::GpuPageOutStrategy::SaveToSystemRam,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+  this->dataPtr->ogreNormalIdTexture->setResolution(
+      this->ImageWidth(), this->ImageHeight());
+  this->dataPtr->ogreNormalIdTexture->setNumMipmaps(1u);
+  this->dataPtr->ogreNormalIdTexture->setPixelFormat(
+      Ogre::PFG_RGBA16_UNORM);
+  this->dataPtr->ogreNormalIdTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
+
+  Ogre::CompositorChannelVec externalTargets(1u);
+  externalTargets[0] = this->dataPtr->ogreNormalIdTexture;
+  this->dataPtr->ogreNormalIdWorkspace =
+      ogreCompMgr->addWorkspace(
+        this->scene->OgreSceneManager(),
+        externalTargets,
+        this->ogreCamera,
+        wsDefName,
+        false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::DestroyNormalIdTexture()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  if (this->dataPtr->ogreNormalIdWorkspace)
+  {
+    ogreCompMgr->removeWorkspace(this->dataPtr->ogreNormalIdWorkspace);
+    this->dataPtr->ogreNormalIdWorkspace = nullptr;
+  }
+
+  if (!this->dataPtr->ogreNormalIdWorkspaceDef.empty())
+  {
+    ogreCompMgr->removeWorkspaceDefinition(
+        this->dataPtr->ogreNormalIdWorkspaceDef);
+    ogreCompMgr->removeNodeDefinition(
+        this->dataPtr->ogreNormalIdWorkspaceDef + "/Node");
+    this->dataPtr->ogreNormalIdWorkspaceDef.clear();
+  }
+
+  if (this->dataPtr->ogreNormalIdTexture)
+  {
+    ogreRoot->getRenderSystem()->getTextureGpuManager()->destroyTexture(
+        this->dataPtr->ogreNormalIdTexture);
+    this->dataPtr->ogreNormalIdTexture = nullptr;
+  }
+
+  this->dataPtr->normalIdSwitcher.reset();
+}
+
 //////////////////////////////////////////////////
 RenderTargetPtr Ogre2DepthCamera::RenderTarget() const
 {
@@ -1249,6 +1567,16 @@ void Ogre2DepthCamera::SetShadowsNodeDefDirty()
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::AddRenderPass(const RenderPassPtr &_pass)
 {
+  // depth artifact passes already work with the depth camera point data
+  std::shared_ptr<Ogre2DepthArtifactPass> artifactPass =
+      std::dynamic_pointer_cast<Ogre2DepthArtifactPass>(_pass);
+  if (artifactPass)
+  {
+    this->dataPtr->renderPasses.push_back(artifactPass);
+    this->dataPtr->renderPassDirty = true;
+    return;
+  }
+
   // hack: check and only allow gaussian noise for depth cameras
   // We create a new depth gaussion noise render pass object
   // (class declared in this src file) so that we can change the shader material
@@ -1260,8 +1588,8 @@ void Ogre2DepthCamera::AddRenderPass(const RenderPassPtr &_pass)
       std::dynamic_pointer_cast<Ogre2GaussianNoisePass>(_pass);
   if (!pass)
   {
-    ignerr << "Depth camera currently only supports a gaussian noise pass"
-           << std::endl;
+    ignerr << "Depth camera currently only supports a gaussian noise pass "
+           << "and a depth artifact pass" << std::endl;
     return;
   }
 
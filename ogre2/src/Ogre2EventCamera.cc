@@ -0,0 +1,565 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Rand.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Conversions.hh"
+#include "ignition/rendering/ogre2/Ogre2EventCamera.hh"
+#include "ignition/rendering/ogre2/Ogre2Includes.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+#include "ignition/rendering/RenderTypes.hh"
+
+/// \brief Private data for the Ogre2EventCamera class
+class ignition::rendering::Ogre2EventCameraPrivate
+{
+  /// \brief Per pixel events of the last frame. See event_camera_fs.glsl
+  /// for the layout.
+  public: Ogre::TextureGpu *ogreEventTexture = nullptr;
+
+  /// \brief Reference state of each pixel. The state is read from one
+  /// texture and written to the other, and the two are swapped every frame.
+  public: Ogre::TextureGpu *ogreStateTextures[2] = {nullptr, nullptr};
+
+  /// \brief Workspace definition
+  public: std::string ogreCompositorWorkspaceDef;
+
+  /// \brief Compositor node definition
+  public: std::string ogreCompositorNodeDef;
+
+  /// \brief Compositor workspaces. The first one reads the state from
+  /// ogreStateTextures[0] and the second one from ogreStateTextures[1].
+  public: Ogre::CompositorWorkspace *ogreCompositorWorkspaces[2] =
+      {nullptr, nullptr};
+
+  /// \brief Index of the workspace used to render the next frame
+  public: unsigned int workspaceIndex = 0u;
+
+  /// \brief Material that detects the events
+  public: Ogre::MaterialPtr eventMaterial;
+
+  /// \brief Dummy render texture
+  public: RenderTexturePtr eventTexture;
+
+  /// \brief True if the state textures hold a valid reference
+  public: bool initialized = false;
+
+  /// \brief True if the last frame was compared against a valid reference
+  /// and may contain events
+  public: bool hasEvents = false;
+
+  /// \brief Scene time of the previous frame
+  public: std::chrono::steady_clock::duration frameStart =
+      std::chrono::steady_clock::duration::zero();
+
+  /// \brief Scene time of the last frame
+  public: std::chrono::steady_clock::duration frameEnd =
+      std::chrono::steady_clock::duration::zero();
+
+  /// \brief Events sent to listeners
+  public: std::vector<CameraEvent> events;
+
+  /// \brief Event used to signal new events
+  public: ignition::common::EventT<void(const CameraEvent *,
+              unsigned int)> newEvents;
+
+  /// \brief Name of shadow compositor node
+  public: const std::string kShadowNodeName = "PbsMaterialsShadowNode";
+};
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+Ogre2EventCamera::Ogre2EventCamera() :
+  dataPtr(new Ogre2EventCameraPrivate())
+{
+}
+
+/////////////////////////////////////////////////
+Ogre2EventCamera::~Ogre2EventCamera()
+{
+  this->Destroy();
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::Init()
+{
+  BaseCamera::Init();
+
+  this->CreateCamera();
+
+  this->CreateRenderTexture();
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::Destroy()
+{
+  this->dataPtr->events.clear();
+
+  if (!this->ogreCamera)
+    return;
+
+  this->DestroyEventTexture();
+
+  Ogre::SceneManager *ogreSceneManager;
+  ogreSceneManager = this->scene->OgreSceneManager();
+  if (ogreSceneManager == nullptr)
+  {
+    ignerr << "Scene manager cannot be obtained" << std::endl;
+  }
+  else
+  {
+    if (ogreSceneManager->findCameraNoThrow(this->name) != nullptr)
+    {
+      ogreSceneManager->destroyCamera(this->ogreCamera);
+      this->ogreCamera = nullptr;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::DestroyEventTexture()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  auto ogreCompMgr = ogreRoot->getCompositorManager2();
+  auto textureMgr = ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  for (auto &workspace : this->dataPtr->ogreCompositorWorkspaces)
+  {
+    if (workspace)
+    {
+      ogreCompMgr->removeWorkspace(workspace);
+      workspace = nullptr;
+    }
+  }
+
+  if (!this->dataPtr->ogreCompositorWorkspaceDef.empty())
+  {
+    ogreCompMgr->removeWorkspaceDefinition(
+        this->dataPtr->ogreCompositorWorkspaceDef);
+    ogreCompMgr->removeNodeDefinition(this->dataPtr->ogreCompositorNodeDef);
+    this->dataPtr->ogreCompositorWorkspaceDef.clear();
+    this->dataPtr->ogreCompositorNodeDef.clear();
+  }
+
+  if (this->dataPtr->ogreEventTexture)
+  {
+    textureMgr->destroyTexture(this->dataPtr->ogreEventTexture);
+    this->dataPtr->ogreEventTexture = nullptr;
+  }
+
+  for (auto &texture : this->dataPtr->ogreStateTextures)
+  {
+    if (texture)
+    {
+      textureMgr->destroyTexture(texture);
+      texture = nullptr;
+    }
+  }
+
+  if (this->dataPtr->eventMaterial)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        this->dataPtr->eventMaterial->getName());
+    this->dataPtr->eventMaterial.setNull();
+  }
+
+  this->dataPtr->initialized = false;
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::PreRender()
+{
+  if (!this->dataPtr->ogreEventTexture)
+    this->CreateEventTexture();
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::CreateCamera()
+{
+  auto ogreSceneManager = this->scene->OgreSceneManager();
+  if (ogreSceneManager == nullptr)
+  {
+    ignerr << "Scene manager cannot be obtained" << std::endl;
+    return;
+  }
+
+  this->ogreCamera = ogreSceneManager->createCamera(this->Name());
+  if (this->ogreCamera == nullptr)
+  {
+    ignerr << "Ogre camera cannot be created" << std::endl;
+    return;
+  }
+
+  this->ogreCamera->detachFromParent();
+  this->ogreNode->attachObject(this->ogreCamera);
+
+  // rotate to ignition gazebo coord.
+  this->ogreCamera->yaw(Ogre::Degree(-90));
+  this->ogreCamera->roll(Ogre::Degree(-90));
+  this->ogreCamera->setFixedYawAxis(false);
+
+  this->ogreCamera->setAutoAspectRatio(true);
+  this->ogreCamera->setProjectionType(Ogre::ProjectionType::PT_PERSPECTIVE);
+  this->ogreCamera->setCustomProjectionMatrix(false);
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::CreateEventTexture()
+{
+  // Camera Parameters
+  double aspect = static_cast<double>(this->ImageWidth()) /
+      this->ImageHeight();
+  this->ogreCamera->setNearClipDistance(this->NearClipPlane());
+  this->ogreCamera->setFarClipDistance(this->FarClipPlane());
+  this->ogreCamera->setAspectRatio(aspect);
+  double vfov = 2.0 * atan(tan(this->HFOV().Radian() / 2.0) / aspect);
+  this->ogreCamera->setFOVy(Ogre::Radian(vfov));
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  // The EventCamera material is defined in script (event_camera.material).
+  // We need to clone it since we are going to modify its uniform variables
+  Ogre::MaterialPtr mat =
+      Ogre::MaterialManager::getSingleton().getByName("EventCamera");
+  this->dataPtr->eventMaterial = mat->clone(this->Name() + "_EventCamera");
+  this->dataPtr->eventMaterial->load();
+
+  // Programmatically create the compositor node. It is equivalent to the
+  // following:
+  //
+  // compositor_node EventCamera
+  // {
+  //   in 0 rt0            // events
+  //   in 1 stateIn        // reference state of the previous frame
+  //   in 2 stateOut       // reference state of this frame
+  //
+  //   texture colorTexture target_width target_height PFG_RGBA8_UNORM_SRGB
+  //
+  //   rtv rt0
+  //   {
+  //     colour rt0 stateOut
+  //   }
+  //
+  //   target colorTexture
+  //   {
+  //     pass render_scene
+  //     {
+  //       load { all clear }
+  //       shadows PbsMaterialsShadowNode
+  //     }
+  //   }
+  //   target rt0
+  //   {
+  //     pass render_quad
+  //     {
+  //       load { all clear }
+  //       material EventCamera // Use copy instead of original
+  //       input 0 colorTexture
+  //       input 1 stateIn
+  //     }
+  //   }
+  // }
+  std::string wsDefName = "EventCameraWorkspace_" + this->Name();
+  std::string nodeDefName = wsDefName + "/Node";
+  this->dataPtr->ogreCompositorWorkspaceDef = wsDefName;
+  this->dataPtr->ogreCompositorNodeDef = nodeDefName;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+  nodeDef->addTextureSourceName(
+      "rt0", 0u, Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName(
+      "stateIn", 1u, Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName(
+      "stateOut", 2u, Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  Ogre::TextureDefinitionBase::TextureDefinition *colorTexDef =
+      nodeDef->addTextureDefinition("colorTexture");
+  colorTexDef->textureType = Ogre::TextureTypes::Type2D;
+  colorTexDef->width = 0;
+  colorTexDef->height = 0;
+  colorTexDef->depthOrSlices = 1;
+  colorTexDef->numMipmaps = 0;
+  colorTexDef->widthFactor = 1;
+  colorTexDef->heightFactor = 1;
+  // sRGB so that the shader samples linear intensities
+  colorTexDef->format = Ogre::PFG_RGBA8_UNORM_SRGB;
+  colorTexDef->textureFlags &= ~Ogre::TextureFlags::Uav;
+  colorTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+  colorTexDef->depthBufferFormat = Ogre::PFG_D32_FLOAT;
+  colorTexDef->preferDepthTexture = false;
+
+  Ogre::RenderTargetViewDef *rtvColor =
+    nodeDef->addRenderTextureView("colorTexture");
+  rtvColor->setForTextureDefinition("colorTexture", colorTexDef);
+
+  // the quad pass writes the events and the new state at the same time
+  Ogre::RenderTargetViewDef *rtvEvents = nodeDef->addRenderTextureView("rt0");
+  Ogre::RenderTargetViewEntry eventAttachment;
+  eventAttachment.textureName = "rt0";
+  rtvEvents->colourAttachments.push_back(eventAttachment);
+  Ogre::RenderTargetViewEntry stateAttachment;
+  stateAttachment.textureName = "stateOut";
+  rtvEvents->colourAttachments.push_back(stateAttachment);
+
+  nodeDef->setNumTargetPass(2u);
+  Ogre::CompositorTargetDef *colorTargetDef =
+      nodeDef->addTargetPass("colorTexture");
+  colorTargetDef->setNumPasses(1);
+  {
+    // scene pass
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        colorTargetDef->addPass(Ogre::PASS_SCENE));
+    passScene->setAllLoadActions(Ogre::LoadAction::Clear);
+    passScene->setAllClearColours(
+        Ogre2Conversions::Convert(this->scene->BackgroundColor()));
+    passScene->mShadowNode = this->dataPtr->kShadowNodeName;
+    passScene->mVisibilityMask = this->VisibilityMask();
+    passScene->mIncludeOverlays = false;
+  }
+
+  Ogre::CompositorTargetDef *eventTargetDef = nodeDef->addTargetPass("rt0");
+  eventTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        eventTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->setAllLoadActions(Ogre::LoadAction::Clear);
+    passQuad->setAllClearColours(Ogre::ColourValue::ZERO);
+    passQuad->mMaterialName = this->dataPtr->eventMaterial->getName();
+    passQuad->addQuadTextureSource(0, "colorTexture");
+    passQuad->addQuadTextureSource(1, "stateIn");
+  }
+
+  Ogre::CompositorWorkspaceDef *workDef =
+      ogreCompMgr->addWorkspaceDefinition(wsDefName);
+  workDef->connectExternal(0, nodeDefName, 0);
+  workDef->connectExternal(1, nodeDefName, 1);
+  workDef->connectExternal(2, nodeDefName, 2);
+
+  // create render textures
+  this->dataPtr->ogreEventTexture =
+      textureMgr->createOrRetrieveTexture(this->Name() + "_events",
+        Ogre::GpuPageOutStrategy::SaveToSystemRam,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+  this->dataPtr->ogreEventTexture->setResolution(
+      this->ImageWidth(), this->ImageHeight());
+  this->dataPtr->ogreEventTexture->setNumMipmaps(1u);
+  // full precision floats so that the crossing times of the events keep
+  // their resolution within long frames
+  this->dataPtr->ogreEventTexture->setPixelFormat(Ogre::PFG_RGBA32_FLOAT);
+  this->dataPtr->ogreEventTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
+
+  for (unsigned int i = 0u; i < 2u; ++i)
+  {
+    Ogre::TextureGpu *texture = textureMgr->createOrRetrieveTexture(
+        this->Name() + "_state" + std::to_string(i),
+        Ogre::GpuPageOutStrategy::Discard,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+    texture->setResolution(this->ImageWidth(), this->ImageHeight());
+    texture->setNumMipmaps(1u);
+    texture->setPixelFormat(Ogre::PFG_RGBA32_FLOAT);
+    texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+    this->dataPtr->ogreStateTextures[i] = texture;
+  }
+
+  // create one compositor workspace for each direction of the ping pong
+  // between the state textures
+  for (unsigned int i = 0u; i < 2u; ++i)
+  {
+    Ogre::CompositorChannelVec externalTargets(3u);
+    externalTargets[0] = this->dataPtr->ogreEventTexture;
+    externalTargets[1] = this->dataPtr->ogreStateTextures[i];
+    externalTargets[2] = this->dataPtr->ogreStateTextures[1u - i];
+    this->dataPtr->ogreCompositorWorkspaces[i] =
+        ogreCompMgr->addWorkspace(
+          this->scene->OgreSceneManager(),
+          externalTargets,
+          this->ogreCamera,
+          wsDefName,
+          false);
+  }
+
+  this->dataPtr->workspaceIndex = 0u;
+  this->dataPtr->initialized = false;
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::UpdateEventMaterial(double _frameTime)
+{
+  // Set the uniform variables (event_camera_fs.glsl).
+  Ogre::Pass *pass =
+      this->dataPtr->eventMaterial->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+
+  // random offsets used to sample the threshold noise, see
+  // Ogre2GaussianNoisePass
+  Ogre::Vector3 offsets(ignition::math::Rand::DblUniform(0.0, 1.0),
+                        ignition::math::Rand::DblUniform(0.0, 1.0),
+                        ignition::math::Rand::DblUniform(0.0, 1.0));
+
+  psParams->setNamedConstant("positiveThreshold",
+      static_cast<float>(this->positiveThreshold));
+  psParams->setNamedConstant("negativeThreshold",
+      static_cast<float>(this->negativeThreshold));
+  psParams->setNamedConstant("thresholdNoise",
+      static_cast<float>(this->thresholdNoise));
+  psParams->setNamedConstant("refractoryPeriod", static_cast<float>(
+      std::chrono::duration<double>(this->refractoryPeriod).count()));
+  psParams->setNamedConstant("frameTime", static_cast<float>(_frameTime));
+  psParams->setNamedConstant("initialize",
+      this->dataPtr->initialized ? 0.0f : 1.0f);
+  psParams->setNamedConstant("offsets", offsets);
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::Render()
+{
+  std::chrono::steady_clock::duration now = this->scene->Time();
+  this->dataPtr->frameStart = this->dataPtr->initialized ?
+      this->dataPtr->frameEnd : now;
+  this->dataPtr->frameEnd = now;
+  double frameTime = std::chrono::duration<double>(
+      this->dataPtr->frameEnd - this->dataPtr->frameStart).count();
+  this->UpdateEventMaterial(std::max(frameTime, 0.0));
+
+  Ogre::CompositorWorkspace *workspace =
+      this->dataPtr->ogreCompositorWorkspaces[this->dataPtr->workspaceIndex];
+
+  // update the compositors
+  this->scene->StartRendering(this->ogreCamera);
+
+  workspace->_validateFinalTarget();
+  workspace->_beginUpdate(false);
+  workspace->_update();
+  workspace->_endUpdate(false);
+
+  Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
+  swappedTargets.reserve(3u);
+  workspace->_swapFinalTarget(swappedTargets);
+
+  this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+
+  // the state written by this frame is read by the next one
+  this->dataPtr->workspaceIndex = 1u - this->dataPtr->workspaceIndex;
+  this->dataPtr->hasEvents = this->dataPtr->initialized;
+  this->dataPtr->initialized = true;
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::PostRender()
+{
+  this->dataPtr->events.clear();
+
+  if (this->dataPtr->newEvents.ConnectionCount() == 0u)
+    return;
+
+  if (this->dataPtr->hasEvents)
+  {
+    const unsigned int width = this->ImageWidth();
+    const unsigned int height = this->ImageHeight();
+    const unsigned int channelCount = 4u;
+    const std::chrono::duration<double> frameTime =
+        this->dataPtr->frameEnd - this->dataPtr->frameStart;
+
+    Ogre::Image2 image;
+    image.convertFromTexture(this->dataPtr->ogreEventTexture, 0u, 0u);
+    Ogre::TextureBox box = image.getData(0);
+    const uint8_t *bufferTmp = static_cast<const uint8_t *>(box.data);
+
+    // Most pixels have no events, so only the signed event count is
+    // checked before decoding the crossing times. The texture box may not be
+    // a contiguous region of a texture.
+    for (unsigned int row = 0; row < height; ++row)
+    {
+      const float *rawRow = reinterpret_cast<const float *>(
+          bufferTmp + row * box.bytesPerRow);
+      for (unsigned int column = 0; column < width; ++column)
+      {
+        const float *pixel = rawRow + column * channelCount;
+        float count = pixel[0];
+        if (count == 0.0f)
+          continue;
+
+        CameraEvent event;
+        event.x = column;
+        event.y = row;
+        event.polarity = count > 0.0f;
+        unsigned int n =
+            static_cast<unsigned int>(std::lround(std::abs(count)));
+        float first = pixel[1];
+        float step = pixel[2];
+        for (unsigned int k = 0u; k < n; ++k)
+        {
+          double s = std::min(std::max(first + k * step, 0.0f), 1.0f);
+          event.time = this->dataPtr->frameStart +
+              std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              frameTime * s);
+          this->dataPtr->events.push_back(event);
+        }
+      }
+    }
+  }
+
+  this->dataPtr->newEvents(this->dataPtr->events.data(),
+      static_cast<unsigned int>(this->dataPtr->events.size()));
+}
+
+/////////////////////////////////////////////////
+ignition::common::ConnectionPtr Ogre2EventCamera::ConnectNewEvents(
+    std::function<void(const CameraEvent *, unsigned int)> _subscriber)
+{
+  return this->dataPtr->newEvents.Connect(_subscriber);
+}
+
+/////////////////////////////////////////////////
+RenderTargetPtr Ogre2EventCamera::RenderTarget() const
+{
+  return this->dataPtr->eventTexture;
+}
+
+/////////////////////////////////////////////////
+void Ogre2EventCamera::CreateRenderTexture()
+{
+  RenderTexturePtr base = this->scene->CreateRenderTexture();
+  this->dataPtr->eventTexture =
+    std::dynamic_pointer_cast<Ogre2RenderTexture>(base);
+  this->dataPtr->eventTexture->SetWidth(1);
+  this->dataPtr->eventTexture->SetHeight(1);
+}
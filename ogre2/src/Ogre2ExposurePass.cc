@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/ogre2/Ogre2ExposurePass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <OgreDepthBuffer.h>
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data for the Ogre2ExposurePass class
+class ignition::rendering::Ogre2ExposurePassPrivate
+{
+  /// \brief Pointer to the ogre material that applies exposure and tone
+  /// mapping
+  public: Ogre::Material *exposureMat = nullptr;
+
+  /// \brief Size of the texture the log luminance of the image is
+  /// downsampled to before it is averaged with mipmaps
+  public: const unsigned int kLuminanceSize = 64u;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2ExposurePass::Ogre2ExposurePass()
+  : dataPtr(std::make_unique<Ogre2ExposurePassPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2ExposurePass::~Ogre2ExposurePass()
+{
+}
+
+//////////////////////////////////////////////////
+void Ogre2ExposurePass::PreRender()
+{
+  if (!this->dataPtr->exposureMat)
+    return;
+
+  if (!this->enabled)
+    return;
+
+  // These parameters are declared in
+  // media/materials/scripts/camera_effects.material and
+  // media/materials/programs/GLSL/exposure_fs.glsl
+  Ogre::Pass *pass =
+      this->dataPtr->exposureMat->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+  psParams->setNamedConstant("exposure",
+      static_cast<Ogre::Real>(std::exp2(this->exposureCompensation)));
+  psParams->setNamedConstant("autoExposure",
+      static_cast<int>(this->autoExposure));
+  psParams->setNamedConstant("keyValue",
+      static_cast<Ogre::Real>(this->keyValue));
+  psParams->setNamedConstant("minExposure",
+      static_cast<Ogre::Real>(this->minExposure));
+  psParams->setNamedConstant("maxExposure",
+      static_cast<Ogre::Real>(this->maxExposure));
+  psParams->setNamedConstant("toneMapping",
+      static_cast<int>(this->toneMapping));
+  // the average log luminance is in the last mip level
+  psParams->setNamedConstant("luminanceLod",
+      static_cast<Ogre::Real>(std::log2(this->dataPtr->kLuminanceSize)));
+}
+
+//////////////////////////////////////////////////
+void Ogre2ExposurePass::CreateRenderPass()
+{
+  // the node definition only needs to be created once
+  if (!this->ogreCompositorNodeDefName.empty())
+    return;
+
+  static int exposureNodeCounter = 0;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  std::string nodeDefName = "ExposureNode_"
+      + std::to_string(exposureNodeCounter);
+
+  if (ogreCompMgr->hasNodeDefinition(nodeDefName))
+    return;
+
+  // The materials are defined in script (camera_effects.material).
+  // The luminance material has no parameters so it does not need to be
+  // cloned.
+  std::string lumMatName = "ExposureLuminance";
+  std::string matName = "Exposure";
+  Ogre::MaterialPtr lumMat =
+      Ogre::MaterialManager::getSingleton().getByName(lumMatName);
+  Ogre::MaterialPtr ogreMat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!lumMat || !ogreMat)
+  {
+    ignerr << "Exposure materials not found: '" << lumMatName << "', '"
+           << matName << "'" << std::endl;
+    return;
+  }
+  if (!lumMat->isLoaded())
+    lumMat->load();
+  if (!ogreMat->isLoaded())
+    ogreMat->load();
+  std::string materialName = matName + "_" +
+      std::to_string(exposureNodeCounter);
+  this->dataPtr->exposureMat = ogreMat->clone(materialName).get();
+
+  // create the compositor node definition
+
+  // The compositor node definition is equivalent to the following
+  // ogre compositor script:
+  // compositor_node ExposureNode
+  // {
+  //   in 0 rt_input
+  //   in 1 rt_output
+  //
+  //   // log luminance with a full mip chain
+  //   texture rt_luminance 64 64 PFG_R16_FLOAT mipmaps 0 automipmaps
+  //
+  //   // downsample the log luminance of the input and average it by
+  //   // generating mipmaps
+  //   target rt_luminance
+  //   {
+  //     pass render_quad
+  //     {
+  //       material ExposureLuminance
+  //       input 0 rt_input
+  //     }
+  //     pass generate_mipmaps
+  //     {
+  //     }
+  //   }
+  //
+  //   // apply exposure and tone mapping
+  //   target rt_output
+  //   {
+  //     pass render_quad
+  //     {
+  //       material Exposure // Use copy instead of original
+  //       input 0 rt_input
+  //       input 1 rt_luminance
+  //     }
+  //   }
+  //   out 0 rt_output
+  //   out 1 rt_input
+  // }
+
+  this->ogreCompositorNodeDefName = nodeDefName;
+  exposureNodeCounter++;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+
+  // Input texture
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName("rt_output", 1,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  Ogre::TextureDefinitionBase::TextureDefinition *lumTexDef =
+      nodeDef->addTextureDefinition("rt_luminance");
+  lumTexDef->textureType = Ogre::TextureTypes::Type2D;
+  lumTexDef->width = this->dataPtr->kLuminanceSize;
+  lumTexDef->height = this->dataPtr->kLuminanceSize;
+  lumTexDef->depthOrSlices = 1;
+  // 0 creates the full mip chain
+  lumTexDef->numMipmaps = 0;
+  lumTexDef->format = Ogre::PFG_R16_FLOAT;
+  lumTexDef->fsaa = "0";
+  lumTexDef->textureFlags &= ~Ogre::TextureFlags::Uav;
+  lumTexDef->textureFlags |= Ogre::TextureFlags::AllowAutomipmaps;
+  lumTexDef->depthBufferId = Ogre::DepthBuffer::POOL_NO_DEPTH;
+  lumTexDef->depthBufferFormat = Ogre::PFG_UNKNOWN;
+
+  Ogre::RenderTargetViewDef *rtv =
+      nodeDef->addRenderTextureView("rt_luminance");
+  rtv->setForTextureDefinition("rt_luminance", lumTexDef);
+
+  nodeDef->setNumTargetPass(2);
+
+  // rt_luminance target
+  Ogre::CompositorTargetDef *lumTargetDef =
+      nodeDef->addTargetPass("rt_luminance");
+  lumTargetDef->setNumPasses(2);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        lumTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = lumMatName;
+    passQuad->addQuadTextureSource(0, "rt_input");
+
+    // mipmap pass
+    lumTargetDef->addPass(Ogre::PASS_MIPMAP);
+  }
+
+  // rt_output target
+  Ogre::CompositorTargetDef *outputTargetDef =
+      nodeDef->addTargetPass("rt_output");
+  outputTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        outputTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = materialName;
+    passQuad->addQuadTextureSource(0, "rt_input");
+    passQuad->addQuadTextureSource(1, "rt_luminance");
+  }
+  nodeDef->mapOutputChannel(0, "rt_output");
+  nodeDef->mapOutputChannel(1, "rt_input");
+}
+
+IGN_RENDERING_REGISTER_RENDER_PASS(Ogre2ExposurePass, ExposurePass)
@@ -15,10 +15,19 @@
  *
 */
 
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
 #include <ignition/math/Vector2.hh>
 #include <ignition/math/Vector3.hh>
 
 #include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
 #include <ignition/math/Helpers.hh>
 
 #include "ignition/rendering/ogre2/Ogre2Camera.hh"
@@ -61,14 +70,23 @@ inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
 //
 /// \brief Helper class for switching the ogre item's material to laser retro
 /// source material when a thermal camera is being rendered.
+/// In the physical intensity model, the items are switched to the laser
+/// reflectance source materials instead.
 class Ogre2LaserRetroMaterialSwitcher : public Ogre::Camera::Listener
 {
   /// \brief constructor
   /// \param[in] _scene the scene manager responsible for rendering
-  public: explicit Ogre2LaserRetroMaterialSwitcher(Ogre2ScenePtr _scene);
+  /// \param[in] _retroKey Key of the visual user data that holds the
+  /// retro value
+  /// \param[in] _physical True to render the reflectance of the surfaces
+  /// for the physical intensity model
+  /// \param[in] _name Prefix of the materials created by the switcher
+  public: Ogre2LaserRetroMaterialSwitcher(Ogre2ScenePtr _scene,
+      const std::string &_retroKey, bool _physical,
+      const std::string &_name);
 
   /// \brief destructor
-  public: ~Ogre2LaserRetroMaterialSwitcher() = default;
+  public: ~Ogre2LaserRetroMaterialSwitcher();
 
   /// \brief Callback when a camera is about to be rendered
   /// \param[in] _evt Ogre camera which is about to render
@@ -80,12 +98,76 @@ class Ogre2LaserRetroMaterialSwitcher : public Ogre::Camera::Listener
   private: virtual void cameraPostRenderScene(
       Ogre::Camera *_cam) override;
 
+  /// \brief Read the near infrared reflectance and retroreflectivity of
+  /// a visual from its user data
+  /// \param[in] _visual Visual to read
+  /// \param[out] _reflectance Reflectance in [0, 1]
+  /// \param[out] _retroreflectivity Retroreflectivity in [0, 2000]
+  /// \param[out] _reflectanceMap Path to the reflectance texture, or empty
+  /// if the reflectance is a number
+  private: void ReadReflectance(const Ogre2VisualPtr &_visual,
+      float &_reflectance, float &_retroreflectivity,
+      std::string &_reflectanceMap) const;
+
+  /// \brief A reflectance map material and the number of items using it
+  private: struct ReflectanceMapMaterial
+  {
+    /// \brief The cloned reflectance map material
+    Ogre::MaterialPtr material;
+
+    /// \brief Number of items referencing this material
+    unsigned int refCount = 0u;
+  };
+
+  /// \brief Get the laser reflectance material of a reflectance texture,
+  /// creating it if it does not exist yet, and make the item reference it.
+  /// Any material previously referenced by the item is released.
+  /// \param[in] _itemId Id of the item using the material
+  /// \param[in] _texture Path to the reflectance texture
+  /// \return The reflectance material
+  private: Ogre::MaterialPtr AcquireReflectanceMapMaterial(
+      Ogre::IdType _itemId, const std::string &_texture);
+
+  /// \brief Release the reflectance map material referenced by an item.
+  /// The material is destroyed once no more items reference it.
+  /// \param[in] _itemId Id of the item
+  private: void ReleaseReflectanceMapMaterial(Ogre::IdType _itemId);
+
+  /// \brief Set the min clip distance of the source materials
+  /// \param[in] _distance Min clip distance
+  private: void SetMinClipDistance(float _distance);
+
   /// \brief Scene manager
   private: Ogre2ScenePtr scene = nullptr;
 
-  /// \brief Pointer to the laser retro source material
+  /// \brief Key of the visual user data that holds the retro value
+  private: std::string retroKey;
+
+  /// \brief True to render the reflectance of the surfaces
+  private: bool physical = false;
+
+  /// \brief Prefix of the materials created by the switcher
+  private: std::string name;
+
+  /// \brief Pointer to the laser retro source material, or the laser
+  /// reflectance source material in the physical intensity model
   private: Ogre::MaterialPtr laserRetroSourceMaterial;
 
+  /// \brief Pointer to the base material of the reflectance textures
+  private: Ogre::MaterialPtr reflectanceMapBaseMaterial;
+
+  /// \brief Materials of the reflectance textures, shared by all items
+  /// that have the same texture. The key is the path to the texture
+  private: std::map<std::string, ReflectanceMapMaterial>
+            reflectanceMapMaterials;
+
+  /// \brief A map of all items that have a reflectance map material.
+  /// The key is the item's ID, and the value is the path to the texture
+  private: std::unordered_map<Ogre::IdType, std::string> itemReflectanceMaps;
+
+  /// \brief Counter used to generate unique reflectance map material names
+  private: unsigned int reflectanceMapMaterialCount = 0u;
+
   /// \brief Custom parameter index of laser retro value in an ogre subitem.
   /// This has to match the custom index specifed in LaserRetroSource material
   /// script in media/materials/scripts/gpu_rays.material
@@ -200,6 +282,31 @@ class ignition::rendering::Ogre2GpuRaysPrivate
   /// \brief Max number of cameras used for creating the cubemap of depth
   /// textures for generating lidar data
   public: const unsigned int kCubeCameraCount = 6;
+
+  /// \brief True if the beam footprint is sampled to find multiple echoes.
+  /// Set when the gpu rays textures are created.
+  public: bool multiReturn = false;
+
+  /// \brief Number of echoes written to the output for each ray.
+  /// Set when the gpu rays textures are created.
+  public: unsigned int returnsPerRay = 1u;
+
+  /// \brief True if the sensor pose is interpolated for each column of
+  /// rays. Set when the gpu rays textures are created.
+  public: bool rollingScan = false;
+
+  /// \brief Value of RollingScanEnabled() when the gpu rays textures were
+  /// created
+  public: bool rollingScanRequested = false;
+
+  /// \brief True if the intensity is computed with the physical model.
+  /// Set when the gpu rays textures are created.
+  public: bool physicalIntensity = false;
+
+  /// \brief Width and height of the block of samples used to sample the
+  /// beam footprint of a ray in multi-return mode. This must match
+  /// gpu_rays_2nd_pass_multi_return_fs.glsl
+  public: const unsigned int kFootprintSize = 3u;
 };
 
 using namespace ignition;
@@ -207,16 +314,164 @@ using namespace rendering;
 
 //////////////////////////////////////////////////
 Ogre2LaserRetroMaterialSwitcher::Ogre2LaserRetroMaterialSwitcher(
-    Ogre2ScenePtr _scene)
+    Ogre2ScenePtr _scene, const std::string &_retroKey, bool _physical,
+    const std::string &_name)
 {
   this->scene = _scene;
+  this->retroKey = _retroKey;
+  this->physical = _physical;
+  this->name = _name;
   // plain opaque material
   Ogre::ResourcePtr res =
-    Ogre::MaterialManager::getSingleton().load("LaserRetroSource",
+    Ogre::MaterialManager::getSingleton().load(
+        this->physical ? "LaserReflectanceSource" : "LaserRetroSource",
         Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
 
   this->laserRetroSourceMaterial = res.staticCast<Ogre::Material>();
   this->laserRetroSourceMaterial->load();
+
+  if (this->physical)
+  {
+    this->reflectanceMapBaseMaterial =
+        Ogre::MaterialManager::getSingleton().getByName(
+        "LaserReflectanceMapSource");
+  }
+}
+
+//////////////////////////////////////////////////
+Ogre2LaserRetroMaterialSwitcher::~Ogre2LaserRetroMaterialSwitcher()
+{
+  for (auto &it : this->reflectanceMapMaterials)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        it.second.material->getName());
+  }
+  this->reflectanceMapMaterials.clear();
+  this->itemReflectanceMaps.clear();
+}
+
+//////////////////////////////////////////////////
+void Ogre2LaserRetroMaterialSwitcher::SetMinClipDistance(float _distance)
+{
+  Ogre::Pass *pass =
+      this->laserRetroSourceMaterial->getBestTechnique()->getPass(0u);
+  pass->getVertexProgramParameters()->setNamedConstant(
+        "ignMinClipDistance", _distance);
+
+  for (auto &it : this->reflectanceMapMaterials)
+  {
+    pass = it.second.material->getBestTechnique()->getPass(0u);
+    pass->getVertexProgramParameters()->setNamedConstant(
+          "ignMinClipDistance", _distance);
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2LaserRetroMaterialSwitcher::ReadReflectance(
+    const Ogre2VisualPtr &_visual, float &_reflectance,
+    float &_retroreflectivity, std::string &_reflectanceMap) const
+{
+  // numbers may be stored as float, double or int
+  auto toFloat = [](const Variant &_value, float &_result)
+  {
+    if (auto v = std::get_if<float>(&_value))
+      _result = *v;
+    else if (auto d = std::get_if<double>(&_value))
+      _result = static_cast<float>(*d);
+    else if (auto i = std::get_if<int>(&_value))
+      _result = static_cast<float>(*i);
+    else
+      return false;
+    return true;
+  };
+
+  if (_visual->HasUserData("nir_reflectance"))
+  {
+    Variant value = _visual->UserData("nir_reflectance");
+    if (auto texture = std::get_if<std::string>(&value))
+      _reflectanceMap = *texture;
+    else if (!toFloat(value, _reflectance))
+      ignerr << "Error casting user data: nir_reflectance\n";
+  }
+
+  if (_visual->HasUserData("retroreflectivity"))
+  {
+    Variant value = _visual->UserData("retroreflectivity");
+    if (!toFloat(value, _retroreflectivity))
+      ignerr << "Error casting user data: retroreflectivity\n";
+  }
+
+  _reflectance = std::clamp(_reflectance, 0.0f, 1.0f);
+  _retroreflectivity = std::clamp(_retroreflectivity, 0.0f, 2000.0f);
+}
+
+//////////////////////////////////////////////////
+Ogre::MaterialPtr
+    Ogre2LaserRetroMaterialSwitcher::AcquireReflectanceMapMaterial(
+    Ogre::IdType _itemId, const std::string &_texture)
+{
+  auto itemIt = this->itemReflectanceMaps.find(_itemId);
+  if (itemIt != this->itemReflectanceMaps.end())
+  {
+    // item is already using this material
+    if (itemIt->second == _texture)
+      return this->reflectanceMapMaterials[_texture].material;
+
+    // reflectance map of the item changed
+    this->ReleaseReflectanceMapMaterial(_itemId);
+  }
+
+  auto matIt = this->reflectanceMapMaterials.find(_texture);
+  if (matIt == this->reflectanceMapMaterials.end())
+  {
+    // make sure the texture is in ogre's resource path
+    auto engine = Ogre2RenderEngine::Instance();
+    engine->AddResourcePath(_texture);
+
+    // items with the same texture share the same material
+    std::string baseName = common::basename(_texture);
+    ReflectanceMapMaterial reflectanceMap;
+    reflectanceMap.material = this->reflectanceMapBaseMaterial->clone(
+        this->name + "_" + baseName + "_" +
+        std::to_string(this->reflectanceMapMaterialCount++));
+    reflectanceMap.material->getTechnique(0)->getPass(0)->
+        getTextureUnitState(0)->setTextureName(baseName);
+    reflectanceMap.material->load();
+    reflectanceMap.material->getBestTechnique()->getPass(0u)->
+        getVertexProgramParameters()->setNamedConstant("ignMinClipDistance",
+        engine->HlmsCustomizations().minDistanceClip);
+    matIt = this->reflectanceMapMaterials.emplace(
+        _texture, reflectanceMap).first;
+  }
+
+  matIt->second.refCount++;
+  this->itemReflectanceMaps[_itemId] = _texture;
+  return matIt->second.material;
+}
+
+//////////////////////////////////////////////////
+void Ogre2LaserRetroMaterialSwitcher::ReleaseReflectanceMapMaterial(
+    Ogre::IdType _itemId)
+{
+  auto itemIt = this->itemReflectanceMaps.find(_itemId);
+  if (itemIt == this->itemReflectanceMaps.end())
+    return;
+
+  auto matIt = this->reflectanceMapMaterials.find(itemIt->second);
+  this->itemReflectanceMaps.erase(itemIt);
+  if (matIt == this->reflectanceMapMaterials.end())
+    return;
+
+  if (matIt->second.refCount > 0u)
+    matIt->second.refCount--;
+
+  // destroy the material once no more items use it
+  if (matIt->second.refCount == 0u)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        matIt->second.material->getName());
+    this->reflectanceMapMaterials.erase(matIt);
+  }
 }
 
 //////////////////////////////////////////////////
@@ -227,12 +482,13 @@ void Ogre2LaserRetroMaterialSwitcher::cameraPreRenderScene(
     auto engine = Ogre2RenderEngine::Instance();
     Ogre2IgnHlmsCustomizations &hlmsCustomizations =
         engine->HlmsCustomizations();
-    Ogre::Pass *pass =
-        this->laserRetroSourceMaterial->getBestTechnique()->getPass(0u);
-    pass->getVertexProgramParameters()->setNamedConstant(
-          "ignMinClipDistance", hlmsCustomizations.minDistanceClip );
+    this->SetMinClipDistance(hlmsCustomizations.minDistanceClip);
   }
 
+  // ids of items that currently use a reflectance map material. Used to
+  // release materials of items that no longer exist
+  std::set<Ogre::IdType> reflectanceMapItems;
+
   // swap item to use v1 shader material
   // Note: keep an eye out for performance impact on switching materials
   // on the fly. We are not doing this often so should be ok.
@@ -243,9 +499,12 @@ void Ogre2LaserRetroMaterialSwitcher::cameraPreRenderScene(
     Ogre::MovableObject *object = itor.peekNext();
     Ogre::Item *item = static_cast<Ogre::Item *>(object);
 
-    std::string laserRetroKey = "laser_retro";
+    const std::string &laserRetroKey = this->retroKey;
 
     float retroValue = 0.0f;
+    float reflectance = 0.0f;
+    float retroreflectivity = 0.0f;
+    std::string reflectanceMap;
 
     // get visual
     Ogre::Any userAny = item->getUserObjectBindings().getUserAny();
@@ -263,7 +522,15 @@ void Ogre2LaserRetroMaterialSwitcher::cameraPreRenderScene(
       Ogre2VisualPtr ogreVisual =
           std::dynamic_pointer_cast<Ogre2Visual>(result);
 
-      if (ogreVisual->HasUserData(laserRetroKey))
+      if (this->physical)
+      {
+        if (ogreVisual)
+        {
+          this->ReadReflectance(ogreVisual, reflectance, retroreflectivity,
+              reflectanceMap);
+        }
+      }
+      else if (ogreVisual->HasUserData(laserRetroKey))
       {
         // get laser_retro
         Variant tempLaserRetro = ogreVisual->UserData(laserRetroKey);
@@ -296,6 +563,15 @@ void Ogre2LaserRetroMaterialSwitcher::cameraPreRenderScene(
       retroValue = std::max(retroValue, 0.0f);
     }
 
+    // the sub items of an item share its reflectance map material
+    Ogre::MaterialPtr reflectanceMapMaterial;
+    if (this->physical && !reflectanceMap.empty())
+    {
+      reflectanceMapMaterial =
+          this->AcquireReflectanceMapMaterial(item->getId(), reflectanceMap);
+      reflectanceMapItems.insert(item->getId());
+    }
+
     for (unsigned int i = 0; i < item->getNumSubItems(); ++i)
     {
       Ogre::SubItem *subItem = item->getSubItem(i);
@@ -306,8 +582,20 @@ void Ogre2LaserRetroMaterialSwitcher::cameraPreRenderScene(
         retroValue = 2000.0f;
       }
       float color = retroValue / 2000.0f;
-      subItem->setCustomParameter(this->customParamIdx,
-                                  Ogre::Vector4(color, color, color, 1.0));
+      Ogre::MaterialPtr material = this->laserRetroSourceMaterial;
+      if (this->physical)
+      {
+        // see laser_reflectance_fs.glsl
+        subItem->setCustomParameter(this->customParamIdx,
+            Ogre::Vector4(reflectance, retroreflectivity / 2000.0f, 0.0, 1.0));
+        if (reflectanceMapMaterial)
+          material = reflectanceMapMaterial;
+      }
+      else
+      {
+        subItem->setCustomParameter(this->customParamIdx,
+                                    Ogre::Vector4(color, color, color, 1.0));
+      }
 
       // case when item is using low level materials
       // e.g. shaders
@@ -321,10 +609,21 @@ void Ogre2LaserRetroMaterialSwitcher::cameraPreRenderScene(
         Ogre::HlmsDatablock *datablock = subItem->getDatablock();
         this->datablockMap[subItem] = datablock;
       }
-      subItem->setMaterial(this->laserRetroSourceMaterial);
+      subItem->setMaterial(material);
     }
     itor.moveNext();
   }
+
+  // release reflectance map materials of items that were removed from the
+  // scene or no longer have a reflectance map
+  std::vector<Ogre::IdType> staleItems;
+  for (const auto &it : this->itemReflectanceMaps)
+  {
+    if (reflectanceMapItems.find(it.first) == reflectanceMapItems.end())
+      staleItems.push_back(it.first);
+  }
+  for (auto id : staleItems)
+    this->ReleaseReflectanceMapMaterial(id);
 }
 
 //////////////////////////////////////////////////
@@ -345,10 +644,7 @@ void Ogre2LaserRetroMaterialSwitcher::cameraPostRenderScene(
     subItem->setMaterial(it.second);
   }
 
-  Ogre::Pass *pass =
-      this->laserRetroSourceMaterial->getBestTechnique()->getPass(0u);
-  pass->getVertexProgramParameters()->setNamedConstant(
-        "ignMinClipDistance", 0.0f );
+  this->SetMinClipDistance(0.0f);
 
   this->datablockMap.clear();
   this->laserRetroMaterialMap.clear();
@@ -393,6 +689,27 @@ void Ogre2GpuRays::Destroy()
   if (!this->dataPtr->ogreCamera)
     return;
 
+  this->DestroyGpuRaysTextures();
+
+  if (this->scene)
+  {
+    Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
+    if (ogreSceneManager == nullptr)
+    {
+      ignerr << "Scene manager not available. "
+             << "Unable to remove camera" << std::endl;
+    }
+    else
+    {
+      ogreSceneManager->destroyCamera(this->dataPtr->ogreCamera);
+      this->dataPtr->ogreCamera = nullptr;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::DestroyGpuRaysTextures()
+{
   if (this->dataPtr->gpuRaysBuffer)
   {
     delete [] this->dataPtr->gpuRaysBuffer;
@@ -495,10 +812,10 @@ void Ogre2GpuRays::Destroy()
         this->dataPtr->particleNoiseListener[i].reset();
         this->dataPtr->laserRetroMaterialSwitcher[i].reset();
       }
-      ogreSceneManager->destroyCamera(this->dataPtr->ogreCamera);
-      this->dataPtr->ogreCamera = nullptr;
     }
   }
+
+  this->dataPtr->cubeFaceIdx.clear();
 }
 
 /////////////////////////////////////////////////
@@ -542,39 +859,75 @@ void Ogre2GpuRays::CreateCamera()
 /////////////////////////////////////////////////
 void Ogre2GpuRays::ConfigureCamera()
 {
-  // horizontal gpu rays setup
-  auto hfovAngle = this->AngleMax() - this->AngleMin();
-  hfovAngle = std::max(this->dataPtr->kMinAllowedAngle, hfovAngle);
-  this->SetHFOV(hfovAngle);
-
-  // vertical laser setup
+  math::Angle hfovAngle;
   double vfovAngle;
-
-  if (this->VerticalRangeCount() > 1)
+  unsigned int hs;
+  unsigned int vs;
+  if (!this->rayDirections.empty())
   {
+    // fov is given by the bounds of the ray direction table
+    math::Vector2d minDir = this->rayDirections[0];
+    math::Vector2d maxDir = this->rayDirections[0];
+    for (const auto &dir : this->rayDirections)
+    {
+      minDir.Min(dir);
+      maxDir.Max(dir);
+    }
+    hfovAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(),
+        maxDir.X() - minDir.X());
     vfovAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(),
-        (this->VerticalAngleMax() - this->VerticalAngleMin()).Radian());
+        maxDir.Y() - minDir.Y());
+    this->SetHFOV(hfovAngle);
+    this->SetVFOV(vfovAngle);
+
+    // The rays in the table are not necessarily on a grid, e.g. rosette
+    // patterns, so estimate the number of samples within a cubemap face
+    // from the average ray density
+    double rayCount = static_cast<double>(this->rayDirections.size());
+    double samples;
+    if (maxDir.Y() - minDir.Y() < this->dataPtr->kMinAllowedAngle.Radian())
+      samples = IGN_PI * 0.5 / hfovAngle.Radian() * rayCount;
+    else
+      samples = IGN_PI * 0.5 * std::sqrt(rayCount /
+          (hfovAngle.Radian() * vfovAngle));
+    // the texture size is clamped below, this only avoids overflow
+    hs = static_cast<unsigned int>(std::min(samples, 65536.0));
+    vs = hs;
   }
   else
   {
-    vfovAngle = 0;
+    // horizontal gpu rays setup
+    hfovAngle = this->AngleMax() - this->AngleMin();
+    hfovAngle = std::max(this->dataPtr->kMinAllowedAngle, hfovAngle);
+    this->SetHFOV(hfovAngle);
 
-    if (this->VerticalAngleMax() != this->VerticalAngleMin())
+    // vertical laser setup
+    if (this->VerticalRangeCount() > 1)
     {
-      ignwarn << "Only one vertical ray but vertical min. and max. angle "
-          "are not equal. Min. angle is used.\n";
-      this->SetVerticalAngleMax(this->VerticalAngleMin().Radian());
+      vfovAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(),
+          (this->VerticalAngleMax() - this->VerticalAngleMin()).Radian());
     }
-  }
-  this->SetVFOV(vfovAngle);
+    else
+    {
+      vfovAngle = 0;
 
-  // Configure first pass texture size
-  // Each cubemap texture covers 90 deg FOV so determine number of samples
-  // within the view for both horizontal and vertical FOV
-  unsigned int hs = static_cast<unsigned int>(
-      IGN_PI * 0.5 / hfovAngle.Radian() * this->RangeCount());
-  unsigned int vs = static_cast<unsigned int>(
-      IGN_PI * 0.5 / vfovAngle * this->VerticalRangeCount());
+      if (this->VerticalAngleMax() != this->VerticalAngleMin())
+      {
+        ignwarn << "Only one vertical ray but vertical min. and max. angle "
+            "are not equal. Min. angle is used.\n";
+        this->SetVerticalAngleMax(this->VerticalAngleMin().Radian());
+      }
+    }
+    this->SetVFOV(vfovAngle);
+
+    // Configure first pass texture size
+    // Each cubemap texture covers 90 deg FOV so determine number of samples
+    // within the view for both horizontal and vertical FOV
+    hs = static_cast<unsigned int>(
+        IGN_PI * 0.5 / hfovAngle.Radian() * this->RangeCount());
+    vs = static_cast<unsigned int>(
+        IGN_PI * 0.5 / vfovAngle * this->VerticalRangeCount());
+  }
 
   // get the max number from the two
   unsigned int v = std::max(hs, vs);
@@ -641,7 +994,8 @@ math::Vector2d Ogre2GpuRays::SampleCubemap(const math::Vector3d &_v,
 }
 
 /////////////////////////////////////////////////////////
-void Ogre2GpuRays::CreateSampleTexture()
+void Ogre2GpuRays::ComputeSampleData(float *_data,
+    std::set<unsigned int> &_faces)
 {
   double min = this->AngleMin().Radian();
   double max = this->AngleMax().Radian();
@@ -658,6 +1012,107 @@ void Ogre2GpuRays::CreateSampleTexture()
   if (this->dataPtr->h2nd > 1)
     vStep = vAngle / static_cast<double>(this->dataPtr->h2nd-1);
 
+  // in multi-return mode, the beam footprint of each ray is sampled by a
+  // block of kFootprintSize x kFootprintSize texels: one at the center of
+  // the beam and the others evenly spaced on a circle of radius
+  // divergence / 2 around it
+  const unsigned int footprint = this->dataPtr->multiReturn ?
+      this->dataPtr->kFootprintSize : 1u;
+  const unsigned int texWidth = this->dataPtr->w2nd * footprint;
+  const double footprintRadius =
+      std::tan(this->BeamDivergence().Radian() * 0.5);
+  const int footprintCenter = static_cast<int>(footprint / 2u);
+
+  const bool useTable = !this->rayDirections.empty();
+
+  // in rolling scan mode, the direction of the ray is stored instead and the
+  // cubemap is sampled in the shader once the ray is moved to the sensor pose
+  // at the time of the ray. All faces are rendered since the rays can point
+  // anywhere once rotated
+  const bool rolling = this->dataPtr->rollingScan;
+  if (rolling)
+  {
+    for (unsigned int i = 0; i < this->dataPtr->kCubeCameraCount; ++i)
+      _faces.insert(i);
+  }
+
+  double v = vmin;
+  for (unsigned int i = 0; i < this->dataPtr->h2nd; ++i)
+  {
+    double h = min;
+    for (unsigned int j = 0; j < this->dataPtr->w2nd; ++j)
+    {
+      if (useTable)
+      {
+        const math::Vector2d &dir =
+            this->rayDirections[i * this->dataPtr->w2nd + j];
+        h = dir.X();
+        v = dir.Y();
+      }
+      math::Quaterniond pitch(math::Vector3d(1, 0, 0), -v);
+      math::Quaterniond yaw(math::Vector3d(0, 1, 0), -h);
+      for (unsigned int fy = 0; fy < footprint; ++fy)
+      {
+        for (unsigned int fx = 0; fx < footprint; ++fx)
+        {
+          // set up dir vector to sample from a standard Y up cubemap
+          math::Vector3d ray(0, 0, 1);
+          int dx = static_cast<int>(fx) - footprintCenter;
+          int dy = static_cast<int>(fy) - footprintCenter;
+          if (dx != 0 || dy != 0)
+          {
+            double phi = std::atan2(dy, dx);
+            ray.X() = footprintRadius * std::cos(phi);
+            ray.Y() = footprintRadius * std::sin(phi);
+          }
+          ray.Normalize();
+          math::Vector3d dir = yaw * pitch * ray;
+          unsigned int index = ((i * footprint + fy) * texWidth +
+              j * footprint + fx) * 4u;
+          if (rolling)
+          {
+            // columns are measured one after another during the scan,
+            // unless the rays of the table have their own times
+            double time;
+            if (useTable && !this->rayTimes.empty())
+              time = this->rayTimes[i * this->dataPtr->w2nd + j];
+            else if (this->dataPtr->w2nd > 1u)
+              time = static_cast<double>(j) / (this->dataPtr->w2nd - 1u);
+            else
+              time = 0.0;
+            _data[index] = dir.X();
+            _data[index + 1] = dir.Y();
+            _data[index + 2] = dir.Z();
+            _data[index + 3] = static_cast<float>(time);
+            continue;
+          }
+          unsigned int faceIdx;
+          math::Vector2d uv = this->SampleCubemap(dir, faceIdx);
+          _faces.insert(faceIdx);
+          // igndbg << "p(" << pitch << ") y(" << yaw << "): " << dir << " | "
+          //       << uv << " | " << faceIdx << std::endl;
+          // u
+          _data[index] = uv.X();
+          // v
+          _data[index + 1] = uv.Y();
+          // face
+          _data[index + 2] = static_cast<float>(faceIdx);
+          // unused
+          _data[index + 3] = 1.0;
+        }
+      }
+      h += hStep;
+    }
+    v += vStep;
+  }
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::CreateSampleTexture()
+{
+  const unsigned int footprint = this->dataPtr->multiReturn ?
+      this->dataPtr->kFootprintSize : 1u;
+
   // create an RGB texture (cubeUVTex) to pack info that tells the shaders how
   // to sample from the cubemap textures.
   // Each pixel packs the follow data:
@@ -665,6 +1120,8 @@ void Ogre2GpuRays::CreateSampleTexture()
   //   G: v coordinate on the cubemap face
   //   B: cubemap face index
   //   A: unused
+  // In rolling scan mode, RGB holds the ray direction instead and A the
+  // fraction of the scan duration elapsed when the ray is measured.
   // this texture is passed to the 2nd pass fragment shader
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
@@ -682,7 +1139,7 @@ void Ogre2GpuRays::CreateSampleTexture()
 
   this->dataPtr->cubeUVTexture->setTextureType(Ogre::TextureTypes::Type2D);
   this->dataPtr->cubeUVTexture->setResolution(
-    this->dataPtr->w2nd, this->dataPtr->h2nd);
+    this->dataPtr->w2nd * footprint, this->dataPtr->h2nd * footprint);
   this->dataPtr->cubeUVTexture->setNumMipmaps(1u);
   this->dataPtr->cubeUVTexture->setPixelFormat(Ogre::PFG_RGBA32_FLOAT);
 
@@ -695,46 +1152,35 @@ void Ogre2GpuRays::CreateSampleTexture()
     this->dataPtr->cubeUVTexture->getPixelFormat(),
     rowAlignment);
 
-  const size_t bytesPerRow =
-    this->dataPtr->cubeUVTexture->_getSysRamCopyBytesPerRow( 0 );
   float *pDest = reinterpret_cast<float*>(
     OGRE_MALLOC_SIMD(dataSize, Ogre::MEMCATEGORY_RESOURCE));
 
-  double v = vmin;
-  int index = 0;
-  for (unsigned int i = 0; i < this->dataPtr->h2nd; ++i)
-  {
-    double h = min;
-    for (unsigned int j = 0; j < this->dataPtr->w2nd; ++j)
-    {
-      // set up dir vector to sample from a standard Y up cubemap
-      math::Vector3d ray(0, 0, 1);
-      ray.Normalize();
-      math::Quaterniond pitch(math::Vector3d(1, 0, 0), -v);
-      math::Quaterniond yaw(math::Vector3d(0, 1, 0), -h);
-      math::Vector3d dir = yaw * pitch * ray;
-      unsigned int faceIdx;
-      math::Vector2d uv = this->SampleCubemap(dir, faceIdx);
-      this->dataPtr->cubeFaceIdx.insert(faceIdx);
-      // igndbg << "p(" << pitch << ") y(" << yaw << "): " << dir << " | "
-      //       << uv << " | " << faceIdx << std::endl;
-      // u
-      pDest[index++] = uv.X();
-      // v
-      pDest[index++] = uv.Y();
-      // face
-      pDest[index++] = static_cast<float>(faceIdx);
-      // unused
-      pDest[index++] = 1.0;
-      h += hStep;
-    }
-    v += vStep;
-  }
+  this->ComputeSampleData(pDest, this->dataPtr->cubeFaceIdx);
+
   this->dataPtr->cubeUVTexture->_transitionTo(
     Ogre::GpuResidency::Resident,
     reinterpret_cast<Ogre::uint8*>(pDest) );
   this->dataPtr->cubeUVTexture->_setNextResidencyStatus(
     Ogre::GpuResidency::Resident);
+
+  this->UploadSampleTexture(pDest);
+
+  // Do not free the pointer if texture's paging strategy is
+  // GpuPageOutStrategy::AlwaysKeepSystemRamCopy
+  this->dataPtr->cubeUVTexture->notifyDataIsReady();
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::UploadSampleTexture(const float *_data)
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  const size_t bytesPerRow =
+    this->dataPtr->cubeUVTexture->_getSysRamCopyBytesPerRow( 0 );
+
   // We have to upload the data via a StagingTexture, which acts as an
   // intermediate stash memory that is both visible to CPU and GPU.
   Ogre::StagingTexture *stagingTexture = textureMgr->getStagingTexture(
@@ -754,7 +1200,7 @@ void Ogre2GpuRays::CreateSampleTexture()
     this->dataPtr->cubeUVTexture->getPixelFormat());
 
   texBox.copyFrom(
-    pDest,
+    const_cast<float *>(_data),
     this->dataPtr->cubeUVTexture->getWidth(),
     this->dataPtr->cubeUVTexture->getHeight(),
     bytesPerRow);
@@ -764,9 +1210,37 @@ void Ogre2GpuRays::CreateSampleTexture()
   // Otherwise it will leak.
   textureMgr->removeStagingTexture(stagingTexture);
   stagingTexture = 0;
-  // Do not free the pointer if texture's paging strategy is
-  // GpuPageOutStrategy::AlwaysKeepSystemRamCopy
-  this->dataPtr->cubeUVTexture->notifyDataIsReady();
+}
+
+/////////////////////////////////////////////////////////
+bool Ogre2GpuRays::UpdateSampleTexture()
+{
+  // the size of the textures is fixed once they are created
+  const unsigned int footprint = this->dataPtr->multiReturn ?
+      this->dataPtr->kFootprintSize : 1u;
+  if (this->rayDirections.empty() ||
+      this->dataPtr->w2nd != static_cast<unsigned int>(this->RangeCount()) ||
+      this->dataPtr->h2nd !=
+      static_cast<unsigned int>(this->VerticalRangeCount()))
+  {
+    return false;
+  }
+
+  std::vector<float> data(
+      this->dataPtr->w2nd * footprint * this->dataPtr->h2nd * footprint * 4u);
+  std::set<unsigned int> faces;
+  this->ComputeSampleData(data.data(), faces);
+
+  // only the cubemap faces that were needed by the previous table are
+  // rendered
+  if (!std::includes(this->dataPtr->cubeFaceIdx.begin(),
+      this->dataPtr->cubeFaceIdx.end(), faces.begin(), faces.end()))
+  {
+    return false;
+  }
+
+  this->UploadSampleTexture(data.data());
+  return true;
 }
 
 /////////////////////////////////////////////////////////
@@ -894,8 +1368,10 @@ void Ogre2GpuRays::Setup1stPass()
     colorTexDef->widthFactor = 1;
     colorTexDef->heightFactor = 1;
     // We need at least 16-bit because otherwise 256 values are not enough to
-    // store all retro value range
-    colorTexDef->format = Ogre::PFG_R16_UNORM;
+    // store all retro value range. The physical intensity model also needs
+    // the reflectance and incidence angle, see laser_reflectance_fs.glsl
+    colorTexDef->format = this->dataPtr->physicalIntensity ?
+        Ogre::PFG_RGBA16_UNORM : Ogre::PFG_R16_UNORM;
     colorTexDef->fsaa = "0";
     colorTexDef->textureFlags &= ~Ogre::TextureFlags::Uav;
     colorTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
@@ -1080,13 +1556,16 @@ void Ogre2GpuRays::Setup1stPass()
 
     for (auto c : channelsTex)
     {
-      if (c->getPixelFormat() == Ogre::PFG_R16_UNORM)
+      if (c->getPixelFormat() == Ogre::PFG_R16_UNORM ||
+          c->getPixelFormat() == Ogre::PFG_RGBA16_UNORM)
       {
         // add laser retro material switcher to render target listener
         // so we can switch to use laser retro material when the camera is being
         // updated
         this->dataPtr->laserRetroMaterialSwitcher[i].reset(
-            new Ogre2LaserRetroMaterialSwitcher(this->scene));
+            new Ogre2LaserRetroMaterialSwitcher(this->scene,
+            this->RetroUserDataKey(), this->dataPtr->physicalIntensity,
+            this->Name() + "_reflectance" + std::to_string(i)));
         this->dataPtr->cubeCam[i]->addListener(
             this->dataPtr->laserRetroMaterialSwitcher[i].get());
 
@@ -1120,8 +1599,9 @@ void Ogre2GpuRays::Setup2ndPass()
       Ogre::TextureFlags::RenderToTexture,
       Ogre::TextureTypes::Type2D);
 
+  // each ray writes one texel per echo
   this->dataPtr->secondPassTexture->setResolution(
-    this->dataPtr->w2nd, this->dataPtr->h2nd);
+    this->dataPtr->w2nd * this->dataPtr->returnsPerRay, this->dataPtr->h2nd);
   this->dataPtr->secondPassTexture->setNumMipmaps(1u);
   this->dataPtr->secondPassTexture->setPixelFormat(
     Ogre::PFG_RGBA32_FLOAT);
@@ -1130,9 +1610,13 @@ void Ogre2GpuRays::Setup2ndPass()
     Ogre::GpuResidency::Resident);
 
   // Create second pass material
-  // The GpuRaysScan2nd material is defined in script (gpu_rays.material).
+  // The GpuRaysScan2nd* materials are defined in script (gpu_rays.material).
   // We need to clone it since we are going to modify texture unit states.
   std::string mat2ndName = "GpuRaysScan2nd";
+  if (this->dataPtr->multiReturn)
+    mat2ndName = "GpuRaysScan2ndMultiReturn";
+  else if (this->dataPtr->rollingScan)
+    mat2ndName = "GpuRaysScan2ndRolling";
   Ogre::MaterialPtr mat2nd =
       Ogre::MaterialManager::getSingleton().getByName(mat2ndName);
   this->dataPtr->matSecondPass = mat2nd->clone(
@@ -1140,6 +1624,44 @@ void Ogre2GpuRays::Setup2ndPass()
   this->dataPtr->matSecondPass->load();
   Ogre::Pass *pass = this->dataPtr->matSecondPass->getTechnique(0)->getPass(0);
 
+  if (this->dataPtr->multiReturn)
+  {
+    // Set the uniform variables
+    // (see gpu_rays_2nd_pass_multi_return_fs.glsl).
+    Ogre::GpuProgramParametersSharedPtr psParams =
+        pass->getFragmentProgramParameters();
+    psParams->setNamedConstant("rangeCount",
+        Ogre::Vector2(this->dataPtr->w2nd, this->dataPtr->h2nd));
+    psParams->setNamedConstant("returnCount",
+        static_cast<float>(this->dataPtr->returnsPerRay));
+    psParams->setNamedConstant("returnMode",
+        static_cast<float>(this->ReturnMode()));
+    psParams->setNamedConstant("separation",
+        static_cast<float>(this->ReturnSeparation()));
+    psParams->setNamedConstant("near",
+        static_cast<float>(this->NearClipPlane()));
+    psParams->setNamedConstant("far",
+        static_cast<float>(this->FarClipPlane()));
+    psParams->setNamedConstant("max",
+        static_cast<float>(this->dataMaxVal));
+  }
+  else if (this->dataPtr->rollingScan)
+  {
+    // Set the uniform variables that do not change
+    // (see gpu_rays_2nd_pass_rolling_fs.glsl). The scan poses are set in
+    // UpdateRollingScan
+    Ogre::GpuProgramParametersSharedPtr psParams =
+        pass->getFragmentProgramParameters();
+    psParams->setNamedConstant("near",
+        static_cast<float>(this->NearClipPlane()));
+    psParams->setNamedConstant("far",
+        static_cast<float>(this->FarClipPlane()));
+    psParams->setNamedConstant("min",
+        static_cast<float>(this->dataMinVal));
+    psParams->setNamedConstant("max",
+        static_cast<float>(this->dataMaxVal));
+  }
+
   // Connect cubeUVTexture to the GpuRaysScan2nd material's texture unit state
   // The texture unit index (0) must match the one specified in the script
   // See GpuRaysScan2nd definition
@@ -1243,6 +1765,24 @@ void Ogre2GpuRays::CreateGpuRaysTextures()
   double boxSize = this->NearClipPlane() * 2 / std::sqrt(3.0);
   this->dataPtr->nearClipCube = boxSize * 0.5;
 
+  // the beam footprint only needs to be sampled if it can hit more than one
+  // surface or if multiple echoes are requested
+  this->dataPtr->multiReturn = this->BeamDivergence().Radian() > 0.0 ||
+      this->ReturnMode() == LRM_ALL;
+  this->dataPtr->returnsPerRay = this->ReturnMode() == LRM_ALL ?
+      this->ReturnCount() : 1u;
+
+  this->dataPtr->physicalIntensity = this->IntensityModel() == LIM_PHYSICAL;
+  this->dataPtr->rollingScanRequested = this->RollingScanEnabled();
+  this->dataPtr->rollingScan = this->RollingScanEnabled();
+  if (this->dataPtr->rollingScan && this->dataPtr->multiReturn)
+  {
+    ignwarn << "Rolling scan mode is not supported together with multiple "
+            << "returns. Disabling rolling scan for [" << this->Name() << "]"
+            << std::endl;
+    this->dataPtr->rollingScan = false;
+  }
+
   this->ConfigureCamera();
   this->CreateSampleTexture();
   this->Setup1stPass();
@@ -1255,10 +1795,17 @@ void Ogre2GpuRays::UpdateRenderTarget1stPass()
   Ogre::vector<Ogre::TextureGpu *>::type swappedTargets;
   swappedTargets.reserve(2u);
 
+  Ogre::Pass *pass = this->dataPtr->matFirstPass->getTechnique(0)->getPass(0);
+
   // update the compositors
   for (auto i : this->dataPtr->cubeFaceIdx)
   {
     this->scene->UpdateAllHeightmaps(this->dataPtr->cubeCam[i]);
+
+    // the participating media and the precipitation are integrated along
+    // rays in the view space of each cubemap face
+    this->scene->SetParticipatingMediaParams(pass, this->dataPtr->cubeCam[i]);
+    this->scene->SetPrecipitationParams(pass, this->dataPtr->cubeCam[i]);
     this->dataPtr->ogreCompositorWorkspace1st[i]->setEnabled(true);
 
     this->dataPtr->ogreCompositorWorkspace1st[i]->_validateFinalTarget();
@@ -1330,8 +1877,63 @@ void Ogre2GpuRays::Render()
 //////////////////////////////////////////////////
 void Ogre2GpuRays::PreRender()
 {
+  if (this->rayDirectionsDirty && this->dataPtr->cubeUVTexture)
+  {
+    // a new table of the same size that samples the same cubemap faces is
+    // only uploaded, otherwise recreate everything
+    if (!this->UpdateSampleTexture())
+      this->DestroyGpuRaysTextures();
+  }
+  this->rayDirectionsDirty = false;
+
+  if (this->dataPtr->cubeUVTexture &&
+      (this->dataPtr->rollingScanRequested != this->RollingScanEnabled() ||
+      this->dataPtr->physicalIntensity !=
+      (this->IntensityModel() == LIM_PHYSICAL)))
+  {
+    this->DestroyGpuRaysTextures();
+  }
+
   if (!this->dataPtr->cubeUVTexture)
     this->CreateGpuRaysTextures();
+
+  // the calibration of the physical intensity model can change at any time,
+  // see gpu_rays_1st_pass_fs.glsl
+  Ogre::Pass *pass = this->dataPtr->matFirstPass->getTechnique(0)->getPass(0);
+  pass->getFragmentProgramParameters()->setNamedConstant("intensityParams",
+      Ogre::Vector4(
+      this->dataPtr->physicalIntensity ? 1.0f : 0.0f,
+      static_cast<float>(this->IntensityScale()),
+      static_cast<float>(this->IntensityReferenceRange()),
+      static_cast<float>(this->IntensityRangeExponent())));
+
+  if (this->dataPtr->rollingScan)
+    this->UpdateRollingScan();
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::UpdateRollingScan()
+{
+  // the cubemap is rendered from the current pose. Express the scan poses
+  // relative to it
+  math::Pose3d pose = this->WorldPose();
+  math::Quaterniond invRot = pose.Rot().Inverse();
+  math::Quaterniond startRot = invRot * this->ScanStartPose().Rot();
+  math::Quaterniond endRot = invRot * this->ScanEndPose().Rot();
+  math::Vector3d startPos = invRot * (this->ScanStartPose().Pos() - pose.Pos());
+  math::Vector3d endPos = invRot * (this->ScanEndPose().Pos() - pose.Pos());
+
+  Ogre::Pass *pass = this->dataPtr->matSecondPass->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+  psParams->setNamedConstant("startRot", Ogre::Vector4(
+      startRot.X(), startRot.Y(), startRot.Z(), startRot.W()));
+  psParams->setNamedConstant("endRot", Ogre::Vector4(
+      endRot.X(), endRot.Y(), endRot.Z(), endRot.W()));
+  psParams->setNamedConstant("startPos", Ogre2Conversions::Convert(startPos));
+  psParams->setNamedConstant("endPos", Ogre2Conversions::Convert(endPos));
+  psParams->setNamedConstant("duration",
+      static_cast<float>(this->ScanDuration()));
 }
 
 //////////////////////////////////////////////////
@@ -1340,10 +1942,14 @@ void Ogre2GpuRays::PostRender()
   unsigned int width = this->dataPtr->w2nd;
   unsigned int height = this->dataPtr->h2nd;
 
+  // number of texels in a row of the second pass texture. Each echo of a
+  // ray is stored in its own texel
+  unsigned int texWidth = width * this->dataPtr->returnsPerRay;
+
   PixelFormat format = PF_FLOAT32_RGBA;
   unsigned int rawChannelCount = PixelUtil::ChannelCount(format);
   unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(format);
-  int rawLen = width * height * rawChannelCount;
+  int rawLen = texWidth * height * rawChannelCount;
 
   if (!this->dataPtr->gpuRaysBuffer)
   {
@@ -1361,9 +1967,9 @@ void Ogre2GpuRays::PostRender()
   for (unsigned int i = 0; i < height; ++i)
   {
     unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
-    unsigned int rowIdx = i * width * rawChannelCount;
+    unsigned int rowIdx = i * texWidth * rawChannelCount;
     memcpy(&this->dataPtr->gpuRaysBuffer[rowIdx], &bufferTmp[rawDataRowIdx],
-        width * rawChannelCount * bytesPerChannel);
+        texWidth * rawChannelCount * bytesPerChannel);
   }
 
   // Metal does not support RGB32_FLOAT so the internal texture format is
@@ -1375,16 +1981,18 @@ void Ogre2GpuRays::PostRender()
     this->dataPtr->gpuRaysScan = new float[outputLen];
   }
 
-  // copy data from RGBA buffer to RGB buffer
+  // copy data from RGBA buffer to RGB buffer. The echoes of a ray are next
+  // to each other so the output stays one contiguous buffer
+  const unsigned int texelChannels = this->channels;
   for (unsigned int row = 0; row < height; ++row)
   {
     // the texture box step size could be larger than our image buffer step
     // size
-    for (unsigned int column = 0; column < width; ++column)
+    for (unsigned int column = 0; column < texWidth; ++column)
     {
-      unsigned int idx = (row * width * this->Channels()) +
-          column * this->Channels();
-      unsigned int rawIdx = (row * width * rawChannelCount) +
+      unsigned int idx = (row * texWidth * texelChannels) +
+          column * texelChannels;
+      unsigned int rawIdx = (row * texWidth * rawChannelCount) +
           column * rawChannelCount;
 
       this->dataPtr->gpuRaysScan[idx] =
@@ -1431,7 +2039,23 @@ void Ogre2GpuRays::Copy(float *_dataDest)
   unsigned int height = this->dataPtr->h2nd;
 
   memcpy(_dataDest, this->dataPtr->gpuRaysScan,
-    width * height * 3 * sizeof(float));
+    width * height * this->Channels() * sizeof(float));
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2GpuRays::Channels() const
+{
+  // the number of echoes per ray is fixed once the textures are created
+  unsigned int returnsPerRay = this->dataPtr->cubeUVTexture ?
+      this->dataPtr->returnsPerRay :
+      (this->ReturnMode() == LRM_ALL ? this->ReturnCount() : 1u);
+  return this->channels * returnsPerRay;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2GpuRays::RetroUserDataKey() const
+{
+  return "laser_retro";
 }
 
 /////////////////////////////////////////////////
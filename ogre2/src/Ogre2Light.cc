@@ -300,3 +300,73 @@ void Ogre2SpotLight::SetFalloff(double _falloff)
 }
 
 //////////////////////////////////////////////////
+// Ogre2AreaLight
+//////////////////////////////////////////////////
+Ogre2AreaLight::Ogre2AreaLight()
+{
+  this->ogreLightType = Ogre::Light::LT_AREA_APPROX;
+}
+
+//////////////////////////////////////////////////
+Ogre2AreaLight::~Ogre2AreaLight()
+{
+}
+
+//////////////////////////////////////////////////
+math::Vector3d Ogre2AreaLight::Direction() const
+{
+  return Ogre2Conversions::Convert(this->ogreLight->getDirection());
+}
+
+//////////////////////////////////////////////////
+void Ogre2AreaLight::SetDirection(const math::Vector3d &_dir)
+{
+  this->ogreLight->setDirection(Ogre2Conversions::Convert(_dir));
+}
+
+//////////////////////////////////////////////////
+void Ogre2AreaLight::SetShape(AreaLightShape _shape)
+{
+  BaseAreaLight::SetShape(_shape);
+  this->scene->SetAreaLightsDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2AreaLight::SetSize(const math::Vector2d &_size)
+{
+  BaseAreaLight::SetSize(_size);
+  this->ogreLight->setRectSize(Ogre::Vector2(
+      static_cast<Ogre::Real>(this->size.X()),
+      static_cast<Ogre::Real>(this->size.Y())));
+  this->scene->SetAreaLightsDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2AreaLight::SetTexture(const std::string &_texture)
+{
+  BaseAreaLight::SetTexture(_texture);
+  this->scene->SetAreaLightsDirty();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2AreaLight::CastShadows() const
+{
+  return false;
+}
+
+//////////////////////////////////////////////////
+void Ogre2AreaLight::SetCastShadows(bool /*_castShadows*/)
+{
+  this->ogreLight->setCastShadows(false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2AreaLight::Destroy()
+{
+  Ogre2Light::Destroy();
+  // the scene drops area lights without an ogre light
+  this->ogreLight = nullptr;
+  this->scene->SetAreaLightsDirty();
+}
+
+//////////////////////////////////////////////////
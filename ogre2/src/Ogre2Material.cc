@@ -477,6 +477,8 @@ void Ogre2Material::SetEnvironmentMap(const std::string &_name)
     return;
   }
 
+  // an environment map takes precedence over the scene's reflection probes
+  this->ogreDatablock->setCubemapProbe(nullptr);
   this->environmentMapName = _name;
   this->SetTextureMapImpl(this->environmentMapName, Ogre::PBSM_REFLECTION);
 }
@@ -485,6 +487,7 @@ void Ogre2Material::SetEnvironmentMap(const std::string &_name)
 void Ogre2Material::ClearEnvironmentMap()
 {
   this->environmentMapName = "";
+  this->ogreDatablock->setCubemapProbe(nullptr);
   this->ogreDatablock->setTexture(
     Ogre::PBSM_REFLECTION, this->environmentMapName);
 }
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "Ogre2NormalIdMaterialSwitcher.hh"
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Heightmap.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreItem.h>
+#include <OgreMaterialManager.h>
+#include <OgreSceneManager.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+Ogre2NormalIdMaterialSwitcher::Ogre2NormalIdMaterialSwitcher(
+    Ogre2ScenePtr _scene)
+{
+  this->scene = _scene;
+
+  Ogre::ResourcePtr res =
+    Ogre::MaterialManager::getSingleton().load(
+        "ign-rendering/normal_material_id",
+        Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+
+  this->normalIdMaterial = res.staticCast<Ogre::Material>();
+  this->normalIdMaterial->load();
+}
+
+/////////////////////////////////////////////////
+Ogre2NormalIdMaterialSwitcher::~Ogre2NormalIdMaterialSwitcher()
+{
+}
+
+/////////////////////////////////////////////////
+unsigned int Ogre2NormalIdMaterialSwitcher::MaterialId(
+    const std::string &_name)
+{
+  auto it = this->materialIds.find(_name);
+  if (it != this->materialIds.end())
+    return it->second;
+
+  if (this->materialNames.size() >= kMaxMaterialId)
+  {
+    ignwarn << "Too many materials for 16 bit material ids. Material ["
+            << _name << "] is given id " << kMaxMaterialId << std::endl;
+    this->materialIds[_name] = kMaxMaterialId;
+    return kMaxMaterialId;
+  }
+
+  this->materialNames.push_back(_name);
+  unsigned int id = static_cast<unsigned int>(this->materialNames.size());
+  this->materialIds[_name] = id;
+  return id;
+}
+
+/////////////////////////////////////////////////
+std::string Ogre2NormalIdMaterialSwitcher::MaterialName(
+    unsigned int _id) const
+{
+  if (_id == 0u || _id > this->materialNames.size())
+    return std::string();
+  return this->materialNames[_id - 1u];
+}
+
+////////////////////////////////////////////////
+void Ogre2NormalIdMaterialSwitcher::cameraPreRenderScene(
+    Ogre::Camera * /*_cam*/)
+{
+  auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
+      Ogre::ItemFactory::FACTORY_TYPE_NAME);
+  while (itor.hasMoreElements())
+  {
+    Ogre::Item *item = static_cast<Ogre::Item *>(itor.peekNext());
+    itor.moveNext();
+
+    for (unsigned int i = 0; i < item->getNumSubItems(); ++i)
+    {
+      Ogre::SubItem *subItem = item->getSubItem(i);
+
+      // save the sub item material and use its name to find the id
+      std::string materialName;
+      if (!subItem->getMaterial().isNull())
+      {
+        // low level material, e.g. shaders
+        this->materialMap[subItem] = subItem->getMaterial();
+        materialName = subItem->getMaterial()->getName();
+      }
+      else
+      {
+        // regular Pbs Hlms datablock
+        Ogre::HlmsDatablock *datablock = subItem->getDatablock();
+        this->datablockMap[subItem] = datablock;
+        const Ogre::String *name = datablock->getNameStr();
+        materialName = name ? *name :
+            datablock->getName().getFriendlyText();
+      }
+
+      float id = this->MaterialId(materialName) /
+          static_cast<float>(kMaxMaterialId);
+      subItem->setCustomParameter(1, Ogre::Vector4(id, 0.0, 0.0, 1.0));
+      subItem->setMaterial(this->normalIdMaterial);
+    }
+  }
+
+  // disable heightmaps until we support changing their material
+  // TODO(anyone) add support for heightmaps
+  auto heightmaps = this->scene->Heightmaps();
+  for (auto h : heightmaps)
+  {
+    auto heightmap = h.lock();
+    if (heightmap)
+      heightmap->Parent()->SetVisible(false);
+  }
+}
+
+////////////////////////////////////////////////
+void Ogre2NormalIdMaterialSwitcher::cameraPostRenderScene(
+    Ogre::Camera * /*_cam*/)
+{
+  // restore item to use pbs hlms material
+  for (const auto &[subItem, dataBlock] : this->datablockMap)
+    subItem->setDatablock(dataBlock);
+
+  for (const auto &[subItem, material] : this->materialMap)
+    subItem->setMaterial(material);
+
+  this->datablockMap.clear();
+  this->materialMap.clear();
+
+  // re-enable heightmaps
+  auto heightmaps = this->scene->Heightmaps();
+  for (auto h : heightmaps)
+  {
+    auto heightmap = h.lock();
+    if (heightmap)
+      heightmap->Parent()->SetVisible(true);
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2NORMALIDMATERIALSWITCHER_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2NORMALIDMATERIALSWITCHER_HH_
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+#include "ignition/rendering/ogre2/Ogre2Camera.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace ignition
+{
+namespace rendering
+{
+inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Helper class that switches the material of all items to one that
+/// writes surface normals and material ids. Each material is assigned a
+/// 16 bit id the first time it is seen.
+class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2NormalIdMaterialSwitcher :
+  public Ogre::Camera::Listener
+{
+  /// \brief Constructor
+  /// \param[in] _scene The scene associated with the material switcher
+  public: explicit Ogre2NormalIdMaterialSwitcher(Ogre2ScenePtr _scene);
+
+  /// \brief Destructor
+  public: ~Ogre2NormalIdMaterialSwitcher();
+
+  /// \brief Ogre's pre render update callback
+  /// \param[in] _cam Ogre camera
+  public: virtual void cameraPreRenderScene(Ogre::Camera *_cam) override;
+
+  /// \brief Ogre's post render update callback
+  /// \param[in] _cam Ogre camera
+  public: virtual void cameraPostRenderScene(Ogre::Camera *_cam) override;
+
+  /// \brief Get the name of the material a material id was assigned to
+  /// \param[in] _id Material id
+  /// \return Material name, or an empty string if the id is not assigned
+  public: std::string MaterialName(unsigned int _id) const;
+
+  /// \brief Get the id of a material, assigning a new id if needed
+  /// \param[in] _name Material name
+  /// \return Material id
+  private: unsigned int MaterialId(const std::string &_name);
+
+  /// \brief Largest material id. Materials seen after all ids have been
+  /// assigned share this id.
+  private: static const unsigned int kMaxMaterialId = 65535u;
+
+  /// \brief A map of ogre sub item pointer to their original hlms material
+  private: std::unordered_map<Ogre::SubItem *,
+    Ogre::HlmsDatablock *> datablockMap;
+
+  /// \brief A map of ogre sub item pointer to their original low level
+  /// material
+  private: std::map<Ogre::SubItem *, Ogre::MaterialPtr> materialMap;
+
+  /// \brief Material that writes normals and material ids
+  private: Ogre::MaterialPtr normalIdMaterial;
+
+  /// \brief Material ids, key: material name
+  private: std::unordered_map<std::string, unsigned int> materialIds;
+
+  /// \brief Material names, the name of material id i is at index i - 1
+  private: std::vector<std::string> materialNames;
+
+  /// \brief Ogre2 Scene
+  private: Ogre2ScenePtr scene = nullptr;
+};
+}
+}  // namespace rendering
+}  // namespace ignition
+
+#endif  // IGNITION_RENDERING_OGRE2_OGRE2NORMALIDMATERIALSWITCHER_HH_
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+
+#include "ignition/rendering/ogre2/Ogre2ParticipatingMedia.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreCamera.h>
+#include <OgreGpuProgramParams.h>
+#include <OgrePass.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data class for Ogre2ParticipatingMedia
+class ignition::rendering::Ogre2ParticipatingMediaPrivate
+{
+  /// \brief True if the media have been destroyed
+  public: bool destroyed = false;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+namespace
+{
+  /// \brief Set a uniform if the fragment program declares it
+  /// \param[in] _params Fragment program parameters
+  /// \param[in] _name Uniform name
+  /// \param[in] _value Uniform value
+  template <typename V>
+  void setIfDeclared(const Ogre::GpuProgramParametersSharedPtr &_params,
+      const std::string &_name, const V &_value)
+  {
+    if (_params->_findNamedConstantDefinition(_name))
+      _params->setNamedConstant(_name, _value);
+  }
+}
+
+//////////////////////////////////////////////////
+Ogre2ParticipatingMedia::Ogre2ParticipatingMedia()
+    : dataPtr(new Ogre2ParticipatingMediaPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2ParticipatingMedia::~Ogre2ParticipatingMedia()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2ParticipatingMedia::Destroy()
+{
+  this->dataPtr->destroyed = true;
+
+  BaseParticipatingMedia::Destroy();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2ParticipatingMedia::IsDestroyed() const
+{
+  return this->dataPtr->destroyed;
+}
+
+//////////////////////////////////////////////////
+void Ogre2ParticipatingMedia::SetShaderParams(Ogre::Pass *_pass,
+    const Ogre::Camera *_camera) const
+{
+  if (!_pass || !_camera)
+    return;
+
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      _pass->getFragmentProgramParameters();
+
+  // extinction of the red, green and blue channels and of infrared
+  math::Vector3d extinction = this->absorption + this->scattering;
+  setIfDeclared(psParams, "mediaExtinction", Ogre::Vector4(
+      static_cast<Ogre::Real>(extinction.X()),
+      static_cast<Ogre::Real>(extinction.Y()),
+      static_cast<Ogre::Real>(extinction.Z()),
+      static_cast<Ogre::Real>(this->infraredExtinction)));
+
+  // light scattered towards the camera by media of infinite depth, i.e.
+  // the media color weighted by the scattering albedo of each channel
+  Ogre::Vector3 inscatter(Ogre::Vector3::ZERO);
+  for (unsigned int i = 0; i < 3u; ++i)
+  {
+    if (extinction[i] > 0.0)
+    {
+      inscatter[i] = static_cast<Ogre::Real>(
+          this->color[i] * this->scattering[i] / extinction[i]);
+    }
+  }
+  setIfDeclared(psParams, "mediaInscatter", inscatter);
+
+  // world up direction in view space and camera height above the base
+  // height, used to integrate the density along view rays
+  Ogre::Vector3 up = _camera->getDerivedOrientation().Inverse() *
+      Ogre::Vector3::UNIT_Z;
+  Ogre::Real height = _camera->getDerivedPosition().z -
+      static_cast<Ogre::Real>(this->baseHeight);
+  setIfDeclared(psParams, "mediaUp",
+      Ogre::Vector4(up.x, up.y, up.z, height));
+  setIfDeclared(psParams, "mediaFalloff",
+      static_cast<Ogre::Real>(this->heightFalloff));
+}
+
+//////////////////////////////////////////////////
+void Ogre2ParticipatingMedia::ClearShaderParams(Ogre::Pass *_pass)
+{
+  if (!_pass)
+    return;
+
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      _pass->getFragmentProgramParameters();
+  setIfDeclared(psParams, "mediaExtinction", Ogre::Vector4::ZERO);
+  setIfDeclared(psParams, "mediaInscatter", Ogre::Vector3::ZERO);
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+#include "Ogre2ParticipatingMediaPass.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
+#include <OgreCamera.h>
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2ParticipatingMediaPass::Ogre2ParticipatingMediaPass(
+    Ogre2ScenePtr _scene)
+{
+  this->scene = _scene;
+}
+
+//////////////////////////////////////////////////
+Ogre2ParticipatingMediaPass::~Ogre2ParticipatingMediaPass()
+{
+}
+
+//////////////////////////////////////////////////
+void Ogre2ParticipatingMediaPass::PreRender()
+{
+  if (!this->mediaMat || !this->ogreCamera || !this->scene)
+    return;
+
+  if (!this->enabled)
+    return;
+
+  // These parameters are declared in
+  // media/materials/scripts/camera_effects.material and
+  // media/materials/programs/GLSL/participating_media_fs.glsl
+  Ogre::Pass *pass = this->mediaMat->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+
+  // The projection params linearize the depth buffer into view space depth
+  // and the inverse projection scale turns it into a view space position
+  psParams->setNamedConstant("projectionParams",
+      this->ogreCamera->getProjectionParamsAB());
+  const Ogre::Matrix4 &proj = this->ogreCamera->getProjectionMatrix();
+  psParams->setNamedConstant("invProjectionScale",
+      Ogre::Vector2(1.0f / proj[0][0], 1.0f / proj[1][1]));
+
+  this->scene->SetParticipatingMediaParams(pass, this->ogreCamera);
+}
+
+//////////////////////////////////////////////////
+void Ogre2ParticipatingMediaPass::CreateRenderPass()
+{
+  // the node definition only needs to be created once
+  if (!this->ogreCompositorNodeDefName.empty())
+    return;
+
+  static int mediaNodeCounter = 0;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  std::string nodeDefName = "ParticipatingMediaNode_"
+      + std::to_string(mediaNodeCounter);
+
+  if (ogreCompMgr->hasNodeDefinition(nodeDefName))
+    return;
+
+  // The material is defined in script (camera_effects.material).
+  // clone the material
+  std::string matName = "ParticipatingMedia";
+  Ogre::MaterialPtr ogreMat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!ogreMat)
+  {
+    ignerr << "Participating media material not found: '" << matName << "'"
+           << std::endl;
+    return;
+  }
+  if (!ogreMat->isLoaded())
+    ogreMat->load();
+  std::string materialName = matName + "_" +
+      std::to_string(mediaNodeCounter);
+  this->mediaMat = ogreMat->clone(materialName).get();
+
+  // create the compositor node definition
+  //
+  // compositor_node ParticipatingMediaNode
+  // {
+  //   in 0 rt_input
+  //   in 1 rt_output
+  //
+  //   texture rt_depth target_width target_height PFG_D32_FLOAT
+  //
+  //   target rt_depth
+  //   {
+  //     pass render_scene
+  //     {
+  //       load { all clear }
+  //       rq_first 0
+  //       rq_last 2
+  //     }
+  //   }
+  //   target rt_output
+  //   {
+  //     pass render_quad
+  //     {
+  //       material ParticipatingMedia_0
+  //       input 0 rt_input
+  //       input 1 rt_depth
+  //     }
+  //   }
+  //   out 0 rt_output
+  //   out 1 rt_input
+  // }
+  this->ogreCompositorNodeDefName = nodeDefName;
+  mediaNodeCounter++;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+
+  // Input texture
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName("rt_output", 1,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  // the depth of opaque objects. Transparent objects are blended into
+  // the image after the media that are behind them are applied, so they
+  // are left out like in the depth buffer of the base scene pass.
+  std::string depthTexName = "rt_depth";
+  Ogre::TextureDefinitionBase::TextureDefinition *depthTexDef =
+      nodeDef->addTextureDefinition(depthTexName);
+  depthTexDef->textureType = Ogre::TextureTypes::Type2D;
+  depthTexDef->width = 0;
+  depthTexDef->height = 0;
+  depthTexDef->widthFactor = 1;
+  depthTexDef->heightFactor = 1;
+  depthTexDef->format = Ogre::PFG_D32_FLOAT;
+  depthTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+  depthTexDef->depthBufferFormat = Ogre::PFG_UNKNOWN;
+  Ogre::RenderTargetViewDef *rtvDepth =
+      nodeDef->addRenderTextureView(depthTexName);
+  rtvDepth->setForTextureDefinition(depthTexName, depthTexDef);
+
+  nodeDef->setNumTargetPass(2);
+
+  Ogre::CompositorTargetDef *depthTargetDef =
+      nodeDef->addTargetPass(depthTexName);
+  depthTargetDef->setNumPasses(1);
+  {
+    // scene pass. The visibility mask of the render target is applied by
+    // Ogre2RenderTargetCompositorListener
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        depthTargetDef->addPass(Ogre::PASS_SCENE));
+    passScene->setAllLoadActions(Ogre::LoadAction::Clear);
+    passScene->mIncludeOverlays = false;
+    passScene->mFirstRQ = 0u;
+    passScene->mLastRQ = 2u;
+  }
+
+  // rt_output target
+  Ogre::CompositorTargetDef *outputTargetDef =
+      nodeDef->addTargetPass("rt_output");
+  outputTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        outputTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = materialName;
+    passQuad->addQuadTextureSource(0, "rt_input");
+    passQuad->addQuadTextureSource(1, depthTexName);
+  }
+
+  nodeDef->mapOutputChannel(0, "rt_output");
+  nodeDef->mapOutputChannel(1, "rt_input");
+}
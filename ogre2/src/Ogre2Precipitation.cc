@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cmath>
+#include <string>
+
+#include <ignition/math/Rand.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Precipitation.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreCamera.h>
+#include <OgreGpuProgramParams.h>
+#include <OgrePass.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data class for Ogre2Precipitation
+class ignition::rendering::Ogre2PrecipitationPrivate
+{
+  /// \brief True if the precipitation has been destroyed
+  public: bool destroyed = false;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+namespace
+{
+  /// \brief Exposure time used to compute the length of the streaks that
+  /// falling particles leave in camera images, in seconds
+  const double kStreakTime = 1.0 / 60.0;
+
+  /// \brief Period after which the scene time used to animate the
+  /// particles wraps around, in seconds. It keeps the particle positions
+  /// within the precision of the shader floats.
+  const double kTimePeriod = 3600.0;
+
+  /// \brief Set a uniform if the fragment program declares it
+  /// \param[in] _params Fragment program parameters
+  /// \param[in] _name Uniform name
+  /// \param[in] _value Uniform value
+  template <typename V>
+  void setIfDeclared(const Ogre::GpuProgramParametersSharedPtr &_params,
+      const std::string &_name, const V &_value)
+  {
+    if (_params->_findNamedConstantDefinition(_name))
+      _params->setNamedConstant(_name, _value);
+  }
+}
+
+//////////////////////////////////////////////////
+Ogre2Precipitation::Ogre2Precipitation()
+    : dataPtr(new Ogre2PrecipitationPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2Precipitation::~Ogre2Precipitation()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Precipitation::Destroy()
+{
+  this->dataPtr->destroyed = true;
+
+  BasePrecipitation::Destroy();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Precipitation::IsDestroyed() const
+{
+  return this->dataPtr->destroyed;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Precipitation::SetShaderParams(Ogre::Pass *_pass,
+    const Ogre::Camera *_camera) const
+{
+  if (!_pass || !_camera)
+    return;
+
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      _pass->getFragmentProgramParameters();
+
+  bool snow = this->type == PT_SNOW;
+  double diameter = this->ParticleDiameter();
+
+  // particles reflect enough light to be detected by lidars up to a
+  // range that grows with their size, since the returned power scales
+  // with their cross section over the squared range
+  double detectionRange = 2500.0 * diameter;
+  setIfDeclared(psParams, "precipScatter", Ogre::Vector4(
+      static_cast<Ogre::Real>(this->Extinction()),
+      static_cast<Ogre::Real>(detectionRange),
+      static_cast<Ogre::Real>(this->Wetness()),
+      static_cast<Ogre::Real>(this->laserRetro)));
+
+  // particle velocity relative to the ground. The particles are laid out
+  // in cells around the sensor and the fraction of occupied cells grows
+  // with the rate. Snow flakes are opaque and far more numerous than rain
+  // drops for the same liquid water rate.
+  math::Vector3d velocity = this->windVelocity -
+      math::Vector3d::UnitZ * this->FallSpeed();
+  double occupancy = 1.0 - std::exp(-this->rate / (snow ? 2.0 : 20.0));
+  setIfDeclared(psParams, "precipParticle", Ogre::Vector4(
+      static_cast<Ogre::Real>(diameter * 0.5),
+      static_cast<Ogre::Real>(velocity.Length() * kStreakTime),
+      static_cast<Ogre::Real>(snow ? 0.9 : 0.25),
+      static_cast<Ogre::Real>(occupancy)));
+
+  double time = std::fmod(std::chrono::duration<double>(
+      this->scene->Time()).count(), kTimePeriod);
+  setIfDeclared(psParams, "precipVelocity", Ogre::Vector4(
+      static_cast<Ogre::Real>(velocity.X()),
+      static_cast<Ogre::Real>(velocity.Y()),
+      static_cast<Ogre::Real>(velocity.Z()),
+      static_cast<Ogre::Real>(time)));
+
+  // world frame axes in view space, used to anchor the particles in the
+  // world while the sensor rotates, and a seed that changes every frame
+  // for the lidar returns
+  Ogre::Quaternion viewRot = _camera->getDerivedOrientation().Inverse();
+  Ogre::Vector3 up = viewRot * Ogre::Vector3::UNIT_Z;
+  Ogre::Vector3 east = viewRot * Ogre::Vector3::UNIT_X;
+  setIfDeclared(psParams, "precipUp", Ogre::Vector4(up.x, up.y, up.z,
+      static_cast<Ogre::Real>(math::Rand::DblUniform(0.0, 1.0))));
+  setIfDeclared(psParams, "precipEast", east);
+}
+
+//////////////////////////////////////////////////
+void Ogre2Precipitation::ClearShaderParams(Ogre::Pass *_pass)
+{
+  if (!_pass)
+    return;
+
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      _pass->getFragmentProgramParameters();
+  setIfDeclared(psParams, "precipScatter", Ogre::Vector4::ZERO);
+  setIfDeclared(psParams, "precipParticle", Ogre::Vector4::ZERO);
+}
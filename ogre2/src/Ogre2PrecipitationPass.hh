@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2PRECIPITATIONPASS_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2PRECIPITATIONPASS_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderPass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace Ogre
+{
+  class Material;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Render pass that applies the precipitation of a scene to the
+    /// image of a camera. It is not created through the render pass system
+    /// but added by Ogre2RenderTarget in front of the render passes of
+    /// each camera while the scene has a precipitation.
+    ///
+    /// The pass renders the opaque objects into a depth texture, darkens
+    /// wet surfaces and draws the particles that are in front of the
+    /// objects.
+    class Ogre2PrecipitationPass : public Ogre2RenderPass
+    {
+      /// \brief Constructor
+      /// \param[in] _scene Scene whose precipitation is applied
+      public: explicit Ogre2PrecipitationPass(Ogre2ScenePtr _scene);
+
+      /// \brief Destructor
+      public: virtual ~Ogre2PrecipitationPass();
+
+      // Documentation inherited
+      public: void PreRender() override;
+
+      // Documentation inherited
+      public: void CreateRenderPass() override;
+
+      /// \brief Pointer to the precipitation ogre material
+      private: Ogre::Material *precipitationMat = nullptr;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/Light.hh"
+#include "ignition/rendering/ogre2/Ogre2Conversions.hh"
+#include "ignition/rendering/ogre2/Ogre2ProceduralSky.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreSceneManager.h>
+#include <OgreTechnique.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data class for Ogre2ProceduralSky
+class ignition::rendering::Ogre2ProceduralSkyPrivate
+{
+  /// \brief Name of the material defined in procedural_sky.material
+  public: const std::string kProceduralSkyMaterialName = "ProceduralSky";
+
+  /// \brief Height of the cloud layer in meters, used to convert the
+  /// wind velocity into a motion of the cloud texture
+  public: const double kCloudHeight = 1000.0;
+
+  /// \brief Fraction of light reflected by the ground, used for the
+  /// ambient light of downward facing surfaces
+  public: const double kGroundAlbedo = 0.3;
+
+  /// \brief Sky material used by the cameras of the scene
+  public: Ogre::MaterialPtr ogreMaterial;
+
+  /// \brief True if the sky has been destroyed
+  public: bool destroyed = false;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2ProceduralSky::Ogre2ProceduralSky()
+    : dataPtr(new Ogre2ProceduralSkyPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2ProceduralSky::~Ogre2ProceduralSky()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2ProceduralSky::Init()
+{
+  BaseProceduralSky::Init();
+
+  // cameras refer to the material by name when building their
+  // compositors, so it has to exist before they first render
+  Ogre::MaterialManager &matManager = Ogre::MaterialManager::getSingleton();
+  std::string matName = this->OgreMaterialName();
+  this->dataPtr->ogreMaterial = matManager.getByName(matName);
+  if (!this->dataPtr->ogreMaterial)
+  {
+    Ogre::MaterialPtr skyMat =
+        matManager.getByName(this->dataPtr->kProceduralSkyMaterialName);
+    if (!skyMat)
+    {
+      ignerr << "Unable to find procedural sky material" << std::endl;
+      return;
+    }
+    this->dataPtr->ogreMaterial = skyMat->clone(matName);
+  }
+  this->dataPtr->ogreMaterial->load();
+}
+
+//////////////////////////////////////////////////
+void Ogre2ProceduralSky::Destroy()
+{
+  // the material is kept as it is still referenced by the compositors of
+  // cameras that rendered the sky
+  this->sunLight.reset();
+  this->dataPtr->destroyed = true;
+
+  BaseProceduralSky::Destroy();
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2ProceduralSky::OgreMaterialName() const
+{
+  return this->dataPtr->kProceduralSkyMaterialName + "_" +
+      this->scene->Name();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2ProceduralSky::UpdateForRender()
+{
+  if (this->dataPtr->destroyed || !this->dataPtr->ogreMaterial)
+    return false;
+
+  // These parameters are declared in
+  // media/materials/programs/GLSL/procedural_sky_fs.glsl
+  Ogre::Pass *pass = this->dataPtr->ogreMaterial->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+  psParams->setNamedConstant("sunDirection",
+      Ogre2Conversions::Convert(this->sunDirection));
+  psParams->setNamedConstant("betaR", Ogre2Conversions::Convert(this->betaR));
+  psParams->setNamedConstant("betaM", Ogre2Conversions::Convert(this->betaM));
+  psParams->setNamedConstant("sunE", static_cast<Ogre::Real>(this->sunE));
+  psParams->setNamedConstant("mieG", static_cast<Ogre::Real>(this->mieG));
+  psParams->setNamedConstant("exposure",
+      static_cast<Ogre::Real>(this->exposure));
+  psParams->setNamedConstant("cloudCover",
+      static_cast<Ogre::Real>(this->cloudCover));
+
+  // clouds drift with the wind based on scene time
+  double t = std::chrono::duration<double>(this->scene->Time()).count();
+  math::Vector2d offset =
+      this->windVelocity * (t / this->dataPtr->kCloudHeight);
+  float cloudOffset[2] = {static_cast<float>(offset.X()),
+      static_cast<float>(offset.Y())};
+  psParams->setNamedConstant("cloudOffset", cloudOffset, 1u, 2u);
+
+  // clouds are lit by the sky and, on their sunny side, by the sun
+  Ogre::ColourValue ambient = Ogre2Conversions::Convert(this->ambientColor);
+  Ogre::ColourValue sun = Ogre2Conversions::Convert(this->sunColor);
+  Ogre::ColourValue cloud = ambient * 1.5f + sun * 0.3f;
+  psParams->setNamedConstant("cloudColor",
+      Ogre::Vector3(cloud.r, cloud.g, cloud.b));
+  psParams->setNamedConstant("sunColor", Ogre::Vector3(sun.r, sun.g, sun.b));
+
+  if (!this->lightingDirty)
+    return false;
+
+  if (this->sunLight)
+  {
+    // light direction points away from the sun
+    this->sunLight->SetDirection(-this->sunDirection);
+    this->sunLight->SetDiffuseColor(this->sunColor);
+    this->sunLight->SetSpecularColor(this->sunColor);
+  }
+
+  // downward facing surfaces receive the sky and sun light reflected by
+  // the ground
+  double sunZ = std::max(0.0, this->sunDirection.Z());
+  Ogre::ColourValue ground = (ambient + sun * static_cast<float>(sunZ)) *
+      static_cast<float>(this->dataPtr->kGroundAlbedo);
+  ground.a = 1.0f;
+  this->scene->OgreSceneManager()->setAmbientLight(ambient, ground,
+      Ogre::Vector3::UNIT_Z);
+
+  this->lightingDirty = false;
+  return true;
+}
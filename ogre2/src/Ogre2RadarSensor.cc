@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Rand.hh>
+
+#include "ignition/rendering/ogre2/Ogre2RadarSensor.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+/// \internal
+/// \brief Private data for the Ogre2RadarSensor class
+class ignition::rendering::Ogre2RadarSensorPrivate
+{
+  /// \brief Rays that fall in the same resolution cell
+  public: struct Cell
+  {
+    /// \brief Number of rays in the cell
+    public: unsigned int count = 0u;
+
+    /// \brief Sum of the ranges of the rays
+    public: double range = 0.0;
+
+    /// \brief Sum of the azimuths of the rays
+    public: double azimuth = 0.0;
+
+    /// \brief Sum of the elevations of the rays
+    public: double elevation = 0.0;
+
+    /// \brief Sum of the radial velocities of the rays
+    public: double radialVelocity = 0.0;
+
+    /// \brief Largest radar cross section of the rays
+    public: double rcs = 0.0;
+  };
+
+  /// \brief Event triggered when new detections are available
+  public: ignition::common::EventT<void(const RadarDetection *,
+      unsigned int)> newDetections;
+
+  /// \brief Detections of the last frame
+  public: std::vector<RadarDetection> detections;
+
+  /// \brief Random number generator for the clutter
+  public: std::mt19937 generator{math::Rand::Seed()};
+
+  /// \brief A hit point is assigned to a moving visual if it is within this
+  /// distance of the world bounding box of the visual, to account for the
+  /// precision of the depth buffer
+  public: const double kBoundingBoxTolerance = 0.01;
+
+  /// \brief Largest radar cross section of a clutter detection in m^2
+  public: const double kMaxClutterRcs = 1.0;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2RadarSensor::Ogre2RadarSensor()
+  : dataPtr(new Ogre2RadarSensorPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2RadarSensor::~Ogre2RadarSensor()
+{
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2RadarSensor::RetroUserDataKey() const
+{
+  return "radar_cross_section";
+}
+
+//////////////////////////////////////////////////
+void Ogre2RadarSensor::PostRender()
+{
+  Ogre2GpuRays::PostRender();
+
+  this->UpdateDetections();
+  this->dataPtr->newDetections(this->dataPtr->detections.data(),
+      static_cast<unsigned int>(this->dataPtr->detections.size()));
+}
+
+//////////////////////////////////////////////////
+void Ogre2RadarSensor::UpdateDetections()
+{
+  this->dataPtr->detections.clear();
+
+  const float *data = this->Data();
+  if (!data)
+    return;
+
+  const unsigned int width = static_cast<unsigned int>(this->RangeCount());
+  const unsigned int height =
+      static_cast<unsigned int>(this->VerticalRangeCount());
+  const unsigned int channels = this->Channels();
+  const double nearClip = this->NearClipPlane();
+  const double farClip = this->FarClipPlane();
+  const math::Pose3d pose = this->WorldPose();
+
+  // world bounding boxes of the moving visuals
+  std::vector<std::pair<math::AxisAlignedBox, math::Vector3d>> movers;
+  for (const auto &it : this->visualVelocities)
+  {
+    VisualPtr visual = this->scene->VisualById(it.first);
+    if (!visual)
+      continue;
+    math::AxisAlignedBox box = visual->BoundingBox();
+    movers.emplace_back(math::AxisAlignedBox(
+        box.Min() - this->dataPtr->kBoundingBoxTolerance,
+        box.Max() + this->dataPtr->kBoundingBoxTolerance), it.second);
+  }
+
+  // same ray layout as the gpu rays sample texture
+  const bool useTable = !this->rayDirections.empty();
+  const double hMin = this->AngleMin().Radian();
+  const double vMin = this->VerticalAngleMin().Radian();
+  const double hStep = width > 1u ?
+      (this->AngleMax().Radian() - hMin) / (width - 1u) : 0.0;
+  const double vStep = height > 1u ?
+      (this->VerticalAngleMax().Radian() - vMin) / (height - 1u) : 0.0;
+
+  // bounds of the cone, used to spread the clutter
+  math::Vector2d coneMin(std::numeric_limits<double>::max(),
+      std::numeric_limits<double>::max());
+  math::Vector2d coneMax(-coneMin.X(), -coneMin.Y());
+
+  // cells are centered on the boresight of the sensor
+  const double rangeRes = this->rangeResolution;
+  const double angleRes = this->angleResolution.Radian();
+  std::map<std::tuple<int, int, int>, Ogre2RadarSensorPrivate::Cell> cells;
+  for (unsigned int i = 0u; i < height; ++i)
+  {
+    for (unsigned int j = 0u; j < width; ++j)
+    {
+      double h = hMin + j * hStep;
+      double v = vMin + i * vStep;
+      if (useTable)
+      {
+        const math::Vector2d &dir = this->rayDirections[i * width + j];
+        h = dir.X();
+        v = dir.Y();
+      }
+      coneMin.Min(math::Vector2d(h, v));
+      coneMax.Max(math::Vector2d(h, v));
+
+      // the first return of the ray holds the range and radar cross section
+      unsigned int idx = (i * width + j) * channels;
+      double range = data[idx];
+      double rcs = data[idx + 1];
+      if (!std::isfinite(range) || range < nearClip || range >= farClip ||
+          rcs <= 0.0)
+      {
+        continue;
+      }
+
+      math::Vector3d dir(std::cos(v) * std::cos(h),
+          std::cos(v) * std::sin(h), std::sin(v));
+      math::Vector3d worldDir = pose.Rot() * dir;
+      math::Vector3d point = pose.Pos() + worldDir * range;
+
+      // use the velocity of the smallest moving visual that contains the
+      // hit point
+      math::Vector3d velocity;
+      double volume = std::numeric_limits<double>::max();
+      for (const auto &mover : movers)
+      {
+        if (mover.first.Contains(point) && mover.first.Volume() < volume)
+        {
+          volume = mover.first.Volume();
+          velocity = mover.second;
+        }
+      }
+
+      auto key = std::make_tuple(
+          static_cast<int>(std::floor(range / rangeRes)),
+          static_cast<int>(std::floor(h / angleRes + 0.5)),
+          static_cast<int>(std::floor(v / angleRes + 0.5)));
+      Ogre2RadarSensorPrivate::Cell &cell = cells[key];
+      cell.count++;
+      cell.range += range;
+      cell.azimuth += h;
+      cell.elevation += v;
+      cell.radialVelocity += (velocity - this->linearVelocity).Dot(worldDir);
+      cell.rcs = std::max(cell.rcs, rcs);
+    }
+  }
+
+  for (const auto &it : cells)
+  {
+    const Ogre2RadarSensorPrivate::Cell &cell = it.second;
+    RadarDetection detection;
+    detection.range = cell.range / cell.count;
+    detection.azimuth = cell.azimuth / cell.count;
+    detection.elevation = cell.elevation / cell.count;
+    detection.radialVelocity = cell.radialVelocity / cell.count;
+    detection.rcs = cell.rcs;
+    this->dataPtr->detections.push_back(detection);
+  }
+
+  // false detections of static clutter, seen moving against the sensor
+  if (this->clutterRate > 0.0 && coneMin.X() <= coneMax.X())
+  {
+    std::poisson_distribution<unsigned int> clutterCount(this->clutterRate);
+    unsigned int count = clutterCount(this->dataPtr->generator);
+    for (unsigned int i = 0u; i < count; ++i)
+    {
+      RadarDetection detection;
+      detection.range = math::Rand::DblUniform(nearClip, farClip);
+      detection.azimuth = math::Rand::DblUniform(coneMin.X(), coneMax.X());
+      detection.elevation = math::Rand::DblUniform(coneMin.Y(), coneMax.Y());
+      math::Vector3d dir(
+          std::cos(detection.elevation) * std::cos(detection.azimuth),
+          std::cos(detection.elevation) * std::sin(detection.azimuth),
+          std::sin(detection.elevation));
+      detection.radialVelocity =
+          -this->linearVelocity.Dot(pose.Rot() * dir);
+      detection.rcs =
+          math::Rand::DblUniform(0.0, this->dataPtr->kMaxClutterRcs);
+      this->dataPtr->detections.push_back(detection);
+    }
+  }
+
+  std::sort(this->dataPtr->detections.begin(),
+      this->dataPtr->detections.end(),
+      [](const RadarDetection &_a, const RadarDetection &_b)
+      {
+        return _a.range < _b.range;
+      });
+}
+
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr Ogre2RadarSensor::ConnectNewDetections(
+    std::function<void(const RadarDetection *, unsigned int)> _subscriber)
+{
+  return this->dataPtr->newDetections.Connect(_subscriber);
+}
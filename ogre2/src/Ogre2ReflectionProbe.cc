@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <string>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Conversions.hh"
+#include "ignition/rendering/ogre2/Ogre2ReflectionProbe.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Cubemaps/OgreCubemapProbe.h>
+#include <Cubemaps/OgreParallaxCorrectedCubemap.h>
+#include <OgreMatrix3.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data class for Ogre2ReflectionProbe
+class ignition::rendering::Ogre2ReflectionProbePrivate
+{
+  /// \brief Ogre cubemap probe
+  public: Ogre::CubemapProbe *ogreProbe = nullptr;
+
+  /// \brief Resolution the probe texture was created with
+  public: unsigned int textureResolution = 0u;
+
+  /// \brief Near clip plane the probe workspace was created with
+  public: double workspaceNear = 0.0;
+
+  /// \brief Far clip plane the probe workspace was created with
+  public: double workspaceFar = 0.0;
+
+  /// \brief Definition the probe workspace was created with
+  public: std::string workspaceDefName;
+
+  /// \brief True if the probe has been destroyed
+  public: bool destroyed = false;
+
+  /// \brief Whether a warning was printed for a capture position outside
+  /// of the probe's area
+  public: bool positionWarned = false;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2ReflectionProbe::Ogre2ReflectionProbe()
+    : dataPtr(new Ogre2ReflectionProbePrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2ReflectionProbe::~Ogre2ReflectionProbe()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2ReflectionProbe::Destroy()
+{
+  if (this->dataPtr->ogreProbe)
+  {
+    // materials must stop using the probe before it is destroyed
+    this->scene->ClearReflectionProbe(this->dataPtr->ogreProbe);
+    this->scene->OgreParallaxCorrectedCubemap()->destroyProbe(
+        this->dataPtr->ogreProbe);
+    this->dataPtr->ogreProbe = nullptr;
+  }
+  this->dataPtr->destroyed = true;
+
+  BaseReflectionProbe::Destroy();
+}
+
+//////////////////////////////////////////////////
+Ogre::CubemapProbe *Ogre2ReflectionProbe::OgreCubemapProbe() const
+{
+  return this->dataPtr->ogreProbe;
+}
+
+//////////////////////////////////////////////////
+void Ogre2ReflectionProbe::UpdateOgreProbe()
+{
+  if (!this->dataPtr->ogreProbe)
+  {
+    this->dataPtr->ogreProbe =
+        this->scene->OgreParallaxCorrectedCubemap()->createProbe();
+  }
+
+  Ogre::CubemapProbe *probe = this->dataPtr->ogreProbe;
+  if (this->dataPtr->textureResolution != this->resolution)
+  {
+    // manual probes are assigned to datablocks by the scene instead of
+    // being blended based on the camera position. Setting the texture
+    // params destroys the workspace, which is recreated below.
+    probe->setTextureParams(this->resolution, this->resolution, true,
+        Ogre::PFG_RGBA8_UNORM_SRGB, this->isStatic);
+    this->dataPtr->textureResolution = this->resolution;
+    this->dataPtr->workspaceNear = 0.0;
+  }
+
+  // the definition changes when a procedural sky is added to the scene
+  std::string wsDefName = this->scene->ReflectionProbeWorkspaceDefName();
+  if (!math::equal(this->dataPtr->workspaceNear, this->nearClip) ||
+      !math::equal(this->dataPtr->workspaceFar, this->farClip) ||
+      this->dataPtr->workspaceDefName != wsDefName)
+  {
+    probe->initWorkspace(static_cast<float>(this->nearClip),
+        static_cast<float>(this->farClip), wsDefName);
+    this->dataPtr->workspaceNear = this->nearClip;
+    this->dataPtr->workspaceFar = this->farClip;
+    this->dataPtr->workspaceDefName = wsDefName;
+  }
+}
+
+//////////////////////////////////////////////////
+bool Ogre2ReflectionProbe::UpdateCapture()
+{
+  std::chrono::steady_clock::duration time = this->scene->Time();
+  if (this->dataPtr->destroyed || !this->NeedsCapture(time))
+    return false;
+
+  this->UpdateOgreProbe();
+
+  // ogre requires the capture position to be inside the area
+  math::Vector3d position = this->capturePosition;
+  if (!this->area.Contains(position))
+  {
+    if (!this->dataPtr->positionWarned)
+    {
+      ignwarn << "Capture position of reflection probe [" << this->Name()
+              << "] is outside of its area. Clamping to the area."
+              << std::endl;
+      this->dataPtr->positionWarned = true;
+    }
+    position.Max(this->area.Min());
+    position.Min(this->area.Max());
+  }
+
+  Ogre::Aabb area(Ogre2Conversions::Convert(this->area.Center()),
+      Ogre2Conversions::Convert(this->area.Size() * 0.5));
+
+  Ogre::CubemapProbe *probe = this->dataPtr->ogreProbe;
+  probe->setStatic(this->isStatic);
+  probe->set(Ogre2Conversions::Convert(position), area,
+      Ogre::Vector3::UNIT_SCALE, Ogre::Matrix3::IDENTITY, area);
+  probe->mDirty = true;
+  probe->_updateRender();
+
+  this->MarkCaptured(time);
+  return true;
+}
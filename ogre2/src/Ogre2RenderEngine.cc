@@ -27,6 +27,8 @@
   // pulled in by anybody (e.g., Boost).
   #include <Winsock2.h>
 #endif
+#include <thread>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Filesystem.hh>
 #include <ignition/common/Util.hh>
@@ -55,6 +57,10 @@ class ignition::rendering::Ogre2RenderEnginePrivate
   /// \brief The graphics API to use
   public: ignition::rendering::GraphicsAPI graphicsAPI{GraphicsAPI::OPENGL};
 
+  /// \brief Thread the OpenGL context is current on, if the engine owns
+  /// the context
+  public: std::thread::id contextThread;
+
   /// \brief A list of supported fsaa levels
   public: std::vector<unsigned int> fsaaLevels;
 
@@ -361,6 +367,12 @@ void Ogre2RenderEngine::LoadAttempt()
   this->ogreRoot->initialise(false);
   this->CreateRenderWindow();
   this->CreateResources();
+
+  if (!this->useCurrentGLContext &&
+      this->dataPtr->graphicsAPI == GraphicsAPI::OPENGL)
+  {
+    this->dataPtr->contextThread = std::this_thread::get_id();
+  }
 }
 
 //////////////////////////////////////////////////
@@ -999,6 +1011,12 @@ GraphicsAPI Ogre2RenderEngine::GraphicsAPI() const
   return this->dataPtr->graphicsAPI;
 }
 
+//////////////////////////////////////////////////
+std::thread::id Ogre2RenderEngine::GraphicsContextThread() const
+{
+  return this->dataPtr->contextThread;
+}
+
 //////////////////////////////////////////////////
 void Ogre2RenderEngine::InitAttempt()
 {
@@ -38,6 +38,7 @@ Ogre2RenderPass::~Ogre2RenderPass()
 //////////////////////////////////////////////////
 void Ogre2RenderPass::Destroy()
 {
+  this->ogreCamera = nullptr;
 }
 
 //////////////////////////////////////////////////
@@ -46,6 +47,18 @@ void Ogre2RenderPass::CreateRenderPass()
   // To be overriden by derived render pass classes
 }
 
+//////////////////////////////////////////////////
+void Ogre2RenderPass::SetCamera(Ogre::Camera *_camera)
+{
+  this->ogreCamera = _camera;
+}
+
+//////////////////////////////////////////////////
+Ogre::Camera *Ogre2RenderPass::Camera() const
+{
+  return this->ogreCamera;
+}
+
 //////////////////////////////////////////////////
 std::string Ogre2RenderPass::OgreCompositorNodeDefinitionName() const
 {
@@ -15,8 +15,12 @@
  *
  */
 
+#include <memory>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 
+#include "ignition/rendering/AmbientOcclusionPass.hh"
 #include "ignition/rendering/Material.hh"
 
 #include "ignition/rendering/ogre2/Ogre2Includes.hh"
@@ -27,6 +31,9 @@
 #include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
 
+#include "Ogre2ParticipatingMediaPass.hh"
+#include "Ogre2PrecipitationPass.hh"
+
 namespace ignition
 {
 namespace rendering
@@ -99,6 +106,15 @@ class ignition::rendering::Ogre2RenderTargetPrivate
   /// actual window
   ///
   public: Ogre::TextureGpu *ogreTexture[2] = {nullptr, nullptr};
+
+  /// \brief Pass that applies the participating media of the scene. It is
+  /// created once the scene has media and disabled while it has none.
+  public: std::shared_ptr<Ogre2ParticipatingMediaPass> mediaPass;
+
+  /// \brief Pass that applies the precipitation of the scene. It is
+  /// created once the scene has a precipitation and disabled while it has
+  /// none.
+  public: std::shared_ptr<Ogre2PrecipitationPass> precipitationPass;
 };
 
 using namespace ignition;
@@ -133,13 +149,17 @@ void Ogre2RenderTarget::BuildCompositor()
 
   this->UpdateBackgroundMaterial();
 
-  bool validBackground = this->backgroundMaterial &&
-      !this->backgroundMaterial->EnvironmentMap().empty();
+  // a procedural sky takes precedence over the skybox cubemap
+  std::string skyMatName = this->scene->ProceduralSkyMaterialName();
+  if (skyMatName.empty() && this->backgroundMaterial &&
+      !this->backgroundMaterial->EnvironmentMap().empty())
+    skyMatName = this->dataPtr->kSkyboxMaterialName + "_" + this->Name();
+  bool validBackground = !skyMatName.empty();
 
   // The function build a similar compositor as the one defined in
   // ogre2/media/2.0/scripts/Compositors/PbsMaterials.compositor
-  // but supports an extra quad pass to render the skybox cubemap if
-  // sky is enabled.
+  // but supports an extra quad pass to render the skybox cubemap or the
+  // procedural sky if sky is enabled.
   // todo(anyone) Note the definition programmatically created here
   // replaces the one defined in the script so it maybe safe to remove the
   // PbsMaterials.compositor file
@@ -218,8 +238,7 @@ void Ogre2RenderTarget::BuildCompositor()
         Ogre::CompositorPassQuadDef *passQuad =
             static_cast<Ogre::CompositorPassQuadDef *>(
             rt0TargetDef->addPass(Ogre::PASS_QUAD));
-        passQuad->mMaterialName = this->dataPtr->kSkyboxMaterialName + "_"
-            + this->Name();
+        passQuad->mMaterialName = skyMatName;
         passQuad->mFrustumCorners =
             Ogre::CompositorPassQuadDef::CAMERA_DIRECTION;
       }
@@ -447,6 +466,43 @@ void Ogre2RenderTarget::SetAntiAliasing(unsigned int _aa)
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::PreRender()
 {
+  // let render passes know which camera they are applied to before they
+  // are updated
+  for (auto &pass : this->renderPasses)
+  {
+    Ogre2RenderPass *ogre2RenderPass =
+        dynamic_cast<Ogre2RenderPass *>(pass.get());
+    if (ogre2RenderPass)
+      ogre2RenderPass->SetCamera(this->ogreCamera);
+  }
+
+  // the participating media of the scene are applied by an internal pass
+  // in front of the render passes added to this target
+  bool hasMedia = this->scene->HasParticipatingMedia();
+  if (hasMedia && !this->dataPtr->mediaPass)
+  {
+    this->dataPtr->mediaPass =
+        std::make_shared<Ogre2ParticipatingMediaPass>(this->scene);
+  }
+  if (this->dataPtr->mediaPass)
+  {
+    this->dataPtr->mediaPass->SetEnabled(hasMedia);
+    this->dataPtr->mediaPass->SetCamera(this->ogreCamera);
+  }
+
+  // so is the precipitation
+  bool hasPrecipitation = this->scene->HasPrecipitation();
+  if (hasPrecipitation && !this->dataPtr->precipitationPass)
+  {
+    this->dataPtr->precipitationPass =
+        std::make_shared<Ogre2PrecipitationPass>(this->scene);
+  }
+  if (this->dataPtr->precipitationPass)
+  {
+    this->dataPtr->precipitationPass->SetEnabled(hasPrecipitation);
+    this->dataPtr->precipitationPass->SetCamera(this->ogreCamera);
+  }
+
   BaseRenderTarget::PreRender();
   this->UpdateBackgroundColor();
 
@@ -456,6 +512,13 @@ void Ogre2RenderTarget::PreRender()
   }
 
   this->UpdateRenderPassChain();
+
+  // the media and precipitation materials are created with the
+  // compositor nodes
+  if (this->dataPtr->mediaPass)
+    this->dataPtr->mediaPass->PreRender();
+  if (this->dataPtr->precipitationPass)
+    this->dataPtr->precipitationPass->PreRender();
 }
 
 //////////////////////////////////////////////////
@@ -661,13 +724,31 @@ void Ogre2RenderTarget::UpdateBackgroundMaterial()
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::UpdateRenderPassChain()
 {
+  // ambient occlusion darkens the light reflected by objects, so it is
+  // applied before the media scatter light in front of them
+  std::vector<RenderPassPtr> passes;
+  for (const auto &pass : this->renderPasses)
+  {
+    if (std::dynamic_pointer_cast<AmbientOcclusionPass>(pass))
+      passes.push_back(pass);
+  }
+  if (this->dataPtr->mediaPass)
+    passes.push_back(this->dataPtr->mediaPass);
+  if (this->dataPtr->precipitationPass)
+    passes.push_back(this->dataPtr->precipitationPass);
+  for (const auto &pass : this->renderPasses)
+  {
+    if (!std::dynamic_pointer_cast<AmbientOcclusionPass>(pass))
+      passes.push_back(pass);
+  }
+
   UpdateRenderPassChain(this->ogreCompositorWorkspace,
       this->ogreCompositorWorkspaceDefName,
       this->ogreCompositorWorkspaceDefName + "/" +
       this->dataPtr->kBaseNodeName,
       this->ogreCompositorWorkspaceDefName + "/" +
       this->dataPtr->kFinalNodeName,
-      this->renderPasses,
+      passes,
       this->renderPassDirty,
       &this->dataPtr->ogreTexture,
       this->IsRenderWindow());
@@ -15,7 +15,15 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+
 #include <ignition/common/Console.hh>
+#include <ignition/common/Image.hh>
 
 #include "ignition/rendering/RenderTypes.hh"
 #include "ignition/rendering/ogre2/Ogre2ArrowVisual.hh"
@@ -25,7 +33,9 @@
 #include "ignition/rendering/ogre2/Ogre2Capsule.hh"
 #include "ignition/rendering/ogre2/Ogre2COMVisual.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
+#include "ignition/rendering/ogre2/Ogre2Decal.hh"
 #include "ignition/rendering/ogre2/Ogre2DepthCamera.hh"
+#include "ignition/rendering/ogre2/Ogre2EventCamera.hh"
 #include "ignition/rendering/ogre2/Ogre2GizmoVisual.hh"
 #include "ignition/rendering/ogre2/Ogre2GpuRays.hh"
 #include "ignition/rendering/ogre2/Ogre2Grid.hh"
@@ -40,14 +50,22 @@
 #include "ignition/rendering/ogre2/Ogre2MeshFactory.hh"
 #include "ignition/rendering/ogre2/Ogre2Node.hh"
 #include "ignition/rendering/ogre2/Ogre2ParticleEmitter.hh"
+#include "ignition/rendering/ogre2/Ogre2ParticipatingMedia.hh"
+#include "ignition/rendering/ogre2/Ogre2Precipitation.hh"
+#include "ignition/rendering/ogre2/Ogre2ProceduralSky.hh"
+#include "ignition/rendering/ogre2/Ogre2RadarSensor.hh"
 #include "ignition/rendering/ogre2/Ogre2RayQuery.hh"
+#include "ignition/rendering/ogre2/Ogre2ReflectionProbe.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
 #include "ignition/rendering/ogre2/Ogre2ThermalCamera.hh"
 #include "ignition/rendering/ogre2/Ogre2SegmentationCamera.hh"
+#include "ignition/rendering/ogre2/Ogre2SonarSensor.hh"
+#include "ignition/rendering/ogre2/Ogre2StereoCamera.hh"
 #include "ignition/rendering/ogre2/Ogre2Visual.hh"
+#include "ignition/rendering/ogre2/Ogre2WaterSurface.hh"
 #include "ignition/rendering/ogre2/Ogre2WireBox.hh"
 
 #ifdef _MSC_VER
@@ -55,10 +73,21 @@
 #endif
 #include <OgreMatrix4.h>
 #include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/OgreCompositorWorkspaceDef.h>
 #include <Compositor/Pass/PassClear/OgreCompositorPassClearDef.h>
 #include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
 #include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
+#include <Cubemaps/OgreCubemapProbe.h>
+#include <Cubemaps/OgreParallaxCorrectedCubemap.h>
+#include <OgreDecal.h>
 #include <OgreDepthBuffer.h>
+#include <Hlms/Pbs/OgreHlmsPbs.h>
+#include <Hlms/Pbs/OgreHlmsPbsDatablock.h>
+#include <OgreHlmsManager.h>
+#include <OgreImage2.h>
+#include <OgreItem.h>
+#include <OgreTextureGpuManager.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #include <Overlay/OgreOverlayManager.h>
@@ -119,6 +148,83 @@ class ignition::rendering::Ogre2ScenePrivate
 
   /// \brief Name of shadow compositor node
   public: const std::string kShadowNodeName = "PbsMaterialsShadowNode";
+
+  /// \brief Reflection probes created by the scene
+  public: std::vector<std::weak_ptr<Ogre2ReflectionProbe>> reflectionProbes;
+
+  /// \brief Owner of the ogre cubemap probes
+  public: Ogre::ParallaxCorrectedCubemap *parallaxCorrectedCubemap = nullptr;
+
+  /// \brief Name of the workspace definition used to capture probes
+  public: std::string probeWorkspaceDefName;
+
+  /// \brief Names of the Pbs datablocks that were given a probe
+  public: std::set<Ogre::IdString> probeDatablocks;
+
+  /// \brief Flag to indicate if the reflection probes were updated in the
+  /// current frame
+  public: bool reflectionProbesUpdated = false;
+
+  /// \brief Name of the workspace definition used to capture probes
+  /// when the scene has a procedural sky
+  public: std::string probeSkyWorkspaceDefName;
+
+  /// \brief Procedural sky of the scene
+  public: std::weak_ptr<Ogre2ProceduralSky> proceduralSky;
+
+  /// \brief Participating media of the scene
+  public: std::weak_ptr<Ogre2ParticipatingMedia> participatingMedia;
+
+  /// \brief Precipitation of the scene
+  public: std::weak_ptr<Ogre2Precipitation> precipitation;
+
+  /// \brief Area lights created by the scene
+  public: std::vector<std::weak_ptr<Ogre2AreaLight>> areaLights;
+
+  /// \brief Flag to indicate if the area light masks need to be rebuilt
+  public: bool areaLightsDirty = false;
+
+  /// \brief Texture array holding the masks of the area lights. Slice 0 is
+  /// the rectangle mask, slice 1 the disc mask and the remaining slices
+  /// hold the area light textures.
+  public: Ogre::TextureGpu *areaLightMasks = nullptr;
+
+  /// \brief Flag to indicate if the user was warned that the area light
+  /// budget was exceeded
+  public: bool areaLightBudgetWarned = false;
+
+  /// \brief Max number of area lights shaded at once. Each of them is
+  /// evaluated for every pixel in the forward pass.
+  public: const unsigned int kMaxAreaLights = 8u;
+
+  /// \brief Width and height of the area light masks in pixels
+  public: const unsigned int kAreaLightMaskSize = 256u;
+
+  /// \brief Decals created by the scene
+  public: std::vector<std::weak_ptr<Ogre2Decal>> decals;
+
+  /// \brief Flag to indicate if the decal textures need to be rebuilt
+  public: bool decalsDirty = false;
+
+  /// \brief Texture arrays holding the diffuse, normal and emissive
+  /// textures of the decals. Slice 0 of each array is used by decals that
+  /// do not have a texture of that kind.
+  public: Ogre::TextureGpu *decalTextures[3] = {nullptr, nullptr, nullptr};
+
+  /// \brief Width and height of the decal textures in pixels
+  public: const unsigned int kDecalTextureSize = 512u;
+
+  /// \brief Max number of decals that can overlap a Forward+ cell
+  public: const unsigned int kMaxDecalsPerCell = 32u;
+
+  /// \brief Holds the shared resource mutex of the render engine from
+  /// PreRender to PostRender, so frames of scenes rendered from different
+  /// threads do not overlap
+  public: std::unique_lock<std::recursive_mutex> frameLock;
+
+  /// \brief Holds the shared resource mutex from StartForcedRender to
+  /// EndForcedRender
+  public: std::unique_lock<std::recursive_mutex> forcedRenderLock;
 };
 
 using namespace ignition;
@@ -204,12 +310,27 @@ void Ogre2Scene::SetAmbientLight(const math::Color &_color)
 //////////////////////////////////////////////////
 void Ogre2Scene::PreRender()
 {
+  // Other scenes of the engine may be rendered from other threads. The
+  // lock is kept until PostRender, or in legacy mode until the first camera
+  // pass ends the frame. See the threading model in Scene
+  std::unique_lock<std::recursive_mutex> lock(
+      Ogre2RenderEngine::Instance()->SharedResourceMutex());
+
   IGN_ASSERT((this->LegacyAutoGpuFlush() ||
               this->dataPtr->frameUpdateStarted == false),
              "Scene::PreRender called again before calling Scene::PostRender. "
              "See Scene::SetCameraPassCountPerGpuFlush for details");
   this->dataPtr->frameUpdateStarted = true;
 
+  // update the sun light before the scene graph is updated
+  this->UpdateProceduralSky();
+
+  // pick the area lights to shade before the scene graph is updated
+  this->UpdateAreaLights();
+
+  // pack the decal textures before the Forward+ pass collects the decals
+  this->UpdateDecals();
+
   if (this->ShadowsDirty())
   {
     // notify all render targets
@@ -254,11 +375,16 @@ void Ogre2Scene::PreRender()
 
     this->ogreSceneManager->updateSceneGraph();
   }
+
+  this->dataPtr->frameLock = std::move(lock);
 }
 
 //////////////////////////////////////////////////
 void Ogre2Scene::PostRender()
 {
+  std::unique_lock<std::recursive_mutex> lock(
+      Ogre2RenderEngine::Instance()->SharedResourceMutex());
+
   IGN_ASSERT((this->LegacyAutoGpuFlush() ||
               this->dataPtr->frameUpdateStarted == true),
              "Scene::PostRender called again before calling Scene::PreRender. "
@@ -289,11 +415,18 @@ void Ogre2Scene::PostRender()
       this->EndFrame();
     }
   }
+
+  // let the scenes of other threads render
+  if (this->dataPtr->frameLock.owns_lock())
+    this->dataPtr->frameLock.unlock();
 }
 
 //////////////////////////////////////////////////
 void Ogre2Scene::StartForcedRender()
 {
+  this->dataPtr->forcedRenderLock = std::unique_lock<std::recursive_mutex>(
+      Ogre2RenderEngine::Instance()->SharedResourceMutex());
+
   if (this->LegacyAutoGpuFlush() || !this->dataPtr->frameUpdateStarted)
   {
     this->ogreSceneManager->updateSceneGraph();
@@ -318,16 +451,29 @@ void Ogre2Scene::EndForcedRender()
       sceneManager->clearFrameData();
     }
   }
+
+  if (this->dataPtr->forcedRenderLock.owns_lock())
+    this->dataPtr->forcedRenderLock.unlock();
 }
 
 //////////////////////////////////////////////////
 void Ogre2Scene::StartRendering(Ogre::Camera *_camera)
 {
+  this->CheckThreadAccess("StartRendering");
+
   if (_camera)
     this->UpdateAllHeightmaps(_camera);
 
   if (this->LegacyAutoGpuFlush())
   {
+    // every camera pass is a frame of its own in legacy mode, which is
+    // kept until EndFrame
+    if (!this->dataPtr->frameLock.owns_lock())
+    {
+      this->dataPtr->frameLock = std::unique_lock<std::recursive_mutex>(
+          Ogre2RenderEngine::Instance()->SharedResourceMutex());
+    }
+
     auto engine = Ogre2RenderEngine::Instance();
 
     const auto currTime = this->Time();
@@ -359,6 +505,8 @@ void Ogre2Scene::StartRendering(Ogre::Camera *_camera)
                "Started rendering without first calling Scene::PreRender. "
                "See Scene::SetCameraPassCountPerGpuFlush for details");
   }
+
+  this->UpdateReflectionProbes();
 }
 
 //////////////////////////////////////////////////
@@ -433,6 +581,7 @@ void Ogre2Scene::EndFrame()
   ogreRoot->_fireFrameRenderingQueued(evt);
 #endif
   this->dataPtr->lastRenderSimTime = currTime;
+  this->dataPtr->reflectionProbesUpdated = false;
 
   auto itor = ogreRoot->getSceneManagerIterator();
   while (itor.hasMoreElements())
@@ -442,6 +591,11 @@ void Ogre2Scene::EndFrame()
   }
 
   ogreRoot->_fireFrameEnded(evt);
+
+  // legacy clients do not call PostRender, let the scenes of other threads
+  // render now that the frame is over
+  if (this->LegacyAutoGpuFlush() && this->dataPtr->frameLock.owns_lock())
+    this->dataPtr->frameLock.unlock();
 }
 
 //////////////////////////////////////////////////
@@ -462,6 +616,23 @@ bool Ogre2Scene::LegacyAutoGpuFlush() const
   return this->dataPtr->cameraPassCountPerGpuFlush == 0u;
 }
 
+//////////////////////////////////////////////////
+void Ogre2Scene::SetOwnerThread(std::thread::id _thread)
+{
+  std::thread::id contextThread =
+      Ogre2RenderEngine::Instance()->GraphicsContextThread();
+  if (contextThread != std::thread::id() && _thread != contextThread)
+  {
+    ignwarn << "Scene [" << this->Name() << "] is handed to a thread other "
+            << "than the one the OpenGL context is current on. The thread "
+            << "may populate the scene, but rendering it from that thread "
+            << "will fail. Hand the scene back to be rendered, or use "
+            << "useCurrentGLContext or the metal render system to render "
+            << "scenes from multiple threads" << std::endl;
+  }
+  BaseScene::SetOwnerThread(_thread);
+}
+
 //////////////////////////////////////////////////
 void Ogre2Scene::Clear()
 {
@@ -473,6 +644,82 @@ void Ogre2Scene::Clear()
 //////////////////////////////////////////////////
 void Ogre2Scene::Destroy()
 {
+  std::lock_guard<std::recursive_mutex> lock(
+      Ogre2RenderEngine::Instance()->SharedResourceMutex());
+
+  Ogre2ProceduralSkyPtr sky = this->dataPtr->proceduralSky.lock();
+  if (sky)
+    sky->Destroy();
+  this->dataPtr->proceduralSky.reset();
+
+  Ogre2ParticipatingMediaPtr media = this->dataPtr->participatingMedia.lock();
+  if (media)
+    media->Destroy();
+  this->dataPtr->participatingMedia.reset();
+
+  Ogre2PrecipitationPtr precipitation = this->dataPtr->precipitation.lock();
+  if (precipitation)
+    precipitation->Destroy();
+  this->dataPtr->precipitation.reset();
+
+  for (auto &d : this->dataPtr->decals)
+  {
+    Ogre2DecalPtr decal = d.lock();
+    if (decal)
+      decal->Destroy();
+  }
+  this->dataPtr->decals.clear();
+  this->ogreSceneManager->setDecalsDiffuse(nullptr);
+  this->ogreSceneManager->setDecalsNormals(nullptr);
+  this->ogreSceneManager->setDecalsEmissive(nullptr);
+  for (auto &texture : this->dataPtr->decalTextures)
+  {
+    if (!texture)
+      continue;
+    Ogre2RenderEngine::Instance()->OgreRoot()->getRenderSystem()->
+        getTextureGpuManager()->destroyTexture(texture);
+    texture = nullptr;
+  }
+
+  this->dataPtr->areaLights.clear();
+  if (this->dataPtr->areaLightMasks)
+  {
+    Ogre::Root *ogreRoot = Ogre2RenderEngine::Instance()->OgreRoot();
+    auto hlmsPbs = static_cast<Ogre::HlmsPbs *>(
+        ogreRoot->getHlmsManager()->getHlms(Ogre::HLMS_PBS));
+    if (hlmsPbs->getAreaLightMasks() == this->dataPtr->areaLightMasks)
+      hlmsPbs->setAreaLightMasks(nullptr);
+    ogreRoot->getRenderSystem()->getTextureGpuManager()->destroyTexture(
+        this->dataPtr->areaLightMasks);
+    this->dataPtr->areaLightMasks = nullptr;
+  }
+
+  for (auto &p : this->dataPtr->reflectionProbes)
+  {
+    Ogre2ReflectionProbePtr probe = p.lock();
+    if (probe)
+      probe->Destroy();
+  }
+  this->dataPtr->reflectionProbes.clear();
+
+  if (this->dataPtr->parallaxCorrectedCubemap)
+  {
+    delete this->dataPtr->parallaxCorrectedCubemap;
+    this->dataPtr->parallaxCorrectedCubemap = nullptr;
+
+    Ogre::CompositorManager2 *ogreCompMgr =
+        Ogre2RenderEngine::Instance()->OgreRoot()->getCompositorManager2();
+    for (const std::string &wsDefName :
+        {this->dataPtr->probeWorkspaceDefName,
+         this->dataPtr->probeSkyWorkspaceDefName})
+    {
+      if (!ogreCompMgr->hasWorkspaceDefinition(wsDefName))
+        continue;
+      ogreCompMgr->removeWorkspaceDefinition(wsDefName);
+      ogreCompMgr->removeNodeDefinition(wsDefName + "/Node");
+    }
+  }
+
   this->DestroyNodes();
 
   // cleanup any items that were not attached to nodes
@@ -603,6 +850,327 @@ void Ogre2Scene::UpdateAllHeightmaps(Ogre::Camera *_camera)
 #endif
 }
 
+//////////////////////////////////////////////////
+void Ogre2Scene::UpdateAreaLights()
+{
+  auto &areaLights = this->dataPtr->areaLights;
+  areaLights.erase(std::remove_if(areaLights.begin(), areaLights.end(),
+      [](const std::weak_ptr<Ogre2AreaLight> &_light)
+      {
+        Ogre2AreaLightPtr light = _light.lock();
+        return !light || !light->Light();
+      }), areaLights.end());
+
+  if (this->dataPtr->areaLightsDirty)
+  {
+    this->UpdateAreaLightMasks();
+    this->dataPtr->areaLightsDirty = false;
+  }
+
+  // ogre shades the first area lights it finds, so pick them here to get
+  // the same lights every frame regardless of the order ogre stores them
+  std::vector<std::pair<double, Ogre::Light *>> ranked;
+  for (auto &l : areaLights)
+  {
+    Ogre2AreaLightPtr light = l.lock();
+    math::Color color = light->DiffuseColor();
+    double power = light->Intensity() * light->Size().X() *
+        light->Size().Y() * std::max({color.R(), color.G(), color.B()});
+    ranked.push_back({power, light->Light()});
+  }
+
+  unsigned int maxLights = this->dataPtr->kMaxAreaLights;
+  if (ranked.size() > maxLights)
+  {
+    if (!this->dataPtr->areaLightBudgetWarned)
+    {
+      ignwarn << "Number of area lights (" << ranked.size() << ") exceeds "
+              << "the limit supported by the underlying rendering engine "
+              << "ogre2. Only the " << maxLights << " brightest area lights "
+              << "will be shaded" << std::endl;
+      this->dataPtr->areaLightBudgetWarned = true;
+    }
+    std::stable_sort(ranked.begin(), ranked.end(),
+        [](const std::pair<double, Ogre::Light *> &_a,
+           const std::pair<double, Ogre::Light *> &_b)
+        {
+          return _a.first > _b.first;
+        });
+  }
+
+  for (unsigned int i = 0; i < ranked.size(); ++i)
+    ranked[i].second->setVisible(i < maxLights);
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::UpdateAreaLightMasks()
+{
+  Ogre::Root *ogreRoot = Ogre2RenderEngine::Instance()->OgreRoot();
+  Ogre::TextureGpuManager *textureMgr =
+      ogreRoot->getRenderSystem()->getTextureGpuManager();
+  auto hlmsPbs = static_cast<Ogre::HlmsPbs *>(
+      ogreRoot->getHlmsManager()->getHlms(Ogre::HLMS_PBS));
+
+  // slice 0 and 1 hold the shape masks, followed by one slice per texture
+  std::map<std::string, Ogre::uint16> slices;
+  std::vector<common::Image> images;
+  for (auto &l : this->dataPtr->areaLights)
+  {
+    Ogre2AreaLightPtr light = l.lock();
+    if (!light || !light->Light())
+      continue;
+
+    Ogre::uint16 slice = (light->Shape() == ALS_DISC) ? 1u : 0u;
+    std::string texture = light->Texture();
+    if (!texture.empty())
+    {
+      auto it = slices.find(texture);
+      if (it != slices.end())
+      {
+        slice = it->second;
+      }
+      else
+      {
+        common::Image image(texture);
+        if (image.Width() == 0u || image.Height() == 0u)
+        {
+          ignerr << "Unable to load area light texture: " << texture
+                 << std::endl;
+        }
+        else
+        {
+          slice = static_cast<Ogre::uint16>(images.size() + 2u);
+          images.push_back(image);
+          slices[texture] = slice;
+        }
+      }
+    }
+    light->Light()->mTextureLightMaskIdx = slice;
+  }
+
+  unsigned int size = this->dataPtr->kAreaLightMaskSize;
+  unsigned int sliceCount = static_cast<unsigned int>(images.size()) + 2u;
+  Ogre::TextureGpu *masks = this->dataPtr->areaLightMasks;
+  if (masks && masks->getNumSlices() != sliceCount)
+  {
+    if (hlmsPbs->getAreaLightMasks() == masks)
+      hlmsPbs->setAreaLightMasks(nullptr);
+    textureMgr->destroyTexture(masks);
+    masks = nullptr;
+  }
+  if (!masks)
+  {
+    masks = textureMgr->createTexture(
+        this->Name() + "_AreaLightMasks",
+        Ogre::GpuPageOutStrategy::Discard,
+        Ogre::TextureFlags::ManualTexture,
+        Ogre::TextureTypes::Type2DArray);
+    masks->setResolution(size, size, sliceCount);
+    masks->setPixelFormat(Ogre::PFG_RGBA8_UNORM_SRGB);
+    masks->setNumMipmaps(1u);
+    masks->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+    masks->waitForData();
+    this->dataPtr->areaLightMasks = masks;
+  }
+
+  // fill each slice on the cpu and upload it
+  const unsigned int channels = 4u;
+  std::vector<Ogre::uint8> data(size * size * channels);
+  for (unsigned int s = 0; s < sliceCount; ++s)
+  {
+    for (unsigned int y = 0; y < size; ++y)
+    {
+      for (unsigned int x = 0; x < size; ++x)
+      {
+        math::Color c = math::Color::White;
+        if (s == 1u)
+        {
+          // disc inscribed in the light rectangle
+          double u = (x + 0.5) / size * 2.0 - 1.0;
+          double v = (y + 0.5) / size * 2.0 - 1.0;
+          if (u * u + v * v > 1.0)
+            c = math::Color::Black;
+        }
+        else if (s > 1u)
+        {
+          // nearest neighbour resampling, flip Y
+          const common::Image &image = images[s - 2u];
+          c = image.Pixel(x * image.Width() / size,
+              image.Height() - 1u - y * image.Height() / size);
+        }
+        unsigned int idx = (y * size + x) * channels;
+        data[idx] = static_cast<Ogre::uint8>(c.R() * 255);
+        data[idx + 1u] = static_cast<Ogre::uint8>(c.G() * 255);
+        data[idx + 2u] = static_cast<Ogre::uint8>(c.B() * 255);
+        data[idx + 3u] = 255u;
+      }
+    }
+    Ogre::Image2 image;
+    image.loadDynamicImage(data.data(), size, size, 1u,
+        Ogre::TextureTypes::Type2D, Ogre::PFG_RGBA8_UNORM_SRGB, false);
+    image.uploadTo(masks, 0u, 0u, s);
+  }
+
+  hlmsPbs->setAreaLightMasks(masks);
+  hlmsPbs->setAreaLightForwardSettings(
+      static_cast<Ogre::uint16>(this->dataPtr->kMaxAreaLights), 0u);
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::UpdateDecals()
+{
+  auto &decals = this->dataPtr->decals;
+  decals.erase(std::remove_if(decals.begin(), decals.end(),
+      [](const std::weak_ptr<Ogre2Decal> &_decal)
+      {
+        Ogre2DecalPtr decal = _decal.lock();
+        return !decal || !decal->OgreDecal();
+      }), decals.end());
+
+  if (!this->dataPtr->decalsDirty)
+    return;
+  this->dataPtr->decalsDirty = false;
+
+  Ogre::TextureGpuManager *textureMgr =
+      Ogre2RenderEngine::Instance()->OgreRoot()->getRenderSystem()->
+      getTextureGpuManager();
+
+  // diffuse, normal and emissive arrays. Ogre decals sample the normals
+  // as two signed channels and reconstruct the third one.
+  const std::string names[3] = {"Diffuse", "Normals", "Emissive"};
+  const Ogre::PixelFormatGpu formats[3] = {Ogre::PFG_RGBA8_UNORM_SRGB,
+      Ogre::PFG_RG8_SNORM, Ogre::PFG_RGBA8_UNORM_SRGB};
+  const unsigned int channels[3] = {4u, 2u, 4u};
+
+  unsigned int size = this->dataPtr->kDecalTextureSize;
+  for (unsigned int k = 0; k < 3u; ++k)
+  {
+    // slice 0 is transparent, flat or black, followed by one slice per
+    // texture
+    std::map<std::string, Ogre::uint32> slices;
+    std::vector<common::Image> images;
+    std::vector<std::pair<Ogre::Decal *, Ogre::uint32>> decalSlices;
+    for (auto &d : decals)
+    {
+      Ogre2DecalPtr decal = d.lock();
+      std::string texture = (k == 0u) ? decal->DiffuseTexture() :
+          (k == 1u) ? decal->NormalTexture() : decal->EmissiveTexture();
+      Ogre::uint32 slice = 0u;
+      if (!texture.empty())
+      {
+        auto it = slices.find(texture);
+        if (it != slices.end())
+        {
+          slice = it->second;
+        }
+        else
+        {
+          common::Image image(texture);
+          if (image.Width() == 0u || image.Height() == 0u)
+          {
+            ignerr << "Unable to load decal texture: " << texture
+                   << std::endl;
+          }
+          else
+          {
+            slice = static_cast<Ogre::uint32>(images.size() + 1u);
+            images.push_back(image);
+            slices[texture] = slice;
+          }
+        }
+      }
+      decalSlices.push_back({decal->OgreDecal(), slice});
+    }
+
+    unsigned int sliceCount = static_cast<unsigned int>(images.size()) + 1u;
+    Ogre::TextureGpu *&textures = this->dataPtr->decalTextures[k];
+    if (textures && textures->getNumSlices() != sliceCount)
+    {
+      if (k == 0u)
+        this->ogreSceneManager->setDecalsDiffuse(nullptr);
+      else if (k == 1u)
+        this->ogreSceneManager->setDecalsNormals(nullptr);
+      else
+        this->ogreSceneManager->setDecalsEmissive(nullptr);
+      textureMgr->destroyTexture(textures);
+      textures = nullptr;
+    }
+    if (!textures)
+    {
+      textures = textureMgr->createTexture(
+          this->Name() + "_Decals" + names[k],
+          Ogre::GpuPageOutStrategy::Discard,
+          Ogre::TextureFlags::ManualTexture,
+          Ogre::TextureTypes::Type2DArray);
+      textures->setResolution(size, size, sliceCount);
+      textures->setPixelFormat(formats[k]);
+      textures->setNumMipmaps(1u);
+      textures->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+      textures->waitForData();
+    }
+
+    // fill each slice on the cpu and upload it. The top of the textures
+    // is at the decal's +Y side.
+    std::vector<Ogre::uint8> data(size * size * channels[k]);
+    for (unsigned int s = 0; s < sliceCount; ++s)
+    {
+      for (unsigned int y = 0; y < size; ++y)
+      {
+        for (unsigned int x = 0; x < size; ++x)
+        {
+          math::Color c(0, 0, 0, 0);
+          if (s > 0u)
+          {
+            // nearest neighbour resampling
+            const common::Image &image = images[s - 1u];
+            c = image.Pixel(x * image.Width() / size,
+                y * image.Height() / size);
+          }
+          else if (k == 1u)
+          {
+            c = math::Color(0.5, 0.5, 1.0);
+          }
+          unsigned int idx = (y * size + x) * channels[k];
+          if (k == 1u)
+          {
+            // unsigned normal map to signed XY
+            data[idx] = static_cast<Ogre::uint8>(static_cast<Ogre::int8>(
+                std::lround((c.R() * 2.0 - 1.0) * 127.0)));
+            data[idx + 1u] = static_cast<Ogre::uint8>(static_cast<Ogre::int8>(
+                std::lround((c.G() * 2.0 - 1.0) * 127.0)));
+          }
+          else
+          {
+            data[idx] = static_cast<Ogre::uint8>(c.R() * 255);
+            data[idx + 1u] = static_cast<Ogre::uint8>(c.G() * 255);
+            data[idx + 2u] = static_cast<Ogre::uint8>(c.B() * 255);
+            data[idx + 3u] = static_cast<Ogre::uint8>(c.A() * 255);
+          }
+        }
+      }
+      Ogre::Image2 image;
+      image.loadDynamicImage(data.data(), size, size, 1u,
+          Ogre::TextureTypes::Type2D, formats[k], false);
+      image.uploadTo(textures, 0u, 0u, s);
+    }
+
+    for (const auto &[ogreDecal, slice] : decalSlices)
+    {
+      if (k == 0u)
+        ogreDecal->setDiffuseTextureRaw(textures, slice);
+      else if (k == 1u)
+        ogreDecal->setNormalTextureRaw(textures, slice);
+      else
+        ogreDecal->setEmissiveTextureRaw(textures, slice);
+    }
+  }
+
+  this->ogreSceneManager->setDecalsDiffuse(this->dataPtr->decalTextures[0]);
+  this->ogreSceneManager->setDecalsNormals(this->dataPtr->decalTextures[1]);
+  this->ogreSceneManager->setDecalsEmissive(
+      this->dataPtr->decalTextures[2]);
+}
+
 //////////////////////////////////////////////////
 void Ogre2Scene::UpdateShadowNode()
 {
@@ -612,9 +1180,14 @@ void Ogre2Scene::UpdateShadowNode()
   unsigned int spotPointLightCount = 0;
   unsigned int dirLightCount = 0;
 
+  // area lights never cast shadows so they are not given shadow maps.
+  // When there are more shadow casting lights than shadow maps, ogre
+  // assigns the shadow maps to the lights closest to the camera.
   for (unsigned int i = 0; i < this->LightCount(); ++i)
   {
     LightPtr light = this->LightByIndex(i);
+    if (std::dynamic_pointer_cast<AreaLight>(light))
+      continue;
     if (light->CastShadows())
     {
       if (std::dynamic_pointer_cast<DirectionalLight>(light))
@@ -1033,6 +1606,300 @@ const std::vector<std::weak_ptr<Ogre2Heightmap>> &Ogre2Scene::Heightmaps() const
   return this->heightmaps;
 }
 
+//////////////////////////////////////////////////
+const std::vector<std::weak_ptr<Ogre2Decal>> &Ogre2Scene::Decals() const
+{
+  return this->dataPtr->decals;
+}
+
+//////////////////////////////////////////////////
+Ogre::ParallaxCorrectedCubemap *Ogre2Scene::OgreParallaxCorrectedCubemap()
+{
+  if (this->dataPtr->parallaxCorrectedCubemap)
+    return this->dataPtr->parallaxCorrectedCubemap;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  Ogre::Root *ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  this->dataPtr->probeWorkspaceDefName =
+      "ReflectionProbeWorkspace_" + this->Name();
+  const std::string &wsDefName = this->dataPtr->probeWorkspaceDefName;
+  this->CreateReflectionProbeWorkspaceDef(wsDefName, "");
+
+  // probes are used manually, i.e. they are assigned to datablocks by
+  // UpdateReflectionProbes, so the cubemap blending is left disabled
+  this->dataPtr->parallaxCorrectedCubemap = new Ogre::ParallaxCorrectedCubemap(
+      Ogre::Id::generateNewId<Ogre::ParallaxCorrectedCubemap>(), ogreRoot,
+      this->ogreSceneManager, ogreCompMgr->getWorkspaceDefinition(wsDefName),
+      250u, 1u << 25u);
+  return this->dataPtr->parallaxCorrectedCubemap;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2Scene::ReflectionProbeWorkspaceDefName()
+{
+  this->OgreParallaxCorrectedCubemap();
+
+  std::string skyMatName = this->ProceduralSkyMaterialName();
+  if (skyMatName.empty())
+    return this->dataPtr->probeWorkspaceDefName;
+
+  this->dataPtr->probeSkyWorkspaceDefName =
+      "ReflectionProbeSkyWorkspace_" + this->Name();
+  this->CreateReflectionProbeWorkspaceDef(
+      this->dataPtr->probeSkyWorkspaceDefName, skyMatName);
+  return this->dataPtr->probeSkyWorkspaceDefName;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::CreateReflectionProbeWorkspaceDef(
+    const std::string &_wsDefName, const std::string &_skyMaterialName)
+{
+  Ogre::CompositorManager2 *ogreCompMgr =
+      Ogre2RenderEngine::Instance()->OgreRoot()->getCompositorManager2();
+  if (ogreCompMgr->hasWorkspaceDefinition(_wsDefName))
+    return;
+
+  // workspace that renders the six faces of a probe's cubemap and then
+  // generates the mipmaps sampled by rough materials
+  const std::string nodeDefName = _wsDefName + "/Node";
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+  nodeDef->addTextureSourceName("rt0", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  bool hasSky = !_skyMaterialName.empty();
+  Ogre::ColourValue clearColor =
+      Ogre2Conversions::Convert(this->BackgroundColor());
+  nodeDef->setNumTargetPass(7u);
+  for (Ogre::uint32 i = 0; i < 6u; ++i)
+  {
+    Ogre::CompositorTargetDef *targetDef =
+        nodeDef->addTargetPass("rt0", i);
+    targetDef->setNumPasses(hasSky ? 2u : 1u);
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        targetDef->addPass(Ogre::PASS_SCENE));
+    passScene->setAllLoadActions(Ogre::LoadAction::Clear);
+    passScene->setAllClearColours(clearColor);
+    passScene->mClearDepth = 1.0f;
+    passScene->mCameraCubemapReorient = true;
+    passScene->mIncludeOverlays = false;
+    // gui visuals, e.g. gizmos, are not part of the environment
+    passScene->mVisibilityMask = IGN_VISIBILITY_ALL & ~IGN_VISIBILITY_GUI;
+
+    // sky is drawn where the scene left the depth buffer empty
+    if (hasSky)
+    {
+      Ogre::CompositorPassQuadDef *passQuad =
+          static_cast<Ogre::CompositorPassQuadDef *>(
+          targetDef->addPass(Ogre::PASS_QUAD));
+      passQuad->mMaterialName = _skyMaterialName;
+      passQuad->mFrustumCorners =
+          Ogre::CompositorPassQuadDef::CAMERA_DIRECTION;
+      passQuad->mCameraCubemapReorient = true;
+    }
+  }
+
+  Ogre::CompositorTargetDef *mipmapTargetDef =
+      nodeDef->addTargetPass("rt0");
+  mipmapTargetDef->setNumPasses(1u);
+  mipmapTargetDef->addPass(Ogre::PASS_MIPMAP);
+
+  Ogre::CompositorWorkspaceDef *wsDef =
+      ogreCompMgr->addWorkspaceDefinition(_wsDefName);
+  wsDef->connectExternal(0, nodeDefName, 0);
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::ClearReflectionProbe(Ogre::CubemapProbe *_probe)
+{
+  Ogre::Hlms *hlmsPbs = Ogre2RenderEngine::Instance()->OgreRoot()->
+      getHlmsManager()->getHlms(Ogre::HLMS_PBS);
+
+  auto itor = this->dataPtr->probeDatablocks.begin();
+  while (itor != this->dataPtr->probeDatablocks.end())
+  {
+    Ogre::HlmsPbsDatablock *datablock =
+        static_cast<Ogre::HlmsPbsDatablock *>(hlmsPbs->getDatablock(*itor));
+    if (!datablock)
+    {
+      // datablock has been destroyed
+      itor = this->dataPtr->probeDatablocks.erase(itor);
+    }
+    else if (datablock->getCubemapProbe() == _probe)
+    {
+      datablock->setCubemapProbe(nullptr);
+      itor = this->dataPtr->probeDatablocks.erase(itor);
+    }
+    else
+    {
+      ++itor;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2Scene::ProceduralSkyMaterialName() const
+{
+  Ogre2ProceduralSkyPtr sky = this->dataPtr->proceduralSky.lock();
+  return sky ? sky->OgreMaterialName() : std::string();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Scene::HasParticipatingMedia() const
+{
+  Ogre2ParticipatingMediaPtr media =
+      this->dataPtr->participatingMedia.lock();
+  return media && !media->IsDestroyed();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetParticipatingMediaParams(Ogre::Pass *_pass,
+    const Ogre::Camera *_camera) const
+{
+  Ogre2ParticipatingMediaPtr media =
+      this->dataPtr->participatingMedia.lock();
+  if (media && !media->IsDestroyed())
+    media->SetShaderParams(_pass, _camera);
+  else
+    Ogre2ParticipatingMedia::ClearShaderParams(_pass);
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Scene::HasPrecipitation() const
+{
+  Ogre2PrecipitationPtr precipitation = this->dataPtr->precipitation.lock();
+  return precipitation && !precipitation->IsDestroyed();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetPrecipitationParams(Ogre::Pass *_pass,
+    const Ogre::Camera *_camera) const
+{
+  Ogre2PrecipitationPtr precipitation = this->dataPtr->precipitation.lock();
+  if (precipitation && !precipitation->IsDestroyed())
+    precipitation->SetShaderParams(_pass, _camera);
+  else
+    Ogre2Precipitation::ClearShaderParams(_pass);
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::UpdateProceduralSky()
+{
+  Ogre2ProceduralSkyPtr sky = this->dataPtr->proceduralSky.lock();
+  if (!sky || !sky->UpdateForRender())
+    return;
+
+  // the environment captured by reflection probes has to match the sky
+  // and its lighting
+  for (auto &p : this->dataPtr->reflectionProbes)
+  {
+    Ogre2ReflectionProbePtr probe = p.lock();
+    if (probe)
+      probe->Capture();
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::UpdateReflectionProbes()
+{
+  if (this->dataPtr->reflectionProbesUpdated)
+    return;
+  this->dataPtr->reflectionProbesUpdated = true;
+
+  std::vector<Ogre2ReflectionProbePtr> probes;
+  auto itor = this->dataPtr->reflectionProbes.begin();
+  auto endt = this->dataPtr->reflectionProbes.end();
+  while (itor != endt)
+  {
+    Ogre2ReflectionProbePtr probe = itor->lock();
+    if (!probe)
+    {
+      // Probe has been destroyed. Remove it from our list.
+      itor = Ogre::efficientVectorRemove(this->dataPtr->reflectionProbes,
+          itor);
+      endt = this->dataPtr->reflectionProbes.end();
+      continue;
+    }
+
+    probe->UpdateCapture();
+    if (probe->OgreCubemapProbe())
+      probes.push_back(probe);
+    ++itor;
+  }
+
+  if (probes.empty())
+    return;
+
+  auto itemItor = this->ogreSceneManager->getMovableObjectIterator(
+      Ogre::ItemFactory::FACTORY_TYPE_NAME);
+  while (itemItor.hasMoreElements())
+  {
+    Ogre::Item *item = static_cast<Ogre::Item *>(itemItor.peekNext());
+    itemItor.moveNext();
+
+    // use the smallest probe area that contains the item, otherwise the
+    // probe area closest to the item
+    math::Vector3d center =
+        Ogre2Conversions::Convert(item->getWorldAabb().mCenter);
+    Ogre::CubemapProbe *nearest = nullptr;
+    bool inside = false;
+    double best = std::numeric_limits<double>::max();
+    for (const auto &probe : probes)
+    {
+      math::AxisAlignedBox area = probe->Area();
+      if (area.Contains(center))
+      {
+        if (!inside || area.Volume() < best)
+        {
+          nearest = probe->OgreCubemapProbe();
+          best = area.Volume();
+          inside = true;
+        }
+      }
+      else if (!inside)
+      {
+        math::Vector3d closest = center;
+        closest.Max(area.Min());
+        closest.Min(area.Max());
+        double dist = closest.Distance(center);
+        if (dist < best)
+        {
+          nearest = probe->OgreCubemapProbe();
+          best = dist;
+        }
+      }
+    }
+
+    for (unsigned int i = 0; i < item->getNumSubItems(); ++i)
+    {
+      Ogre::SubItem *subItem = item->getSubItem(i);
+      Ogre::HlmsDatablock *datablock = subItem->getDatablock();
+      // skip low level materials, e.g. shaders
+      if (!subItem->getMaterial().isNull() || !datablock ||
+          datablock->mType != Ogre::HLMS_PBS)
+      {
+        continue;
+      }
+
+      Ogre::HlmsPbsDatablock *pbsDatablock =
+          static_cast<Ogre::HlmsPbsDatablock *>(datablock);
+      // materials with an environment map keep using it
+      if (!pbsDatablock->getCubemapProbe() &&
+          pbsDatablock->getTexture(Ogre::PBSM_REFLECTION))
+      {
+        continue;
+      }
+
+      if (pbsDatablock->getCubemapProbe() != nearest)
+        pbsDatablock->setCubemapProbe(nearest);
+      this->dataPtr->probeDatablocks.insert(pbsDatablock->getName());
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 DirectionalLightPtr Ogre2Scene::CreateDirectionalLightImpl(unsigned int _id,
     const std::string &_name)
@@ -1060,6 +1927,19 @@ SpotLightPtr Ogre2Scene::CreateSpotLightImpl(unsigned int _id,
   return (result) ? light : nullptr;
 }
 
+//////////////////////////////////////////////////
+AreaLightPtr Ogre2Scene::CreateAreaLightImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2AreaLightPtr light(new Ogre2AreaLight);
+  bool result = this->InitObject(light, _id, _name);
+  if (!result)
+    return nullptr;
+  this->dataPtr->areaLights.push_back(light);
+  this->dataPtr->areaLightsDirty = true;
+  return light;
+}
+
 //////////////////////////////////////////////////
 CameraPtr Ogre2Scene::CreateCameraImpl(unsigned int _id,
     const std::string &_name)
@@ -1108,6 +1988,24 @@ SegmentationCameraPtr Ogre2Scene::CreateSegmentationCameraImpl(
   return (result) ? camera : nullptr;
 }
 
+//////////////////////////////////////////////////
+StereoCameraPtr Ogre2Scene::CreateStereoCameraImpl(
+  const unsigned int _id, const std::string &_name)
+{
+  Ogre2StereoCameraPtr camera(new Ogre2StereoCamera);
+  bool result = this->InitObject(camera, _id, _name);
+  return (result) ? camera : nullptr;
+}
+
+//////////////////////////////////////////////////
+EventCameraPtr Ogre2Scene::CreateEventCameraImpl(
+  const unsigned int _id, const std::string &_name)
+{
+  Ogre2EventCameraPtr camera(new Ogre2EventCamera);
+  bool result = this->InitObject(camera, _id, _name);
+  return (result) ? camera : nullptr;
+}
+
 //////////////////////////////////////////////////
 GpuRaysPtr Ogre2Scene::CreateGpuRaysImpl(unsigned int _id,
     const std::string &_name)
@@ -1117,6 +2015,24 @@ GpuRaysPtr Ogre2Scene::CreateGpuRaysImpl(unsigned int _id,
   return (result) ? gpuRays : nullptr;
 }
 
+//////////////////////////////////////////////////
+RadarSensorPtr Ogre2Scene::CreateRadarSensorImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2RadarSensorPtr radar(new Ogre2RadarSensor);
+  bool result = this->InitObject(radar, _id, _name);
+  return (result) ? radar : nullptr;
+}
+
+//////////////////////////////////////////////////
+SonarSensorPtr Ogre2Scene::CreateSonarSensorImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2SonarSensorPtr sonar(new Ogre2SonarSensor);
+  bool result = this->InitObject(sonar, _id, _name);
+  return (result) ? sonar : nullptr;
+}
+
 //////////////////////////////////////////////////
 VisualPtr Ogre2Scene::CreateVisualImpl(unsigned int _id,
     const std::string &_name)
@@ -1263,6 +2179,15 @@ HeightmapPtr Ogre2Scene::CreateHeightmapImpl(unsigned int _id,
   return (result) ? heightmap : nullptr;
 }
 
+//////////////////////////////////////////////////
+WaterSurfacePtr Ogre2Scene::CreateWaterSurfaceImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2WaterSurfacePtr waterSurface(new Ogre2WaterSurface);
+  bool result = this->InitObject(waterSurface, _id, _name);
+  return (result) ? waterSurface : nullptr;
+}
+
 //////////////////////////////////////////////////
 GridPtr Ogre2Scene::CreateGridImpl(unsigned int _id,
     const std::string &_name)
@@ -1342,6 +2267,92 @@ RayQueryPtr Ogre2Scene::CreateRayQueryImpl(unsigned int _id,
   return (result) ? rayQuery : nullptr;
 }
 
+//////////////////////////////////////////////////
+ReflectionProbePtr Ogre2Scene::CreateReflectionProbeImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2ReflectionProbePtr probe(new Ogre2ReflectionProbe);
+  bool result = this->InitObject(probe, _id, _name);
+  if (!result)
+    return nullptr;
+
+  this->dataPtr->reflectionProbes.push_back(probe);
+  return probe;
+}
+
+//////////////////////////////////////////////////
+ProceduralSkyPtr Ogre2Scene::CreateProceduralSkyImpl(unsigned int _id,
+    const std::string &_name)
+{
+  if (!this->dataPtr->proceduralSky.expired())
+  {
+    ignerr << "Scene [" << this->Name() << "] already has a procedural sky"
+           << std::endl;
+    return nullptr;
+  }
+
+  Ogre2ProceduralSkyPtr sky(new Ogre2ProceduralSky);
+  bool result = this->InitObject(sky, _id, _name);
+  if (!result)
+    return nullptr;
+
+  this->dataPtr->proceduralSky = sky;
+  return sky;
+}
+
+//////////////////////////////////////////////////
+ParticipatingMediaPtr Ogre2Scene::CreateParticipatingMediaImpl(
+    unsigned int _id, const std::string &_name)
+{
+  if (this->HasParticipatingMedia())
+  {
+    ignerr << "Scene [" << this->Name() << "] already has participating "
+           << "media" << std::endl;
+    return nullptr;
+  }
+
+  Ogre2ParticipatingMediaPtr media(new Ogre2ParticipatingMedia);
+  bool result = this->InitObject(media, _id, _name);
+  if (!result)
+    return nullptr;
+
+  this->dataPtr->participatingMedia = media;
+  return media;
+}
+
+//////////////////////////////////////////////////
+PrecipitationPtr Ogre2Scene::CreatePrecipitationImpl(
+    unsigned int _id, const std::string &_name)
+{
+  if (this->HasPrecipitation())
+  {
+    ignerr << "Scene [" << this->Name() << "] already has a precipitation"
+           << std::endl;
+    return nullptr;
+  }
+
+  Ogre2PrecipitationPtr precipitation(new Ogre2Precipitation);
+  bool result = this->InitObject(precipitation, _id, _name);
+  if (!result)
+    return nullptr;
+
+  this->dataPtr->precipitation = precipitation;
+  return precipitation;
+}
+
+//////////////////////////////////////////////////
+DecalPtr Ogre2Scene::CreateDecalImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2DecalPtr decal(new Ogre2Decal);
+  bool result = this->InitObject(decal, _id, _name);
+  if (!result)
+    return nullptr;
+
+  this->dataPtr->decals.push_back(decal);
+  return decal;
+}
+
 //////////////////////////////////////////////////
 ParticleEmitterPtr Ogre2Scene::CreateParticleEmitterImpl(unsigned int _id,
     const std::string &_name)
@@ -1396,11 +2407,11 @@ void Ogre2Scene::CreateContext()
   this->ogreSceneManager->setShadowDirectionalLightExtrusionDistance(500.0f);
   this->ogreSceneManager->setShadowFarDistance(500.0f);
 
-  // enable forward plus to support multiple lights
+  // enable forward plus to support multiple lights and decals
   // this is required for non-shadow-casting point lights and
   // spot lights to work
   this->ogreSceneManager->setForwardClustered(
-    true, 16, 8, 24, 96, 0, 0, 1, 500);
+    true, 16, 8, 24, 96, this->dataPtr->kMaxDecalsPerCell, 0, 1, 500);
 }
 
 //////////////////////////////////////////////////
@@ -1462,6 +2473,18 @@ bool Ogre2Scene::ShadowsDirty() const
   return this->dataPtr->shadowsDirty;
 }
 
+//////////////////////////////////////////////////
+void Ogre2Scene::SetAreaLightsDirty()
+{
+  this->dataPtr->areaLightsDirty = true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetDecalsDirty()
+{
+  this->dataPtr->decalsDirty = true;
+}
+
 //////////////////////////////////////////////////
 void Ogre2Scene::SetSkyEnabled(bool _enabled)
 {
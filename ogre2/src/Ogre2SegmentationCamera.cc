@@ -33,6 +33,7 @@
 #include "ignition/rendering/Utils.hh"
 
 #include "Ogre2SegmentationMaterialSwitcher.hh"
+#include "Ogre2WideAngleRenderer.hh"
 
 /// \brief Private data for the Ogre2SegmentationCamera class
 class ignition::rendering::Ogre2SegmentationCameraPrivate
@@ -69,6 +70,20 @@ class ignition::rendering::Ogre2SegmentationCameraPrivate
   /// with colored version for segmentation
   public: std::unique_ptr<Ogre2SegmentationMaterialSwitcher>
           materialSwitcher {nullptr};
+
+  /// \brief Renders fisheye and panoramic projections
+  public: Ogre2WideAngleRenderer wideAngle;
+
+  /// \brief True if a frame was rendered since buffer was last read back
+  /// from the segmentation texture
+  public: bool bufferDirty {false};
+
+  /// \brief Read the segmentation texture back into buffer
+  /// \param[in] _width Image width
+  /// \param[in] _height Image height
+  /// \param[in] _format Image format
+  public: void ReadBuffer(unsigned int _width, unsigned int _height,
+      PixelFormat _format);
 };
 
 using namespace ignition;
@@ -111,6 +126,8 @@ void Ogre2SegmentationCamera::Destroy()
   if (!this->ogreCamera)
     return;
 
+  this->dataPtr->wideAngle.Destroy();
+
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   auto ogreCompMgr = ogreRoot->getCompositorManager2();
@@ -247,50 +264,62 @@ void Ogre2SegmentationCamera::CreateSegmentationTexture()
 }
 
 /////////////////////////////////////////////////
-void Ogre2SegmentationCamera::PostRender()
+void Ogre2SegmentationCameraPrivate::ReadBuffer(unsigned int _width,
+    unsigned int _height, PixelFormat _format)
 {
-  // return if no one is listening to the new frame
-  if (this->dataPtr->newSegmentationFrame.ConnectionCount() == 0)
-    return;
-
-  const auto width = this->ImageWidth();
-  const auto height = this->ImageHeight();
-  PixelFormat format = this->ImageFormat();
-
-  const auto len = width * height;
-  const auto channelCount = PixelUtil::ChannelCount(format);
-  const auto bytesPerChannel = PixelUtil::BytesPerChannel(format);
+  const auto len = _width * _height;
+  const auto channelCount = PixelUtil::ChannelCount(_format);
+  const auto bytesPerChannel = PixelUtil::BytesPerChannel(_format);
   const auto bufferSize = len * channelCount * bytesPerChannel;
 
   Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->ogreSegmentationTexture, 0u, 0u);
+  image.convertFromTexture(this->ogreSegmentationTexture, 0u, 0u);
   Ogre::TextureBox box = image.getData(0);
 
-  if (!this->dataPtr->buffer)
+  if (!this->buffer)
   {
-    this->dataPtr->buffer = new uint8_t[bufferSize];
+    this->buffer = new uint8_t[bufferSize];
   }
 
   uint8_t *bufferTmp = static_cast<uint8_t*>(box.data);
 
   auto rawChannelCount = 4u;
 
-  for (unsigned int row = 0; row < height; ++row)
+  for (unsigned int row = 0; row < _height; ++row)
   {
     unsigned int rawDataRowIdx = row * box.bytesPerRow / bytesPerChannel;
-    for (unsigned int column = 0; column < width; ++column)
+    for (unsigned int column = 0; column < _width; ++column)
     {
-      unsigned int idx = (row * width * channelCount) +
+      unsigned int idx = (row * _width * channelCount) +
           column * channelCount;
       unsigned int rawIdx = rawDataRowIdx +
           column * rawChannelCount;
 
-      this->dataPtr->buffer[idx] = bufferTmp[rawIdx];
-      this->dataPtr->buffer[idx + 1] = bufferTmp[rawIdx + 1];
-      this->dataPtr->buffer[idx + 2] = bufferTmp[rawIdx + 2];
+      this->buffer[idx] = bufferTmp[rawIdx];
+      this->buffer[idx + 1] = bufferTmp[rawIdx + 1];
+      this->buffer[idx + 2] = bufferTmp[rawIdx + 2];
     }
   }
 
+  this->bufferDirty = false;
+}
+
+/////////////////////////////////////////////////
+void Ogre2SegmentationCamera::PostRender()
+{
+  // the buffer is only read back when it is needed, see SaveFrame
+  this->dataPtr->bufferDirty = true;
+
+  // return if no one is listening to the new frame
+  if (this->dataPtr->newSegmentationFrame.ConnectionCount() == 0)
+    return;
+
+  const auto width = this->ImageWidth();
+  const auto height = this->ImageHeight();
+  PixelFormat format = this->ImageFormat();
+  const auto channelCount = PixelUtil::ChannelCount(format);
+  this->dataPtr->ReadBuffer(width, height, format);
+
   this->dataPtr->newSegmentationFrame(
     this->dataPtr->buffer,
     width, height, channelCount,
@@ -306,22 +335,54 @@ ignition::common::ConnectionPtr
   return this->dataPtr->newSegmentationFrame.Connect(_subscriber);
 }
 
+/////////////////////////////////////////////////
+bool Ogre2SegmentationCamera::SaveFrame(const std::string &_name)
+{
+  // no listener may be connected, in which case the last frame has not
+  // been read back yet
+  if (this->dataPtr->bufferDirty && this->dataPtr->ogreSegmentationTexture)
+  {
+    this->dataPtr->ReadBuffer(this->ImageWidth(), this->ImageHeight(),
+        this->ImageFormat());
+  }
+  return FrameEncoder::Instance()->Enqueue(_name, this->dataPtr->buffer,
+      this->ImageWidth(), this->ImageHeight(), this->ImageFormat());
+}
+
 /////////////////////////////////////////////////
 void Ogre2SegmentationCamera::Render()
 {
-  // update the compositors
-  this->scene->StartRendering(nullptr);
+  auto renderFace = [this]()
+  {
+    // update the compositors
+    this->scene->StartRendering(nullptr);
 
-  this->dataPtr->ogreCompositorWorkspace->_validateFinalTarget();
-  this->dataPtr->ogreCompositorWorkspace->_beginUpdate(false);
-  this->dataPtr->ogreCompositorWorkspace->_update();
-  this->dataPtr->ogreCompositorWorkspace->_endUpdate(false);
+    this->dataPtr->ogreCompositorWorkspace->_validateFinalTarget();
+    this->dataPtr->ogreCompositorWorkspace->_beginUpdate(false);
+    this->dataPtr->ogreCompositorWorkspace->_update();
+    this->dataPtr->ogreCompositorWorkspace->_endUpdate(false);
 
-  Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
-  swappedTargets.reserve(2u);
-  this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
+    Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
+    swappedTargets.reserve(2u);
+    this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
+
+    this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+  };
+
+  if (!WideAngleProjection::IsWideAngle(this->ProjectionType()))
+  {
+    renderFace();
+    return;
+  }
 
-  this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+  // labels can not be interpolated
+  this->dataPtr->wideAngle.SetNearestFiltering(true);
+  this->dataPtr->wideAngle.SetRotatePoints(false);
+  this->dataPtr->wideAngle.SetInvalidColor(
+      Ogre2Conversions::Convert(this->backgroundColor));
+  this->dataPtr->wideAngle.Render(this->Name(), this->scene,
+      this->ogreCamera, this->dataPtr->ogreSegmentationTexture,
+      this->ProjectionModel(), renderFace);
 }
 
 /////////////////////////////////////////////////
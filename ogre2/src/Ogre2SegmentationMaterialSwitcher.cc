@@ -19,10 +19,12 @@
 
 #include <algorithm>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <ignition/common/Console.hh>
 
+#include "ignition/rendering/ogre2/Ogre2Decal.hh"
 #include "ignition/rendering/ogre2/Ogre2Heightmap.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
 #include "ignition/rendering/ogre2/Ogre2Visual.hh"
@@ -31,9 +33,14 @@
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
+#include <OgreCamera.h>
+#include <OgreDecal.h>
+#include <OgreHlms.h>
+#include <OgreHlmsManager.h>
 #include <OgreItem.h>
 #include <OgreMaterialManager.h>
 #include <OgrePass.h>
+#include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #include <OgreTechnique.h>
 #ifdef _MSC_VER
@@ -43,6 +50,82 @@
 using namespace ignition;
 using namespace rendering;
 
+/////////////////////////////////////////////////
+void Ogre2SegmentationTerraListener::preparePassHash(
+    const Ogre::CompositorShadowNode */*_shadowNode*/,
+    bool _casterPass, bool /*_dualParaboloid*/,
+    Ogre::SceneManager */*_sceneManager*/,
+    Ogre::Hlms *_hlms)
+{
+  if (!_casterPass)
+  {
+    _hlms->_setProperty("ign_segmentation", 1);
+    _hlms->_setProperty("ign_max_label_decals",
+        static_cast<Ogre::int32>(kMaxLabelDecals));
+  }
+}
+
+/////////////////////////////////////////////////
+Ogre::uint32 Ogre2SegmentationTerraListener::getPassBufferSize(
+    const Ogre::CompositorShadowNode */*_shadowNode*/,
+    bool _casterPass, bool /*_dualParaboloid*/,
+    Ogre::SceneManager */*_sceneManager*/) const
+{
+  if (_casterPass)
+    return 0u;
+
+  // float4 ignSegmentationColor, float4 ignNumLabelDecals,
+  // float4x4 ignDecalInvView[], float4 ignDecalColor[]
+  return sizeof(float) * (4u + 4u + kMaxLabelDecals * (16u + 4u));
+}
+
+/////////////////////////////////////////////////
+float *Ogre2SegmentationTerraListener::preparePassBuffer(
+    const Ogre::CompositorShadowNode */*_shadowNode*/,
+    bool _casterPass, bool /*_dualParaboloid*/,
+    Ogre::SceneManager *_sceneManager,
+    float *_passBufferPtr)
+{
+  if (_casterPass)
+    return _passBufferPtr;
+
+  for (size_t i = 0; i < 4u; ++i)
+    *_passBufferPtr++ = this->color[i];
+
+  const size_t numDecals = std::min<size_t>(this->decalInvWorld.size(),
+      kMaxLabelDecals);
+  *_passBufferPtr++ = static_cast<float>(numDecals);
+  *_passBufferPtr++ = 0.0f;
+  *_passBufferPtr++ = 0.0f;
+  *_passBufferPtr++ = 0.0f;
+
+  // Terra has view space positions, so bring the decal transforms from
+  // world space to view space
+  const Ogre::Camera *camera =
+      _sceneManager->getCamerasInProgress().renderingCamera;
+  const Ogre::Matrix4 invView =
+      camera->getViewMatrix(true).inverseAffine();
+  for (size_t d = 0; d < kMaxLabelDecals; ++d)
+  {
+    Ogre::Matrix4 m = Ogre::Matrix4::ZERO;
+    if (d < numDecals)
+      m = this->decalInvWorld[d] * invView;
+    for (size_t i = 0; i < 16u; ++i)
+      *_passBufferPtr++ = static_cast<float>(m[0][i]);
+  }
+
+  for (size_t d = 0; d < kMaxLabelDecals; ++d)
+  {
+    Ogre::Vector4 c = Ogre::Vector4::ZERO;
+    if (d < numDecals)
+      c = this->decalColors[d];
+    for (size_t i = 0; i < 4u; ++i)
+      *_passBufferPtr++ = c[i];
+  }
+
+  return _passBufferPtr;
+}
+
 /////////////////////////////////////////////////
 Ogre2SegmentationMaterialSwitcher::Ogre2SegmentationMaterialSwitcher(
   Ogre2ScenePtr _scene, SegmentationCamera *_camera)
@@ -50,26 +133,26 @@ Ogre2SegmentationMaterialSwitcher::Ogre2SegmentationMaterialSwitcher(
   this->scene = _scene;
   this->segmentationCamera = _camera;
 
-  // plain material to switch item's material
+  // segmentation material to switch item's material
   Ogre::ResourcePtr res =
-    Ogre::MaterialManager::getSingleton().load("ign-rendering/plain_color",
+    Ogre::MaterialManager::getSingleton().load("ign-rendering/segmentation",
         Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
 
-  this->plainMaterial = res.staticCast<Ogre::Material>();
-  this->plainMaterial->load();
+  this->segmentationMaterial = res.staticCast<Ogre::Material>();
+  this->segmentationMaterial->load();
 
-  // plain overlay material
-  this->plainOverlayMaterial =
-      this->plainMaterial->clone("plain_color_overlay");
-  if (!this->plainOverlayMaterial->getTechnique(0) ||
-      !this->plainOverlayMaterial->getTechnique(0)->getPass(0))
+  // segmentation overlay material
+  this->segmentationOverlayMaterial =
+      this->segmentationMaterial->clone("segmentation_overlay");
+  if (!this->segmentationOverlayMaterial->getTechnique(0) ||
+      !this->segmentationOverlayMaterial->getTechnique(0)->getPass(0))
   {
-    ignerr << "Problem creating selection buffer overlay material"
+    ignerr << "Problem creating segmentation overlay material"
         << std::endl;
     return;
   }
   Ogre::Pass *overlayPass =
-      this->plainOverlayMaterial->getTechnique(0)->getPass(0);
+      this->segmentationOverlayMaterial->getTechnique(0)->getPass(0);
   Ogre::HlmsMacroblock macroblock(*overlayPass->getMacroblock());
   macroblock.mDepthCheck = false;
   macroblock.mDepthWrite = false;
@@ -157,6 +240,59 @@ VisualPtr Ogre2SegmentationMaterialSwitcher::TopLevelModelVisual(
   return p;
 }
 
+////////////////////////////////////////////////
+Ogre::Vector4 Ogre2SegmentationMaterialSwitcher::LabelToCustomParameter(
+    int _label, bool _isMultiLink)
+{
+  if (this->segmentationCamera->Type() == SegmentationType::ST_SEMANTIC)
+  {
+    if (this->segmentationCamera->IsColoredMap())
+    {
+      // semantic material (each pixel has item's color)
+      math::Color color = this->LabelToColor(_label);
+      return Ogre::Vector4(color.R(), color.G(), color.B(), 1.0);
+    }
+
+    // labels ids material (each pixel has item's label)
+    float labelColor = _label / 255.0;
+    return Ogre::Vector4(labelColor, labelColor, labelColor, 1.0);
+  }
+
+  if (this->segmentationCamera->Type() != SegmentationType::ST_PANOPTIC)
+    return Ogre::Vector4::ZERO;
+
+  auto it = this->instancesCount.find(_label);
+  if (it == this->instancesCount.end())
+    it = this->instancesCount.insert(std::make_pair(_label, 0)).first;
+
+  // all links of a multi link model belong to the same instance
+  if (!_isMultiLink)
+    it->second++;
+
+  int instanceCount = it->second;
+
+  if (this->segmentationCamera->IsColoredMap())
+  {
+    // convert 24 bit number to int64
+    int compositeId = _label * 256 * 256 + instanceCount;
+
+    math::Color color;
+    if (_label == this->segmentationCamera->BackgroundLabel())
+      color = this->LabelToColor(_label, _isMultiLink);
+    else
+      color = this->LabelToColor(compositeId, _isMultiLink);
+
+    return Ogre::Vector4(color.R(), color.G(), color.B(), 1.0);
+  }
+
+  // 256 => 8 bits .. 255 => color percentage
+  float labelColor = _label / 255.0;
+  float instanceColor1 = (instanceCount / 256) / 255.0;
+  float instanceColor2 = (instanceCount % 256) / 255.0;
+
+  return Ogre::Vector4(instanceColor2, instanceColor1, labelColor, 1.0);
+}
+
 ////////////////////////////////////////////////
 void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
     Ogre::Camera * /*_cam*/)
@@ -223,78 +359,22 @@ void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
         label = this->segmentationCamera->BackgroundLabel();
       }
 
-      // sub item custom parameter to set the pixel color material
-      Ogre::Vector4 customParameter;
-
-      // Material Switching
-      if (this->segmentationCamera->Type() == SegmentationType::ST_SEMANTIC)
-      {
-        if (this->segmentationCamera->IsColoredMap())
-        {
-          // semantic material (each pixel has item's color)
-          math::Color color = this->LabelToColor(label);
-          customParameter = Ogre::Vector4(
-            color.R(), color.G(), color.B(), 1.0);
-        }
-        else
-        {
-          // labels ids material (each pixel has item's label)
-          float labelColor = label / 255.0;
-          customParameter = Ogre::Vector4(
-            labelColor, labelColor, labelColor, 1.0);
-        }
-      }
-      else if (this->segmentationCamera->Type() ==
-          SegmentationType::ST_PANOPTIC)
+      // Multi link model has many links with the same first name and should
+      // have the same pixels color
+      bool isMultiLink = false;
+      if (this->segmentationCamera->Type() == SegmentationType::ST_PANOPTIC)
       {
-        auto itemName = visual->Name();
         std::string parentName = this->TopLevelModelVisual(visual)->Name();
-
-        auto it = this->instancesCount.find(label);
-        if (it == this->instancesCount.end())
-          it = this->instancesCount.insert(std::make_pair(label, 0)).first;
-
-        // Multi link model has many links with the same first name and should
-        // have the same pixels color
-        bool isMultiLink = false;
         if (parentName == prevParentName)
-        {
           isMultiLink = true;
-        }
         else
-        {
-          it->second++;
           prevParentName = parentName;
-        }
-
-        int instanceCount = it->second;
-
-        if (this->segmentationCamera->IsColoredMap())
-        {
-          // convert 24 bit number to int64
-          int compositeId = label * 256 * 256 + instanceCount;
-
-          math::Color color;
-          if (label == this->segmentationCamera->BackgroundLabel())
-            color = this->LabelToColor(label, isMultiLink);
-          else
-            color = this->LabelToColor(compositeId, isMultiLink);
-
-          customParameter = Ogre::Vector4(
-            color.R(), color.G(), color.B(), 1.0);
-        }
-        else
-        {
-          // 256 => 8 bits .. 255 => color percentage
-          float labelColor = label / 255.0;
-          float instanceColor1 = (instanceCount / 256) / 255.0;
-          float instanceColor2 = (instanceCount % 256) / 255.0;
-
-          customParameter = Ogre::Vector4(
-            instanceColor2, instanceColor1, labelColor, 1.0);
-        }
       }
 
+      // sub item custom parameter to set the pixel color material
+      Ogre::Vector4 customParameter =
+          this->LabelToCustomParameter(label, isMultiLink);
+
       for (unsigned int i = 0; i < item->getNumSubItems(); ++i)
       {
         Ogre::SubItem *subItem = item->getSubItem(i);
@@ -311,11 +391,11 @@ void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
           if (technique && !technique->isDepthWriteEnabled() &&
               !technique->isDepthCheckEnabled())
           {
-            subItem->setMaterial(this->plainOverlayMaterial);
+            subItem->setMaterial(this->segmentationOverlayMaterial);
           }
           else
           {
-            subItem->setMaterial(this->plainMaterial);
+            subItem->setMaterial(this->segmentationMaterial);
           }
         }
         // regular Pbs Hlms datablock
@@ -328,29 +408,99 @@ void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
           // depth check and depth write properties are off.
           if (!datablock->getMacroblock()->mDepthWrite &&
               !datablock->getMacroblock()->mDepthCheck)
-            subItem->setMaterial(this->plainOverlayMaterial);
+            subItem->setMaterial(this->segmentationOverlayMaterial);
           else
-            subItem->setMaterial(this->plainMaterial);
+            subItem->setMaterial(this->segmentationMaterial);
         }
       }
     }
   }
 
+  this->UpdateLabelDecals();
+
+  // heightmaps keep their Terra material, the listener makes HlmsTerra
+  // write their label color for this pass
+  int heightmapLabel = this->segmentationCamera->BackgroundLabel();
+  auto heightmaps = this->scene->Heightmaps();
+  for (auto h : heightmaps)
+  {
+    auto heightmap = h.lock();
+    if (!heightmap || !heightmap->Parent())
+      continue;
+    Variant labelAny = heightmap->Parent()->UserData("label");
+    if (std::holds_alternative<int>(labelAny))
+    {
+      heightmapLabel = std::get<int>(labelAny);
+      break;
+    }
+  }
+  this->terraListener.color =
+      this->LabelToCustomParameter(heightmapLabel, false);
+
+  Ogre::Hlms *hlmsTerra = Ogre::Root::getSingleton().getHlmsManager()->
+      getHlms(Ogre::HLMS_USER3);
+  this->prevTerraListener = hlmsTerra->getListener();
+  hlmsTerra->setListener(&this->terraListener);
+
   // reset the count & colors tracking
   this->instancesCount.clear();
   this->takenColors.clear();
   this->coloredLabel.clear();
+}
 
-  // disable heightmaps in segmentation camera sensor
-  // until we support changing its material based on input label
-  // TODO(anyone) add support for heightmaps with the segmentation camera
-  // https://github.com/ignitionrobotics/ign-rendering/issues/444
-  auto heightmaps = this->scene->Heightmaps();
-  for (auto h : heightmaps)
+////////////////////////////////////////////////
+void Ogre2SegmentationMaterialSwitcher::UpdateLabelDecals()
+{
+  auto &decalInvWorld = this->terraListener.decalInvWorld;
+  auto &decalColors = this->terraListener.decalColors;
+  decalInvWorld.clear();
+  decalColors.clear();
+
+  // decals without a label keep the label of the surfaces they are
+  // projected on
+  for (auto &d : this->scene->Decals())
   {
-    auto heightmap = h.lock();
-    if (heightmap)
-      heightmap->Parent()->SetVisible(false);
+    Ogre2DecalPtr decal = d.lock();
+    if (!decal || !decal->OgreDecal() || !decal->OgreDecal()->getParentNode())
+      continue;
+
+    Variant labelAny = decal->UserData("label");
+    if (!std::holds_alternative<int>(labelAny))
+      continue;
+
+    if (decalInvWorld.size() ==
+        Ogre2SegmentationTerraListener::kMaxLabelDecals)
+    {
+      ignwarn << "Segmentation cameras label at most "
+              << Ogre2SegmentationTerraListener::kMaxLabelDecals
+              << " decals, decal [" << decal->Name()
+              << "] is not labeled" << std::endl;
+      continue;
+    }
+
+    // the ogre decal covers the unit box of its node
+    Ogre::Node *decalNode = decal->OgreDecal()->getParentNode();
+    decalInvWorld.push_back(
+        decalNode->_getFullTransformUpdated().inverseAffine());
+    decalColors.push_back(
+        this->LabelToCustomParameter(std::get<int>(labelAny), false));
+  }
+
+  // These parameters are declared in
+  // media/materials/programs/GLSL/segmentation_fs.glsl
+  for (auto &material :
+      {this->segmentationMaterial, this->segmentationOverlayMaterial})
+  {
+    Ogre::GpuProgramParametersSharedPtr psParams =
+        material->getTechnique(0)->getPass(0)->getFragmentProgramParameters();
+    psParams->setNamedConstant("numDecals",
+        static_cast<int>(decalInvWorld.size()));
+    if (decalInvWorld.empty())
+      continue;
+    psParams->setNamedConstant("decalInvWorld", decalInvWorld.data(),
+        decalInvWorld.size());
+    psParams->setNamedConstant("decalColor", decalColors[0].ptr(),
+        decalColors.size());
   }
 }
 
@@ -368,14 +518,10 @@ void Ogre2SegmentationMaterialSwitcher::cameraPostRenderScene(
   this->datablockMap.clear();
   this->segmentationMaterialMap.clear();
 
-  // re-enable heightmaps
-  auto heightmaps = this->scene->Heightmaps();
-  for (auto h : heightmaps)
-  {
-    auto heightmap = h.lock();
-    if (heightmap)
-      heightmap->Parent()->SetVisible(true);
-  }
+  Ogre::Hlms *hlmsTerra = Ogre::Root::getSingleton().getHlmsManager()->
+      getHlms(Ogre::HLMS_USER3);
+  hlmsTerra->setListener(this->prevTerraListener);
+  this->prevTerraListener = nullptr;
 }
 
 ////////////////////////////////////////////////
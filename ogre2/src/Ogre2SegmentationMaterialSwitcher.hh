@@ -23,6 +23,7 @@
 #include <random>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <ignition/math/Color.hh>
 
@@ -32,12 +33,76 @@
 #include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
 #include "ignition/rendering/SegmentationCamera.hh"
 
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreHlmsListener.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
 namespace ignition
 {
 namespace rendering
 {
 inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
 
+/// \brief Hlms listener that makes HlmsTerra write the label color of
+/// heightmaps and of the decals projected on them instead of the shaded
+/// colour. It requires the pieces in ogre2/src/media/Hlms/Terra/ign to be
+/// registered with HlmsTerra.
+/// \internal
+class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2SegmentationTerraListener final :
+  public Ogre::HlmsListener
+{
+  /// \brief Destructor
+  public: virtual ~Ogre2SegmentationTerraListener() = default;
+
+  /// \brief Activates the ign_segmentation pieces for non-caster passes
+  /// \param[in] _casterPass True if this is a shadow caster pass
+  /// \param[in] _hlms Hlms the properties are set on
+  private: virtual void preparePassHash(
+        const Ogre::CompositorShadowNode *_shadowNode,
+        bool _casterPass, bool _dualParaboloid,
+        Ogre::SceneManager *_sceneManager,
+        Ogre::Hlms *_hlms) override;
+
+  /// \brief Room for the label colors and decal transforms in the pass
+  /// buffer
+  /// \param[in] _casterPass True if this is a shadow caster pass
+  /// \return Size in bytes of our pass buffer data
+  private: virtual Ogre::uint32 getPassBufferSize(
+        const Ogre::CompositorShadowNode *_shadowNode,
+        bool _casterPass, bool _dualParaboloid,
+        Ogre::SceneManager *_sceneManager) const override;
+
+  /// \brief Writes the label colors and the view space decal transforms
+  /// to the pass buffer
+  /// \param[in] _casterPass True if this is a shadow caster pass
+  /// \param[in] _sceneManager Scene manager of the rendering camera
+  /// \param[in] _passBufferPtr Where to write our data
+  /// \return The pointer where Ogre should continue appending more data
+  private: virtual float *preparePassBuffer(
+        const Ogre::CompositorShadowNode *_shadowNode,
+        bool _casterPass, bool _dualParaboloid,
+        Ogre::SceneManager *_sceneManager,
+        float *_passBufferPtr) override;
+
+  /// \brief Max number of labeled decals. Must match MAX_LABEL_DECALS in
+  /// the segmentation shaders.
+  public: static constexpr unsigned int kMaxLabelDecals = 16u;
+
+  /// \brief Label color of heightmaps. The value is per pass, so all
+  /// heightmaps share it.
+  public: Ogre::Vector4 color = Ogre::Vector4::ZERO;
+
+  /// \brief World to unit box transforms of the labeled decals
+  public: std::vector<Ogre::Matrix4> decalInvWorld;
+
+  /// \brief Label colors of the labeled decals
+  public: std::vector<Ogre::Vector4> decalColors;
+};
+
 /// \brief Helper class to assign unique colors to renderables
 class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2SegmentationMaterialSwitcher :
   public Ogre::Camera::Listener
@@ -79,6 +144,21 @@ class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2SegmentationMaterialSwitcher :
   /// \return The top level model visual of _visual
   private: VisualPtr TopLevelModelVisual(VisualPtr _visual) const;
 
+  /// \brief Get the sub item custom parameter that colors the pixels of
+  /// an object with the given label. In panoptic mode, this also counts a
+  /// new instance of the label unless _isMultiLink is true.
+  /// \param[in] _label Label of the object
+  /// \param[in] _isMultiLink True if the object is a link of the model
+  /// of the previous object, in which case they share the same instance
+  /// \return Custom parameter holding the color of the pixels
+  private: Ogre::Vector4 LabelToCustomParameter(int _label,
+    bool _isMultiLink);
+
+  /// \brief Collect the labeled decals of the scene and set their label
+  /// colors and transforms on the segmentation materials and the Terra
+  /// listener. Each decal is an instance of its own.
+  private: void UpdateLabelDecals();
+
   /// \brief Check if the color is already taken and add it to taken colors
   /// if it does not exist
   /// \param[in] _color Color to be checked
@@ -95,14 +175,19 @@ class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2SegmentationMaterialSwitcher :
   /// \brief A map of ogre sub item pointer to their original low level material
   private: std::map<Ogre::SubItem *, Ogre::MaterialPtr> segmentationMaterialMap;
 
-  /// \brief Ogre material consisting of a shader that changes the
-  /// appearance of item to use a unique color for mouse picking
-  private: Ogre::MaterialPtr plainMaterial;
+  /// \brief Ogre material that colors items with their label color, or
+  /// with the label color of the decals projected on them
+  private: Ogre::MaterialPtr segmentationMaterial;
+
+  /// \brief Same as segmentationMaterial, with the depth check and depth
+  /// write properties disabled
+  private: Ogre::MaterialPtr segmentationOverlayMaterial;
+
+  /// \brief Listener set on HlmsTerra while the camera renders
+  private: Ogre2SegmentationTerraListener terraListener;
 
-  /// \brief Ogre material consisting of a shader that changes the
-  /// appearance of item to use a unique color for mouse picking. In
-  /// addition, the depth check and depth write properties disabled.
-  private: Ogre::MaterialPtr plainOverlayMaterial;
+  /// \brief HlmsTerra listener to restore after the camera renders
+  private: Ogre::HlmsListener *prevTerraListener = nullptr;
 
   /// \brief Keep track of num of instances of the same label
   /// Key: label id, value: num of instances
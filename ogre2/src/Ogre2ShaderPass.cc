@@ -0,0 +1,429 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <memory>
+#include <string>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+
+#include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/ShaderParams.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "ignition/rendering/ogre2/Ogre2ShaderPass.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
+#include <OgreHighLevelGpuProgramManager.h>
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data for the Ogre2ShaderPass class
+class ignition::rendering::Ogre2ShaderPassPrivate
+{
+  /// \brief Load the user fragment shader and set it on the material
+  /// \param[in] _path Path to the fragment shader
+  public: void LoadFragmentShader(const std::string &_path);
+
+  /// \brief Pointer to the ogre material running the user shader
+  public: Ogre::Material *shaderMat = nullptr;
+
+  /// \brief True if all shader params need to be set on the material, e.g.
+  /// after a new shader is loaded
+  public: bool paramsDirty = true;
+
+  /// \brief Counter used to create unique gpu program names
+  public: static int programCounter;
+};
+
+int ignition::rendering::Ogre2ShaderPassPrivate::programCounter = 0;
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+void Ogre2ShaderPassPrivate::LoadFragmentShader(const std::string &_path)
+{
+  if (!this->shaderMat || _path.empty())
+    return;
+
+  std::string dirPath = common::parentPath(_path);
+  if (!Ogre::ResourceGroupManager::getSingleton().resourceLocationExists(
+      dirPath))
+  {
+    Ogre::ResourceGroupManager::getSingleton().addResourceLocation(
+        dirPath, "FileSystem", "General");
+  }
+
+  // metal shaders need to be paired with the vertex program in order to
+  // build the pipeline reflection
+  bool isMetal =
+      Ogre2RenderEngine::Instance()->GraphicsAPI() == GraphicsAPI::METAL;
+
+  std::string programName = "_ign_shader_pass_" +
+      std::to_string(programCounter++) + "_" + common::basename(_path);
+  Ogre::HighLevelGpuProgramPtr fragmentShader =
+    Ogre::HighLevelGpuProgramManager::getSingleton().createProgram(
+        programName,
+        Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME,
+        isMetal ? "metal" : "glsl", Ogre::GpuProgramType::GPT_FRAGMENT_PROGRAM);
+  fragmentShader->setSourceFile(_path);
+  if (isMetal)
+  {
+    fragmentShader->setParameter("shader_reflection_pair_hint",
+        "GaussianNoiseVS_Metal");
+  }
+  fragmentShader->load();
+
+  if (!fragmentShader->isLoaded() || fragmentShader->hasCompileError() ||
+      !fragmentShader->isSupported())
+  {
+    ignerr << "Unable to load fragment shader: " << _path << std::endl;
+    return;
+  }
+
+  // bind the input textures to the texture units declared in
+  // media/materials/scripts/camera_effects.material
+  Ogre::GpuProgramParametersSharedPtr defaultParams =
+      fragmentShader->getDefaultParameters();
+  const char *samplers[] = {"RT", "previousRT", "depthTexture"};
+  for (int i = 0; i < 3; ++i)
+  {
+    if (defaultParams->_findNamedConstantDefinition(samplers[i]))
+      defaultParams->setNamedConstant(samplers[i], i);
+  }
+
+  Ogre::Pass *pass = this->shaderMat->getTechnique(0)->getPass(0);
+  pass->setFragmentProgram(fragmentShader->getName());
+  this->shaderMat->compile();
+  this->shaderMat->load();
+  this->paramsDirty = true;
+}
+
+//////////////////////////////////////////////////
+Ogre2ShaderPass::Ogre2ShaderPass()
+  : dataPtr(std::make_unique<Ogre2ShaderPassPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2ShaderPass::~Ogre2ShaderPass()
+{
+}
+
+//////////////////////////////////////////////////
+void Ogre2ShaderPass::SetFragmentShader(const std::string &_path)
+{
+  BaseShaderPass::SetFragmentShader(_path);
+  if (this->fragmentShaderPath != _path)
+    return;
+
+  // a new shader starts without parameters. The params object is kept so
+  // pointers returned by FragmentShaderParams stay valid
+  this->fragmentShaderParams->Clear();
+  this->dataPtr->LoadFragmentShader(_path);
+}
+
+//////////////////////////////////////////////////
+void Ogre2ShaderPass::PreRender()
+{
+  if (!this->dataPtr->shaderMat)
+    return;
+
+  if (!this->enabled)
+    return;
+
+  if (!this->dataPtr->paramsDirty && !this->fragmentShaderParams->IsDirty())
+    return;
+
+  Ogre::Pass *pass =
+      this->dataPtr->shaderMat->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+
+  for (const auto &nameParam : *this->fragmentShaderParams)
+  {
+    const std::string &name = nameParam.first;
+    const ShaderParam &param = nameParam.second;
+
+    auto *constantDef =
+        Ogre::GpuProgramParameters::getAutoConstantDefinition(name);
+    if (constantDef)
+    {
+      psParams->setNamedAutoConstant(name, constantDef->acType);
+      continue;
+    }
+
+    if (ShaderParam::PARAM_TEXTURE == param.Type())
+    {
+      std::string value;
+      uint32_t uvSetIndex = 0;
+      param.Value(value, uvSetIndex);
+      if (!common::isFile(value))
+      {
+        ignerr << "Shader param texture not found: " << value << std::endl;
+        continue;
+      }
+      std::string dirPath = common::parentPath(value);
+      if (!Ogre::ResourceGroupManager::getSingleton().resourceLocationExists(
+          dirPath))
+      {
+        Ogre::ResourceGroupManager::getSingleton().addResourceLocation(
+            dirPath, "FileSystem", "General");
+      }
+
+      // extra textures are added after the RT, previousRT and depthTexture
+      // texture units
+      Ogre::TextureUnitState *texUnit = pass->getTextureUnitState(name);
+      if (!texUnit)
+      {
+        texUnit = pass->createTextureUnitState();
+        texUnit->setName(name);
+      }
+      texUnit->setTextureName(common::basename(value),
+          Ogre::TextureTypes::Type2D);
+      int texIndex = static_cast<int>(pass->getTextureUnitStateIndex(texUnit));
+      if (psParams->_findNamedConstantDefinition(name))
+        psParams->setNamedConstant(name, texIndex);
+      continue;
+    }
+
+    if (!psParams->_findNamedConstantDefinition(name))
+    {
+      ignwarn << "Unable to find GPU program parameter: " << name
+              << std::endl;
+      continue;
+    }
+
+    if (ShaderParam::PARAM_FLOAT == param.Type())
+    {
+      float value;
+      param.Value(&value);
+      psParams->setNamedConstant(name, value);
+    }
+    else if (ShaderParam::PARAM_INT == param.Type())
+    {
+      int value;
+      param.Value(&value);
+      psParams->setNamedConstant(name, value);
+    }
+    else if (ShaderParam::PARAM_FLOAT_BUFFER == param.Type())
+    {
+      std::shared_ptr<void> buffer;
+      param.Buffer(buffer);
+      psParams->setNamedConstant(name,
+          reinterpret_cast<float *>(buffer.get()), param.Count(), 1u);
+    }
+    else if (ShaderParam::PARAM_INT_BUFFER == param.Type())
+    {
+      std::shared_ptr<void> buffer;
+      param.Buffer(buffer);
+      psParams->setNamedConstant(name,
+          reinterpret_cast<int *>(buffer.get()), param.Count(), 1u);
+    }
+  }
+  this->fragmentShaderParams->ClearDirty();
+  this->dataPtr->paramsDirty = false;
+}
+
+//////////////////////////////////////////////////
+void Ogre2ShaderPass::CreateRenderPass()
+{
+  // the node definition only needs to be created once
+  if (!this->ogreCompositorNodeDefName.empty())
+    return;
+
+  static int shaderNodeCounter = 0;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  std::string nodeDefName = "ShaderPassNode_"
+      + std::to_string(shaderNodeCounter);
+
+  if (ogreCompMgr->hasNodeDefinition(nodeDefName))
+    return;
+
+  // The material is defined in script (camera_effects.material). It copies
+  // the input until the user shader replaces its fragment program.
+  std::string matName = "ShaderPass";
+  Ogre::MaterialPtr ogreMat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!ogreMat)
+  {
+    ignerr << "Shader pass material not found: '" << matName << "'"
+           << std::endl;
+    return;
+  }
+  if (!ogreMat->isLoaded())
+    ogreMat->load();
+  std::string materialName = matName + "_" +
+      std::to_string(shaderNodeCounter);
+  this->dataPtr->shaderMat = ogreMat->clone(materialName).get();
+  this->dataPtr->LoadFragmentShader(this->fragmentShaderPath);
+
+  // create the compositor node definition
+  //
+  // compositor_node ShaderPassNode
+  // {
+  //   in 0 rt_input
+  //   in 1 rt_output
+  //
+  //   texture rt_previous target_width target_height target_format
+  //   // only if depth input is enabled
+  //   texture rt_depth target_width target_height PFG_D32_FLOAT
+  //
+  //   target rt_depth
+  //   {
+  //     pass render_scene
+  //     {
+  //       load { all clear }
+  //     }
+  //   }
+  //   target rt_output
+  //   {
+  //     pass render_quad
+  //     {
+  //       material ShaderPass_0
+  //       input 0 rt_input
+  //       input 1 rt_previous
+  //       input 2 rt_depth
+  //     }
+  //   }
+  //   target rt_previous
+  //   {
+  //     pass render_quad
+  //     {
+  //       material ShaderPass
+  //       input 0 rt_input
+  //     }
+  //   }
+  //   out 0 rt_output
+  //   out 1 rt_input
+  // }
+  this->ogreCompositorNodeDefName = nodeDefName;
+  shaderNodeCounter++;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+
+  // Input texture
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName("rt_output", 1,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  // local textures are persistent so rt_previous still holds the input of
+  // the last frame when the quad pass reads it. PFG_UNKNOWN takes the
+  // format of the render target, which the input textures share
+  Ogre::TextureDefinitionBase::TextureDefinition *previousTexDef =
+      nodeDef->addTextureDefinition("rt_previous");
+  previousTexDef->textureType = Ogre::TextureTypes::Type2D;
+  previousTexDef->width = 0;
+  previousTexDef->height = 0;
+  previousTexDef->widthFactor = 1;
+  previousTexDef->heightFactor = 1;
+  previousTexDef->format = Ogre::PFG_UNKNOWN;
+  previousTexDef->depthBufferId = Ogre::DepthBuffer::POOL_NO_DEPTH;
+  Ogre::RenderTargetViewDef *rtvPrevious =
+      nodeDef->addRenderTextureView("rt_previous");
+  rtvPrevious->setForTextureDefinition("rt_previous", previousTexDef);
+
+  std::string depthTexName = "rt_input";
+  if (this->depthInputEnabled)
+  {
+    depthTexName = "rt_depth";
+    Ogre::TextureDefinitionBase::TextureDefinition *depthTexDef =
+        nodeDef->addTextureDefinition(depthTexName);
+    depthTexDef->textureType = Ogre::TextureTypes::Type2D;
+    depthTexDef->width = 0;
+    depthTexDef->height = 0;
+    depthTexDef->widthFactor = 1;
+    depthTexDef->heightFactor = 1;
+    depthTexDef->format = Ogre::PFG_D32_FLOAT;
+    depthTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+    depthTexDef->depthBufferFormat = Ogre::PFG_UNKNOWN;
+    Ogre::RenderTargetViewDef *rtvDepth =
+        nodeDef->addRenderTextureView(depthTexName);
+    rtvDepth->setForTextureDefinition(depthTexName, depthTexDef);
+  }
+
+  nodeDef->setNumTargetPass(this->depthInputEnabled ? 3 : 2);
+
+  if (this->depthInputEnabled)
+  {
+    Ogre::CompositorTargetDef *depthTargetDef =
+        nodeDef->addTargetPass(depthTexName);
+    depthTargetDef->setNumPasses(1);
+    {
+      // scene pass. The visibility mask of the render target is applied by
+      // Ogre2RenderTargetCompositorListener
+      Ogre::CompositorPassSceneDef *passScene =
+          static_cast<Ogre::CompositorPassSceneDef *>(
+          depthTargetDef->addPass(Ogre::PASS_SCENE));
+      passScene->setAllLoadActions(Ogre::LoadAction::Clear);
+      passScene->mIncludeOverlays = false;
+      passScene->mFirstRQ = 0u;
+      passScene->mLastRQ = 2u;
+    }
+  }
+
+  // rt_output target
+  Ogre::CompositorTargetDef *outputTargetDef =
+      nodeDef->addTargetPass("rt_output");
+  outputTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        outputTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = materialName;
+    passQuad->addQuadTextureSource(0, "rt_input");
+    passQuad->addQuadTextureSource(1, "rt_previous");
+    passQuad->addQuadTextureSource(2, depthTexName);
+  }
+
+  // rt_previous target
+  Ogre::CompositorTargetDef *previousTargetDef =
+      nodeDef->addTargetPass("rt_previous");
+  previousTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        previousTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = matName;
+    passQuad->addQuadTextureSource(0, "rt_input");
+  }
+
+  nodeDef->mapOutputChannel(0, "rt_output");
+  nodeDef->mapOutputChannel(1, "rt_input");
+}
+
+IGN_RENDERING_REGISTER_RENDER_PASS(Ogre2ShaderPass, ShaderPass)
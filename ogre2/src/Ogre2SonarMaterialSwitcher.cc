@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "Ogre2SonarMaterialSwitcher.hh"
+
+#include <algorithm>
+#include <string>
+#include <variant>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Heightmap.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreHlms.h>
+#include <OgreHlmsManager.h>
+#include <OgreItem.h>
+#include <OgreMaterialManager.h>
+#include <OgreRoot.h>
+#include <OgreSceneManager.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+void Ogre2SonarTerraListener::preparePassHash(
+    const Ogre::CompositorShadowNode */*_shadowNode*/,
+    bool _casterPass, bool /*_dualParaboloid*/,
+    Ogre::SceneManager */*_sceneManager*/,
+    Ogre::Hlms *_hlms)
+{
+  if (!_casterPass)
+    _hlms->_setProperty("ign_sonar", 1);
+}
+
+/////////////////////////////////////////////////
+Ogre::uint32 Ogre2SonarTerraListener::getPassBufferSize(
+    const Ogre::CompositorShadowNode */*_shadowNode*/,
+    bool _casterPass, bool /*_dualParaboloid*/,
+    Ogre::SceneManager */*_sceneManager*/) const
+{
+  if (_casterPass)
+    return 0u;
+  return sizeof(float) * 4u;
+}
+
+/////////////////////////////////////////////////
+float *Ogre2SonarTerraListener::preparePassBuffer(
+    const Ogre::CompositorShadowNode */*_shadowNode*/,
+    bool _casterPass, bool /*_dualParaboloid*/,
+    Ogre::SceneManager */*_sceneManager*/,
+    float *_passBufferPtr)
+{
+  if (!_casterPass)
+  {
+    // float4 ignSonarReflectivity
+    *_passBufferPtr++ = this->reflectivity;
+    *_passBufferPtr++ = 0.0f;
+    *_passBufferPtr++ = 0.0f;
+    *_passBufferPtr++ = 0.0f;
+  }
+  return _passBufferPtr;
+}
+
+/////////////////////////////////////////////////
+Ogre2SonarMaterialSwitcher::Ogre2SonarMaterialSwitcher(
+    Ogre2ScenePtr _scene)
+{
+  this->scene = _scene;
+
+  Ogre::ResourcePtr res =
+    Ogre::MaterialManager::getSingleton().load(
+        "ign-rendering/sonar_source",
+        Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+
+  this->sonarMaterial = res.staticCast<Ogre::Material>();
+  this->sonarMaterial->load();
+}
+
+/////////////////////////////////////////////////
+Ogre2SonarMaterialSwitcher::~Ogre2SonarMaterialSwitcher()
+{
+}
+
+/////////////////////////////////////////////////
+float Ogre2SonarMaterialSwitcher::Reflectivity(
+    const Ogre::Item *_item) const
+{
+  Ogre::Any userAny = _item->getUserObjectBindings().getUserAny();
+  if (userAny.isEmpty() || userAny.getType() != typeid(unsigned int))
+    return 0.0f;
+
+  VisualPtr visual;
+  try
+  {
+    visual = this->scene->VisualById(Ogre::any_cast<unsigned int>(userAny));
+  }
+  catch(Ogre::Exception &e)
+  {
+    ignerr << "Ogre Error:" << e.getFullDescription() << "\n";
+  }
+  return this->Reflectivity(visual);
+}
+
+/////////////////////////////////////////////////
+float Ogre2SonarMaterialSwitcher::Reflectivity(
+    const VisualPtr &_visual) const
+{
+  const std::string reflectivityKey = "acoustic_reflectivity";
+
+  if (!_visual || !_visual->HasUserData(reflectivityKey))
+    return 0.0f;
+
+  float reflectivity = 0.0f;
+  Variant value = _visual->UserData(reflectivityKey);
+  if (std::holds_alternative<float>(value))
+    reflectivity = std::get<float>(value);
+  else if (std::holds_alternative<double>(value))
+    reflectivity = static_cast<float>(std::get<double>(value));
+  else if (std::holds_alternative<int>(value))
+    reflectivity = static_cast<float>(std::get<int>(value));
+  else
+    ignerr << "Error casting user data [" << reflectivityKey << "]\n";
+
+  return std::clamp(reflectivity, 0.0f, 1.0f);
+}
+
+////////////////////////////////////////////////
+void Ogre2SonarMaterialSwitcher::cameraPreRenderScene(
+    Ogre::Camera * /*_cam*/)
+{
+  auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
+      Ogre::ItemFactory::FACTORY_TYPE_NAME);
+  while (itor.hasMoreElements())
+  {
+    Ogre::Item *item = static_cast<Ogre::Item *>(itor.peekNext());
+    itor.moveNext();
+
+    float reflectivity = this->Reflectivity(item);
+    for (unsigned int i = 0; i < item->getNumSubItems(); ++i)
+    {
+      Ogre::SubItem *subItem = item->getSubItem(i);
+
+      if (!subItem->getMaterial().isNull())
+      {
+        // low level material, e.g. shaders
+        this->materialMap[subItem] = subItem->getMaterial();
+      }
+      else
+      {
+        // regular Pbs Hlms datablock
+        this->datablockMap[subItem] = subItem->getDatablock();
+      }
+
+      subItem->setCustomParameter(1,
+          Ogre::Vector4(reflectivity, 0.0, 0.0, 1.0));
+      subItem->setMaterial(this->sonarMaterial);
+    }
+  }
+
+  // heightmaps keep their Terra material, the listener makes HlmsTerra
+  // write the range and backscatter for this pass
+  this->terraListener.reflectivity = 0.0f;
+  auto heightmaps = this->scene->Heightmaps();
+  for (auto h : heightmaps)
+  {
+    auto heightmap = h.lock();
+    if (!heightmap)
+      continue;
+    VisualPtr visual = heightmap->Parent();
+    if (visual && visual->HasUserData("acoustic_reflectivity"))
+    {
+      this->terraListener.reflectivity = this->Reflectivity(visual);
+      break;
+    }
+  }
+
+  Ogre::Hlms *hlmsTerra = Ogre::Root::getSingleton().getHlmsManager()->
+      getHlms(Ogre::HLMS_USER3);
+  this->prevTerraListener = hlmsTerra->getListener();
+  hlmsTerra->setListener(&this->terraListener);
+}
+
+////////////////////////////////////////////////
+void Ogre2SonarMaterialSwitcher::cameraPostRenderScene(
+    Ogre::Camera * /*_cam*/)
+{
+  // restore item to use pbs hlms material
+  for (const auto &[subItem, dataBlock] : this->datablockMap)
+    subItem->setDatablock(dataBlock);
+
+  for (const auto &[subItem, material] : this->materialMap)
+    subItem->setMaterial(material);
+
+  this->datablockMap.clear();
+  this->materialMap.clear();
+
+  Ogre::Hlms *hlmsTerra = Ogre::Root::getSingleton().getHlmsManager()->
+      getHlms(Ogre::HLMS_USER3);
+  hlmsTerra->setListener(this->prevTerraListener);
+  this->prevTerraListener = nullptr;
+}
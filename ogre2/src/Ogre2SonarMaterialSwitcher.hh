@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2SONARMATERIALSWITCHER_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2SONARMATERIALSWITCHER_HH_
+
+#include <map>
+#include <unordered_map>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+#include "ignition/rendering/ogre2/Ogre2Camera.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreHlmsListener.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+namespace ignition
+{
+namespace rendering
+{
+inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Hlms listener that makes HlmsTerra write the sonar range and
+/// backscatter instead of the shaded colour. It requires the pieces in
+/// ogre2/src/media/Hlms/Terra/ign to be registered with HlmsTerra.
+/// \internal
+class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2SonarTerraListener final :
+  public Ogre::HlmsListener
+{
+  /// \brief Destructor
+  public: virtual ~Ogre2SonarTerraListener() = default;
+
+  /// \brief Activates the ign_sonar pieces for non-caster passes
+  /// \param[in] _casterPass True if this is a shadow caster pass
+  /// \param[in] _hlms Hlms the properties are set on
+  private: virtual void preparePassHash(
+        const Ogre::CompositorShadowNode *_shadowNode,
+        bool _casterPass, bool _dualParaboloid,
+        Ogre::SceneManager *_sceneManager,
+        Ogre::Hlms *_hlms) override;
+
+  /// \brief Room for the reflectivity in the pass buffer
+  /// \param[in] _casterPass True if this is a shadow caster pass
+  /// \return Size in bytes of our pass buffer data
+  private: virtual Ogre::uint32 getPassBufferSize(
+        const Ogre::CompositorShadowNode *_shadowNode,
+        bool _casterPass, bool _dualParaboloid,
+        Ogre::SceneManager *_sceneManager) const override;
+
+  /// \brief Writes the reflectivity to the pass buffer
+  /// \param[in] _casterPass True if this is a shadow caster pass
+  /// \param[in] _passBufferPtr Where to write our data
+  /// \return The pointer where Ogre should continue appending more data
+  private: virtual float *preparePassBuffer(
+        const Ogre::CompositorShadowNode *_shadowNode,
+        bool _casterPass, bool _dualParaboloid,
+        Ogre::SceneManager *_sceneManager,
+        float *_passBufferPtr) override;
+
+  /// \brief Acoustic reflectivity of heightmaps in the range of [0, 1].
+  /// The value is per pass, so all heightmaps share it.
+  public: float reflectivity = 0.0f;
+};
+
+/// \brief Helper class that switches the material of all items to one that
+/// writes the range and the Lambertian backscatter of each pixel for sonar
+/// sensors. The backscatter is the "acoustic_reflectivity" user data of the
+/// visual times the cosine of the incidence angle.
+/// Heightmaps keep their Terra material and are rendered through
+/// Ogre2SonarTerraListener instead. Since their reflectivity is sent per
+/// pass, all heightmaps use the reflectivity of the first heightmap visual
+/// that has "acoustic_reflectivity" user data.
+class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2SonarMaterialSwitcher :
+  public Ogre::Camera::Listener
+{
+  /// \brief Constructor
+  /// \param[in] _scene The scene associated with the material switcher
+  public: explicit Ogre2SonarMaterialSwitcher(Ogre2ScenePtr _scene);
+
+  /// \brief Destructor
+  public: ~Ogre2SonarMaterialSwitcher();
+
+  /// \brief Ogre's pre render update callback
+  /// \param[in] _cam Ogre camera
+  public: virtual void cameraPreRenderScene(Ogre::Camera *_cam) override;
+
+  /// \brief Ogre's post render update callback
+  /// \param[in] _cam Ogre camera
+  public: virtual void cameraPostRenderScene(Ogre::Camera *_cam) override;
+
+  /// \brief Get the acoustic reflectivity of the visual an item belongs to
+  /// \param[in] _item Ogre item
+  /// \return Reflectivity in the range of [0, 1], 0 if it is not set
+  private: float Reflectivity(const Ogre::Item *_item) const;
+
+  /// \brief Get the acoustic reflectivity of a visual
+  /// \param[in] _visual Visual to get the reflectivity of
+  /// \return Reflectivity in the range of [0, 1], 0 if it is not set
+  private: float Reflectivity(const VisualPtr &_visual) const;
+
+  /// \brief A map of ogre sub item pointer to their original hlms material
+  private: std::unordered_map<Ogre::SubItem *,
+    Ogre::HlmsDatablock *> datablockMap;
+
+  /// \brief A map of ogre sub item pointer to their original low level
+  /// material
+  private: std::map<Ogre::SubItem *, Ogre::MaterialPtr> materialMap;
+
+  /// \brief Material that writes the range and backscatter
+  private: Ogre::MaterialPtr sonarMaterial;
+
+  /// \brief Listener set on HlmsTerra while the sonar renders
+  private: Ogre2SonarTerraListener terraListener;
+
+  /// \brief HlmsTerra listener to restore after the sonar renders
+  private: Ogre::HlmsListener *prevTerraListener = nullptr;
+
+  /// \brief Ogre2 Scene
+  private: Ogre2ScenePtr scene = nullptr;
+};
+}
+}  // namespace rendering
+}  // namespace ignition
+
+#endif  // IGNITION_RENDERING_OGRE2_OGRE2SONARMATERIALSWITCHER_HH_
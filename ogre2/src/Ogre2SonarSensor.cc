@@ -0,0 +1,484 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Rand.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Includes.hh"
+#include "ignition/rendering/ogre2/Ogre2ParticleEmitter.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+#include "ignition/rendering/ogre2/Ogre2SonarSensor.hh"
+#include "ignition/rendering/RenderTypes.hh"
+
+#include "Ogre2SonarMaterialSwitcher.hh"
+
+/// \brief Private data for the Ogre2SonarSensor class
+class ignition::rendering::Ogre2SonarSensorPrivate
+{
+  /// \brief Polar image with one column per beam and one row per range bin
+  public: Ogre::TextureGpu *ogreSonarTexture = nullptr;
+
+  /// \brief Workspace definition
+  public: std::string ogreCompositorWorkspaceDef;
+
+  /// \brief Compositor node definition
+  public: std::string ogreCompositorNodeDef;
+
+  /// \brief Compositor workspace
+  public: Ogre::CompositorWorkspace *ogreCompositorWorkspace = nullptr;
+
+  /// \brief Material that forms the beams
+  public: Ogre::MaterialPtr sonarMaterial;
+
+  /// \brief Switches the material of all items to one that writes the
+  /// range and backscatter of each pixel during the scene pass
+  public: std::unique_ptr<Ogre2SonarMaterialSwitcher> materialSwitcher;
+
+  /// \brief Dummy render texture
+  public: RenderTexturePtr sonarTexture;
+
+  /// \brief Beam count the textures were created with
+  public: unsigned int textureBeamCount = 0u;
+
+  /// \brief Range bin count the textures were created with
+  public: unsigned int textureRangeBinCount = 0u;
+
+  /// \brief Image width the textures were created with
+  public: unsigned int textureImageWidth = 0u;
+
+  /// \brief Image height the textures were created with
+  public: unsigned int textureImageHeight = 0u;
+
+  /// \brief Polar image sent to listeners
+  public: std::vector<float> data;
+
+  /// \brief Event used to signal new sonar frames
+  public: ignition::common::EventT<void(const float *,
+              unsigned int, unsigned int)> newSonarFrame;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+Ogre2SonarSensor::Ogre2SonarSensor() :
+  dataPtr(new Ogre2SonarSensorPrivate())
+{
+}
+
+/////////////////////////////////////////////////
+Ogre2SonarSensor::~Ogre2SonarSensor()
+{
+  this->Destroy();
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::Init()
+{
+  BaseCamera::Init();
+
+  this->CreateCamera();
+
+  this->CreateRenderTexture();
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::Destroy()
+{
+  this->dataPtr->data.clear();
+
+  if (!this->ogreCamera)
+    return;
+
+  this->DestroySonarTexture();
+
+  Ogre::SceneManager *ogreSceneManager;
+  ogreSceneManager = this->scene->OgreSceneManager();
+  if (ogreSceneManager == nullptr)
+  {
+    ignerr << "Scene manager cannot be obtained" << std::endl;
+  }
+  else
+  {
+    if (ogreSceneManager->findCameraNoThrow(this->name) != nullptr)
+    {
+      ogreSceneManager->destroyCamera(this->ogreCamera);
+      this->ogreCamera = nullptr;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::DestroySonarTexture()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  auto ogreCompMgr = ogreRoot->getCompositorManager2();
+  auto textureMgr = ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  if (this->dataPtr->materialSwitcher)
+  {
+    this->ogreCamera->removeListener(this->dataPtr->materialSwitcher.get());
+    this->dataPtr->materialSwitcher.reset();
+  }
+
+  if (this->dataPtr->ogreCompositorWorkspace)
+  {
+    ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspace);
+    this->dataPtr->ogreCompositorWorkspace = nullptr;
+  }
+
+  if (!this->dataPtr->ogreCompositorWorkspaceDef.empty())
+  {
+    ogreCompMgr->removeWorkspaceDefinition(
+        this->dataPtr->ogreCompositorWorkspaceDef);
+    ogreCompMgr->removeNodeDefinition(this->dataPtr->ogreCompositorNodeDef);
+    this->dataPtr->ogreCompositorWorkspaceDef.clear();
+    this->dataPtr->ogreCompositorNodeDef.clear();
+  }
+
+  if (this->dataPtr->ogreSonarTexture)
+  {
+    textureMgr->destroyTexture(this->dataPtr->ogreSonarTexture);
+    this->dataPtr->ogreSonarTexture = nullptr;
+  }
+
+  if (this->dataPtr->sonarMaterial)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        this->dataPtr->sonarMaterial->getName());
+    this->dataPtr->sonarMaterial.setNull();
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::PreRender()
+{
+  // the polar image and the source image are sized when they are created
+  if (this->dataPtr->ogreSonarTexture &&
+      (this->dataPtr->textureBeamCount != this->BeamCount() ||
+       this->dataPtr->textureRangeBinCount != this->RangeBinCount() ||
+       this->dataPtr->textureImageWidth != this->ImageWidth() ||
+       this->dataPtr->textureImageHeight != this->ImageHeight()))
+  {
+    this->DestroySonarTexture();
+  }
+
+  if (!this->dataPtr->ogreSonarTexture)
+    this->CreateSonarTexture();
+
+  // The source image covers the horizontal and vertical apertures. Its
+  // pixels are not square unless the image size matches the aspect ratio,
+  // which the beam forming shader accounts for.
+  double tanHalfHfov = std::tan(this->HFOV().Radian() / 2.0);
+  double tanHalfVfov = std::tan(this->VerticalFOV().Radian() / 2.0);
+  this->ogreCamera->setNearClipDistance(this->NearClipPlane());
+  this->ogreCamera->setFarClipDistance(this->FarClipPlane());
+  this->ogreCamera->setAspectRatio(tanHalfHfov / tanHalfVfov);
+  this->ogreCamera->setFOVy(Ogre::Radian(this->VerticalFOV().Radian()));
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::CreateCamera()
+{
+  auto ogreSceneManager = this->scene->OgreSceneManager();
+  if (ogreSceneManager == nullptr)
+  {
+    ignerr << "Scene manager cannot be obtained" << std::endl;
+    return;
+  }
+
+  this->ogreCamera = ogreSceneManager->createCamera(this->Name());
+  if (this->ogreCamera == nullptr)
+  {
+    ignerr << "Ogre camera cannot be created" << std::endl;
+    return;
+  }
+
+  this->ogreCamera->detachFromParent();
+  this->ogreNode->attachObject(this->ogreCamera);
+
+  // rotate to ignition gazebo coord.
+  this->ogreCamera->yaw(Ogre::Degree(-90));
+  this->ogreCamera->roll(Ogre::Degree(-90));
+  this->ogreCamera->setFixedYawAxis(false);
+
+  // the aspect ratio follows the apertures, not the image size
+  this->ogreCamera->setAutoAspectRatio(false);
+  this->ogreCamera->setProjectionType(Ogre::ProjectionType::PT_PERSPECTIVE);
+  this->ogreCamera->setCustomProjectionMatrix(false);
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::CreateSonarTexture()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  // The SonarSensor material is defined in script (sonar.material).
+  // We need to clone it since we are going to modify its uniform variables
+  Ogre::MaterialPtr mat =
+      Ogre::MaterialManager::getSingleton().getByName("SonarSensor");
+  this->dataPtr->sonarMaterial = mat->clone(this->Name() + "_SonarSensor");
+  this->dataPtr->sonarMaterial->load();
+
+  this->dataPtr->materialSwitcher =
+      std::make_unique<Ogre2SonarMaterialSwitcher>(this->scene);
+  this->ogreCamera->addListener(this->dataPtr->materialSwitcher.get());
+
+  // Programmatically create the compositor node. It is equivalent to the
+  // following:
+  //
+  // compositor_node SonarSensor
+  // {
+  //   in 0 rt0            // beams x range bins
+  //
+  //   texture sourceTexture imageWidth imageHeight PFG_RG32_FLOAT
+  //
+  //   target sourceTexture
+  //   {
+  //     pass render_scene
+  //     {
+  //       load { all clear }
+  //       clear_colour 0 0 0 0
+  //       visibility_mask 0xFFFFFFFF & ~particles
+  //     }
+  //   }
+  //   target rt0
+  //   {
+  //     pass render_quad
+  //     {
+  //       load { all clear }
+  //       material SonarSensor // Use copy instead of original
+  //       input 0 sourceTexture
+  //     }
+  //   }
+  // }
+  std::string wsDefName = "SonarSensorWorkspace_" + this->Name();
+  std::string nodeDefName = wsDefName + "/Node";
+  this->dataPtr->ogreCompositorWorkspaceDef = wsDefName;
+  this->dataPtr->ogreCompositorNodeDef = nodeDefName;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+  nodeDef->addTextureSourceName(
+      "rt0", 0u, Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  // the source image is sized independently of the polar image
+  Ogre::TextureDefinitionBase::TextureDefinition *sourceTexDef =
+      nodeDef->addTextureDefinition("sourceTexture");
+  sourceTexDef->textureType = Ogre::TextureTypes::Type2D;
+  sourceTexDef->width = this->ImageWidth();
+  sourceTexDef->height = this->ImageHeight();
+  sourceTexDef->depthOrSlices = 1;
+  sourceTexDef->numMipmaps = 0;
+  sourceTexDef->widthFactor = 1;
+  sourceTexDef->heightFactor = 1;
+  sourceTexDef->format = Ogre::PFG_RG32_FLOAT;
+  sourceTexDef->textureFlags &= ~Ogre::TextureFlags::Uav;
+  sourceTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+  sourceTexDef->depthBufferFormat = Ogre::PFG_D32_FLOAT;
+  sourceTexDef->preferDepthTexture = false;
+
+  Ogre::RenderTargetViewDef *rtvSource =
+    nodeDef->addRenderTextureView("sourceTexture");
+  rtvSource->setForTextureDefinition("sourceTexture", sourceTexDef);
+
+  nodeDef->setNumTargetPass(2u);
+  Ogre::CompositorTargetDef *sourceTargetDef =
+      nodeDef->addTargetPass("sourceTexture");
+  sourceTargetDef->setNumPasses(1);
+  {
+    // scene pass, a range of 0 marks pixels with no return
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        sourceTargetDef->addPass(Ogre::PASS_SCENE));
+    passScene->setAllLoadActions(Ogre::LoadAction::Clear);
+    passScene->setAllClearColours(Ogre::ColourValue::ZERO);
+    passScene->mVisibilityMask = this->VisibilityMask()
+        & ~Ogre2ParticleEmitter::kParticleVisibilityFlags;
+    passScene->mIncludeOverlays = false;
+  }
+
+  Ogre::CompositorTargetDef *sonarTargetDef = nodeDef->addTargetPass("rt0");
+  sonarTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        sonarTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->setAllLoadActions(Ogre::LoadAction::Clear);
+    passQuad->setAllClearColours(Ogre::ColourValue::ZERO);
+    passQuad->mMaterialName = this->dataPtr->sonarMaterial->getName();
+    passQuad->addQuadTextureSource(0, "sourceTexture");
+  }
+
+  Ogre::CompositorWorkspaceDef *workDef =
+      ogreCompMgr->addWorkspaceDefinition(wsDefName);
+  workDef->connectExternal(0, nodeDefName, 0);
+
+  // create render texture
+  this->dataPtr->ogreSonarTexture =
+      textureMgr->createOrRetrieveTexture(this->Name() + "_sonar",
+        Ogre::GpuPageOutStrategy::SaveToSystemRam,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+  this->dataPtr->ogreSonarTexture->setResolution(
+      this->BeamCount(), this->RangeBinCount());
+  this->dataPtr->ogreSonarTexture->setNumMipmaps(1u);
+  this->dataPtr->ogreSonarTexture->setPixelFormat(Ogre::PFG_R32_FLOAT);
+  this->dataPtr->ogreSonarTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
+
+  Ogre::CompositorChannelVec externalTargets(1u);
+  externalTargets[0] = this->dataPtr->ogreSonarTexture;
+  this->dataPtr->ogreCompositorWorkspace =
+      ogreCompMgr->addWorkspace(
+        this->scene->OgreSceneManager(),
+        externalTargets,
+        this->ogreCamera,
+        wsDefName,
+        false);
+
+  this->dataPtr->textureBeamCount = this->BeamCount();
+  this->dataPtr->textureRangeBinCount = this->RangeBinCount();
+  this->dataPtr->textureImageWidth = this->ImageWidth();
+  this->dataPtr->textureImageHeight = this->ImageHeight();
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::UpdateSonarMaterial()
+{
+  // Set the uniform variables (sonar_fs.glsl).
+  Ogre::Pass *pass =
+      this->dataPtr->sonarMaterial->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+
+  // random offsets used to sample the speckle, see Ogre2GaussianNoisePass
+  Ogre::Vector3 offsets(ignition::math::Rand::DblUniform(0.0, 1.0),
+                        ignition::math::Rand::DblUniform(0.0, 1.0),
+                        ignition::math::Rand::DblUniform(0.0, 1.0));
+
+  double hfov = this->HFOV().Radian();
+  double vfov = this->VerticalFOV().Radian();
+  Ogre::Vector2 tanHalfFov(
+      static_cast<Ogre::Real>(std::tan(hfov / 2.0)),
+      static_cast<Ogre::Real>(std::tan(vfov / 2.0)));
+
+  psParams->setNamedConstant("beamCount",
+      static_cast<float>(this->BeamCount()));
+  psParams->setNamedConstant("rangeBinCount",
+      static_cast<float>(this->RangeBinCount()));
+  psParams->setNamedConstant("hfov", static_cast<float>(hfov));
+  psParams->setNamedConstant("tanHalfFov", tanHalfFov);
+  psParams->setNamedConstant("vfov", static_cast<float>(vfov));
+  psParams->setNamedConstant("near",
+      static_cast<float>(this->NearClipPlane()));
+  psParams->setNamedConstant("far",
+      static_cast<float>(this->FarClipPlane()));
+  psParams->setNamedConstant("beamWidth",
+      static_cast<float>(this->BeamWidth().Radian()));
+  psParams->setNamedConstant("attenuation",
+      static_cast<float>(this->Attenuation()));
+  psParams->setNamedConstant("speckle",
+      static_cast<float>(this->SpeckleNoise()));
+  psParams->setNamedConstant("offsets", offsets);
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::Render()
+{
+  this->UpdateSonarMaterial();
+
+  // update the compositors
+  this->scene->StartRendering(this->ogreCamera);
+
+  Ogre::CompositorWorkspace *workspace =
+      this->dataPtr->ogreCompositorWorkspace;
+  workspace->_validateFinalTarget();
+  workspace->_beginUpdate(false);
+  workspace->_update();
+  workspace->_endUpdate(false);
+
+  Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
+  swappedTargets.reserve(2u);
+  workspace->_swapFinalTarget(swappedTargets);
+
+  this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::PostRender()
+{
+  if (this->dataPtr->newSonarFrame.ConnectionCount() == 0u)
+    return;
+
+  const unsigned int beamCount = this->dataPtr->textureBeamCount;
+  const unsigned int binCount = this->dataPtr->textureRangeBinCount;
+  this->dataPtr->data.resize(beamCount * binCount);
+
+  Ogre::Image2 image;
+  image.convertFromTexture(this->dataPtr->ogreSonarTexture, 0u, 0u);
+  Ogre::TextureBox box = image.getData(0);
+  const uint8_t *bufferTmp = static_cast<const uint8_t *>(box.data);
+
+  // The texture box may not be a contiguous region of a texture
+  for (unsigned int row = 0; row < binCount; ++row)
+  {
+    std::memcpy(&this->dataPtr->data[row * beamCount],
+        bufferTmp + row * box.bytesPerRow, beamCount * sizeof(float));
+  }
+
+  this->dataPtr->newSonarFrame(this->dataPtr->data.data(),
+      beamCount, binCount);
+}
+
+/////////////////////////////////////////////////
+ignition::common::ConnectionPtr Ogre2SonarSensor::ConnectNewSonarFrame(
+    std::function<void(const float *, unsigned int, unsigned int)>
+    _subscriber)
+{
+  return this->dataPtr->newSonarFrame.Connect(_subscriber);
+}
+
+/////////////////////////////////////////////////
+RenderTargetPtr Ogre2SonarSensor::RenderTarget() const
+{
+  return this->dataPtr->sonarTexture;
+}
+
+/////////////////////////////////////////////////
+void Ogre2SonarSensor::CreateRenderTexture()
+{
+  RenderTexturePtr base = this->scene->CreateRenderTexture();
+  this->dataPtr->sonarTexture =
+    std::dynamic_pointer_cast<Ogre2RenderTexture>(base);
+  this->dataPtr->sonarTexture->SetWidth(1);
+  this->dataPtr->sonarTexture->SetHeight(1);
+}
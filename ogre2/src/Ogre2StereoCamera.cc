@@ -0,0 +1,653 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Conversions.hh"
+#include "ignition/rendering/ogre2/Ogre2Includes.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+#include "ignition/rendering/ogre2/Ogre2StereoCamera.hh"
+#include "ignition/rendering/RenderTypes.hh"
+
+/// \brief Private data for the Ogre2StereoCamera class
+class ignition::rendering::Ogre2StereoCameraPrivate
+{
+  /// \brief Side by side texture holding the left eye in the left half and
+  /// the right eye in the right half
+  public: Ogre::TextureGpu *ogreStereoTexture = nullptr;
+
+  /// \brief Disparity of each pixel of the left eye
+  public: Ogre::TextureGpu *ogreDisparityTexture = nullptr;
+
+  /// \brief Camera whose frustum contains both eyes. Used for culling.
+  public: Ogre::Camera *ogreCullCamera = nullptr;
+
+  /// \brief Eye transforms and projections used by instanced stereo
+  /// rendering
+  public: Ogre::VrData vrData;
+
+  /// \brief Workspace definition
+  public: std::string ogreCompositorWorkspaceDef;
+
+  /// \brief Compositor node definition
+  public: std::string ogreCompositorNodeDef;
+
+  /// \brief Compositor workspace
+  public: Ogre::CompositorWorkspace *ogreCompositorWorkspace = nullptr;
+
+  /// \brief Material that converts the depth of the left eye to disparity
+  public: Ogre::MaterialPtr disparityMaterial;
+
+  /// \brief Dummy render texture
+  public: RenderTexturePtr stereoTexture;
+
+  /// \brief True if the textures and workspace need to be recreated
+  public: bool stereoTextureDirty = false;
+
+  /// \brief Left image sent to listeners
+  public: std::vector<unsigned char> leftImage;
+
+  /// \brief Right image sent to listeners
+  public: std::vector<unsigned char> rightImage;
+
+  /// \brief Disparity map sent to listeners
+  public: std::vector<float> disparityImage;
+
+  /// \brief Event used to signal new stereo image pairs
+  public: ignition::common::EventT<void(const unsigned char *,
+              const unsigned char *, unsigned int, unsigned int,
+              unsigned int, const std::string &)> newStereoFrame;
+
+  /// \brief Event used to signal new disparity maps
+  public: ignition::common::EventT<void(const float *,
+              unsigned int, unsigned int, unsigned int,
+              const std::string &)> newDisparityFrame;
+
+  /// \brief Name of shadow compositor node
+  public: const std::string kShadowNodeName = "PbsMaterialsShadowNode";
+};
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+Ogre2StereoCamera::Ogre2StereoCamera() :
+  dataPtr(new Ogre2StereoCameraPrivate())
+{
+}
+
+/////////////////////////////////////////////////
+Ogre2StereoCamera::~Ogre2StereoCamera()
+{
+  this->Destroy();
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::Init()
+{
+  BaseCamera::Init();
+
+  this->CreateCamera();
+
+  this->CreateRenderTexture();
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::Destroy()
+{
+  this->dataPtr->leftImage.clear();
+  this->dataPtr->rightImage.clear();
+  this->dataPtr->disparityImage.clear();
+
+  if (!this->ogreCamera)
+    return;
+
+  this->DestroyStereoTexture();
+
+  Ogre::SceneManager *ogreSceneManager;
+  ogreSceneManager = this->scene->OgreSceneManager();
+  if (ogreSceneManager == nullptr)
+  {
+    ignerr << "Scene manager cannot be obtained" << std::endl;
+  }
+  else
+  {
+    if (this->dataPtr->ogreCullCamera)
+    {
+      ogreSceneManager->destroyCamera(this->dataPtr->ogreCullCamera);
+      this->dataPtr->ogreCullCamera = nullptr;
+    }
+    if (ogreSceneManager->findCameraNoThrow(this->name) != nullptr)
+    {
+      this->ogreCamera->setVrData(nullptr);
+      ogreSceneManager->destroyCamera(this->ogreCamera);
+      this->ogreCamera = nullptr;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::DestroyStereoTexture()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  auto ogreCompMgr = ogreRoot->getCompositorManager2();
+  auto textureMgr = ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  if (this->dataPtr->ogreCompositorWorkspace)
+  {
+    ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspace);
+    this->dataPtr->ogreCompositorWorkspace = nullptr;
+  }
+
+  if (!this->dataPtr->ogreCompositorWorkspaceDef.empty())
+  {
+    ogreCompMgr->removeWorkspaceDefinition(
+        this->dataPtr->ogreCompositorWorkspaceDef);
+    ogreCompMgr->removeNodeDefinition(this->dataPtr->ogreCompositorNodeDef);
+    this->dataPtr->ogreCompositorWorkspaceDef.clear();
+    this->dataPtr->ogreCompositorNodeDef.clear();
+  }
+
+  if (this->dataPtr->ogreStereoTexture)
+  {
+    textureMgr->destroyTexture(this->dataPtr->ogreStereoTexture);
+    this->dataPtr->ogreStereoTexture = nullptr;
+  }
+
+  if (this->dataPtr->ogreDisparityTexture)
+  {
+    textureMgr->destroyTexture(this->dataPtr->ogreDisparityTexture);
+    this->dataPtr->ogreDisparityTexture = nullptr;
+  }
+
+  if (this->dataPtr->disparityMaterial)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        this->dataPtr->disparityMaterial->getName());
+    this->dataPtr->disparityMaterial.setNull();
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::PreRender()
+{
+  if (this->dataPtr->stereoTextureDirty)
+  {
+    this->DestroyStereoTexture();
+    this->dataPtr->stereoTextureDirty = false;
+  }
+
+  if (!this->dataPtr->ogreStereoTexture)
+    this->CreateStereoTexture();
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::CreateCamera()
+{
+  auto ogreSceneManager = this->scene->OgreSceneManager();
+  if (ogreSceneManager == nullptr)
+  {
+    ignerr << "Scene manager cannot be obtained" << std::endl;
+    return;
+  }
+
+  this->ogreCamera = ogreSceneManager->createCamera(this->Name());
+  if (this->ogreCamera == nullptr)
+  {
+    ignerr << "Ogre camera cannot be created" << std::endl;
+    return;
+  }
+
+  this->ogreCamera->detachFromParent();
+  this->ogreNode->attachObject(this->ogreCamera);
+
+  // rotate to ignition gazebo coord.
+  this->ogreCamera->yaw(Ogre::Degree(-90));
+  this->ogreCamera->roll(Ogre::Degree(-90));
+  this->ogreCamera->setFixedYawAxis(false);
+
+  // each eye only covers half of the stereo texture so the aspect ratio
+  // is set explicitly
+  this->ogreCamera->setAutoAspectRatio(false);
+  this->ogreCamera->setProjectionType(Ogre::ProjectionType::PT_PERSPECTIVE);
+  this->ogreCamera->setCustomProjectionMatrix(false);
+
+  // The cull camera is attached to the same node and kept in sync with the
+  // eyes in UpdateEyes
+  this->dataPtr->ogreCullCamera =
+      ogreSceneManager->createCamera(this->Name() + "_cull");
+  this->dataPtr->ogreCullCamera->detachFromParent();
+  this->ogreNode->attachObject(this->dataPtr->ogreCullCamera);
+  this->dataPtr->ogreCullCamera->setFixedYawAxis(false);
+  this->dataPtr->ogreCullCamera->setAutoAspectRatio(false);
+  this->dataPtr->ogreCullCamera->setProjectionType(
+      Ogre::ProjectionType::PT_PERSPECTIVE);
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::CreateStereoTexture()
+{
+  // Camera Parameters
+  double aspect = static_cast<double>(this->ImageWidth()) /
+      this->ImageHeight();
+  this->ogreCamera->setNearClipDistance(this->NearClipPlane());
+  this->ogreCamera->setFarClipDistance(this->FarClipPlane());
+  this->ogreCamera->setAspectRatio(aspect);
+  double vfov = 2.0 * atan(tan(this->HFOV().Radian() / 2.0) / aspect);
+  this->ogreCamera->setFOVy(Ogre::Radian(vfov));
+
+  this->SetImageFormat(PixelFormat::PF_R8G8B8);
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  bool disparity = this->disparityEnabled;
+  if (disparity)
+  {
+    // The StereoDisparity material is defined in script
+    // (stereo_camera.material). We need to clone it since we are going to
+    // modify its uniform variables
+    Ogre::MaterialPtr mat =
+        Ogre::MaterialManager::getSingleton().getByName("StereoDisparity");
+    this->dataPtr->disparityMaterial =
+        mat->clone(this->Name() + "_StereoDisparity");
+    this->dataPtr->disparityMaterial->load();
+  }
+
+  // Programmatically create the compositor node. It is equivalent to the
+  // following:
+  //
+  // compositor_node StereoCamera
+  // {
+  //   in 0 rt0
+  //   in 1 rt1
+  //
+  //   texture depthTexture target_width target_height PFG_D32_FLOAT
+  //
+  //   rtv rt0
+  //   {
+  //     colour rt0
+  //     depth depthTexture
+  //   }
+  //
+  //   target rt0
+  //   {
+  //     pass render_scene
+  //     {
+  //       load { all clear }
+  //       shadows PbsMaterialsShadowNode
+  //       instanced_stereo true
+  //       viewport 0 0 0.5 1 0.5 0 0.5 1
+  //       cull_camera <name>_cull
+  //     }
+  //   }
+  //   target rt1
+  //   {
+  //     pass render_quad
+  //     {
+  //       load { all clear }
+  //       material StereoDisparity // Use copy instead of original
+  //       input 0 depthTexture
+  //     }
+  //   }
+  // }
+  std::string wsDefName = "StereoCameraWorkspace_" + this->Name();
+  std::string nodeDefName = wsDefName + "/Node";
+  this->dataPtr->ogreCompositorWorkspaceDef = wsDefName;
+  this->dataPtr->ogreCompositorNodeDef = nodeDefName;
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+  nodeDef->addTextureSourceName(
+      "rt0", 0u, Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  if (disparity)
+  {
+    nodeDef->addTextureSourceName(
+        "rt1", 1u, Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  }
+
+  // depth buffer of both eyes, sampled by the disparity pass
+  Ogre::TextureDefinitionBase::TextureDefinition *depthTexDef =
+      nodeDef->addTextureDefinition("depthTexture");
+  depthTexDef->textureType = Ogre::TextureTypes::Type2D;
+  depthTexDef->width = 0;
+  depthTexDef->height = 0;
+  depthTexDef->depthOrSlices = 1;
+  depthTexDef->numMipmaps = 0;
+  depthTexDef->widthFactor = 1;
+  depthTexDef->heightFactor = 1;
+  depthTexDef->format = Ogre::PFG_D32_FLOAT;
+  depthTexDef->textureFlags &= ~Ogre::TextureFlags::Uav;
+  depthTexDef->depthBufferId = Ogre::DepthBuffer::POOL_NON_SHAREABLE;
+  depthTexDef->depthBufferFormat = Ogre::PFG_UNKNOWN;
+  depthTexDef->fsaa = "0";
+
+  // Manually set up the RTV so the scene pass uses the depth texture we
+  // created (and thus we can sample from it later)
+  Ogre::RenderTargetViewDef *rtvStereo =
+      nodeDef->addRenderTextureView("rt0");
+  Ogre::RenderTargetViewEntry colourAttachment;
+  colourAttachment.textureName = "rt0";
+  rtvStereo->colourAttachments.push_back(colourAttachment);
+  rtvStereo->depthAttachment.textureName = "depthTexture";
+
+  nodeDef->setNumTargetPass(disparity ? 2u : 1u);
+  Ogre::CompositorTargetDef *stereoTargetDef = nodeDef->addTargetPass("rt0");
+  stereoTargetDef->setNumPasses(1);
+  {
+    // scene pass rendering both eyes. Each instance is drawn twice, once
+    // into each viewport, so culling and shadow maps are shared.
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        stereoTargetDef->addPass(Ogre::PASS_SCENE));
+    passScene->setAllLoadActions(Ogre::LoadAction::Clear);
+    passScene->setAllClearColours(
+        Ogre2Conversions::Convert(this->scene->BackgroundColor()));
+    passScene->mShadowNode = this->dataPtr->kShadowNodeName;
+    passScene->mVisibilityMask = this->VisibilityMask();
+    passScene->mIncludeOverlays = false;
+    passScene->mInstancedStereo = true;
+    passScene->mCullCameraName = this->dataPtr->ogreCullCamera->getName();
+    passScene->mNumViewports = 2u;
+    for (unsigned int i = 0u; i < 2u; ++i)
+    {
+      auto &vp = passScene->mVpRect[i];
+      vp.mVpLeft = 0.5f * i;
+      vp.mVpTop = 0.0f;
+      vp.mVpWidth = 0.5f;
+      vp.mVpHeight = 1.0f;
+      vp.mVpScissorLeft = vp.mVpLeft;
+      vp.mVpScissorTop = vp.mVpTop;
+      vp.mVpScissorWidth = vp.mVpWidth;
+      vp.mVpScissorHeight = vp.mVpHeight;
+    }
+  }
+
+  if (disparity)
+  {
+    Ogre::CompositorTargetDef *disparityTargetDef =
+        nodeDef->addTargetPass("rt1");
+    disparityTargetDef->setNumPasses(1);
+    {
+      // quad pass
+      Ogre::CompositorPassQuadDef *passQuad =
+          static_cast<Ogre::CompositorPassQuadDef *>(
+          disparityTargetDef->addPass(Ogre::PASS_QUAD));
+      passQuad->setAllLoadActions(Ogre::LoadAction::Clear);
+      passQuad->setAllClearColours(Ogre::ColourValue::ZERO);
+      passQuad->mMaterialName = this->dataPtr->disparityMaterial->getName();
+      passQuad->addQuadTextureSource(0, "depthTexture");
+    }
+  }
+
+  Ogre::CompositorWorkspaceDef *workDef =
+      ogreCompMgr->addWorkspaceDefinition(wsDefName);
+  workDef->connectExternal(0, nodeDefName, 0);
+  if (disparity)
+    workDef->connectExternal(1, nodeDefName, 1);
+
+  // create render textures
+  this->dataPtr->ogreStereoTexture =
+      textureMgr->createOrRetrieveTexture(this->Name() + "_stereo",
+        Ogre::GpuPageOutStrategy::SaveToSystemRam,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+  this->dataPtr->ogreStereoTexture->setResolution(
+      2u * this->ImageWidth(), this->ImageHeight());
+  this->dataPtr->ogreStereoTexture->setNumMipmaps(1u);
+  this->dataPtr->ogreStereoTexture->setPixelFormat(
+      Ogre::PFG_RGBA8_UNORM_SRGB);
+  this->dataPtr->ogreStereoTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
+
+  Ogre::CompositorChannelVec externalTargets(disparity ? 2u : 1u);
+  externalTargets[0] = this->dataPtr->ogreStereoTexture;
+
+  if (disparity)
+  {
+    this->dataPtr->ogreDisparityTexture =
+        textureMgr->createOrRetrieveTexture(this->Name() + "_disparity",
+          Ogre::GpuPageOutStrategy::SaveToSystemRam,
+          Ogre::TextureFlags::RenderToTexture,
+          Ogre::TextureTypes::Type2D);
+    this->dataPtr->ogreDisparityTexture->setResolution(
+        this->ImageWidth(), this->ImageHeight());
+    this->dataPtr->ogreDisparityTexture->setNumMipmaps(1u);
+    this->dataPtr->ogreDisparityTexture->setPixelFormat(Ogre::PFG_R32_FLOAT);
+    this->dataPtr->ogreDisparityTexture->scheduleTransitionTo(
+        Ogre::GpuResidency::Resident);
+    externalTargets[1] = this->dataPtr->ogreDisparityTexture;
+  }
+
+  // create compositor workspace
+  this->dataPtr->ogreCompositorWorkspace =
+      ogreCompMgr->addWorkspace(
+        this->scene->OgreSceneManager(),
+        externalTargets,
+        this->ogreCamera,
+        wsDefName,
+        false);
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::UpdateEyes()
+{
+  // The left eye is at the camera pose and the right eye is offset by the
+  // baseline along the x axis of the ogre camera, which points right
+  double baseline = this->baseline;
+  Ogre::Matrix4 eyeToHead[2];
+  eyeToHead[0] = Ogre::Matrix4::IDENTITY;
+  eyeToHead[1].makeTrans(Ogre::Vector3(baseline, 0.0, 0.0));
+
+  // rectified eyes share the same projection
+  Ogre::Matrix4 projection[2];
+  projection[0] = this->ogreCamera->getProjectionMatrixWithRSDepth();
+  projection[1] = projection[0];
+  this->dataPtr->vrData.set(eyeToHead, projection);
+  this->ogreCamera->setVrData(&this->dataPtr->vrData);
+
+  // Both eye frusta are contained in a frustum with the same field of view
+  // whose apex is centered between the eyes and moved back until its sides
+  // pass through the eyes.
+  double near = this->NearClipPlane();
+  double far = this->FarClipPlane();
+  double pullBack = 0.5 * baseline / tan(this->HFOV().Radian() / 2.0);
+  Ogre::Camera *cull = this->dataPtr->ogreCullCamera;
+  cull->setOrientation(this->ogreCamera->getOrientation());
+  cull->setPosition(this->ogreCamera->getPosition() +
+      this->ogreCamera->getOrientation() *
+      Ogre::Vector3(0.5 * baseline, 0.0, pullBack));
+  cull->setFOVy(this->ogreCamera->getFOVy());
+  cull->setAspectRatio(this->ogreCamera->getAspectRatio());
+  cull->setNearClipDistance(near);
+  cull->setFarClipDistance(far + pullBack);
+
+  if (this->dataPtr->disparityMaterial)
+  {
+    // Set the uniform variables (stereo_disparity_fs.glsl).
+    // The projectionParams are used to linearize depth buffer data
+    Ogre::Pass *pass =
+        this->dataPtr->disparityMaterial->getTechnique(0)->getPass(0);
+    Ogre::GpuProgramParametersSharedPtr psParams =
+        pass->getFragmentProgramParameters();
+    Ogre::Vector2 projectionAB = this->ogreCamera->getProjectionParamsAB();
+    psParams->setNamedConstant("projectionParams",
+        Ogre::Vector2(projectionAB.x, projectionAB.y / far));
+    psParams->setNamedConstant("far", static_cast<float>(far));
+    psParams->setNamedConstant("focalBaseline",
+        static_cast<float>(this->FocalLength() * baseline));
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::Render()
+{
+  this->UpdateEyes();
+
+  // update the compositors
+  this->scene->StartRendering(this->ogreCamera);
+
+  this->dataPtr->ogreCompositorWorkspace->_validateFinalTarget();
+  this->dataPtr->ogreCompositorWorkspace->_beginUpdate(false);
+  this->dataPtr->ogreCompositorWorkspace->_update();
+  this->dataPtr->ogreCompositorWorkspace->_endUpdate(false);
+
+  Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
+  swappedTargets.reserve(2u);
+  this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
+
+  this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::PostRender()
+{
+  const unsigned int width = this->ImageWidth();
+  const unsigned int height = this->ImageHeight();
+
+  if (this->dataPtr->newStereoFrame.ConnectionCount() > 0u)
+  {
+    PixelFormat format = this->ImageFormat();
+    const unsigned int channelCount = PixelUtil::ChannelCount(format);
+    const unsigned int rawChannelCount = 4u;
+    const size_t len = width * height * channelCount;
+    this->dataPtr->leftImage.resize(len);
+    this->dataPtr->rightImage.resize(len);
+
+    Ogre::Image2 image;
+    image.convertFromTexture(this->dataPtr->ogreStereoTexture, 0u, 0u);
+    Ogre::TextureBox box = image.getData(0);
+    const uint8_t *bufferTmp = static_cast<const uint8_t *>(box.data);
+
+    // split the side by side texture into the two eyes and drop alpha
+    for (unsigned int row = 0; row < height; ++row)
+    {
+      const uint8_t *rawRow = bufferTmp + row * box.bytesPerRow;
+      for (unsigned int column = 0; column < width; ++column)
+      {
+        size_t idx = (row * width + column) * channelCount;
+        const uint8_t *left = rawRow + column * rawChannelCount;
+        const uint8_t *right = left + width * rawChannelCount;
+        for (unsigned int c = 0; c < channelCount; ++c)
+        {
+          this->dataPtr->leftImage[idx + c] = left[c];
+          this->dataPtr->rightImage[idx + c] = right[c];
+        }
+      }
+    }
+
+    this->dataPtr->newStereoFrame(this->dataPtr->leftImage.data(),
+        this->dataPtr->rightImage.data(), width, height, channelCount,
+        PixelUtil::Name(format));
+  }
+
+  if (!this->dataPtr->ogreDisparityTexture)
+    return;
+
+  this->dataPtr->disparityImage.resize(width * height);
+
+  Ogre::Image2 image;
+  image.convertFromTexture(this->dataPtr->ogreDisparityTexture, 0u, 0u);
+  Ogre::TextureBox box = image.getData(0);
+  const uint8_t *bufferTmp = static_cast<const uint8_t *>(box.data);
+
+  // copy data row by row. The texture box may not be a contiguous region of
+  // a texture
+  for (unsigned int row = 0; row < height; ++row)
+  {
+    memcpy(&this->dataPtr->disparityImage[row * width],
+        bufferTmp + row * box.bytesPerRow, width * sizeof(float));
+  }
+
+  this->dataPtr->newDisparityFrame(this->dataPtr->disparityImage.data(),
+      width, height, 1, "FLOAT32");
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::SetDisparityEnabled(bool _enable)
+{
+  if (_enable == this->disparityEnabled)
+    return;
+
+  BaseStereoCamera::SetDisparityEnabled(_enable);
+  this->dataPtr->stereoTextureDirty = true;
+}
+
+/////////////////////////////////////////////////
+const float *Ogre2StereoCamera::DisparityData() const
+{
+  if (!this->disparityEnabled || this->dataPtr->disparityImage.empty())
+    return nullptr;
+  return this->dataPtr->disparityImage.data();
+}
+
+/////////////////////////////////////////////////
+ignition::common::ConnectionPtr Ogre2StereoCamera::ConnectNewStereoFrame(
+    std::function<void(const unsigned char *, const unsigned char *,
+    unsigned int, unsigned int, unsigned int,
+    const std::string &)> _subscriber)
+{
+  return this->dataPtr->newStereoFrame.Connect(_subscriber);
+}
+
+/////////////////////////////////////////////////
+ignition::common::ConnectionPtr Ogre2StereoCamera::ConnectNewDisparityFrame(
+    std::function<void(const float *, unsigned int, unsigned int,
+    unsigned int, const std::string &)> _subscriber)
+{
+  return this->dataPtr->newDisparityFrame.Connect(_subscriber);
+}
+
+/////////////////////////////////////////////////
+bool Ogre2StereoCamera::SaveFrame(const std::string &_name)
+{
+  // only the left image is saved, the same image Capture would return for a
+  // mono camera at the same pose
+  if (this->dataPtr->leftImage.empty())
+    return false;
+  return FrameEncoder::Instance()->Enqueue(_name,
+      this->dataPtr->leftImage.data(), this->ImageWidth(),
+      this->ImageHeight(), this->ImageFormat());
+}
+
+/////////////////////////////////////////////////
+RenderTargetPtr Ogre2StereoCamera::RenderTarget() const
+{
+  return this->dataPtr->stereoTexture;
+}
+
+/////////////////////////////////////////////////
+void Ogre2StereoCamera::CreateRenderTexture()
+{
+  RenderTexturePtr base = this->scene->CreateRenderTexture();
+  this->dataPtr->stereoTexture =
+    std::dynamic_pointer_cast<Ogre2RenderTexture>(base);
+  this->dataPtr->stereoTexture->SetWidth(1);
+  this->dataPtr->stereoTexture->SetHeight(1);
+}
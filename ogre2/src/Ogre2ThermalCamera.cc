@@ -36,9 +36,13 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(push, 0)
@@ -68,6 +72,8 @@
 
 #include <ignition/common/Image.hh>
 
+#include "Ogre2WideAngleRenderer.hh"
+
 namespace ignition
 {
 namespace rendering
@@ -85,7 +91,7 @@ class Ogre2ThermalCameraMaterialSwitcher : public Ogre::Camera::Listener
               const std::string & _name);
 
   /// \brief destructor
-  public: ~Ogre2ThermalCameraMaterialSwitcher() = default;
+  public: ~Ogre2ThermalCameraMaterialSwitcher();
 
   /// \brief Set image format
   /// \param[in] _format Image format
@@ -105,6 +111,35 @@ class Ogre2ThermalCameraMaterialSwitcher : public Ogre::Camera::Listener
   private: virtual void cameraPostRenderScene(
     Ogre::Camera * _cam) override;
 
+  /// \brief Key used to share heat signature materials between items.
+  /// The values are: <texture, min temperature, max temperature, emissivity>
+  private: using HeatSignatureKey =
+      std::tuple<std::string, float, float, float>;
+
+  /// \brief A heat signature material and the number of items using it
+  private: struct HeatSignatureMaterial
+  {
+    /// \brief The cloned heat signature material
+    Ogre::MaterialPtr material;
+
+    /// \brief Number of items referencing this material
+    unsigned int refCount = 0u;
+  };
+
+  /// \brief Get the heat signature material for the given key, creating
+  /// it if it does not exist yet, and make the item reference it.
+  /// Any material previously referenced by the item is released.
+  /// \param[in] _itemId Id of the item using the material
+  /// \param[in] _key Heat signature key
+  /// \return The heat signature material
+  private: Ogre::MaterialPtr AcquireHeatSignatureMaterial(
+      Ogre::IdType _itemId, const HeatSignatureKey &_key);
+
+  /// \brief Release the heat signature material referenced by an item.
+  /// The material is destroyed once no more items reference it.
+  /// \param[in] _itemId Id of the item
+  private: void ReleaseHeatSignatureMaterial(Ogre::IdType _itemId);
+
   /// \brief Scene manager
   private: Ogre2ScenePtr scene = nullptr;
 
@@ -117,12 +152,20 @@ class Ogre2ThermalCameraMaterialSwitcher : public Ogre::Camera::Listener
   /// signature texture applied to it
   private: Ogre::MaterialPtr baseHeatSigMaterial;
 
-  /// \brief A map of all items that have a heat signature material.
-  /// The key is the item's ID, and the value is the heat signature
-  /// for that item.
-  private: std::unordered_map<Ogre::IdType, Ogre::MaterialPtr>
+  /// \brief Heat signature materials shared by all items that have the
+  /// same texture, temperature range and emissivity.
+  private: std::map<HeatSignatureKey, HeatSignatureMaterial>
             heatSignatureMaterials;
 
+  /// \brief A map of all items that have a heat signature material.
+  /// The key is the item's ID, and the value is the key of the shared heat
+  /// signature material used by that item.
+  private: std::unordered_map<Ogre::IdType, HeatSignatureKey>
+            itemHeatSignatures;
+
+  /// \brief Counter used to generate unique heat signature material names
+  private: unsigned int heatSignatureMaterialCount = 0u;
+
   /// \brief The name of the thermal camera sensor
   private: const std::string name;
 
@@ -154,6 +197,29 @@ class Ogre2ThermalCameraMaterialSwitcher : public Ogre::Camera::Listener
 }
 }
 
+/// \brief Read a numeric user data value from a visual
+/// \param[in] _visual Visual to read the user data from
+/// \param[in] _key User data key
+/// \param[out] _value Value read from the user data
+/// \return True if the user data exists and holds a numeric value
+static bool NumericUserData(const ignition::rendering::VisualPtr &_visual,
+    const std::string &_key, float &_value)
+{
+  if (!_visual->HasUserData(_key))
+    return false;
+
+  ignition::rendering::Variant data = _visual->UserData(_key);
+  if (auto f = std::get_if<float>(&data))
+    _value = *f;
+  else if (auto d = std::get_if<double>(&data))
+    _value = static_cast<float>(*d);
+  else if (auto i = std::get_if<int>(&data))
+    _value = static_cast<float>(*i);
+  else
+    return false;
+  return true;
+}
+
 /// \internal
 /// \brief Private data for the Ogre2ThermalCamera class
 class ignition::rendering::Ogre2ThermalCameraPrivate
@@ -201,6 +267,20 @@ class ignition::rendering::Ogre2ThermalCameraPrivate
 
   /// \brief bit depth of each pixel
   public: unsigned int bitDepth = 16u;
+
+  /// \brief Renders fisheye and panoramic projections
+  public: Ogre2WideAngleRenderer wideAngle;
+
+  /// \brief True if a frame was rendered since thermalImage was last
+  /// read back from the thermal texture
+  public: bool thermalImageDirty = false;
+
+  /// \brief Read the thermal texture back into thermalImage
+  /// \param[in] _width Image width
+  /// \param[in] _height Image height
+  /// \param[in] _format Image format
+  public: void ReadThermalImage(unsigned int _width, unsigned int _height,
+      PixelFormat _format);
 };
 
 using namespace ignition;
@@ -225,6 +305,18 @@ Ogre2ThermalCameraMaterialSwitcher::Ogre2ThermalCameraMaterialSwitcher(
   this->ogreCamera = this->scene->OgreSceneManager()->findCamera(this->name);
 }
 
+//////////////////////////////////////////////////
+Ogre2ThermalCameraMaterialSwitcher::~Ogre2ThermalCameraMaterialSwitcher()
+{
+  for (auto &it : this->heatSignatureMaterials)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        it.second.material->getName());
+  }
+  this->heatSignatureMaterials.clear();
+  this->itemHeatSignatures.clear();
+}
+
 //////////////////////////////////////////////////
 void Ogre2ThermalCameraMaterialSwitcher::SetFormat(PixelFormat _format)
 {
@@ -237,10 +329,98 @@ void Ogre2ThermalCameraMaterialSwitcher::SetLinearResolution(double _resolution)
 {
   this->resolution = _resolution;
 }
+
+//////////////////////////////////////////////////
+Ogre::MaterialPtr
+    Ogre2ThermalCameraMaterialSwitcher::AcquireHeatSignatureMaterial(
+    Ogre::IdType _itemId, const HeatSignatureKey &_key)
+{
+  auto itemIt = this->itemHeatSignatures.find(_itemId);
+  if (itemIt != this->itemHeatSignatures.end())
+  {
+    // item is already using this material
+    if (itemIt->second == _key)
+      return this->heatSignatureMaterials[_key].material;
+
+    // heat signature of the item changed
+    this->ReleaseHeatSignatureMaterial(_itemId);
+  }
+
+  auto matIt = this->heatSignatureMaterials.find(_key);
+  if (matIt == this->heatSignatureMaterials.end())
+  {
+    // make sure the texture is in ogre's resource path
+    const std::string &texture = std::get<0>(_key);
+    auto engine = Ogre2RenderEngine::Instance();
+    engine->AddResourcePath(texture);
+
+    // create a material for this heat signature, now that the texture has
+    // been searched for. We must clone the base heat signature material since
+    // different items may use different textures and temperature ranges.
+    // Items with identical heat signatures share the same material.
+    std::string baseName = common::basename(texture);
+    HeatSignatureMaterial heatSig;
+    heatSig.material = this->baseHeatSigMaterial->clone(
+        this->name + "_" + baseName + "_" +
+        Ogre::StringConverter::toString(this->heatSignatureMaterialCount++));
+    auto textureUnitStatePtr = heatSig.material->
+      getTechnique(0)->getPass(0)->getTextureUnitState(0);
+    textureUnitStatePtr->setTextureName(baseName);
+
+    // set temperature range for the heat signature. The range has already
+    // been clamped to [min, max] kelvin for the given pixel format and camera
+    // resolution
+    Ogre::GpuProgramParametersSharedPtr params =
+      heatSig.material->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+    params->setNamedConstant("minTemp", std::get<1>(_key));
+    params->setNamedConstant("maxTemp", std::get<2>(_key));
+    params->setNamedConstant("emissivity", std::get<3>(_key));
+    params->setNamedConstant("bitDepth",
+        static_cast<int>(this->bitDepth));
+    params->setNamedConstant("resolution",
+        static_cast<float>(this->resolution));
+    heatSig.material->load();
+    matIt = this->heatSignatureMaterials.emplace(_key, heatSig).first;
+  }
+
+  matIt->second.refCount++;
+  this->itemHeatSignatures[_itemId] = _key;
+  return matIt->second.material;
+}
+
+//////////////////////////////////////////////////
+void Ogre2ThermalCameraMaterialSwitcher::ReleaseHeatSignatureMaterial(
+    Ogre::IdType _itemId)
+{
+  auto itemIt = this->itemHeatSignatures.find(_itemId);
+  if (itemIt == this->itemHeatSignatures.end())
+    return;
+
+  auto matIt = this->heatSignatureMaterials.find(itemIt->second);
+  this->itemHeatSignatures.erase(itemIt);
+  if (matIt == this->heatSignatureMaterials.end())
+    return;
+
+  if (matIt->second.refCount > 0u)
+    matIt->second.refCount--;
+
+  // destroy the material once no more items use it
+  if (matIt->second.refCount == 0u)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        matIt->second.material->getName());
+    this->heatSignatureMaterials.erase(matIt);
+  }
+}
 //////////////////////////////////////////////////
 void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
     Ogre::Camera * /*_cam*/)
 {
+  // ids of items that currently use a heat signature material. Used to
+  // release materials of items that no longer exist
+  std::set<Ogre::IdType> heatSignatureItems;
+
   // swap item to use v1 shader material
   // Note: keep an eye out for performance impact on switching materials
   // on the fly. We are not doing this often so should be ok.
@@ -268,6 +448,13 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
       Ogre2VisualPtr ogreVisual =
           std::dynamic_pointer_cast<Ogre2Visual>(result);
 
+      // get emissivity, which is encoded in the blue channel as
+      // (1 - emissivity) so that black bodies keep the [heat, 0, 0, 0]
+      // heat source encoding
+      float emissivity = 1.0f;
+      if (NumericUserData(ogreVisual, "emissivity", emissivity))
+        emissivity = ignition::math::clamp(emissivity, 0.0f, 1.0f);
+
       // get temperature
       Variant tempAny = ogreVisual->UserData(tempKey);
       if (tempAny.index() != 0 && !std::holds_alternative<std::string>(tempAny))
@@ -315,11 +502,11 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
           // normalize temperature value
           float color = (temp / this->resolution) / ((1 << bitDepth) - 1.0);
 
-          // set g, b, a to 0. This will be used by shaders to determine
+          // set g, a to 0. This will be used by shaders to determine
           // if particular fragment is a heat source or not
           // see media/materials/programs/thermal_camera_fs.glsl
           subItem->setCustomParameter(this->customParamIdx,
-              Ogre::Vector4(color, 0, 0, 0.0));
+              Ogre::Vector4(color, 0, 1.0 - emissivity, 0.0));
           // case when item is using low level materials
           // e.g. shaders
           if (!subItem->getMaterial().isNull())
@@ -338,57 +525,30 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
       // get heat signature and the corresponding min/max temperature values
       else if (auto heatSignature = std::get_if<std::string>(&tempAny))
       {
-        // if this is the first time rendering the heat signature,
-        // we need to make sure that the texture is loaded and applied to
-        // the heat signature material before loading the material
-        if (this->heatSignatureMaterials.find(item->getId()) ==
-            this->heatSignatureMaterials.end())
+        // set temperature range for the heat signature and make sure it is
+        // between [min, max] kelvin for the given pixel format and camera
+        // resolution
+        float minTemp = 0.0f;
+        float maxTemp = 100.0f;
+        auto minTempVariant = ogreVisual->UserData("minTemp");
+        auto maxTempVariant = ogreVisual->UserData("maxTemp");
+        auto minTemperature = std::get_if<float>(&minTempVariant);
+        auto maxTemperature = std::get_if<float>(&maxTempVariant);
+        if (minTemperature && maxTemperature)
         {
-          // make sure the texture is in ogre's resource path
-          const auto &texture = *heatSignature;
-          auto engine = Ogre2RenderEngine::Instance();
-          engine->AddResourcePath(texture);
-
-          // create a material for this item, now that the texture has been
-          // searched for. We must clone the base heat signature material since
-          // different items may use different textures. We also append the
-          // item's ID to the end of the new material name to ensure new
-          // material uniqueness in case two items use the same heat signature
-          // texture, but have different temperature ranges
-          std::string baseName = common::basename(texture);
-          auto heatSignatureMaterial = this->baseHeatSigMaterial->clone(
-              this->name + "_" + baseName + "_" +
-              Ogre::StringConverter::toString(item->getId()));
-          auto textureUnitStatePtr = heatSignatureMaterial->
-            getTechnique(0)->getPass(0)->getTextureUnitState(0);
-          Ogre::String textureName = baseName;
-          textureUnitStatePtr->setTextureName(textureName);
-
-          // set temperature range for the heat signature
-          auto minTempVariant = ogreVisual->UserData("minTemp");
-          auto maxTempVariant = ogreVisual->UserData("maxTemp");
-          auto minTemperature = std::get_if<float>(&minTempVariant);
-          auto maxTemperature = std::get_if<float>(&maxTempVariant);
-          if (minTemperature && maxTemperature)
-          {
-            // make sure the temperature range is between [min, max] kelvin
-            // for the given pixel format and camera resolution
-            float maxTemp = ((1 << bitDepth) - 1.0) * this->resolution;
-            Ogre::GpuProgramParametersSharedPtr params =
-              heatSignatureMaterial->getTechnique(0)->getPass(0)->
-              getFragmentProgramParameters();
-            params->setNamedConstant("minTemp",
-                std::max(static_cast<float>(*minTemperature), 0.0f));
-            params->setNamedConstant("maxTemp",
-                std::min(static_cast<float>(*maxTemperature), maxTemp));
-            params->setNamedConstant("bitDepth",
-                static_cast<int>(this->bitDepth));
-            params->setNamedConstant("resolution",
-                static_cast<float>(this->resolution));
-          }
-          heatSignatureMaterial->load();
-          this->heatSignatureMaterials[item->getId()] = heatSignatureMaterial;
+          minTemp = *minTemperature;
+          maxTemp = *maxTemperature;
         }
+        float maxTempFormat = ((1 << bitDepth) - 1.0) * this->resolution;
+        minTemp = std::max(minTemp, 0.0f);
+        maxTemp = std::min(maxTemp, maxTempFormat);
+
+        // items with the same heat signature texture, temperature range and
+        // emissivity share the same material
+        Ogre::MaterialPtr heatSignatureMaterial =
+            this->AcquireHeatSignatureMaterial(item->getId(),
+            HeatSignatureKey(*heatSignature, minTemp, maxTemp, emissivity));
+        heatSignatureItems.insert(item->getId());
 
         for (unsigned int i = 0; i < item->getNumSubItems(); ++i)
         {
@@ -407,7 +567,7 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
             this->datablockMap[subItem] = datablock;
           }
 
-          subItem->setMaterial(this->heatSignatureMaterials[item->getId()]);
+          subItem->setMaterial(heatSignatureMaterial);
         }
       }
       // background objects
@@ -452,6 +612,17 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
     }
     itor.moveNext();
   }
+
+  // release heat signature materials of items that were removed from the
+  // scene or no longer have a heat signature
+  std::vector<Ogre::IdType> staleItems;
+  for (const auto &it : this->itemHeatSignatures)
+  {
+    if (heatSignatureItems.find(it.first) == heatSignatureItems.end())
+      staleItems.push_back(it.first);
+  }
+  for (auto id : staleItems)
+    this->ReleaseHeatSignatureMaterial(id);
 }
 
 //////////////////////////////////////////////////
@@ -515,6 +686,8 @@ void Ogre2ThermalCamera::Destroy()
   if (!this->ogreCamera)
     return;
 
+  this->dataPtr->wideAngle.Destroy();
+
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   auto ogreCompMgr = ogreRoot->getCompositorManager2();
@@ -685,6 +858,12 @@ void Ogre2ThermalCamera::CreateThermalTexture()
       static_cast<int>(this->dataPtr->rgbToTemp));
   psParams->setNamedConstant("bitDepth",
       static_cast<int>(this->dataPtr->bitDepth));
+  psParams->setNamedConstant("radiometric",
+      static_cast<int>(this->radiometric));
+  psParams->setNamedConstant("reflectedTemp",
+      static_cast<float>(this->ReflectedTemperature()));
+  psParams->setNamedConstant("extinctionCoeff",
+      static_cast<float>(this->extinctionCoeff));
 
   // Create thermal camera compositor
   auto engine = Ogre2RenderEngine::Instance();
@@ -878,35 +1057,59 @@ void Ogre2ThermalCamera::CreateThermalTexture()
 //////////////////////////////////////////////////
 void Ogre2ThermalCamera::Render()
 {
-  // GL_DEPTH_CLAMP is disabled in later version of ogre2.2
-  // however our shaders rely on clamped values so enable it for this sensor
-  auto engine = Ogre2RenderEngine::Instance();
-  std::string renderSystemName =
-      engine->OgreRoot()->getRenderSystem()->getFriendlyName();
-  bool useGL = renderSystemName.find("OpenGL") != std::string::npos;
+  auto renderFace = [this]()
+  {
+    // GL_DEPTH_CLAMP is disabled in later version of ogre2.2
+    // however our shaders rely on clamped values so enable it for this
+    // sensor
+    auto engine = Ogre2RenderEngine::Instance();
+    std::string renderSystemName =
+        engine->OgreRoot()->getRenderSystem()->getFriendlyName();
+    bool useGL = renderSystemName.find("OpenGL") != std::string::npos;
 #ifndef _WIN32
-  if (useGL)
-    glEnable(GL_DEPTH_CLAMP);
+    if (useGL)
+      glEnable(GL_DEPTH_CLAMP);
 #endif
 
-  // update the compositors
-  this->scene->StartRendering(this->ogreCamera);
+    // the participating media are integrated along rays in the view space
+    // of the camera, which is rotated for each face of wide angle cameras
+    this->scene->SetParticipatingMediaParams(
+        this->dataPtr->thermalMaterial->getTechnique(0)->getPass(0),
+        this->ogreCamera);
 
-  this->dataPtr->ogreCompositorWorkspace->_validateFinalTarget();
-  this->dataPtr->ogreCompositorWorkspace->_beginUpdate(false);
-  this->dataPtr->ogreCompositorWorkspace->_update();
-  this->dataPtr->ogreCompositorWorkspace->_endUpdate(false);
+    // update the compositors
+    this->scene->StartRendering(this->ogreCamera);
 
-  Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
-  swappedTargets.reserve(2u);
-  this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
+    this->dataPtr->ogreCompositorWorkspace->_validateFinalTarget();
+    this->dataPtr->ogreCompositorWorkspace->_beginUpdate(false);
+    this->dataPtr->ogreCompositorWorkspace->_update();
+    this->dataPtr->ogreCompositorWorkspace->_endUpdate(false);
 
-  this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+    Ogre::vector<Ogre::TextureGpu*>::type swappedTargets;
+    swappedTargets.reserve(2u);
+    this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
+
+    this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
 
 #ifndef _WIN32
-  if (useGL)
-    glDisable(GL_DEPTH_CLAMP);
+    if (useGL)
+      glDisable(GL_DEPTH_CLAMP);
 #endif
+  };
+
+  if (!WideAngleProjection::IsWideAngle(this->ProjectionType()))
+  {
+    renderFace();
+    return;
+  }
+
+  this->dataPtr->wideAngle.SetNearestFiltering(false);
+  this->dataPtr->wideAngle.SetRotatePoints(false);
+  this->dataPtr->wideAngle.SetInvalidColor(
+      Ogre::ColourValue(0.0f, 0.0f, 0.0f, 0.0f));
+  this->dataPtr->wideAngle.Render(this->Name(), this->scene,
+      this->ogreCamera, this->dataPtr->ogreThermalTexture,
+      this->ProjectionModel(), renderFace);
 }
 
 //////////////////////////////////////////////////
@@ -917,40 +1120,34 @@ void Ogre2ThermalCamera::PreRender()
 }
 
 //////////////////////////////////////////////////
-void Ogre2ThermalCamera::PostRender()
+void Ogre2ThermalCameraPrivate::ReadThermalImage(unsigned int _width,
+    unsigned int _height, PixelFormat _format)
 {
-  if (this->dataPtr->newThermalFrame.ConnectionCount() <= 0u)
-    return;
-
-  unsigned int width = this->ImageWidth();
-  unsigned int height = this->ImageHeight();
-  PixelFormat format = this->ImageFormat();
-
-  int len = width * height;
-  unsigned int channelCount = PixelUtil::ChannelCount(format);
-  unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(format);
+  int len = _width * _height;
+  unsigned int channelCount = PixelUtil::ChannelCount(_format);
+  unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(_format);
 
   Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->ogreThermalTexture, 0u, 0u);
+  image.convertFromTexture(this->ogreThermalTexture, 0u, 0u);
 
-  if (!this->dataPtr->thermalImage)
+  if (!this->thermalImage)
   {
-    this->dataPtr->thermalImage = new uint16_t[len];
+    this->thermalImage = new uint16_t[len];
   }
 
   Ogre::TextureBox box = image.getData(0u);
-  if (format == PF_L8)
+  if (_format == PF_L8)
   {
     uint8_t *thermalBuffer = static_cast<uint8_t*>(box.data);
-    for (unsigned int i = 0u; i < height; ++i)
+    for (unsigned int i = 0u; i < _height; ++i)
     {
       // the texture box step size could be larger than our image buffer step
       // size
       unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
-      for (unsigned int j = 0u; j < width; ++j)
+      for (unsigned int j = 0u; j < _width; ++j)
       {
-        unsigned int idx = (i * width) + j;
-        this->dataPtr->thermalImage[idx] = thermalBuffer[rawDataRowIdx + j];
+        unsigned int idx = (i * _width) + j;
+        this->thermalImage[idx] = thermalBuffer[rawDataRowIdx + j];
       }
     }
   }
@@ -960,16 +1157,33 @@ void Ogre2ThermalCamera::PostRender()
     // copy data row by row. The texture box may not be a contiguous region of
     // a texture
     uint16_t * thermalBuffer = static_cast<uint16_t *>(box.data);
-    for (unsigned int i = 0; i < height; ++i)
+    for (unsigned int i = 0; i < _height; ++i)
     {
       unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
-      unsigned int rowIdx = i * width * channelCount;
-      memcpy(&this->dataPtr->thermalImage[rowIdx],
+      unsigned int rowIdx = i * _width * channelCount;
+      memcpy(&this->thermalImage[rowIdx],
           &thermalBuffer[rawDataRowIdx],
-          width * channelCount * bytesPerChannel);
+          _width * channelCount * bytesPerChannel);
     }
   }
 
+  this->thermalImageDirty = false;
+}
+
+//////////////////////////////////////////////////
+void Ogre2ThermalCamera::PostRender()
+{
+  // the image is only read back when it is needed, see SaveFrame
+  this->dataPtr->thermalImageDirty = true;
+
+  if (this->dataPtr->newThermalFrame.ConnectionCount() <= 0u)
+    return;
+
+  unsigned int width = this->ImageWidth();
+  unsigned int height = this->ImageHeight();
+  PixelFormat format = this->ImageFormat();
+  this->dataPtr->ReadThermalImage(width, height, format);
+
   this->dataPtr->newThermalFrame(
       this->dataPtr->thermalImage, width, height, 1,
       PixelUtil::Name(format));
@@ -994,6 +1208,21 @@ common::ConnectionPtr Ogre2ThermalCamera::ConnectNewThermalFrame(
   return this->dataPtr->newThermalFrame.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+bool Ogre2ThermalCamera::SaveFrame(const std::string &_name)
+{
+  // no listener may be connected, in which case the last frame has not
+  // been read back yet
+  if (this->dataPtr->thermalImageDirty && this->dataPtr->ogreThermalTexture)
+  {
+    this->dataPtr->ReadThermalImage(this->ImageWidth(), this->ImageHeight(),
+        this->ImageFormat());
+  }
+  return FrameEncoder::Instance()->Enqueue(_name,
+      this->dataPtr->thermalImage, this->ImageWidth(), this->ImageHeight(),
+      PF_L16);
+}
+
 //////////////////////////////////////////////////
 RenderTargetPtr Ogre2ThermalCamera::RenderTarget() const
 {
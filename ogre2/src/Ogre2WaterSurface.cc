@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Mesh.hh>
+#include <ignition/common/MeshManager.hh>
+#include <ignition/common/SubMesh.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Includes.hh"
+#include "ignition/rendering/ogre2/Ogre2Mesh.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+#include "ignition/rendering/ogre2/Ogre2Visual.hh"
+#include "ignition/rendering/ogre2/Ogre2WaterSurface.hh"
+
+class ignition::rendering::Ogre2WaterSurfacePrivate
+{
+  /// \brief Name of the low level material the water material is cloned
+  /// from. See media/materials/scripts/water_surface.material
+  public: const std::string kBaseMaterialName = "WaterSurface";
+
+  /// \brief Water surface material with the wave parameters of this
+  /// surface
+  public: Ogre::MaterialPtr ogreMaterial;
+
+  /// \brief Mesh holding the level of detail grid
+  public: Ogre2MeshPtr ogreMesh{nullptr};
+
+  /// \brief Distance the grid is snapped to when following the camera.
+  /// This is the cell size of the coarsest level of detail
+  public: double gridSnap = 1.0;
+
+  /// \brief Time of the last wave parameter update
+  public: double lastTime = 0.0;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2WaterSurface::Ogre2WaterSurface()
+  : dataPtr(new Ogre2WaterSurfacePrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2WaterSurface::~Ogre2WaterSurface() = default;
+
+//////////////////////////////////////////////////
+Ogre::MovableObject *Ogre2WaterSurface::OgreObject() const
+{
+  if (this->dataPtr->ogreMesh)
+    return this->dataPtr->ogreMesh->OgreObject();
+  else
+    return nullptr;
+}
+
+//////////////////////////////////////////////////
+void Ogre2WaterSurface::PreRender()
+{
+  if (this->gridDirty)
+  {
+    this->UpdateGrid();
+    this->gridDirty = false;
+    // the grid spacing and bounds depend on the size
+    this->wavesDirty = true;
+  }
+
+  if (this->wavesDirty ||
+      !math::equal(this->time, this->dataPtr->lastTime))
+  {
+    this->UpdateWaves();
+    this->wavesDirty = false;
+    this->dataPtr->lastTime = this->time;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2WaterSurface::Init()
+{
+  Ogre::MaterialPtr baseMaterial = Ogre::MaterialManager::getSingleton().
+      getByName(this->dataPtr->kBaseMaterialName);
+  if (baseMaterial.isNull())
+  {
+    ignerr << "Unable to find water surface material: "
+           << this->dataPtr->kBaseMaterialName << std::endl;
+    return;
+  }
+
+  this->dataPtr->ogreMaterial = baseMaterial->clone(
+      this->Name() + "_" + this->dataPtr->kBaseMaterialName);
+  this->dataPtr->ogreMaterial->load();
+
+  this->UpdateGrid();
+  this->gridDirty = false;
+}
+
+//////////////////////////////////////////////////
+void Ogre2WaterSurface::Destroy()
+{
+  if (this->dataPtr->ogreMesh)
+  {
+    this->dataPtr->ogreMesh->Destroy();
+    this->dataPtr->ogreMesh.reset();
+  }
+
+  if (!this->dataPtr->ogreMaterial.isNull())
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        this->dataPtr->ogreMaterial->getName());
+    this->dataPtr->ogreMaterial.setNull();
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2WaterSurface::UpdateGrid()
+{
+  if (this->dataPtr->ogreMaterial.isNull())
+    return;
+
+  // The grid consists of a square center level with n x n cells followed by
+  // rings that double the cell size at each level. Vertex coordinates are
+  // generated in units of the finest cell size. The grid extends by the
+  // largest side of the surface around the camera so the whole surface is
+  // covered wherever the camera is. Vertices outside of the surface are
+  // clamped to its border in the vertex shader.
+  const int n = static_cast<int>(this->tessellation);
+  const unsigned int levels = this->lodLevels;
+  const int coarsestCell = 1 << (levels - 1u);
+  const int extent = n / 2 * coarsestCell;
+  const double maxSize = std::max(this->size.X(), this->size.Y());
+  const double spacing = maxSize / extent;
+  this->dataPtr->gridSnap = spacing * coarsestCell;
+
+  common::MeshManager *meshMgr = common::MeshManager::Instance();
+  std::string meshName = "water_surface_mesh_" + std::to_string(n) + "_" +
+      std::to_string(levels) + "_" + std::to_string(spacing);
+
+  if (!meshMgr->HasMesh(meshName))
+  {
+    common::SubMesh subMesh;
+    subMesh.SetPrimitiveType(common::SubMesh::TRIANGLES);
+
+    // vertices are shared between cells and between levels
+    std::map<std::pair<int, int>, unsigned int> vertexIndices;
+    auto addVertex = [&](const std::pair<int, int> &_p)
+    {
+      auto it = vertexIndices.find(_p);
+      if (it != vertexIndices.end())
+      {
+        subMesh.AddIndex(it->second);
+        return;
+      }
+      unsigned int index = static_cast<unsigned int>(subMesh.VertexCount());
+      subMesh.AddVertex(_p.first * spacing, _p.second * spacing, 0.0);
+      subMesh.AddNormal(0.0, 0.0, 1.0);
+      subMesh.AddIndex(index);
+      vertexIndices[_p] = index;
+    };
+
+    for (unsigned int level = 0u; level < levels; ++level)
+    {
+      const int cell = 1 << level;
+      const int outer = n / 2 * cell;
+      // region covered by the previous, finer level
+      const int inner = (level == 0u) ? 0 : outer / 2;
+      for (int y0 = -outer; y0 < outer; y0 += cell)
+      {
+        for (int x0 = -outer; x0 < outer; x0 += cell)
+        {
+          const int x1 = x0 + cell;
+          const int y1 = y0 + cell;
+          const bool insideX = x0 >= -inner && x1 <= inner;
+          const bool insideY = y0 >= -inner && y1 <= inner;
+          if (insideX && insideY)
+            continue;
+
+          // cell corners in counter clockwise order
+          std::vector<std::pair<int, int>> polygon =
+              {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+
+          // cells bordering the finer level share an edge with two of its
+          // cells. Add the vertex in the middle of that edge to avoid
+          // cracks between the levels.
+          std::size_t fanCenter = 0u;
+          const int half = cell / 2;
+          if (inner > 0 && insideX && y0 == inner)
+          {
+            polygon.insert(polygon.begin() + 1,
+                std::make_pair(x0 + half, y0));
+            fanCenter = 1u;
+          }
+          else if (inner > 0 && insideX && y1 == -inner)
+          {
+            polygon.insert(polygon.begin() + 3,
+                std::make_pair(x0 + half, y1));
+            fanCenter = 3u;
+          }
+          else if (inner > 0 && insideY && x1 == -inner)
+          {
+            polygon.insert(polygon.begin() + 2,
+                std::make_pair(x1, y0 + half));
+            fanCenter = 2u;
+          }
+          else if (inner > 0 && insideY && x0 == inner)
+          {
+            polygon.push_back(std::make_pair(x0, y0 + half));
+            fanCenter = 4u;
+          }
+
+          // triangulate as a fan
+          for (std::size_t i = 1u; i + 1u < polygon.size(); ++i)
+          {
+            addVertex(polygon[fanCenter]);
+            addVertex(polygon[(fanCenter + i) % polygon.size()]);
+            addVertex(polygon[(fanCenter + i + 1u) % polygon.size()]);
+          }
+        }
+      }
+    }
+
+    common::Mesh *mesh = new common::Mesh();
+    mesh->SetName(meshName);
+    mesh->AddSubMesh(subMesh);
+    meshMgr->AddMesh(mesh);
+  }
+
+  MeshDescriptor meshDescriptor;
+  meshDescriptor.mesh = meshMgr->MeshByName(meshName);
+  if (meshDescriptor.mesh == nullptr)
+  {
+    ignerr << "Water surface mesh is unavailable in the Mesh Manager"
+           << std::endl;
+    return;
+  }
+
+  auto visual = std::dynamic_pointer_cast<Ogre2Visual>(this->Parent());
+
+  // clear geom if needed
+  if (this->dataPtr->ogreMesh)
+  {
+    if (visual)
+    {
+      visual->RemoveGeometry(
+          std::dynamic_pointer_cast<Geometry>(shared_from_this()));
+    }
+    this->dataPtr->ogreMesh->Destroy();
+  }
+  this->dataPtr->ogreMesh = std::dynamic_pointer_cast<Ogre2Mesh>(
+      this->Scene()->CreateMesh(meshDescriptor));
+
+  for (unsigned int i = 0; i < this->dataPtr->ogreMesh->SubMeshCount(); ++i)
+  {
+    auto subMesh = std::dynamic_pointer_cast<Ogre2SubMesh>(
+        this->dataPtr->ogreMesh->SubMeshByIndex(i));
+    subMesh->Ogre2SubItem()->setMaterial(this->dataPtr->ogreMaterial);
+  }
+  this->dataPtr->ogreMesh->OgreObject()->setCastShadows(false);
+
+  if (visual)
+  {
+    visual->AddGeometry(
+        std::dynamic_pointer_cast<Geometry>(shared_from_this()));
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2WaterSurface::UpdateWaves()
+{
+  if (this->dataPtr->ogreMaterial.isNull() || !this->dataPtr->ogreMesh)
+    return;
+
+  // per wave (amplitude, wavenumber, angular frequency, steepness) and
+  // (direction x, direction y, phase, unused). The time dependent part of
+  // the phase is computed here in double precision and wrapped to avoid
+  // precision loss in the shader for large times.
+  const unsigned int maxCount = GerstnerWaves::kMaxWaveCount;
+  std::vector<float> waveParams(maxCount * 4u, 0.0f);
+  std::vector<float> waveDirs(maxCount * 4u, 0.0f);
+  double maxHeight = 0.0;
+  double maxOffset = 0.0;
+  for (unsigned int i = 0; i < this->waves.WaveCount(); ++i)
+  {
+    GerstnerWave wave = this->waves.Wave(i);
+    double omega = this->waves.AngularFrequency(i);
+    double phase = std::fmod(wave.phase - omega * this->time, 2.0 * IGN_PI);
+
+    waveParams[i * 4u] = static_cast<float>(wave.amplitude);
+    waveParams[i * 4u + 1u] = static_cast<float>(this->waves.Wavenumber(i));
+    waveParams[i * 4u + 2u] = static_cast<float>(omega);
+    waveParams[i * 4u + 3u] = static_cast<float>(wave.steepness);
+    waveDirs[i * 4u] = static_cast<float>(wave.direction.X());
+    waveDirs[i * 4u + 1u] = static_cast<float>(wave.direction.Y());
+    waveDirs[i * 4u + 2u] = static_cast<float>(phase);
+
+    maxHeight += std::abs(wave.amplitude);
+    maxOffset += std::abs(wave.steepness * wave.amplitude);
+  }
+
+  Ogre::Pass *pass =
+      this->dataPtr->ogreMaterial->getTechnique(0u)->getPass(0u);
+  Ogre::GpuProgramParametersSharedPtr vsParams =
+      pass->getVertexProgramParameters();
+  vsParams->setNamedConstant("waveCount",
+      static_cast<int>(this->waves.WaveCount()));
+  vsParams->setNamedConstant("waveParams", waveParams.data(), maxCount, 4u);
+  vsParams->setNamedConstant("waveDirs", waveDirs.data(), maxCount, 4u);
+  vsParams->setNamedConstant("gridParams", Ogre::Vector4(
+      static_cast<Ogre::Real>(this->size.X() * 0.5),
+      static_cast<Ogre::Real>(this->size.Y() * 0.5),
+      static_cast<Ogre::Real>(this->dataPtr->gridSnap), 0));
+
+  // the grid is moved with the camera in the vertex shader so the bounds of
+  // the mesh do not match the rendered surface
+  Ogre::Vector3 halfExtents(
+      static_cast<Ogre::Real>(this->size.X() * 0.5 + maxOffset),
+      static_cast<Ogre::Real>(this->size.Y() * 0.5 + maxOffset),
+      static_cast<Ogre::Real>(maxHeight));
+  this->dataPtr->ogreMesh->OgreObject()->setLocalAabb(
+      Ogre::Aabb(Ogre::Vector3::ZERO, halfExtents));
+}
+
+//////////////////////////////////////////////////
+void Ogre2WaterSurface::SetMaterial(MaterialPtr, bool)
+{
+  ignwarn << "Material of water surface [" << this->Name() << "] "
+          << "can not be changed" << std::endl;
+}
+
+//////////////////////////////////////////////////
+MaterialPtr Ogre2WaterSurface::Material() const
+{
+  return nullptr;
+}
@@ -0,0 +1,447 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <string>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Quaternion.hh>
+
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/OgreCompositorWorkspace.h>
+#include <Compositor/OgreCompositorWorkspaceDef.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <OgreCamera.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgrePixelFormatGpuUtils.h>
+#include <OgreRoot.h>
+#include <OgreStagingTexture.h>
+#include <OgreTechnique.h>
+#include <OgreTextureGpuManager.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+#include "Ogre2WideAngleRenderer.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Orientation of the camera of each cube face relative to the
+/// camera, in the Ogre camera frame. Matches the cubemap cameras of
+/// Ogre2GpuRays.
+static const Ogre::Quaternion kFaceOrientations[
+    Ogre2WideAngleRenderer::kCubeFaceCount] =
+{
+  Ogre::Quaternion(Ogre::Degree(-90), Ogre::Vector3::UNIT_Y),
+  Ogre::Quaternion(Ogre::Degree(90), Ogre::Vector3::UNIT_Y),
+  Ogre::Quaternion(Ogre::Degree(90), Ogre::Vector3::UNIT_X),
+  Ogre::Quaternion(Ogre::Degree(-90), Ogre::Vector3::UNIT_X),
+  Ogre::Quaternion::IDENTITY,
+  Ogre::Quaternion(Ogre::Degree(180), Ogre::Vector3::UNIT_Y)
+};
+
+/// \brief Same rotations as kFaceOrientations in the sensor frame
+/// (x forward, y left, z up), used to rotate points back to the camera frame
+static const math::Quaterniond kFaceRotations[
+    Ogre2WideAngleRenderer::kCubeFaceCount] =
+{
+  math::Quaterniond(0, 0, -IGN_PI * 0.5),
+  math::Quaterniond(0, 0, IGN_PI * 0.5),
+  math::Quaterniond(0, -IGN_PI * 0.5, 0),
+  math::Quaterniond(0, IGN_PI * 0.5, 0),
+  math::Quaterniond::Identity,
+  math::Quaterniond(0, 0, IGN_PI)
+};
+
+//////////////////////////////////////////////////
+Ogre2WideAngleRenderer::~Ogre2WideAngleRenderer()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleRenderer::SetNearestFiltering(bool _nearest)
+{
+  this->nearest = _nearest;
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleRenderer::SetRotatePoints(bool _rotate)
+{
+  this->rotatePoints = _rotate;
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleRenderer::SetInvalidColor(const Ogre::ColourValue &_color)
+{
+  this->invalidColor = _color;
+}
+
+//////////////////////////////////////////////////
+const std::set<unsigned int> &Ogre2WideAngleRenderer::Faces() const
+{
+  return this->faces;
+}
+
+//////////////////////////////////////////////////
+math::Vector2d Ogre2WideAngleRenderer::SampleCubemap(const math::Vector3d &_v,
+    unsigned int &_faceIndex)
+{
+  // see Ogre2GpuRays::SampleCubemap
+  math::Vector3d vAbs = _v.Abs();
+  double ma;
+  math::Vector2d uv;
+  if (vAbs.Z() >= vAbs.X() && vAbs.Z() >= vAbs.Y())
+  {
+    _faceIndex = _v.Z() < 0 ? 5 : 4;
+    ma = 0.5 / vAbs.Z();
+    uv = math::Vector2d(_v.Z() < 0.0 ? -_v.X() : _v.X(), -_v.Y());
+  }
+  else if (vAbs.Y() >= vAbs.X())
+  {
+    _faceIndex = _v.Y() < 0 ? 3 : 2;
+    ma = 0.5 / vAbs.Y();
+    uv = math::Vector2d(_v.X(), _v.Y() < 0.0 ? -_v.Z() : _v.Z());
+  }
+  else
+  {
+    _faceIndex = _v.X() < 0 ? 1 : 0;
+    ma = 0.5 / vAbs.X();
+    uv = math::Vector2d(_v.X() < 0.0 ? _v.Z() : -_v.Z(), -_v.Y());
+  }
+  return uv * ma + 0.5;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2WideAngleRenderer::IsDirty(Ogre::TextureGpu *_target,
+    const WideAngleProjection &_projection) const
+{
+  return !this->workspace || _target != this->target ||
+      _target->getWidth() != this->projection.ImageWidth() ||
+      _target->getHeight() != this->projection.ImageHeight() ||
+      _projection.Type() != this->projection.Type() ||
+      _projection.ImageWidth() != this->projection.ImageWidth() ||
+      _projection.ImageHeight() != this->projection.ImageHeight() ||
+      _projection.HFOV() != this->projection.HFOV() ||
+      _projection.Coefficients() != this->projection.Coefficients();
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleRenderer::Render(const std::string &_name,
+    Ogre2ScenePtr _scene, Ogre::Camera *_camera, Ogre::TextureGpu *_target,
+    const WideAngleProjection &_projection,
+    const std::function<void()> &_renderFace)
+{
+  if (!_camera || !_target)
+    return;
+
+  if (this->IsDirty(_target, _projection))
+  {
+    this->Destroy();
+    this->projection = _projection;
+    this->Create(_name, _scene, _camera, _target);
+  }
+
+  // render each face with a 90 degrees square frustum
+  Ogre::Quaternion orientation = _camera->getOrientation();
+  Ogre::Radian fovy = _camera->getFOVy();
+  Ogre::Real aspectRatio = _camera->getAspectRatio();
+  bool autoAspectRatio = _camera->getAutoAspectRatio();
+  _camera->setAutoAspectRatio(false);
+  _camera->setAspectRatio(1.0);
+  _camera->setFOVy(Ogre::Degree(90));
+
+  for (auto i : this->faces)
+  {
+    _camera->setOrientation(orientation * kFaceOrientations[i]);
+    _renderFace();
+    _target->copyTo(this->faceTextures[i],
+        this->faceTextures[i]->getEmptyBox(0u), 0u,
+        _target->getEmptyBox(0u), 0u);
+  }
+
+  _camera->setOrientation(orientation);
+  _camera->setFOVy(fovy);
+  _camera->setAspectRatio(aspectRatio);
+  _camera->setAutoAspectRatio(autoAspectRatio);
+
+  // remap the faces into the output texture
+  _scene->StartRendering(nullptr);
+
+  this->workspace->_validateFinalTarget();
+  this->workspace->_beginUpdate(false);
+  this->workspace->_update();
+  this->workspace->_endUpdate(false);
+
+  Ogre::vector<Ogre::TextureGpu *>::type swappedTargets;
+  swappedTargets.reserve(2u);
+  this->workspace->_swapFinalTarget(swappedTargets);
+
+  _scene->FlushGpuCommandsAndStartNewFrame(0u, false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleRenderer::CreateLookupTexture(const std::string &_name)
+{
+  // Each pixel packs the following data:
+  //   R: u coordinate on the cube face
+  //   G: v coordinate on the cube face
+  //   B: cube face index
+  //   A: 1 if a ray maps to the pixel, 0 otherwise
+  const unsigned int width = this->projection.ImageWidth();
+  const unsigned int height = this->projection.ImageHeight();
+
+  auto engine = Ogre2RenderEngine::Instance();
+  Ogre::TextureGpuManager *textureMgr =
+    engine->OgreRoot()->getRenderSystem()->getTextureGpuManager();
+  this->lookupTexture = textureMgr->createOrRetrieveTexture(
+      _name + "_wide_angle_lookup",
+      Ogre::GpuPageOutStrategy::SaveToSystemRam,
+      Ogre::TextureFlags::ManualTexture,
+      Ogre::TextureTypes::Type2D,
+      Ogre::BLANKSTRING,
+      0u);
+  this->lookupTexture->setResolution(width, height);
+  this->lookupTexture->setNumMipmaps(1u);
+  this->lookupTexture->setPixelFormat(Ogre::PFG_RGBA32_FLOAT);
+
+  const size_t dataSize = Ogre::PixelFormatGpuUtils::getSizeBytes(
+      width, height, 1u, 1u, Ogre::PFG_RGBA32_FLOAT, 1u);
+  // the texture takes ownership of the system ram copy
+  float *data = reinterpret_cast<float *>(
+      OGRE_MALLOC_SIMD(dataSize, Ogre::MEMCATEGORY_RESOURCE));
+  std::fill(data, data + width * height * 4u, 0.0f);
+  this->faces.clear();
+  for (unsigned int i = 0; i < height; ++i)
+  {
+    for (unsigned int j = 0; j < width; ++j)
+    {
+      math::Vector3d ray;
+      if (!this->projection.PixelToRay(math::Vector2d(j + 0.5, i + 0.5), ray))
+        continue;
+
+      // sensor frame to cubemap frame
+      math::Vector3d v(-ray.Y(), ray.Z(), ray.X());
+      unsigned int faceIdx;
+      math::Vector2d uv = SampleCubemap(v, faceIdx);
+      this->faces.insert(faceIdx);
+
+      unsigned int index = (i * width + j) * 4u;
+      data[index] = static_cast<float>(uv.X());
+      data[index + 1] = static_cast<float>(uv.Y());
+      data[index + 2] = static_cast<float>(faceIdx);
+      data[index + 3] = 1.0f;
+    }
+  }
+
+  this->lookupTexture->_transitionTo(Ogre::GpuResidency::Resident,
+      reinterpret_cast<Ogre::uint8 *>(data));
+  this->lookupTexture->_setNextResidencyStatus(Ogre::GpuResidency::Resident);
+
+  // upload the data via a staging texture, see
+  // Ogre2GpuRays::UploadSampleTexture
+  Ogre::StagingTexture *stagingTexture = textureMgr->getStagingTexture(
+      width, height, 1u, 1u, Ogre::PFG_RGBA32_FLOAT);
+  stagingTexture->startMapRegion();
+  Ogre::TextureBox texBox = stagingTexture->mapRegion(
+      width, height, 1u, 1u, Ogre::PFG_RGBA32_FLOAT);
+  texBox.copyFrom(data, width, height,
+      this->lookupTexture->_getSysRamCopyBytesPerRow(0));
+  stagingTexture->stopMapRegion();
+  stagingTexture->upload(texBox, this->lookupTexture, 0, 0, 0, true);
+  textureMgr->removeStagingTexture(stagingTexture);
+
+  this->lookupTexture->notifyDataIsReady();
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleRenderer::Create(const std::string &_name,
+    Ogre2ScenePtr _scene, Ogre::Camera *_camera, Ogre::TextureGpu *_target)
+{
+  this->target = _target;
+  this->CreateLookupTexture(_name);
+
+  if (this->faces.empty())
+  {
+    ignwarn << "No pixel of [" << _name << "] is covered by its projection. "
+            << "Check the horizontal field of view." << std::endl;
+  }
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  // the faces have the resolution of the output image. The square frustum
+  // used to render them only makes their texels non square
+  for (auto i : this->faces)
+  {
+    this->faceTextures[i] = textureMgr->createOrRetrieveTexture(
+        _name + "_wide_angle_face_" + std::to_string(i),
+        Ogre::GpuPageOutStrategy::SaveToSystemRam,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+    this->faceTextures[i]->setResolution(_target->getWidth(),
+        _target->getHeight());
+    this->faceTextures[i]->setNumMipmaps(1u);
+    this->faceTextures[i]->setPixelFormat(_target->getPixelFormat());
+    this->faceTextures[i]->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+  }
+
+  // The WideAngleRemap material is defined in script (wide_angle.material).
+  // We need to clone it since we are going to modify texture unit states.
+  Ogre::MaterialPtr mat =
+      Ogre::MaterialManager::getSingleton().getByName("WideAngleRemap");
+  this->material = mat->clone(_name + "_WideAngleRemap");
+  this->material->load();
+  Ogre::Pass *pass = this->material->getTechnique(0)->getPass(0);
+  pass->getTextureUnitState(0)->setTexture(this->lookupTexture);
+  for (auto i : this->faces)
+  {
+    // texIndex need to match how the texture units are defined in the
+    // wide_angle.material script
+    Ogre::TextureUnitState *texUnit = pass->getTextureUnitState(1 + i);
+    texUnit->setTexture(this->faceTextures[i]);
+    if (!this->nearest)
+      texUnit->setTextureFiltering(Ogre::TFO_BILINEAR);
+  }
+
+  // see wide_angle_remap_fs.glsl
+  float faceRot[kCubeFaceCount * 4u];
+  for (unsigned int i = 0; i < kCubeFaceCount; ++i)
+  {
+    faceRot[i * 4u] = static_cast<float>(kFaceRotations[i].X());
+    faceRot[i * 4u + 1] = static_cast<float>(kFaceRotations[i].Y());
+    faceRot[i * 4u + 2] = static_cast<float>(kFaceRotations[i].Z());
+    faceRot[i * 4u + 3] = static_cast<float>(kFaceRotations[i].W());
+  }
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+  psParams->setNamedConstant("faceRot", faceRot, kCubeFaceCount, 4u);
+  psParams->setNamedConstant("invalidColor", this->invalidColor);
+  psParams->setNamedConstant("nearest", this->nearest ? 1.0f : 0.0f);
+  psParams->setNamedConstant("rotatePoints",
+      this->rotatePoints ? 1.0f : 0.0f);
+  psParams->setNamedConstant("texResolution", Ogre::Vector4(
+      static_cast<float>(_target->getWidth()),
+      static_cast<float>(_target->getHeight()),
+      1.0f / _target->getWidth(), 1.0f / _target->getHeight()));
+
+  // The workspace definition is equivalent to the following compositor
+  // script:
+  //
+  // compositor_node WideAngleRemap
+  // {
+  //   in 0 rt_output
+  //   target rt_output
+  //   {
+  //     pass render_quad
+  //     {
+  //       material WideAngleRemap // Use copy instead of original
+  //     }
+  //   }
+  //   out 0 rt_output
+  // }
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+  this->workspaceDefName = _name + "_WideAngleRemapWorkspace";
+  if (!ogreCompMgr->hasWorkspaceDefinition(this->workspaceDefName))
+  {
+    std::string nodeDefName = this->workspaceDefName + "/Node";
+    Ogre::CompositorNodeDef *nodeDef =
+        ogreCompMgr->addNodeDefinition(nodeDefName);
+    nodeDef->addTextureSourceName("rt_output", 0,
+        Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+    nodeDef->setNumTargetPass(1);
+    Ogre::CompositorTargetDef *targetDef =
+        nodeDef->addTargetPass("rt_output");
+    targetDef->setNumPasses(1);
+    {
+      Ogre::CompositorPassQuadDef *passQuad =
+          static_cast<Ogre::CompositorPassQuadDef *>(
+          targetDef->addPass(Ogre::PASS_QUAD));
+      passQuad->setAllLoadActions(Ogre::LoadAction::DontCare);
+      passQuad->mMaterialName = this->material->getName();
+    }
+    nodeDef->mapOutputChannel(0, "rt_output");
+
+    Ogre::CompositorWorkspaceDef *workDef =
+        ogreCompMgr->addWorkspaceDefinition(this->workspaceDefName);
+    workDef->connectExternal(0, nodeDef->getName(), 0);
+  }
+
+  this->workspace = ogreCompMgr->addWorkspace(_scene->OgreSceneManager(),
+      _target, _camera, this->workspaceDefName, false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleRenderer::Destroy()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  if (!engine || !engine->OgreRoot())
+    return;
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  if (this->workspace)
+  {
+    ogreCompMgr->removeWorkspace(this->workspace);
+    this->workspace = nullptr;
+  }
+
+  if (!this->workspaceDefName.empty() &&
+      ogreCompMgr->hasWorkspaceDefinition(this->workspaceDefName))
+  {
+    ogreCompMgr->removeWorkspaceDefinition(this->workspaceDefName);
+    ogreCompMgr->removeNodeDefinition(this->workspaceDefName + "/Node");
+  }
+  this->workspaceDefName.clear();
+
+  if (this->material)
+  {
+    Ogre::MaterialManager::getSingleton().remove(this->material->getName());
+    this->material.reset();
+  }
+
+  for (auto &tex : this->faceTextures)
+  {
+    if (tex)
+    {
+      textureMgr->destroyTexture(tex);
+      tex = nullptr;
+    }
+  }
+
+  if (this->lookupTexture)
+  {
+    textureMgr->destroyTexture(this->lookupTexture);
+    this->lookupTexture = nullptr;
+  }
+
+  this->faces.clear();
+  this->target = nullptr;
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2WIDEANGLERENDERER_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2WIDEANGLERENDERER_HH_
+
+#include <functional>
+#include <set>
+#include <string>
+
+#include <ignition/math/Vector2.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/WideAngleProjection.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreColourValue.h>
+#include <OgreMaterial.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+namespace Ogre
+{
+  class Camera;
+  class CompositorWorkspace;
+  class TextureGpu;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Helper class used by cameras to render fisheye and panoramic
+    /// projections. The cube faces seen by the projection are rendered one
+    /// after another with the camera's own pipeline. Each face is copied
+    /// out of the camera's output texture, and a quad pass then remaps the
+    /// faces back into the output texture.
+    class Ogre2WideAngleRenderer
+    {
+      /// \brief Number of cube faces
+      public: static const unsigned int kCubeFaceCount = 6u;
+
+      /// \brief Destructor
+      public: ~Ogre2WideAngleRenderer();
+
+      /// \brief Set whether to use the nearest texel of a face instead of
+      /// interpolating between texels. Needed by outputs that can not be
+      /// interpolated, e.g. labels or packed data.
+      /// \param[in] _nearest True to use the nearest texel
+      public: void SetNearestFiltering(bool _nearest);
+
+      /// \brief Set whether the xyz channels hold a point in the camera
+      /// frame that has to be rotated from the frame of the cube face to
+      /// the frame of the camera, e.g. depth camera point clouds.
+      /// \param[in] _rotate True to rotate the points
+      public: void SetRotatePoints(bool _rotate);
+
+      /// \brief Set the value written to pixels that no ray maps to, e.g.
+      /// outside of the image circle of a fisheye projection
+      /// \param[in] _color Value of invalid pixels
+      public: void SetInvalidColor(const Ogre::ColourValue &_color);
+
+      /// \brief Render the camera with a wide angle projection. Textures
+      /// are recreated when the projection or the output texture change.
+      /// \param[in] _name Unique name used for the resources created
+      /// \param[in] _scene Scene being rendered
+      /// \param[in] _camera Ogre camera whose orientation, field of view and
+      /// aspect ratio are changed to render each face, then restored
+      /// \param[in] _target Output texture of the camera
+      /// \param[in] _projection Projection to render
+      /// \param[in] _renderFace Callback that renders the camera into
+      /// _target once with the current camera settings
+      public: void Render(const std::string &_name, Ogre2ScenePtr _scene,
+          Ogre::Camera *_camera, Ogre::TextureGpu *_target,
+          const WideAngleProjection &_projection,
+          const std::function<void()> &_renderFace);
+
+      /// \brief Destroy all resources
+      public: void Destroy();
+
+      /// \brief Get the cube faces rendered by the current projection
+      /// \return Indices of the cube faces
+      public: const std::set<unsigned int> &Faces() const;
+
+      /// \brief Get the cube face and position on the face of a ray
+      /// \param[in] _v Ray direction in the cubemap frame (x right, y up,
+      /// z forward)
+      /// \param[out] _faceIndex Index of the cube face
+      /// \return uv coordinates on the face
+      public: static math::Vector2d SampleCubemap(const math::Vector3d &_v,
+          unsigned int &_faceIndex);
+
+      /// \brief Create the textures, material and workspace
+      /// \param[in] _name Unique name used for the resources created
+      /// \param[in] _scene Scene being rendered
+      /// \param[in] _camera Camera used by the remap workspace
+      /// \param[in] _target Output texture of the camera
+      private: void Create(const std::string &_name, Ogre2ScenePtr _scene,
+          Ogre::Camera *_camera, Ogre::TextureGpu *_target);
+
+      /// \brief Create and upload the texture that tells the remap shader
+      /// which face and texel each output pixel comes from
+      /// \param[in] _name Unique name used for the resources created
+      private: void CreateLookupTexture(const std::string &_name);
+
+      /// \brief Check if the resources need to be recreated
+      /// \param[in] _target Output texture of the camera
+      /// \param[in] _projection Projection to render
+      /// \return True if the resources are out of date
+      private: bool IsDirty(Ogre::TextureGpu *_target,
+          const WideAngleProjection &_projection) const;
+
+      /// \brief Projection the resources were created for
+      private: WideAngleProjection projection;
+
+      /// \brief Output texture the resources were created for
+      private: Ogre::TextureGpu *target = nullptr;
+
+      /// \brief Textures holding a copy of each rendered face
+      private: Ogre::TextureGpu *faceTextures[kCubeFaceCount] =
+          {nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+
+      /// \brief Face index and uv coordinates of each output pixel
+      private: Ogre::TextureGpu *lookupTexture = nullptr;
+
+      /// \brief Faces seen by the projection
+      private: std::set<unsigned int> faces;
+
+      /// \brief Remap material
+      private: Ogre::MaterialPtr material;
+
+      /// \brief Remap workspace definition name
+      private: std::string workspaceDefName;
+
+      /// \brief Remap workspace
+      private: Ogre::CompositorWorkspace *workspace = nullptr;
+
+      /// \brief Use the nearest texel of a face
+      private: bool nearest = false;
+
+      /// \brief Rotate points from the face frame to the camera frame
+      private: bool rotatePoints = false;
+
+      /// \brief Value of pixels that no ray maps to
+      private: Ogre::ColourValue invalidColor = Ogre::ColourValue::Black;
+    };
+    }
+  }
+}
+#endif
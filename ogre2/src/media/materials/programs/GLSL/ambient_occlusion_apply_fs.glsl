@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+uniform sampler2D RT;
+uniform sampler2D aoTexture;
+uniform sampler2D depthTexture;
+
+// linearizes the depth buffer into view space depth
+uniform vec2 projectionParams;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+float linearDepth(vec2 uv)
+{
+  float fDepth = texture(depthTexture, uv).x;
+  return projectionParams.y / (fDepth - projectionParams.x);
+}
+
+void main()
+{
+  vec4 color = texture(RT, inPs.uv0);
+
+  // 4x4 blur of the occlusion that ignores samples at a different depth so
+  // the occlusion does not bleed across the edges of objects. This also
+  // upsamples occlusion evaluated at half resolution.
+  vec2 aoTexel = 1.0 / vec2(textureSize(aoTexture, 0));
+  float d = linearDepth(inPs.uv0);
+  float sum = 0.0;
+  float weightSum = 0.0;
+  for (int y = -2; y < 2; ++y)
+  {
+    for (int x = -2; x < 2; ++x)
+    {
+      vec2 uv = inPs.uv0 + (vec2(x, y) + 0.5) * aoTexel;
+      float w = 1.0 / (0.001 + abs(linearDepth(uv) - d) / d);
+      sum += texture(aoTexture, uv).x * w;
+      weightSum += w;
+    }
+  }
+
+  color.rgb *= sum / weightSum;
+  fragColor = color;
+}
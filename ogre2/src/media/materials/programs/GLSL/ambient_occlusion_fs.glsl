@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+uniform sampler2D depthTexture;
+
+// linearizes the depth buffer into view space depth
+uniform vec2 projectionParams;
+// x and y scale of the projection matrix
+uniform vec2 projectionScale;
+// distance in meters within which surfaces occlude each other
+uniform float radius;
+// number of depth samples per pixel
+uniform int sampleCount;
+// strength of the darkening
+uniform float intensity;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+// view space position of the opaque surface seen at a texture coordinate
+vec3 viewPosition(vec2 uv)
+{
+  float fDepth = texture(depthTexture, uv).x;
+  float d = projectionParams.y / (fDepth - projectionParams.x);
+  vec2 ndc = vec2(uv.x * 2.0 - 1.0, 1.0 - uv.y * 2.0);
+  return vec3(ndc / projectionScale * d, -d);
+}
+
+void main()
+{
+  // the background is not occluded
+  if (texture(depthTexture, inPs.uv0).x >= 1.0)
+  {
+    fragColor = vec4(1.0);
+    return;
+  }
+
+  vec3 p = viewPosition(inPs.uv0);
+
+  // reconstruct the normal from the neighbors that are closest in depth so
+  // that it does not bend at depth discontinuities
+  vec2 size = vec2(textureSize(depthTexture, 0));
+  vec2 texel = 1.0 / size;
+  vec3 px0 = viewPosition(inPs.uv0 - vec2(texel.x, 0.0));
+  vec3 px1 = viewPosition(inPs.uv0 + vec2(texel.x, 0.0));
+  vec3 py0 = viewPosition(inPs.uv0 - vec2(0.0, texel.y));
+  vec3 py1 = viewPosition(inPs.uv0 + vec2(0.0, texel.y));
+  vec3 dx = abs(px1.z - p.z) < abs(p.z - px0.z) ? px1 - p : p - px0;
+  vec3 dy = abs(py1.z - p.z) < abs(p.z - py0.z) ? py1 - p : p - py0;
+  vec3 n = normalize(cross(dy, dx));
+
+  // radius of the sample disc in texture coordinates
+  vec2 uvRadius = 0.5 * radius * projectionScale / -p.z;
+
+  // rotate the sample spiral of each pixel by interleaved gradient noise,
+  // which the apply pass blurs away
+  vec2 pixel = floor(inPs.uv0 * size);
+  float noise = fract(52.9829189 *
+      fract(dot(pixel, vec2(0.06711056, 0.00583715))));
+
+  float r2 = radius * radius;
+  float occlusion = 0.0;
+  for (int i = 0; i < sampleCount; ++i)
+  {
+    float t = (float(i) + 0.5) / float(sampleCount);
+    float angle = 6.2831853 * (7.0 * t + noise);
+    vec2 offset = vec2(cos(angle), sin(angle)) * t * uvRadius;
+    vec3 v = viewPosition(inPs.uv0 + offset) - p;
+    float vv = dot(v, v);
+
+    // samples above the tangent plane occlude the point, less so the
+    // further away they are. The bias avoids self occlusion of flat
+    // surfaces.
+    float cosine = dot(v, n) * inversesqrt(vv + 1e-6);
+    occlusion += max(0.0, 1.0 - vv / r2) * max(0.0, cosine - 0.1);
+  }
+
+  float ao = 1.0 - 2.0 * intensity * occlusion / float(sampleCount);
+  fragColor = vec4(clamp(ao, 0.0, 1.0));
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+uniform sampler2D RT;
+
+// relative magnification of the red channel. The blue channel is
+// magnified by the same amount in the opposite direction
+uniform float strength;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+void main()
+{
+  vec2 center = vec2(0.5, 0.5);
+  vec2 d = inPs.uv0 - center;
+
+  vec4 color = texture(RT, inPs.uv0);
+  color.r = texture(RT, center + d / (1.0 + strength)).r;
+  color.b = texture(RT, center + d / (1.0 - strength)).b;
+
+  fragColor = color;
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#version 330
+
+// This fragment shader adds the artifacts of structured light and time of
+// flight depth sensors to a float32 rgba texture that consists of
+// [x, y, z, rgba] values, with x pointing forward, y left and z up.
+// Invalid points are moved to the origin so that the depth camera final pass
+// reports them as points closer than the near clip plane.
+
+uniform sampler2D RT;
+
+uniform vec4 texResolution;
+
+// Tangent of half of the vertical field of view
+uniform float tanHalfFovY;
+// Real near and far clip planes of the depth camera
+uniform float near;
+uniform float far;
+// Random values sampled on the CPU
+uniform vec3 offsets;
+
+// Projector offset along the negative y axis, 0 to disable
+uniform float baseline;
+// Disparity step in pixels, 0 to disable
+uniform float disparityStep;
+// Depth difference that produces flying pixels, 0 to disable
+uniform float flyingThreshold;
+// Fraction of the depth of a concave region added to its depth
+uniform float multipathStrength;
+// Range of luminance that returns valid depth
+uniform float minReflectance;
+uniform float maxReflectance;
+// Cosine of the largest incidence angle that returns valid depth
+uniform float cosMaxIncidence;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+// Max number of texels searched for an occluder of the projector
+#define SHADOW_SAMPLES 64
+// Distance in texels of the neighbors used to estimate multipath
+#define MULTIPATH_RADIUS 3
+
+float rand(vec2 co)
+{
+  float r = fract(sin(dot(co.xy, vec2(12.9898,78.233))) * 43758.5453);
+  return clamp(r, 0.001, 1.0);
+}
+
+vec4 unpack(float color)
+{
+  int rgba = floatBitsToInt(color);
+  int r = rgba >> 24 & 0xFF;
+  int g = rgba >> 16 & 0xFF;
+  int b = rgba >> 8 & 0xFF;
+  int a = rgba & 0xFF;
+  return vec4(r/255.0, g/255.0, b/255.0, a/255.0);
+}
+
+bool isValid(vec3 p)
+{
+  float tolerance = 1e-6;
+  return !isinf(p.x) && !isnan(p.x) && p.x > near + tolerance &&
+      length(p) < far - tolerance;
+}
+
+vec3 fetchPoint(ivec2 uv)
+{
+  ivec2 size = ivec2(texResolution.xy);
+  return texelFetch(RT, clamp(uv, ivec2(0), size - ivec2(1)), 0).xyz;
+}
+
+// Check if the projector can not see the point. The segment from the point
+// to the projector lies on the same image row, toward the projector side.
+bool inProjectorShadow(ivec2 uv, vec3 p, float fx)
+{
+  int dir = baseline > 0.0 ? 1 : -1;
+  int width = int(texResolution.x);
+  for (int i = 1; i <= SHADOW_SAMPLES; ++i)
+  {
+    int u = uv.x + dir * i;
+    if (u < 0 || u >= width)
+      break;
+    // depth of the segment where it crosses this column
+    float k = float(i) * p.x / (fx * abs(baseline));
+    float segmentDepth = p.x / (1.0 + k);
+    float depth = fetchPoint(ivec2(u, uv.y)).x;
+    if (depth < segmentDepth * 0.99)
+      return true;
+  }
+  return false;
+}
+
+void main()
+{
+  ivec2 uv = ivec2(inPs.uv0 * texResolution.xy);
+  vec4 p = texelFetch(RT, uv, 0);
+  vec3 point = p.xyz;
+  vec3 invalid = vec3(0.0);
+
+  if (!isValid(point))
+  {
+    fragColor = p;
+    return;
+  }
+
+  // focal length in pixels
+  float fx = texResolution.y / (2.0 * tanHalfFovY);
+
+  // shadow cast by objects between the projector and the point
+  if (baseline != 0.0 && inProjectorShadow(uv, point, fx))
+  {
+    fragColor = vec4(invalid, p.a);
+    return;
+  }
+
+  // surfaces that are too dark or too bright to return depth. Color is
+  // stored gamma corrected
+  if (minReflectance > 0.0 || maxReflectance < 1.0)
+  {
+    vec3 color = unpack(p.a).rgb;
+    float luminance = dot(color * color, vec3(0.2126, 0.7152, 0.0722));
+    if (luminance < minReflectance || luminance > maxReflectance)
+    {
+      fragColor = vec4(invalid, p.a);
+      return;
+    }
+  }
+
+  vec3 left = fetchPoint(uv + ivec2(-1, 0));
+  vec3 right = fetchPoint(uv + ivec2(1, 0));
+  vec3 down = fetchPoint(uv + ivec2(0, -1));
+  vec3 up = fetchPoint(uv + ivec2(0, 1));
+
+  // surfaces seen at grazing angles
+  if (cosMaxIncidence > 0.0)
+  {
+    vec3 dx = (isValid(right) ? right : point) - (isValid(left) ? left : point);
+    vec3 dy = (isValid(up) ? up : point) - (isValid(down) ? down : point);
+    vec3 n = cross(dx, dy);
+    if (length(n) > 0.0 &&
+        abs(dot(normalize(n), normalize(point))) < cosMaxIncidence)
+    {
+      fragColor = vec4(invalid, p.a);
+      return;
+    }
+  }
+
+  float depth = point.x;
+
+  // flying pixels at depth discontinuities are placed between the
+  // foreground and the background
+  if (flyingThreshold > 0.0)
+  {
+    vec3 neighbors[4] = vec3[4](left, right, down, up);
+    float jump = 0.0;
+    float target = depth;
+    for (int i = 0; i < 4; ++i)
+    {
+      float d = isValid(neighbors[i]) ? neighbors[i].x : far;
+      if (abs(d - point.x) > jump)
+      {
+        jump = abs(d - point.x);
+        target = d;
+      }
+    }
+    if (jump > flyingThreshold)
+      depth = mix(depth, target, 0.5 * rand(inPs.uv0 + offsets.xy));
+  }
+
+  // light bouncing between surfaces makes concave regions look deeper
+  if (multipathStrength > 0.0)
+  {
+    float sum = 0.0;
+    float count = 0.0;
+    for (int i = -1; i <= 1; i += 2)
+    {
+      vec3 h = fetchPoint(uv + ivec2(i * MULTIPATH_RADIUS, 0));
+      vec3 v = fetchPoint(uv + ivec2(0, i * MULTIPATH_RADIUS));
+      if (isValid(h))
+      {
+        sum += h.x;
+        count += 1.0;
+      }
+      if (isValid(v))
+      {
+        sum += v.x;
+        count += 1.0;
+      }
+    }
+    if (count > 0.0)
+      depth += multipathStrength * max(point.x - sum / count, 0.0);
+  }
+
+  // depth recovered from a disparity measured in discrete steps
+  if (disparityStep > 0.0 && baseline != 0.0)
+  {
+    float disparity = fx * abs(baseline) / depth;
+    disparity = round(disparity / disparityStep) * disparityStep;
+    if (disparity <= 0.0)
+    {
+      fragColor = vec4(invalid, p.a);
+      return;
+    }
+    depth = fx * abs(baseline) / disparity;
+  }
+
+  // move the point along its ray
+  fragColor = vec4(point * (depth / point.x), p.a);
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// rendered image in linear color space
+uniform sampler2D colorTexture;
+
+// state of each pixel after the previous frame:
+// x = reference log intensity
+// y = log intensity of the previous frame
+// z = time of the last event relative to the end of the previous frame
+uniform sampler2D stateTexture;
+
+// contrast thresholds in log intensity
+uniform float positiveThreshold;
+uniform float negativeThreshold;
+
+// standard deviation of the threshold noise
+uniform float thresholdNoise;
+
+// minimum time between two events of a pixel in seconds
+uniform float refractoryPeriod;
+
+// time elapsed since the previous frame in seconds
+uniform float frameTime;
+
+// 1 if there is no previous frame and the state has to be initialized
+uniform float initialize;
+
+// random offsets used to sample the threshold noise, see
+// gaussian_noise_fs.glsl
+uniform vec3 offsets;
+
+// events of this frame:
+// x = signed event count, positive for ON events
+// y = time of the first event as a fraction of the frame time
+// z = time between two events as a fraction of the frame time
+layout(location = 0) out vec4 events;
+
+// state of each pixel after this frame, same layout as stateTexture
+layout(location = 1) out vec4 state;
+
+#define PI 3.14159265358979323846264
+
+// avoids the log of black pixels
+const float kEpsilon = 1e-3;
+
+// smallest threshold after adding noise
+const float kMinThreshold = 0.01;
+
+// time of the last event of pixels that never fired
+const float kNoEvent = -1e9;
+
+float rand(vec2 co)
+{
+  // see gaussian_noise_fs.glsl
+  float r = fract(sin(dot(co.xy, vec2(12.9898,78.233))) * 43758.5453);
+  if(r == 0.0)
+    return 0.000000000001;
+  else
+    return r;
+}
+
+float gaussrand(vec2 co)
+{
+  // Box-Muller method
+  float U = rand(co + vec2(offsets.x, offsets.x));
+  float V = rand(co + vec2(offsets.y, offsets.y));
+  return sqrt(-2.0 * log(U)) * cos(2.0 * PI * V);
+}
+
+void main()
+{
+  vec3 color = texture(colorTexture, inPs.uv0).rgb;
+  float luminance = dot(color, vec3(0.2126, 0.7152, 0.0722));
+  float logI = log(luminance + kEpsilon);
+
+  events = vec4(0.0);
+  if (initialize > 0.5)
+  {
+    state = vec4(logI, logI, kNoEvent, 0.0);
+    return;
+  }
+
+  vec4 prev = texture(stateTexture, inPs.uv0);
+  float ref = prev.x;
+  float prevLogI = prev.y;
+  float lastEvent = max(prev.z - frameTime, kNoEvent);
+  state = vec4(ref, logI, lastEvent, 0.0);
+
+  float delta = logI - ref;
+  float polarity = delta >= 0.0 ? 1.0 : -1.0;
+  float threshold = polarity > 0.0 ? positiveThreshold : negativeThreshold;
+  threshold = max(threshold + thresholdNoise * gaussrand(inPs.uv0),
+      kMinThreshold);
+
+  float crossings = floor(abs(delta) / threshold);
+  if (crossings < 1.0)
+    return;
+
+  // the reference moves by every crossing, including the ones that are not
+  // reported because of the refractory period
+  state.x = ref + polarity * crossings * threshold;
+
+  // The log intensity is interpolated linearly between the two frames, so
+  // the crossings are evenly spaced in time. Crossings that can not be
+  // placed between the frames happen at the end of the frame.
+  float change = (logI - prevLogI) * polarity;
+  float first = 1.0;
+  float step = 0.0;
+  if (change > 0.0)
+  {
+    step = threshold / change;
+    first = clamp(((ref - prevLogI) * polarity + threshold) / change,
+        0.0, 1.0);
+    if (crossings > 1.0)
+      step = min(step, (1.0 - first) / (crossings - 1.0));
+  }
+
+  // skip the crossings that happen too early after the last event, and
+  // keep one of every stride crossings so that consecutive events are at
+  // least a refractory period apart
+  float dt = max(frameTime, 1e-9);
+  float skip = 0.0;
+  float stride = 1.0;
+  if (refractoryPeriod > 0.0)
+  {
+    float earliest = 1.0 + (lastEvent + refractoryPeriod) / dt;
+    if (step > 0.0)
+    {
+      skip = max(ceil((earliest - first) / step), 0.0);
+      stride = max(ceil(refractoryPeriod / (step * dt)), 1.0);
+    }
+    else
+    {
+      skip = first < earliest ? crossings : 0.0;
+      stride = crossings;
+    }
+  }
+
+  if (skip >= crossings)
+    return;
+
+  float count = floor((crossings - 1.0 - skip) / stride) + 1.0;
+  first += skip * step;
+  step *= stride;
+  events = vec4(polarity * count, first, step, 0.0);
+  state.z = (first + (count - 1.0) * step - 1.0) * dt;
+}
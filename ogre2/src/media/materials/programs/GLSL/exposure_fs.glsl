@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+// Applies exposure and tone mapping to the input image. Values sampled from
+// the sRGB render target are linear.
+
+uniform sampler2D RT;
+// average log luminance is stored in the last mip level
+uniform sampler2D luminance;
+
+// exposure factor from exposure compensation
+uniform float exposure;
+uniform int autoExposure;
+uniform float keyValue;
+uniform float minExposure;
+uniform float maxExposure;
+// 0: none, 1: Reinhard, 2: ACES. See ToneMappingType
+uniform int toneMapping;
+uniform float luminanceLod;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+// Filmic curve fitted to the ACES reference rendering transform by
+// Krzysztof Narkowicz
+vec3 aces(vec3 x)
+{
+  return (x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14);
+}
+
+void main()
+{
+  vec4 color = texture(RT, inPs.uv0);
+
+  float e = exposure;
+  if (autoExposure != 0)
+  {
+    float avgLum = exp(textureLod(luminance, vec2(0.5, 0.5), luminanceLod).r);
+    e *= clamp(keyValue / max(avgLum, 1e-4), minExposure, maxExposure);
+  }
+
+  vec3 c = color.rgb * e;
+  if (toneMapping == 1)
+    c = c / (1.0 + c);
+  else if (toneMapping == 2)
+    c = aces(c);
+
+  fragColor = vec4(clamp(c, 0.0, 1.0), color.a);
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+// Writes the log luminance of the input image. The result is averaged by
+// generating mipmaps of the output texture, see Ogre2ExposurePass.
+
+uniform sampler2D RT;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+void main()
+{
+  vec3 color = texture(RT, inPs.uv0).rgb;
+  float lum = dot(color, vec3(0.2126, 0.7152, 0.0722));
+  // small offset avoids log(0) for black pixels
+  fragColor = vec4(log(lum + 1e-4), 0.0, 0.0, 1.0);
+}
@@ -41,6 +41,27 @@ uniform float particleScatterRatio;
 // rnd is a random number in the range of [0-1]
 uniform float rnd;
 
+// participating media params, see participating_media_fs.glsl
+uniform vec4 mediaExtinction;
+uniform vec4 mediaUp;
+uniform float mediaFalloff;
+
+// precipitation params, see precipitation_fs.glsl
+uniform vec4 precipScatter;
+uniform vec4 precipUp;
+
+// physical intensity model, see GpuRays::SetIntensityModel.
+// x: 1 if enabled, y: scale, z: reference range, w: range exponent
+uniform vec4 intensityParams;
+
+// cosine of the entrance angle beyond which retroreflectors stop reflecting
+// the beam back to the sensor (60 degrees)
+const float cosMaxEntranceAngle = 0.5;
+
+// returns whose two-way transmittance through participating media falls
+// below this value are too weak to be detected
+const float minMediaTransmittance = 0.01;
+
 // see gaussian_noise_fs.glsl for documentation on the rand and gaussrand
 // functions
 
@@ -70,6 +91,26 @@ vec4 gaussrand(vec2 co, vec3 offsets, float stddev, float mean)
   return vec4(Z, Z, Z, 0.0);
 }
 
+// see participating_media_fs.glsl for documentation on the media
+// functions
+
+float mediaHeightIntegral(float z)
+{
+  if (z <= 0.0 || mediaFalloff <= 0.0)
+    return z;
+  return (1.0 - exp(-mediaFalloff * z)) / mediaFalloff;
+}
+
+float mediaDensityLength(vec3 viewPos)
+{
+  float l = length(viewPos);
+  float z0 = mediaUp.w;
+  float z1 = z0 + dot(viewPos, mediaUp.xyz);
+  if (abs(z1 - z0) < 1e-4)
+    return l * (z0 <= 0.0 ? 1.0 : exp(-mediaFalloff * z0));
+  return l * (mediaHeightIntegral(z1) - mediaHeightIntegral(z0)) / (z1 - z0);
+}
+
 void main()
 {
   // get linear depth
@@ -77,7 +118,8 @@ void main()
   float d = projectionParams.y / (fDepth - projectionParams.x);
 
   // get retro
-  float retro = texture(colorTexture, inPs.uv0).x * 2000.0;
+  vec4 surface = texture(colorTexture, inPs.uv0);
+  float retro = surface.x * 2000.0;
 
   // reconstruct 3d viewspace pos from depth
   vec3 viewSpacePos = inPs.cameraDir * d;
@@ -85,6 +127,26 @@ void main()
   // get length of 3d point, i.e.range
   float l = length(viewSpacePos);
 
+  // in the physical intensity model the colorTexture holds the reflectance,
+  // the retroreflectivity and the cosine of the incidence angle of the
+  // surface, see laser_reflectance_fs.glsl
+  if (intensityParams.x > 0.5)
+  {
+    float cosIncidence = surface.z;
+    float retroreflection = surface.y * 2000.0 *
+        clamp((cosIncidence - cosMaxEntranceAngle) /
+        (1.0 - cosMaxEntranceAngle), 0.0, 1.0);
+    // the built-in max() is hidden by the max uniform
+    float falloff = pow(intensityParams.z / (l > 1e-3 ? l : 1e-3),
+        intensityParams.w);
+    retro = intensityParams.y *
+        (surface.x * cosIncidence + retroreflection) * falloff;
+  }
+
+  // surface normal, for the wetness of the surface. Derivatives are only
+  // defined outside of branches.
+  vec3 normal = cross(dFdx(viewSpacePos), dFdy(viewSpacePos));
+
   // particle mask - color and depth
   vec4 particle = texture(particleTexture, inPs.uv0);
   float particleDepth = texture(particleDepthTexture, inPs.uv0).x;
@@ -121,6 +183,57 @@ void main()
     }
   }
 
+  // attenuate the return by the participating media on the way to the
+  // hit point and back
+  if (mediaExtinction.w > 0.0 && l <= far)
+  {
+    vec3 hitPos = normalize(inPs.cameraDir) * l;
+    float transmittance =
+        exp(-2.0 * mediaExtinction.w * mediaDensityLength(hitPos));
+    retro *= transmittance;
+    if (transmittance < minMediaTransmittance)
+      l = far + 1.0;
+  }
+
+  if (precipScatter.x > 0.0)
+  {
+    if (l <= far)
+    {
+      // the water film on wet surfaces that face up reflects the beam
+      // away from the sensor
+      if (dot(normal, normal) > 0.0)
+      {
+        normal = normalize(normal);
+        if (dot(normal, viewSpacePos) > 0.0)
+          normal = -normal;
+        float facingUp = clamp(dot(normal, precipUp.xyz), 0.0, 1.0);
+        retro *= 1.0 - 0.5 * precipScatter.z * facingUp;
+      }
+
+      // the particles attenuate the beam on the way to the hit point and
+      // back. The weaker the return the more likely it is lost in noise.
+      float transmittance = exp(-2.0 * precipScatter.x * l);
+      retro *= transmittance;
+      if (rand(inPs.uv0 + vec2(precipUp.w, 0.37)) > transmittance)
+        l = far + 1.0;
+    }
+
+    // the distance to the first particle along the beam follows an
+    // exponential distribution. Its return is detected with a probability
+    // that decays with the squared range beyond the detection range.
+    float u = rand(inPs.uv0 + vec2(precipUp.w, 0.71));
+    float s = -log(u) / precipScatter.x;
+    // the built-in min() is hidden by the min uniform
+    float detection = pow(precipScatter.y / s, 2.0);
+    float visibleRange = l < far ? l : far;
+    if (s < visibleRange && s >= near &&
+        rand(inPs.uv0 + vec2(0.53, precipUp.w)) < detection)
+    {
+      l = s;
+      retro = precipScatter.w;
+    }
+  }
+
   if (l > far)
     l = max;
   else if (l < near)
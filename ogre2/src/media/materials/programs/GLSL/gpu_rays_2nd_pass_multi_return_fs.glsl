@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// cubeUVTex packs information needed to sample from tex0-5.
+// Each ray owns a FOOTPRINT_SIZE x FOOTPRINT_SIZE block of texels that
+// sample its beam footprint. See gpu_rays_2nd_pass_fs.glsl for the layout
+// of a texel and the cubemap faces
+uniform sampler2D cubeUVTex;
+
+uniform sampler2D tex0;
+uniform sampler2D tex1;
+uniform sampler2D tex2;
+uniform sampler2D tex3;
+uniform sampler2D tex4;
+uniform sampler2D tex5;
+
+// number of rays in the horizontal and vertical direction
+uniform vec2 rangeCount;
+
+// number of echoes written for each ray, one texel per echo
+uniform float returnCount;
+
+// 0: first, 1: last, 2: strongest, 3: all. See LidarReturnMode
+uniform float returnMode;
+
+// min range difference between two distinct echoes
+uniform float separation;
+
+uniform float near;
+uniform float far;
+uniform float max;
+
+out vec4 fragColor;
+
+#define FOOTPRINT_SIZE 3
+#define SAMPLE_COUNT 9
+
+vec2 getRange(vec2 uv, sampler2D tex)
+{
+  vec2 range = texture(tex, uv).xy;
+  return range;
+}
+
+vec2 sampleCubemap(vec3 data)
+{
+  // which face to sample range data from
+  float faceIdx = data.z;
+
+  // uv coordinates on texture that stores the range data
+  vec2 uv = data.xy;
+
+  vec2 d = vec2(0.0, 0.0);
+  if (faceIdx == 0)
+    d = getRange(uv, tex0);
+  else if (faceIdx == 1)
+    d = getRange(uv, tex1);
+  else if (faceIdx == 2)
+    d = getRange(uv, tex2);
+  else if (faceIdx == 3)
+    d = getRange(uv, tex3);
+  else if (faceIdx == 4)
+    d = getRange(uv, tex4);
+  else if (faceIdx == 5)
+    d = getRange(uv, tex5);
+  return d;
+}
+
+void main()
+{
+  // ray and echo written by this fragment
+  int echoCountPerRay = int(returnCount);
+  int column = int(inPs.uv0.x * rangeCount.x * returnCount);
+  int ray = column / echoCountPerRay;
+  int echo = column - ray * echoCountPerRay;
+  int row = int(inPs.uv0.y * rangeCount.y);
+
+  // sample the beam footprint and sort the hits by range
+  float ranges[SAMPLE_COUNT];
+  float retros[SAMPLE_COUNT];
+  int hitCount = 0;
+  vec2 center = vec2(max, 0.0);
+  for (int j = 0; j < FOOTPRINT_SIZE; ++j)
+  {
+    for (int i = 0; i < FOOTPRINT_SIZE; ++i)
+    {
+      ivec2 texel = ivec2(ray * FOOTPRINT_SIZE + i, row * FOOTPRINT_SIZE + j);
+      vec2 d = sampleCubemap(texelFetch(cubeUVTex, texel, 0).xyz);
+      if (i == FOOTPRINT_SIZE / 2 && j == FOOTPRINT_SIZE / 2)
+        center = d;
+
+      // out of range samples, i.e. clamped or +/-inf, are not hits
+      if (!(d.x > near && d.x < far))
+        continue;
+
+      int k = hitCount;
+      while (k > 0 && ranges[k - 1] > d.x)
+      {
+        ranges[k] = ranges[k - 1];
+        retros[k] = retros[k - 1];
+        --k;
+      }
+      ranges[k] = d.x;
+      retros[k] = d.y;
+      ++hitCount;
+    }
+  }
+
+  // group hits into echoes. A new echo starts when the gap to the previous
+  // hit is larger than the separation
+  float echoRange[SAMPLE_COUNT];
+  float echoRetro[SAMPLE_COUNT];
+  float echoSamples[SAMPLE_COUNT];
+  int echoCount = 0;
+  for (int s = 0; s < hitCount; ++s)
+  {
+    if (s == 0 || ranges[s] - ranges[s - 1] > separation)
+    {
+      echoRange[echoCount] = 0.0;
+      echoRetro[echoCount] = 0.0;
+      echoSamples[echoCount] = 0.0;
+      ++echoCount;
+    }
+    echoRange[echoCount - 1] += ranges[s];
+    echoRetro[echoCount - 1] += retros[s];
+    echoSamples[echoCount - 1] += 1.0;
+  }
+
+  // select the echo to output
+  int mode = int(returnMode);
+  int idx = -1;
+  if (echoCount > 0)
+  {
+    if (mode == 0)
+    {
+      idx = 0;
+    }
+    else if (mode == 1)
+    {
+      idx = echoCount - 1;
+    }
+    else if (mode == 2)
+    {
+      idx = 0;
+      for (int e = 1; e < echoCount; ++e)
+      {
+        if (echoRetro[e] > echoRetro[idx])
+          idx = e;
+      }
+    }
+    else if (echo < echoCount)
+    {
+      idx = echo;
+    }
+  }
+
+  if (idx >= 0)
+  {
+    // range is the mean range of the echo samples, intensity is the
+    // retro value weighted by the fraction of the footprint that hit
+    fragColor = vec4(echoRange[idx] / echoSamples[idx],
+        echoRetro[idx] / float(SAMPLE_COUNT),
+        echoSamples[idx] / float(SAMPLE_COUNT), 1.0);
+  }
+  else if (echo == 0)
+  {
+    // no hit, output the center of the beam as in single return mode
+    fragColor = vec4(center.x, 0.0, 0.0, 1.0);
+  }
+  else
+  {
+    fragColor = vec4(max, 0.0, 0.0, 1.0);
+  }
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// In rolling scan mode, each texel of cubeUVTex packs the direction of a ray
+// in the cubemap frame (xyz) and the time of the ray as a fraction of the
+// scan duration (w). See gpu_rays_2nd_pass_fs.glsl for the cubemap faces
+uniform sampler2D cubeUVTex;
+
+uniform sampler2D tex0;
+uniform sampler2D tex1;
+uniform sampler2D tex2;
+uniform sampler2D tex3;
+uniform sampler2D tex4;
+uniform sampler2D tex5;
+
+// pose of the sensor at the start and end of the scan relative to the pose
+// the cubemap is rendered from, in the sensor frame (x forward, z up).
+// Rotations are quaternions stored as (x, y, z, w)
+uniform vec4 startRot;
+uniform vec3 startPos;
+uniform vec4 endRot;
+uniform vec3 endPos;
+
+// scan duration in seconds
+uniform float duration;
+
+uniform float near;
+uniform float far;
+uniform float min;
+uniform float max;
+
+out vec4 fragColor;
+
+// number of iterations used to find the range along a ray that does not
+// start at the cubemap origin
+#define ITERATIONS 3
+
+vec3 toSensorFrame(vec3 v)
+{
+  return vec3(v.z, -v.x, v.y);
+}
+
+vec3 toCubemapFrame(vec3 v)
+{
+  return vec3(-v.y, v.z, v.x);
+}
+
+vec3 rotate(vec4 q, vec3 v)
+{
+  vec3 t = 2.0 * cross(q.xyz, v);
+  return v + q.w * t + cross(q.xyz, t);
+}
+
+vec4 slerp(vec4 q0, vec4 q1, float t)
+{
+  float d = dot(q0, q1);
+  // take the shortest path
+  if (d < 0.0)
+  {
+    q1 = -q1;
+    d = -d;
+  }
+  // use linear interpolation for nearly identical rotations
+  if (d > 0.9995)
+    return normalize(mix(q0, q1, t));
+  float theta = acos(d);
+  return (sin((1.0 - t) * theta) * q0 + sin(t * theta) * q1) / sin(theta);
+}
+
+// see Ogre2GpuRays::SampleCubemap
+vec2 sampleCubemap(vec3 v)
+{
+  vec3 vAbs = abs(v);
+  float faceIdx;
+  float ma;
+  vec2 uv;
+  if (vAbs.z >= vAbs.x && vAbs.z >= vAbs.y)
+  {
+    faceIdx = v.z < 0.0 ? 5.0 : 4.0;
+    ma = 0.5 / vAbs.z;
+    uv = vec2(v.z < 0.0 ? -v.x : v.x, -v.y);
+  }
+  else if (vAbs.y >= vAbs.x)
+  {
+    faceIdx = v.y < 0.0 ? 3.0 : 2.0;
+    ma = 0.5 / vAbs.y;
+    uv = vec2(v.x, v.y < 0.0 ? -v.z : v.z);
+  }
+  else
+  {
+    faceIdx = v.x < 0.0 ? 1.0 : 0.0;
+    ma = 0.5 / vAbs.x;
+    uv = vec2(v.x < 0.0 ? v.z : -v.z, -v.y);
+  }
+  uv = uv * ma + 0.5;
+
+  vec2 d = vec2(0.0, 0.0);
+  if (faceIdx == 0)
+    d = texture(tex0, uv).xy;
+  else if (faceIdx == 1)
+    d = texture(tex1, uv).xy;
+  else if (faceIdx == 2)
+    d = texture(tex2, uv).xy;
+  else if (faceIdx == 3)
+    d = texture(tex3, uv).xy;
+  else if (faceIdx == 4)
+    d = texture(tex4, uv).xy;
+  else if (faceIdx == 5)
+    d = texture(tex5, uv).xy;
+  return d;
+}
+
+void main()
+{
+  vec4 data = texture(cubeUVTex, inPs.uv0);
+  float t = data.w;
+
+  // ray origin and direction at the time the ray is measured, relative to
+  // the pose the cubemap is rendered from
+  vec4 q = slerp(startRot, endRot, t);
+  vec3 origin = toCubemapFrame(mix(startPos, endPos, t));
+  vec3 dir = toCubemapFrame(rotate(q, toSensorFrame(data.xyz)));
+
+  // the cubemap stores ranges from its origin. Find the range along the ray
+  // by repeatedly looking up the surface in the direction of the current
+  // estimate of the hit point
+  vec2 d = sampleCubemap(dir);
+  float range = d.x;
+  for (int i = 0; i < ITERATIONS; ++i)
+  {
+    if (!(d.x > near && d.x < far))
+      break;
+    vec3 p = origin + dir * range;
+    vec3 pDir = normalize(p);
+    d = sampleCubemap(pDir);
+    range = dot(pDir * d.x - origin, dir);
+  }
+
+  if (!(d.x > near && d.x < far))
+    range = d.x;
+  else if (range > far)
+    range = max;
+  else if (range < near)
+    range = min;
+
+  fragColor = vec4(range, d.y, t * duration, 1.0);
+}
@@ -38,6 +38,9 @@ uniform float maxTemp = 100.0;
 uniform int bitDepth;
 uniform float resolution;
 
+// emissivity of the surface, encoded as (1 - emissivity) in the blue channel
+uniform float emissivity = 1.0;
+
 // map a temperature from the [min, max] range to the user defined
 // [minTemp, maxTemp] range
 float mapNormalized(float num)
@@ -50,7 +53,7 @@ void main()
 {
   float heat = texture(RT, inPs.uv0.xy).x;
 
-  // set g, b, a to 0. This will be used by thermal_camera_fs.glsl to determine
+  // set g, a to 0. This will be used by thermal_camera_fs.glsl to determine
   // if a particular fragment is a heat source or not
-  fragColor = vec4(mapNormalized(heat), 0, 0, 0.0);
+  fragColor = vec4(mapNormalized(heat), 0, 1.0 - emissivity, 0.0);
 }
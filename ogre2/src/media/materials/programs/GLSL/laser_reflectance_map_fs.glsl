@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#version 330
+
+// Same as laser_reflectance_fs.glsl but reads the reflectance from the red
+// channel of a texture
+
+in block
+{
+  vec3 viewPos;
+  vec3 viewNormal;
+  vec2 uv0;
+} inPs;
+
+// reflectance map, set programmatically
+uniform sampler2D reflectanceMap;
+
+// y: retroreflectivity / 2000. Set per sub item
+uniform vec4 inReflectance;
+
+out vec4 fragColor;
+
+float cosIncidence()
+{
+  vec3 n = inPs.viewNormal;
+  if (dot(n, n) < 1e-12)
+    return 1.0;
+  return abs(dot(normalize(n), normalize(inPs.viewPos)));
+}
+
+void main()
+{
+  float reflectance = texture(reflectanceMap, inPs.uv0).x;
+  fragColor = vec4(reflectance, inReflectance.y, cosIncidence(), 1.0);
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#version 330
+
+// Vertex shader of the materials used by gpu rays to render the near infrared
+// reflectance of the surfaces, see laser_reflectance_fs.glsl
+
+in vec4 vertex;
+in vec3 normal;
+in vec2 uv0;
+
+uniform mat4 worldViewProj;
+uniform mat4 worldView;
+uniform mat4 worldViewIT;
+uniform float ignMinClipDistance;
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+  float gl_ClipDistance[1];
+};
+
+out block
+{
+  vec3 viewPos;
+  vec3 viewNormal;
+  vec2 uv0;
+} outVs;
+
+void main()
+{
+  gl_Position = worldViewProj * vertex;
+  outVs.viewPos = (worldView * vertex).xyz;
+  outVs.viewNormal = mat3(worldViewIT) * normal;
+  outVs.uv0 = uv0;
+
+  // see plain_color_vs.glsl
+  if (ignMinClipDistance > 0.0)
+    gl_ClipDistance[0] = length(outVs.viewPos) - ignMinClipDistance;
+  else
+    gl_ClipDistance[0] = 1.0;
+}
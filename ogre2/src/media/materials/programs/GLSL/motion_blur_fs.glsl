@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+uniform sampler2D RT;
+
+// maps clip space positions of the current frame to the previous frame
+uniform mat4 reprojection;
+// fraction of the time between frames the shutter is open
+uniform float exposureFraction;
+uniform int sampleCount;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+// Image motion of a pixel since the previous frame
+vec2 motion(vec2 uv)
+{
+  vec4 clip = reprojection *
+      vec4(uv.x * 2.0 - 1.0, 1.0 - uv.y * 2.0, 0.5, 1.0);
+  // point was behind the camera in the previous frame
+  if (clip.w <= 0.0)
+    return vec2(0.0, 0.0);
+  vec2 ndc = clip.xy / clip.w;
+  vec2 prevUv = vec2(ndc.x * 0.5 + 0.5, 0.5 - ndc.y * 0.5);
+  return uv - prevUv;
+}
+
+void main()
+{
+  // the shutter closes at the time of the current frame, so average
+  // along the path the pixel took while the shutter was open
+  vec2 m = motion(inPs.uv0) * exposureFraction;
+  vec4 color = vec4(0.0);
+  for (int i = 0; i < sampleCount; ++i)
+  {
+    float t = (sampleCount > 1) ? float(i) / float(sampleCount - 1) : 0.0;
+    color += texture(RT, inPs.uv0 - m * t);
+  }
+  fragColor = color / float(sampleCount);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#version 330
+
+// Writes the surface normal in the camera frame, octahedral-encoded into the
+// rg channels, and the material id into the b channel. The encoding must
+// match encodeOctahedralNormal() in Utils.cc
+
+in block
+{
+  vec3 viewPos;
+  vec3 viewNormal;
+} inPs;
+
+// Material id divided by 65535, set per sub item
+uniform vec4 materialId;
+
+out vec4 fragColor;
+
+vec2 signNotZero(vec2 v)
+{
+  return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+vec2 octahedralEncode(vec3 n)
+{
+  vec2 p = n.xy / (abs(n.x) + abs(n.y) + abs(n.z));
+  if (n.z < 0.0)
+    p = (1.0 - abs(p.yx)) * signNotZero(p);
+  return p * 0.5 + 0.5;
+}
+
+void main()
+{
+  // geometry without normals, e.g. lines, faces the camera
+  vec3 n = inPs.viewNormal;
+  if (length(n) < 1e-6)
+    n = -inPs.viewPos;
+  n = normalize(n);
+
+  // normals of back faces point away from the camera
+  if (dot(n, inPs.viewPos) > 0.0)
+    n = -n;
+
+  // convert from the ogre view frame (x right, y up, z backward) to the
+  // camera frame (x forward, y left, z up)
+  vec3 cameraNormal = vec3(-n.z, -n.x, n.y);
+
+  fragColor = vec4(octahedralEncode(cameraNormal), materialId.x, 1.0);
+}
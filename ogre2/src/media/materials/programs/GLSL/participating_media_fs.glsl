@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+uniform sampler2D RT;
+uniform sampler2D depthTexture;
+
+// linearizes the depth buffer into view space depth
+uniform vec2 projectionParams;
+// inverse of the x and y scale of the projection matrix
+uniform vec2 invProjectionScale;
+
+// Participating media params shared by the camera, lidar and thermal
+// shaders (see Ogre2ParticipatingMedia)
+// extinction coefficients of the red, green, blue channels and infrared
+uniform vec4 mediaExtinction;
+// color of the light scattered towards the camera by infinitely deep media
+uniform vec3 mediaInscatter;
+// world up direction in view space, camera height above the base height
+uniform vec4 mediaUp;
+// rate at which the media density decays above the base height
+uniform float mediaFalloff;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+// Density integrated from the base height up to a height relative to it.
+// The density is uniform below the base height and decays exponentially
+// above it.
+float mediaHeightIntegral(float z)
+{
+  if (z <= 0.0 || mediaFalloff <= 0.0)
+    return z;
+  return (1.0 - exp(-mediaFalloff * z)) / mediaFalloff;
+}
+
+// Length of media at full density that is equivalent to the media between
+// the camera and a point in view space
+float mediaDensityLength(vec3 viewPos)
+{
+  float l = length(viewPos);
+  float z0 = mediaUp.w;
+  float z1 = z0 + dot(viewPos, mediaUp.xyz);
+  if (abs(z1 - z0) < 1e-4)
+    return l * (z0 <= 0.0 ? 1.0 : exp(-mediaFalloff * z0));
+  return l * (mediaHeightIntegral(z1) - mediaHeightIntegral(z0)) / (z1 - z0);
+}
+
+void main()
+{
+  vec4 color = texture(RT, inPs.uv0);
+
+  // reconstruct view space position from depth. The background is at the
+  // far plane so it fades into the media like distant objects.
+  float fDepth = texture(depthTexture, inPs.uv0).x;
+  float d = projectionParams.y / (fDepth - projectionParams.x);
+  vec2 ndc = vec2(inPs.uv0.x * 2.0 - 1.0, 1.0 - inPs.uv0.y * 2.0);
+  vec3 viewPos = vec3(ndc * invProjectionScale * d, -d);
+
+  // Beer-Lambert attenuation of the light reflected by the object and
+  // light scattered in by the media along the view ray
+  vec3 transmittance = exp(-mediaExtinction.rgb * mediaDensityLength(viewPos));
+  color.rgb = color.rgb * transmittance +
+      mediaInscatter * (vec3(1.0) - transmittance);
+
+  fragColor = color;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+uniform sampler2D RT;
+uniform sampler2D depthTexture;
+
+// linearizes the depth buffer into view space depth
+uniform vec2 projectionParams;
+// inverse of the x and y scale of the projection matrix
+uniform vec2 invProjectionScale;
+// distance to the far clip plane, where the background is
+uniform float farPlane;
+
+// Precipitation params shared by the camera and lidar shaders (see
+// Ogre2Precipitation)
+// extinction coefficient (1/m), range up to which lidars detect the
+// particles (m), wetness of upward facing surfaces, laser retro of the
+// particles
+uniform vec4 precipScatter;
+// particle radius (m), streak length (m), particle opacity, fraction of
+// the cells of a layer that hold a particle
+uniform vec4 precipParticle;
+// particle velocity in world frame (m/s), scene time (s)
+uniform vec4 precipVelocity;
+// world up direction in view space, random seed in [0, 1]
+uniform vec4 precipUp;
+// world x axis in view space
+uniform vec3 precipEast;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+// color of the light scattered by the particles towards the camera
+const vec3 precipColor = vec3(0.8);
+
+// the particles are laid out in layers around the camera whose radius
+// doubles from one layer to the next
+const int precipLayers = 4;
+const float precipNearRadius = 1.0;
+
+float rand(vec2 co)
+{
+  return fract(sin(dot(co, vec2(12.9898, 78.233))) * 43758.5453);
+}
+
+// Fraction of a pixel covered by the particles of a layer. The particles
+// of a layer lie on a vertical cylinder around the camera, one in each
+// occupied cell of a grid on the cylinder surface. The grid is sheared
+// along the particle velocity so that the particles only move vertically
+// in grid coordinates.
+// worldDir: view ray in world frame, radius: layer radius (m), dist:
+// distance to the object seen in the pixel (m), pixelAngle: angle covered
+// by the pixel (rad), seed: offset that decorrelates the layers
+float precipLayer(vec3 worldDir, float radius, float dist, float pixelAngle,
+    float seed)
+{
+  float horizontal = length(worldDir.xy);
+  if (horizontal < 1e-3)
+    return 0.0;
+
+  // particles behind the object seen in the pixel are hidden
+  float t = radius / horizontal;
+  if (t > dist)
+    return 0.0;
+
+  // arc length and height of the ray on the cylinder surface
+  float azimuth = atan(worldDir.y, worldDir.x);
+  vec2 pos = vec2(azimuth * radius, worldDir.z * t);
+
+  // shear and scroll the grid with the particle velocity
+  vec3 velocity = precipVelocity.xyz;
+  float vt = dot(velocity.xy, vec2(-sin(azimuth), cos(azimuth)));
+  float vz = min(velocity.z, -0.1);
+  pos.x -= pos.y * vt / vz;
+  pos.y -= vz * precipVelocity.w;
+
+  // cells grow with the layer radius so that all layers have a similar
+  // density on screen, and are longer than the streaks
+  float streak = precipParticle.y;
+  vec2 cell = vec2(0.02, 0.05) * radius;
+  cell.y = max(cell.y, 2.0 * streak);
+
+  vec2 g = pos / cell;
+  vec2 id = floor(g);
+  vec2 key = mod(id, 1024.0) + vec2(seed);
+  if (rand(key) >= precipParticle.w)
+    return 0.0;
+
+  // distance from the pixel to the streak left by the particle
+  vec2 center = 0.25 + 0.5 * vec2(rand(key + 0.31), rand(key + 0.67));
+  vec2 offset = (g - id - center) * cell;
+  float along = max(abs(offset.y) - 0.5 * streak, 0.0);
+  float d = length(vec2(offset.x, along));
+
+  // particles are usually thinner than a pixel. Spread them over a pixel
+  // and reduce their coverage accordingly
+  float radiusPx = max(precipParticle.x, 0.5 * t * pixelAngle);
+  float coverage = 1.0 - smoothstep(0.5 * radiusPx, radiusPx, d);
+  return coverage * precipParticle.x / radiusPx;
+}
+
+void main()
+{
+  vec4 color = texture(RT, inPs.uv0);
+
+  // reconstruct view space position from depth
+  float fDepth = texture(depthTexture, inPs.uv0).x;
+  float d = projectionParams.y / (fDepth - projectionParams.x);
+  vec2 ndc = vec2(inPs.uv0.x * 2.0 - 1.0, 1.0 - inPs.uv0.y * 2.0);
+  vec3 viewPos = vec3(ndc * invProjectionScale * d, -d);
+  float dist = length(viewPos);
+  vec3 viewDir = viewPos / dist;
+
+  // derivatives are only defined outside of branches
+  vec3 normal = cross(dFdx(viewPos), dFdy(viewPos));
+  float pixelAngle = length(fwidth(viewDir));
+
+  // wet surfaces that face up are darker since the water film lets less
+  // light scatter back out of the surface
+  if (d < farPlane * 0.999 && dot(normal, normal) > 0.0)
+  {
+    normal = normalize(normal);
+    if (dot(normal, viewPos) > 0.0)
+      normal = -normal;
+    float facingUp = clamp(dot(normal, precipUp.xyz), 0.0, 1.0);
+    color.rgb *= 1.0 - 0.5 * precipScatter.z * facingUp;
+  }
+
+  // light from the object is scattered out of the view ray by the
+  // particles, which veil it with the light they scatter in
+  float transmittance = exp(-precipScatter.x * dist);
+  color.rgb = mix(precipColor, color.rgb, transmittance);
+
+  // particles of the layers, from the farthest to the nearest
+  vec3 north = cross(precipUp.xyz, precipEast);
+  vec3 worldDir = vec3(dot(viewDir, precipEast), dot(viewDir, north),
+      dot(viewDir, precipUp.xyz));
+  for (int i = precipLayers - 1; i >= 0; --i)
+  {
+    float radius = precipNearRadius * exp2(float(i));
+    float coverage = precipLayer(worldDir, radius, dist, pixelAngle,
+        float(i) * 7.31);
+    color.rgb = mix(color.rgb, precipColor, coverage * precipParticle.z);
+  }
+
+  fragColor = color;
+}
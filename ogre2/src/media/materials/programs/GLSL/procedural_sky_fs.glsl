@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Procedural sky based on the analytic daylight model of Preetham et al.
+// with the Rayleigh and Mie single scattering terms of Hoffman and
+// Preetham, "Rendering Outdoor Light Scattering in Real Time". The
+// scattering coefficients are computed on the CPU, see
+// BaseProceduralSky.hh, which also evaluates the same model to set the
+// sun light and ambient colors.
+
+#version 330
+
+in block
+{
+  vec3 cameraDir;
+} inPs;
+
+// unit vector pointing towards the sun in world frame (z up)
+uniform vec3 sunDirection;
+
+// total Rayleigh and Mie scattering coefficients
+uniform vec3 betaR;
+uniform vec3 betaM;
+
+// sun irradiance
+uniform float sunE;
+
+// Mie scattering phase function anisotropy
+uniform float mieG;
+
+// exposure used to map the scattered radiance to [0, 1]
+uniform float exposure;
+
+// fraction of the sky covered by clouds
+uniform float cloudCover;
+
+// offset of the cloud layer due to wind, in units of cloud height
+uniform vec2 cloudOffset;
+
+// linear color of the lit side of clouds and of the sun light
+uniform vec3 cloudColor;
+uniform vec3 sunColor;
+
+out vec4 fragColour;
+
+const float PI = 3.14159265358979323846;
+
+// optical length of the atmosphere at the zenith in meters
+const float rayleighZenithLength = 8.4e3;
+const float mieZenithLength = 1.25e3;
+
+// cosine of the angular radius of the sun disc
+const float sunAngularDiameterCos = 0.99995667694644844;
+
+float rayleighPhase(float _cosTheta)
+{
+  return 3.0 / (16.0 * PI) * (1.0 + _cosTheta * _cosTheta);
+}
+
+float henyeyGreensteinPhase(float _cosTheta, float _g)
+{
+  float g2 = _g * _g;
+  float inverse = 1.0 / pow(1.0 - 2.0 * _g * _cosTheta + g2, 1.5);
+  return 1.0 / (4.0 * PI) * ((1.0 - g2) * inverse);
+}
+
+float hash(vec2 _p)
+{
+  _p = fract(_p * vec2(123.34, 456.21));
+  _p += dot(_p, _p + 45.32);
+  return fract(_p.x * _p.y);
+}
+
+float valueNoise(vec2 _p)
+{
+  vec2 i = floor(_p);
+  vec2 f = fract(_p);
+  vec2 u = f * f * (3.0 - 2.0 * f);
+  return mix(mix(hash(i), hash(i + vec2(1.0, 0.0)), u.x),
+             mix(hash(i + vec2(0.0, 1.0)), hash(i + vec2(1.0, 1.0)), u.x),
+             u.y);
+}
+
+float fbm(vec2 _p)
+{
+  float value = 0.0;
+  float amplitude = 0.5;
+  for (int i = 0; i < 5; ++i)
+  {
+    value += amplitude * valueNoise(_p);
+    _p *= 2.03;
+    amplitude *= 0.5;
+  }
+  return value;
+}
+
+void main()
+{
+  vec3 dir = normalize(inPs.cameraDir);
+
+  // optical length of the view ray, the sky below the horizon is a
+  // continuation of the horizon
+  float zenithAngle = acos(max(0.0, dir.z));
+  float inverse = 1.0 / (cos(zenithAngle) + 0.15 *
+      pow(93.885 - zenithAngle * 180.0 / PI, -1.253));
+  float sR = rayleighZenithLength * inverse;
+  float sM = mieZenithLength * inverse;
+
+  // extinction
+  vec3 fex = exp(-(betaR * sR + betaM * sM));
+
+  // in-scattering
+  float cosTheta = dot(dir, sunDirection);
+  vec3 betaRTheta = betaR * rayleighPhase(cosTheta * 0.5 + 0.5);
+  vec3 betaMTheta = betaM * henyeyGreensteinPhase(cosTheta, mieG);
+  vec3 scatter = sunE * (betaRTheta + betaMTheta) / (betaR + betaM);
+  vec3 lin = pow(scatter * (1.0 - fex), vec3(1.5));
+  lin *= mix(vec3(1.0), pow(scatter * fex, vec3(0.5)),
+      clamp(pow(1.0 - sunDirection.z, 5.0), 0.0, 1.0));
+
+  // night sky and sun disc
+  vec3 l0 = vec3(0.1) * fex;
+  float sunDisc = smoothstep(sunAngularDiameterCos,
+      sunAngularDiameterCos + 0.00002, cosTheta);
+  l0 += sunE * 19000.0 * fex * sunDisc;
+
+  vec3 radiance = (lin + l0) * 0.04 + vec3(0.0, 0.0003, 0.00075);
+  vec3 color = 1.0 - exp(-exposure * radiance);
+
+  // cloud layer on a plane above the camera
+  if (cloudCover > 0.0 && dir.z > 0.01)
+  {
+    vec2 p = dir.xy / dir.z + cloudOffset;
+    float threshold = mix(0.75, 0.2, cloudCover);
+    float density = smoothstep(threshold, threshold + 0.2, fbm(p * 2.0)) *
+        smoothstep(0.01, 0.15, dir.z);
+    vec3 cloud = cloudColor + sunColor * 0.5 * pow(max(cosTheta, 0.0), 8.0);
+    color = mix(color, min(cloud, vec3(1.0)), density);
+  }
+
+  // the render target converts the linear color to sRGB
+  fragColour = vec4(color, 1.0);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+uniform sampler2D RT;
+
+// maps clip space positions of the current frame to the previous frame
+uniform mat4 reprojection;
+// fraction of the time between frames it takes to read out all rows
+uniform float readoutFraction;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+// Image motion of a pixel since the previous frame
+vec2 motion(vec2 uv)
+{
+  vec4 clip = reprojection *
+      vec4(uv.x * 2.0 - 1.0, 1.0 - uv.y * 2.0, 0.5, 1.0);
+  // point was behind the camera in the previous frame
+  if (clip.w <= 0.0)
+    return vec2(0.0, 0.0);
+  vec2 ndc = clip.xy / clip.w;
+  vec2 prevUv = vec2(ndc.x * 0.5 + 0.5, 0.5 - ndc.y * 0.5);
+  return uv - prevUv;
+}
+
+void main()
+{
+  // rows are read out from top to bottom and the bottom row is captured at
+  // the time of the current frame. Rows read out earlier see the scene
+  // from an orientation interpolated towards the previous frame.
+  float delay = readoutFraction * (1.0 - inPs.uv0.y);
+  fragColor = texture(RT, inPs.uv0 + motion(inPs.uv0) * delay);
+}
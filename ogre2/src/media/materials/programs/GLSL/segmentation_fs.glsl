@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#version 330
+
+// Writes the label color of the object. Pixels inside the projection box
+// of a labeled decal that face the decal get the label color of the decal
+// instead, so only the visible surfaces the decal is projected on are
+// labeled.
+
+#define MAX_LABEL_DECALS 16
+
+in block
+{
+  vec3 worldPos;
+  vec3 worldNormal;
+} inPs;
+
+uniform vec4 inColor;
+
+// world to unit box transforms and label colors of the labeled decals
+uniform int numDecals;
+uniform mat4 decalInvWorld[MAX_LABEL_DECALS];
+uniform vec4 decalColor[MAX_LABEL_DECALS];
+
+out vec4 fragColor;
+
+void main()
+{
+  fragColor = inColor;
+  for (int i = 0; i < numDecals; ++i)
+  {
+    mat4 m = decalInvWorld[i];
+    vec3 p = (m * vec4(inPs.worldPos, 1.0)).xyz;
+
+    // like ogre decals, skip the surfaces that look away from the Y axis
+    // of the box, which is the projection direction. Geometry without
+    // normals faces the decal.
+    vec3 decalDir = vec3(m[0][1], m[1][1], m[2][1]);
+    bool facing = dot(decalDir, inPs.worldNormal) > 0.0 ||
+        length(inPs.worldNormal) < 1e-6;
+
+    if (facing && all(lessThanEqual(abs(p), vec3(0.5))))
+      fragColor = decalColor[i];
+  }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+// Forms the beams of a sonar. Each output pixel is one range bin of one
+// beam and gathers the backscatter of the source pixels in that range bin,
+// weighted by the horizontal and vertical beam patterns and the solid angle
+// of the pixel, with spherical spreading and water absorption applied.
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// range in the r channel and backscatter in the g channel
+uniform sampler2D sourceTexture;
+
+uniform float beamCount;
+uniform float rangeBinCount;
+uniform float hfov;
+// tangents of half the horizontal and vertical field of view of the source
+uniform vec2 tanHalfFov;
+uniform float vfov;
+uniform float near;
+uniform float far;
+uniform float beamWidth;
+// absorption in dB/m
+uniform float attenuation;
+uniform float speckle;
+uniform vec3 offsets;
+
+out vec4 fragColor;
+
+// scales the argument of sinc^2 so that it is 0.5 at half the beam width
+const float kHalfPower = 1.39156;
+// columns further than this many beam widths from the beam axis are skipped,
+// which keeps the main lobe and the first side lobe
+const float kBeamSupport = 2.26;
+const int kMaxColumns = 512;
+
+float rand(vec2 co)
+{
+  float r = fract(sin(dot(co.xy, vec2(12.9898,78.233))) * 43758.5453);
+  if(r == 0.0)
+    return 0.000000000001;
+  else
+    return r;
+}
+
+float sinc2(float x)
+{
+  if (abs(x) < 1e-4)
+    return 1.0;
+  float s = sin(x) / x;
+  return s * s;
+}
+
+void main()
+{
+  ivec2 size = textureSize(sourceTexture, 0);
+  float beam = min(floor(inPs.uv0.x * beamCount), beamCount - 1.0);
+  float bin = min(floor(inPs.uv0.y * rangeBinCount), rangeBinCount - 1.0);
+
+  // beam 0 is on the left, i.e. at the largest azimuth
+  float beamAzimuth = 0.5 * hfov - (beam + 0.5) * hfov / beamCount;
+
+  float binSize = (far - near) / rangeBinCount;
+  float rMin = near + bin * binSize;
+  float rMax = rMin + binSize;
+
+  // columns within the support of the beam pattern. Azimuth is positive to
+  // the left while the x of the columns grows to the right
+  float support = kBeamSupport * beamWidth;
+  float azLeft = min(beamAzimuth + support, 0.5 * hfov);
+  float azRight = max(beamAzimuth - support, -0.5 * hfov);
+  float w = float(size.x);
+  float h = float(size.y);
+  int c0 = int(clamp(floor((-tan(azLeft) / tanHalfFov.x * 0.5 + 0.5) * w),
+      0.0, w - 1.0));
+  int c1 = int(clamp(ceil((-tan(azRight) / tanHalfFov.x * 0.5 + 0.5) * w),
+      0.0, w - 1.0));
+  c1 = min(c1, c0 + kMaxColumns - 1);
+
+  // area of a pixel on the image plane at a distance of 1
+  float pixelArea = 4.0 * tanHalfFov.x * tanHalfFov.y / (w * h);
+
+  float sum = 0.0;
+  for (int c = c0; c <= c1; ++c)
+  {
+    float x = ((float(c) + 0.5) / w * 2.0 - 1.0) * tanHalfFov.x;
+    float dAz = -atan(x) - beamAzimuth;
+    float horizontal = sinc2(kHalfPower * 2.0 * dAz / beamWidth);
+    for (int r = 0; r < size.y; ++r)
+    {
+      vec2 texel = texelFetch(sourceTexture, ivec2(c, r), 0).xy;
+      float range = texel.x;
+      if (range < rMin || range >= rMax || texel.y <= 0.0)
+        continue;
+
+      float y = (1.0 - (float(r) + 0.5) / h * 2.0) * tanHalfFov.y;
+      float elevation = atan(y, sqrt(1.0 + x * x));
+      float vertical = sinc2(kHalfPower * 2.0 * elevation / vfov);
+
+      float dist2 = 1.0 + x * x + y * y;
+      float solidAngle = pixelArea / (dist2 * sqrt(dist2));
+      float loss = pow(10.0, -0.2 * attenuation * range) / (range * range);
+      sum += texel.y * horizontal * vertical * solidAngle * loss;
+    }
+  }
+
+  // fully developed speckle has an exponentially distributed intensity
+  float u = rand(inPs.uv0 + offsets.xy);
+  sum *= mix(1.0, -log(u), speckle);
+
+  fragColor = vec4(sum, 0.0, 0.0, 1.0);
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+// Writes the range of each pixel in the r channel and its Lambertian
+// backscatter, i.e. the acoustic reflectivity times the cosine of the
+// incidence angle, in the g channel. Used by sonar sensors.
+
+in block
+{
+  vec3 viewPos;
+  vec3 viewNormal;
+} inPs;
+
+// acoustic reflectivity in the x component, set per sub item
+uniform vec4 reflectivity;
+
+out vec4 fragColor;
+
+void main()
+{
+  float range = length(inPs.viewPos);
+  vec3 toSensor = -inPs.viewPos / max(range, 1e-6);
+
+  // geometry without normals, e.g. lines, faces the sensor
+  vec3 n = inPs.viewNormal;
+  if (length(n) < 1e-6)
+    n = toSensor;
+  n = normalize(n);
+
+  // back faces scatter like front faces
+  float cosIncidence = abs(dot(n, toSensor));
+
+  fragColor = vec4(range, reflectivity.x * cosIncidence, 0.0, 1.0);
+}
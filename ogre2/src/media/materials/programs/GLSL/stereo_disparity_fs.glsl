@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// depth buffer of the side by side stereo texture. The left eye covers the
+// left half.
+uniform sampler2D depthTexture;
+
+// used to linearize the depth buffer, see depth_camera_fs.glsl
+uniform vec2 projectionParams;
+uniform float far;
+
+// focal length in pixels times the baseline
+uniform float focalBaseline;
+
+out vec4 fragColor;
+
+void main()
+{
+  float fDepth = texture(depthTexture, vec2(inPs.uv0.x * 0.5, inPs.uv0.y)).x;
+  float z = far * projectionParams.y / (fDepth - projectionParams.x);
+
+  // nothing was rendered at this pixel
+  float disparity = 0.0;
+  if (z > 0.0 && z < far * (1.0 - 1e-4))
+    disparity = focalBaseline / z;
+
+  fragColor = vec4(disparity, 0.0, 0.0, 1.0);
+}
@@ -40,6 +40,16 @@ uniform float ambient;
 uniform int rgbToTemp;
 uniform int bitDepth;
 
+// radiometric model params
+uniform int radiometric;
+uniform float reflectedTemp;
+uniform float extinctionCoeff;
+
+// participating media params, see participating_media_fs.glsl
+uniform vec4 mediaExtinction;
+uniform vec4 mediaUp;
+uniform float mediaFalloff;
+
 float getDepth(vec2 uv)
 {
   float fDepth = texture(depthTexture, uv).x;
@@ -47,6 +57,26 @@ float getDepth(vec2 uv)
   return linearDepth;
 }
 
+// see participating_media_fs.glsl for documentation on the media
+// functions
+
+float mediaHeightIntegral(float z)
+{
+  if (z <= 0.0 || mediaFalloff <= 0.0)
+    return z;
+  return (1.0 - exp(-mediaFalloff * z)) / mediaFalloff;
+}
+
+float mediaDensityLength(vec3 viewPos)
+{
+  float l = length(viewPos);
+  float z0 = mediaUp.w;
+  float z1 = z0 + dot(viewPos, mediaUp.xyz);
+  if (abs(z1 - z0) < 1e-4)
+    return l * (z0 <= 0.0 ? 1.0 : exp(-mediaFalloff * z0));
+  return l * (mediaHeightIntegral(z1) - mediaHeightIntegral(z0)) / (z1 - z0);
+}
+
 void main()
 {
   // temperature defaults to ambient
@@ -63,13 +93,14 @@ void main()
   // check for heat source
   // heat source are objects with uniform temperature or heat signature
   // The custom heat source / signature shaders stores heat data in
-  // a vec4 of [heat, 0, 0, 0] so we test to see if it is a heat
-  // source by checking gba == 0. This is more of a hack but the idea is to
+  // a vec4 of [heat, 0, 1 - emissivity, 0] so we test to see if it is a heat
+  // source by checking ga == 0. This is more of a hack but the idea is to
   // avoid having to render an extra pass to create a mask of heat source
   // objects
   vec4 rgba = texture(colorTexture, inPs.uv0).rgba;
-  bool isHeatSource = (rgba.g == 0.0 && rgba.b == 0.0 && rgba.a == 0.0);
+  bool isHeatSource = (rgba.g == 0.0 && rgba.a == 0.0);
   float heat = rgba.r;
+  float emissivity = 1.0;
 
   if (isHeatSource)
   {
@@ -80,6 +111,8 @@ void main()
 
     // set temperature variation for heat source
     heatRange = heatSourceTempRange;
+
+    emissivity = 1.0 - rgba.b;
   }
   else
   {
@@ -111,6 +144,45 @@ void main()
   // simulate temp variations
   float delta = (1.0 - dNorm) * heatRange;
   temp = temp - heatRange / 2.0 + delta;
+
+  // infrared transmission through the participating media of the scene,
+  // which are at ambient temperature
+  float mediaTau = 1.0;
+  if (mediaExtinction.w > 0.0)
+  {
+    vec3 viewSpacePos = inPs.cameraDir * getDepth(inPs.uv0);
+    mediaTau = exp(-mediaExtinction.w * mediaDensityLength(viewSpacePos));
+  }
+
+  if (radiometric == 1)
+  {
+    // distance from the sensor to the object
+    float d = getDepth(inPs.uv0);
+    float dist = length(inPs.cameraDir * d);
+
+    // atmospheric transmission over the distance
+    float tau = exp(-extinctionCoeff * dist) * mediaTau;
+
+    // total radiance received by the sensor (Stefan-Boltzmann law, constant
+    // factor omitted): emitted by the object, reflected from the
+    // surroundings and emitted by the atmosphere at ambient temperature.
+    // Temperatures are scaled down to avoid precision loss in pow.
+    float tObj = temp * 0.01;
+    float tRefl = reflectedTemp * 0.01;
+    float tAtm = ambient * 0.01;
+    float radiance = tau * (emissivity * pow(tObj, 4.0) +
+        (1.0 - emissivity) * pow(tRefl, 4.0)) +
+        (1.0 - tau) * pow(tAtm, 4.0);
+
+    // apparent temperature of a black body emitting the same radiance
+    temp = pow(radiance, 0.25) * 100.0;
+  }
+  else
+  {
+    // the media hide the object behind their own ambient temperature
+    temp = mix(ambient, temp, mediaTau);
+  }
+
   clamp(temp, min, max);
 
   // apply resolution factor
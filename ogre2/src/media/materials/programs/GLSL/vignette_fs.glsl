@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+uniform sampler2D RT;
+
+// amount of light lost at the corners
+uniform float intensity;
+// normalized distance at which the image starts to darken
+uniform float radius;
+// normalized width of the darkening transition
+uniform float smoothness;
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+out vec4 fragColor;
+
+void main()
+{
+  vec4 color = texture(RT, inPs.uv0);
+
+  // distance from the image center, 1 at the corners
+  float r = length(inPs.uv0 - vec2(0.5, 0.5)) * sqrt(2.0);
+  float v = 1.0 - intensity * smoothstep(radius, radius + smoothness, r);
+
+  fragColor = vec4(color.rgb * v, color.a);
+}
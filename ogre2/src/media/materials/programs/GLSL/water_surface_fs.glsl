@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+in block
+{
+  vec3 pos;
+  vec3 normal;
+} inPs;
+
+uniform vec3 cameraPos;
+uniform vec3 sunDirection;
+uniform vec4 deepColor;
+uniform vec4 skyColor;
+
+out vec4 fragColor;
+
+void main()
+{
+  vec3 n = normalize(inPs.normal);
+  vec3 v = normalize(cameraPos - inPs.pos);
+
+  // viewed from below the surface
+  if (dot(n, v) < 0.0)
+    n = -n;
+
+  // Schlick's approximation with the reflectance of water at normal incidence
+  float fresnel = 0.02 + 0.98 * pow(1.0 - max(dot(n, v), 0.0), 5.0);
+
+  vec3 h = normalize(normalize(sunDirection) + v);
+  float specular = pow(max(dot(n, h), 0.0), 200.0);
+
+  vec3 color = mix(deepColor.rgb, skyColor.rgb, fresnel) + vec3(specular);
+  fragColor = vec4(color, 1.0);
+}
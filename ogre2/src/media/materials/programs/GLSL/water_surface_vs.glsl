@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+// Keep in sync with GerstnerWaves::kMaxWaveCount and the wave function in
+// GerstnerWaves::Displacement
+#define MAX_WAVES 8
+
+in vec4 vertex;
+
+uniform mat4 worldViewProj;
+uniform vec3 cameraPos;
+
+// (half size x, half size y, grid snap distance, unused)
+uniform vec4 gridParams;
+
+uniform int waveCount;
+// (amplitude, wavenumber, angular frequency, steepness)
+uniform vec4 waveParams[MAX_WAVES];
+// (direction x, direction y, phase at current time, unused)
+uniform vec4 waveDirs[MAX_WAVES];
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+};
+
+out block
+{
+  vec3 pos;
+  vec3 normal;
+} outVs;
+
+void main()
+{
+  // move the grid with the camera in steps of the coarsest cell size so
+  // the vertices of all levels stay on their own grid and do not swim.
+  vec2 halfSize = gridParams.xy;
+  vec2 center = floor(cameraPos.xy / gridParams.z + 0.5) * gridParams.z;
+  vec2 x0 = clamp(vertex.xy + center, -halfSize, halfSize);
+
+  vec3 p = vec3(x0, 0.0);
+  vec3 b = vec3(1.0, 0.0, 0.0);
+  vec3 t = vec3(0.0, 1.0, 0.0);
+  for (int i = 0; i < waveCount; ++i)
+  {
+    float a = waveParams[i].x;
+    float k = waveParams[i].y;
+    float q = waveParams[i].w;
+    vec2 d = waveDirs[i].xy;
+    float theta = k * dot(d, x0) + waveDirs[i].z;
+    float s = sin(theta);
+    float c = cos(theta);
+
+    p.xy -= q * a * d * s;
+    p.z += a * c;
+
+    float qkac = q * k * a * c;
+    float kas = k * a * s;
+    b += vec3(-qkac * d.x * d.x, -qkac * d.x * d.y, -kas * d.x);
+    t += vec3(-qkac * d.x * d.y, -qkac * d.y * d.y, -kas * d.y);
+  }
+
+  gl_Position = worldViewProj * vec4(p, 1.0);
+  outVs.pos = p;
+  outVs.normal = normalize(cross(b, t));
+}
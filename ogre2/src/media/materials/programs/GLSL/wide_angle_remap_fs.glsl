@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// Each texel of lookupTex packs the uv coordinates on the cube face (xy),
+// the cube face index (z) and whether a ray maps to the pixel (w).
+// Cube faces follow the same convention as the gpu rays cubemap, see
+// gpu_rays_2nd_pass_fs.glsl
+uniform sampler2D lookupTex;
+
+uniform sampler2D tex0;
+uniform sampler2D tex1;
+uniform sampler2D tex2;
+uniform sampler2D tex3;
+uniform sampler2D tex4;
+uniform sampler2D tex5;
+
+// rotation from the frame of each face to the camera frame as quaternions
+// stored as (x, y, z, w)
+uniform vec4 faceRot[6];
+
+// value of pixels no ray maps to
+uniform vec4 invalidColor;
+
+// 1 to use the nearest texel of the face, e.g. labels or packed data that
+// can not be interpolated
+uniform float nearest;
+
+// 1 if xyz hold a point in the face frame, e.g. depth camera point clouds
+uniform float rotatePoints;
+
+// resolution of the face textures (xy) and its inverse (zw)
+uniform vec4 texResolution;
+
+out vec4 fragColor;
+
+vec4 sampleFace(sampler2D tex, vec2 uv)
+{
+  if (nearest > 0.5)
+  {
+    // texelFetch keeps packed data intact
+    ivec2 p = ivec2(min(uv * texResolution.xy, texResolution.xy - 1.0));
+    return texelFetch(tex, p, 0);
+  }
+  return texture(tex, uv);
+}
+
+vec3 rotate(vec4 q, vec3 v)
+{
+  vec3 t = 2.0 * cross(q.xyz, v);
+  return v + q.w * t + cross(q.xyz, t);
+}
+
+void main()
+{
+  vec4 data = texture(lookupTex, inPs.uv0);
+  if (data.w < 0.5)
+  {
+    fragColor = invalidColor;
+    return;
+  }
+
+  int faceIdx = int(data.z + 0.5);
+  vec2 uv = data.xy;
+  vec4 color = vec4(0.0);
+  if (faceIdx == 0)
+    color = sampleFace(tex0, uv);
+  else if (faceIdx == 1)
+    color = sampleFace(tex1, uv);
+  else if (faceIdx == 2)
+    color = sampleFace(tex2, uv);
+  else if (faceIdx == 3)
+    color = sampleFace(tex3, uv);
+  else if (faceIdx == 4)
+    color = sampleFace(tex4, uv);
+  else if (faceIdx == 5)
+    color = sampleFace(tex5, uv);
+
+  // clamped values (+/-inf) are kept as they are
+  if (rotatePoints > 0.5 && !any(isinf(color.xyz)) && !any(isnan(color.xyz)))
+    color.xyz = rotate(faceRot[faceIdx], color.xyz);
+
+  fragColor = color;
+}
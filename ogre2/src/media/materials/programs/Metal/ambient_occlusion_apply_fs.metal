@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: ambient_occlusion_apply_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float2 projectionParams;
+};
+
+float linearDepth(float2 uv, texture2d<float> depthTexture,
+    sampler depthSampler, float2 projectionParams)
+{
+  float fDepth = depthTexture.sample(depthSampler, uv).x;
+  return projectionParams.y / (fDepth - projectionParams.x);
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  texture2d<float> aoTexture [[texture(1)]],
+  texture2d<float> depthTexture [[texture(2)]],
+  sampler rtSampler [[sampler(0)]],
+  sampler aoSampler [[sampler(1)]],
+  sampler depthSampler [[sampler(2)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float4 color = RT.sample(rtSampler, inPs.uv0);
+
+  float2 aoTexel = 1.0 / float2(aoTexture.get_width(),
+      aoTexture.get_height());
+  float d = linearDepth(inPs.uv0, depthTexture, depthSampler,
+      p.projectionParams);
+  float sum = 0.0;
+  float weightSum = 0.0;
+  for (int y = -2; y < 2; ++y)
+  {
+    for (int x = -2; x < 2; ++x)
+    {
+      float2 uv = inPs.uv0 + (float2(x, y) + 0.5) * aoTexel;
+      float w = 1.0 / (0.001 + abs(linearDepth(uv, depthTexture,
+          depthSampler, p.projectionParams) - d) / d);
+      sum += aoTexture.sample(aoSampler, uv).x * w;
+      weightSum += w;
+    }
+  }
+
+  color.rgb *= sum / weightSum;
+  return color;
+}
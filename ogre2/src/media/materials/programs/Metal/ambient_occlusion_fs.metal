@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: ambient_occlusion_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float2 projectionParams;
+  float2 projectionScale;
+  float radius;
+  int sampleCount;
+  float intensity;
+};
+
+float3 viewPosition(float2 uv, texture2d<float> depthTexture,
+    sampler depthSampler, float2 projectionParams, float2 projectionScale)
+{
+  float fDepth = depthTexture.sample(depthSampler, uv).x;
+  float d = projectionParams.y / (fDepth - projectionParams.x);
+  float2 ndc = float2(uv.x * 2.0 - 1.0, 1.0 - uv.y * 2.0);
+  return float3(ndc / projectionScale * d, -d);
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> depthTexture [[texture(0)]],
+  sampler depthSampler [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  if (depthTexture.sample(depthSampler, inPs.uv0).x >= 1.0)
+    return float4(1.0);
+
+  float3 pos = viewPosition(inPs.uv0, depthTexture, depthSampler,
+      p.projectionParams, p.projectionScale);
+
+  float2 size = float2(depthTexture.get_width(), depthTexture.get_height());
+  float2 texel = 1.0 / size;
+  float3 px0 = viewPosition(inPs.uv0 - float2(texel.x, 0.0), depthTexture,
+      depthSampler, p.projectionParams, p.projectionScale);
+  float3 px1 = viewPosition(inPs.uv0 + float2(texel.x, 0.0), depthTexture,
+      depthSampler, p.projectionParams, p.projectionScale);
+  float3 py0 = viewPosition(inPs.uv0 - float2(0.0, texel.y), depthTexture,
+      depthSampler, p.projectionParams, p.projectionScale);
+  float3 py1 = viewPosition(inPs.uv0 + float2(0.0, texel.y), depthTexture,
+      depthSampler, p.projectionParams, p.projectionScale);
+  float3 dx = abs(px1.z - pos.z) < abs(pos.z - px0.z) ? px1 - pos : pos - px0;
+  float3 dy = abs(py1.z - pos.z) < abs(pos.z - py0.z) ? py1 - pos : pos - py0;
+  float3 n = normalize(cross(dy, dx));
+
+  float2 uvRadius = 0.5 * p.radius * p.projectionScale / -pos.z;
+
+  float2 pixel = floor(inPs.uv0 * size);
+  float noise = fract(52.9829189 *
+      fract(dot(pixel, float2(0.06711056, 0.00583715))));
+
+  float r2 = p.radius * p.radius;
+  float occlusion = 0.0;
+  for (int i = 0; i < p.sampleCount; ++i)
+  {
+    float t = (float(i) + 0.5) / float(p.sampleCount);
+    float angle = 6.2831853 * (7.0 * t + noise);
+    float2 offset = float2(cos(angle), sin(angle)) * t * uvRadius;
+    float3 v = viewPosition(inPs.uv0 + offset, depthTexture, depthSampler,
+        p.projectionParams, p.projectionScale) - pos;
+    float vv = dot(v, v);
+    float cosine = dot(v, n) * rsqrt(vv + 1e-6);
+    occlusion += max(0.0, 1.0 - vv / r2) * max(0.0, cosine - 0.1);
+  }
+
+  float ao = 1.0 - 2.0 * p.intensity * occlusion / float(p.sampleCount);
+  return float4(clamp(ao, 0.0, 1.0));
+}
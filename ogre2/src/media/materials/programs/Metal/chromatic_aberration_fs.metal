@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: chromatic_aberration_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float strength;
+};
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  sampler rtSampler [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float2 center = float2(0.5, 0.5);
+  float2 d = inPs.uv0 - center;
+
+  float4 color = RT.sample(rtSampler, inPs.uv0);
+  color.r = RT.sample(rtSampler, center + d / (1.0 + p.strength)).r;
+  color.b = RT.sample(rtSampler, center + d / (1.0 - p.strength)).b;
+
+  return color;
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: depth_artifact_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float4 texResolution;
+  float tanHalfFovY;
+  float near;
+  float far;
+  float3 offsets;
+  float baseline;
+  float disparityStep;
+  float flyingThreshold;
+  float multipathStrength;
+  float minReflectance;
+  float maxReflectance;
+  float cosMaxIncidence;
+};
+
+#define SHADOW_SAMPLES 64
+#define MULTIPATH_RADIUS 3
+
+float rand(float2 co)
+{
+  float r = fract(sin(dot(co.xy, float2(12.9898,78.233))) * 43758.5453);
+  return clamp(r, 0.001, 1.0);
+}
+
+float4 unpack(float color)
+{
+  int rgba = as_type<int>(color);
+  int r = rgba >> 24 & 0xFF;
+  int g = rgba >> 16 & 0xFF;
+  int b = rgba >> 8 & 0xFF;
+  int a = rgba & 0xFF;
+  return float4(r/255.0, g/255.0, b/255.0, a/255.0);
+}
+
+bool isValid(float3 p, constant Params &params)
+{
+  float tolerance = 1e-6;
+  return !isinf(p.x) && !isnan(p.x) && p.x > params.near + tolerance &&
+      length(p) < params.far - tolerance;
+}
+
+float3 fetchPoint(texture2d<float> RT, int2 uv, constant Params &params)
+{
+  int2 size = int2(params.texResolution.xy);
+  return RT.read(uint2(clamp(uv, int2(0), size - int2(1))), 0).xyz;
+}
+
+bool inProjectorShadow(texture2d<float> RT, int2 uv, float3 p, float fx,
+    constant Params &params)
+{
+  int dir = params.baseline > 0.0 ? 1 : -1;
+  int width = int(params.texResolution.x);
+  for (int i = 1; i <= SHADOW_SAMPLES; ++i)
+  {
+    int u = uv.x + dir * i;
+    if (u < 0 || u >= width)
+      break;
+    float k = float(i) * p.x / (fx * abs(params.baseline));
+    float segmentDepth = p.x / (1.0 + k);
+    float depth = fetchPoint(RT, int2(u, uv.y), params).x;
+    if (depth < segmentDepth * 0.99)
+      return true;
+  }
+  return false;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  constant Params &params [[buffer(PARAMETER_SLOT)]]
+)
+{
+  int2 uv = int2(inPs.uv0 * params.texResolution.xy);
+  float4 p = RT.read(uint2(uv), 0);
+  float3 point = p.xyz;
+  float3 invalid = float3(0.0);
+
+  if (!isValid(point, params))
+    return p;
+
+  float fx = params.texResolution.y / (2.0 * params.tanHalfFovY);
+
+  if (params.baseline != 0.0 &&
+      inProjectorShadow(RT, uv, point, fx, params))
+    return float4(invalid, p.a);
+
+  if (params.minReflectance > 0.0 || params.maxReflectance < 1.0)
+  {
+    float3 color = unpack(p.a).rgb;
+    float luminance = dot(color * color, float3(0.2126, 0.7152, 0.0722));
+    if (luminance < params.minReflectance ||
+        luminance > params.maxReflectance)
+      return float4(invalid, p.a);
+  }
+
+  float3 left = fetchPoint(RT, uv + int2(-1, 0), params);
+  float3 right = fetchPoint(RT, uv + int2(1, 0), params);
+  float3 down = fetchPoint(RT, uv + int2(0, -1), params);
+  float3 up = fetchPoint(RT, uv + int2(0, 1), params);
+
+  if (params.cosMaxIncidence > 0.0)
+  {
+    float3 dx = (isValid(right, params) ? right : point) -
+        (isValid(left, params) ? left : point);
+    float3 dy = (isValid(up, params) ? up : point) -
+        (isValid(down, params) ? down : point);
+    float3 n = cross(dx, dy);
+    if (length(n) > 0.0 &&
+        abs(dot(normalize(n), normalize(point))) < params.cosMaxIncidence)
+      return float4(invalid, p.a);
+  }
+
+  float depth = point.x;
+
+  if (params.flyingThreshold > 0.0)
+  {
+    float3 neighbors[4] = {left, right, down, up};
+    float jump = 0.0;
+    float target = depth;
+    for (int i = 0; i < 4; ++i)
+    {
+      float d = isValid(neighbors[i], params) ? neighbors[i].x : params.far;
+      if (abs(d - point.x) > jump)
+      {
+        jump = abs(d - point.x);
+        target = d;
+      }
+    }
+    if (jump > params.flyingThreshold)
+      depth = mix(depth, target, 0.5 * rand(inPs.uv0 + params.offsets.xy));
+  }
+
+  if (params.multipathStrength > 0.0)
+  {
+    float sum = 0.0;
+    float count = 0.0;
+    for (int i = -1; i <= 1; i += 2)
+    {
+      float3 h = fetchPoint(RT, uv + int2(i * MULTIPATH_RADIUS, 0), params);
+      float3 v = fetchPoint(RT, uv + int2(0, i * MULTIPATH_RADIUS), params);
+      if (isValid(h, params))
+      {
+        sum += h.x;
+        count += 1.0;
+      }
+      if (isValid(v, params))
+      {
+        sum += v.x;
+        count += 1.0;
+      }
+    }
+    if (count > 0.0)
+      depth += params.multipathStrength * max(point.x - sum / count, 0.0);
+  }
+
+  if (params.disparityStep > 0.0 && params.baseline != 0.0)
+  {
+    float disparity = fx * abs(params.baseline) / depth;
+    disparity = round(disparity / params.disparityStep) * params.disparityStep;
+    if (disparity <= 0.0)
+      return float4(invalid, p.a);
+    depth = fx * abs(params.baseline) / disparity;
+  }
+
+  return float4(point * (depth / point.x), p.a);
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: event_camera_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct PS_OUTPUT
+{
+  float4 events [[color(0)]];
+  float4 state [[color(1)]];
+};
+
+struct Params
+{
+  float positiveThreshold;
+  float negativeThreshold;
+  float thresholdNoise;
+  float refractoryPeriod;
+  float frameTime;
+  float initialize;
+  float3 offsets;
+};
+
+#define PI 3.14159265358979323846264
+
+constant float kEpsilon = 1e-3;
+constant float kMinThreshold = 0.01;
+constant float kNoEvent = -1e9;
+
+float rand(float2 co)
+{
+  float r = fract(sin(dot(co.xy, float2(12.9898,78.233))) * 43758.5453);
+  if(r == 0.0)
+    return 0.000000000001;
+  else
+    return r;
+}
+
+float gaussrand(float2 co, float3 offsets)
+{
+  float U = rand(co + float2(offsets.x, offsets.x));
+  float V = rand(co + float2(offsets.y, offsets.y));
+  return sqrt(-2.0 * log(U)) * cos(2.0 * PI * V);
+}
+
+fragment PS_OUTPUT main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> colorTexture [[texture(0)]],
+  texture2d<float> stateTexture [[texture(1)]],
+  sampler colorSampler [[sampler(0)]],
+  sampler stateSampler [[sampler(1)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  PS_OUTPUT outPs;
+
+  float3 color = colorTexture.sample(colorSampler, inPs.uv0).rgb;
+  float luminance = dot(color, float3(0.2126, 0.7152, 0.0722));
+  float logI = log(luminance + kEpsilon);
+
+  outPs.events = float4(0.0);
+  if (p.initialize > 0.5)
+  {
+    outPs.state = float4(logI, logI, kNoEvent, 0.0);
+    return outPs;
+  }
+
+  float4 prev = stateTexture.sample(stateSampler, inPs.uv0);
+  float ref = prev.x;
+  float prevLogI = prev.y;
+  float lastEvent = max(prev.z - p.frameTime, kNoEvent);
+  outPs.state = float4(ref, logI, lastEvent, 0.0);
+
+  float delta = logI - ref;
+  float polarity = delta >= 0.0 ? 1.0 : -1.0;
+  float threshold = polarity > 0.0 ?
+      p.positiveThreshold : p.negativeThreshold;
+  threshold = max(threshold +
+      p.thresholdNoise * gaussrand(inPs.uv0, p.offsets), kMinThreshold);
+
+  float crossings = floor(abs(delta) / threshold);
+  if (crossings < 1.0)
+    return outPs;
+
+  outPs.state.x = ref + polarity * crossings * threshold;
+
+  float change = (logI - prevLogI) * polarity;
+  float first = 1.0;
+  float step = 0.0;
+  if (change > 0.0)
+  {
+    step = threshold / change;
+    first = clamp(((ref - prevLogI) * polarity + threshold) / change,
+        0.0, 1.0);
+    if (crossings > 1.0)
+      step = min(step, (1.0 - first) / (crossings - 1.0));
+  }
+
+  float dt = max(p.frameTime, 1e-9);
+  float skip = 0.0;
+  float stride = 1.0;
+  if (p.refractoryPeriod > 0.0)
+  {
+    float earliest = 1.0 + (lastEvent + p.refractoryPeriod) / dt;
+    if (step > 0.0)
+    {
+      skip = max(ceil((earliest - first) / step), 0.0);
+      stride = max(ceil(p.refractoryPeriod / (step * dt)), 1.0);
+    }
+    else
+    {
+      skip = first < earliest ? crossings : 0.0;
+      stride = crossings;
+    }
+  }
+
+  if (skip >= crossings)
+    return outPs;
+
+  float count = floor((crossings - 1.0 - skip) / stride) + 1.0;
+  first += skip * step;
+  step *= stride;
+  outPs.events = float4(polarity * count, first, step, 0.0);
+  outPs.state.z = (first + (count - 1.0) * step - 1.0) * dt;
+  return outPs;
+}
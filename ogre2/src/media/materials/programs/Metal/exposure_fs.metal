@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: exposure_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float exposure;
+  int autoExposure;
+  float keyValue;
+  float minExposure;
+  float maxExposure;
+  int toneMapping;
+  float luminanceLod;
+};
+
+float3 aces(float3 x)
+{
+  return (x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14);
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  texture2d<float> luminance [[texture(1)]],
+  sampler rtSampler [[sampler(0)]],
+  sampler luminanceSampler [[sampler(1)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float4 color = RT.sample(rtSampler, inPs.uv0);
+
+  float e = p.exposure;
+  if (p.autoExposure != 0)
+  {
+    float avgLum = exp(luminance.sample(luminanceSampler, float2(0.5, 0.5),
+        level(p.luminanceLod)).r);
+    e *= clamp(p.keyValue / max(avgLum, 1e-4), p.minExposure,
+        p.maxExposure);
+  }
+
+  float3 c = color.rgb * e;
+  if (p.toneMapping == 1)
+    c = c / (1.0 + c);
+  else if (p.toneMapping == 2)
+    c = aces(c);
+
+  return float4(clamp(c, 0.0, 1.0), color.a);
+}
@@ -37,8 +37,43 @@ struct Params
   float particleScatterRatio;
   // rnd is a random number in the range of [0-1]
   float rnd;
+  float4 mediaExtinction;
+  float4 mediaUp;
+  float mediaFalloff;
+  float4 precipScatter;
+  float4 precipUp;
+  float4 intensityParams;
 };
 
+// returns whose two-way transmittance through participating media falls
+// below this value are too weak to be detected
+constant float minMediaTransmittance = 0.01;
+
+// cosine of the entrance angle beyond which retroreflectors stop reflecting
+// the beam back to the sensor (60 degrees)
+constant float cosMaxEntranceAngle = 0.5;
+
+// see participating_media_fs.glsl for documentation on the media
+// functions
+
+float mediaHeightIntegral(float z, float falloff)
+{
+  if (z <= 0.0 || falloff <= 0.0)
+    return z;
+  return (1.0 - exp(-falloff * z)) / falloff;
+}
+
+float mediaDensityLength(float3 viewPos, float4 up, float falloff)
+{
+  float l = length(viewPos);
+  float z0 = up.w;
+  float z1 = z0 + dot(viewPos, up.xyz);
+  if (abs(z1 - z0) < 1e-4)
+    return l * (z0 <= 0.0 ? 1.0 : exp(-falloff * z0));
+  return l * (mediaHeightIntegral(z1, falloff) -
+      mediaHeightIntegral(z0, falloff)) / (z1 - z0);
+}
+
 // see gaussian_noise_fs.metal for documentation on the rand and gaussrand
 // functions
 
@@ -86,7 +121,8 @@ fragment float4 main_metal
   float d = p.projectionParams.y / (fDepth - p.projectionParams.x);
 
   // get retro
-  float retro = colorTexture.sample(colorSampler, inPs.uv0).x * 2000.0;
+  float4 surface = colorTexture.sample(colorSampler, inPs.uv0);
+  float retro = surface.x * 2000.0;
 
   // reconstruct 3d viewspace pos from depth
   float3 viewSpacePos = inPs.cameraDir * d;
@@ -94,6 +130,20 @@ fragment float4 main_metal
   // get length of 3d point, i.e.range
   float l = length(viewSpacePos);
 
+  if (p.intensityParams.x > 0.5)
+  {
+    float cosIncidence = surface.z;
+    float retroreflection = surface.y * 2000.0 *
+        clamp((cosIncidence - cosMaxEntranceAngle) /
+        (1.0 - cosMaxEntranceAngle), 0.0, 1.0);
+    float falloff =
+        pow(p.intensityParams.z / max(l, 1e-3), p.intensityParams.w);
+    retro = p.intensityParams.y *
+        (surface.x * cosIncidence + retroreflection) * falloff;
+  }
+
+  float3 normal = cross(dfdx(viewSpacePos), dfdy(viewSpacePos));
+
   // particle mask - color and depth
   float4 particle = particleTexture.sample(particleSampler, inPs.uv0);
   float particleDepth = particleDepthTexture.sample(particleDepthSampler, inPs.uv0).x;
@@ -130,6 +180,49 @@ fragment float4 main_metal
     }
   }
 
+  // attenuate the return by the participating media on the way to the
+  // hit point and back
+  if (p.mediaExtinction.w > 0.0 && l <= p.far)
+  {
+    float3 hitPos = normalize(inPs.cameraDir) * l;
+    float transmittance = exp(-2.0 * p.mediaExtinction.w *
+        mediaDensityLength(hitPos, p.mediaUp, p.mediaFalloff));
+    retro *= transmittance;
+    if (transmittance < minMediaTransmittance)
+      l = p.far + 1.0;
+  }
+
+  // precipitation, see gpu_rays_1st_pass_fs.glsl
+  if (p.precipScatter.x > 0.0)
+  {
+    if (l <= p.far)
+    {
+      if (dot(normal, normal) > 0.0)
+      {
+        normal = normalize(normal);
+        if (dot(normal, viewSpacePos) > 0.0)
+          normal = -normal;
+        float facingUp = clamp(dot(normal, p.precipUp.xyz), 0.0, 1.0);
+        retro *= 1.0 - 0.5 * p.precipScatter.z * facingUp;
+      }
+
+      float transmittance = exp(-2.0 * p.precipScatter.x * l);
+      retro *= transmittance;
+      if (rand(inPs.uv0 + float2(p.precipUp.w, 0.37)) > transmittance)
+        l = p.far + 1.0;
+    }
+
+    float u = rand(inPs.uv0 + float2(p.precipUp.w, 0.71));
+    float s = -log(u) / p.precipScatter.x;
+    float detection = min(1.0, pow(p.precipScatter.y / s, 2.0));
+    if (s < min(l, p.far) && s >= p.near &&
+        rand(inPs.uv0 + float2(0.53, p.precipUp.w)) < detection)
+    {
+      l = s;
+      retro = p.precipScatter.w;
+    }
+  }
+
   if (l > p.far)
     l = p.max;
   else if (l < p.near)
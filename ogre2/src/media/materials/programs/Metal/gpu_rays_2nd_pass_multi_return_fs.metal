@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: gpu_rays_2nd_pass_multi_return_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float2 rangeCount;
+  float returnCount;
+  float returnMode;
+  float separation;
+  float near;
+  float far;
+  float max;
+};
+
+#define FOOTPRINT_SIZE 3
+#define SAMPLE_COUNT 9
+
+float2 getRange(float2 uv, texture2d<float> tex, sampler texSampler)
+{
+  float2 range = tex.sample(texSampler, uv).xy;
+  return range;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float>  cubeUVTex [[texture(0)]],
+  texture2d<float>  tex0      [[texture(1)]],
+  texture2d<float>  tex1      [[texture(2)]],
+  texture2d<float>  tex2      [[texture(3)]],
+  texture2d<float>  tex3      [[texture(4)]],
+  texture2d<float>  tex4      [[texture(5)]],
+  texture2d<float>  tex5      [[texture(6)]],
+  sampler cubeUVTexSampler    [[sampler(0)]],
+  sampler tex0Sampler         [[sampler(1)]],
+  sampler tex1Sampler         [[sampler(2)]],
+  sampler tex2Sampler         [[sampler(3)]],
+  sampler tex3Sampler         [[sampler(4)]],
+  sampler tex4Sampler         [[sampler(5)]],
+  sampler tex5Sampler         [[sampler(6)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  // ray and echo written by this fragment
+  int echoCountPerRay = int(p.returnCount);
+  int column = int(inPs.uv0.x * p.rangeCount.x * p.returnCount);
+  int ray = column / echoCountPerRay;
+  int echo = column - ray * echoCountPerRay;
+  int row = int(inPs.uv0.y * p.rangeCount.y);
+
+  // sample the beam footprint and sort the hits by range
+  float ranges[SAMPLE_COUNT];
+  float retros[SAMPLE_COUNT];
+  int hitCount = 0;
+  float2 center = float2(p.max, 0.0);
+  for (int j = 0; j < FOOTPRINT_SIZE; ++j)
+  {
+    for (int i = 0; i < FOOTPRINT_SIZE; ++i)
+    {
+      uint2 texel = uint2(ray * FOOTPRINT_SIZE + i, row * FOOTPRINT_SIZE + j);
+      float3 data = cubeUVTex.read(texel).xyz;
+      float faceIdx = data.z;
+      float2 uv = data.xy;
+
+      float2 d = float2(0.0, 0.0);
+      if (faceIdx == 0)
+        d = getRange(uv, tex0, tex0Sampler);
+      else if (faceIdx == 1)
+        d = getRange(uv, tex1, tex1Sampler);
+      else if (faceIdx == 2)
+        d = getRange(uv, tex2, tex2Sampler);
+      else if (faceIdx == 3)
+        d = getRange(uv, tex3, tex3Sampler);
+      else if (faceIdx == 4)
+        d = getRange(uv, tex4, tex4Sampler);
+      else if (faceIdx == 5)
+        d = getRange(uv, tex5, tex5Sampler);
+
+      if (i == FOOTPRINT_SIZE / 2 && j == FOOTPRINT_SIZE / 2)
+        center = d;
+
+      // out of range samples, i.e. clamped or +/-inf, are not hits
+      if (!(d.x > p.near && d.x < p.far))
+        continue;
+
+      int k = hitCount;
+      while (k > 0 && ranges[k - 1] > d.x)
+      {
+        ranges[k] = ranges[k - 1];
+        retros[k] = retros[k - 1];
+        --k;
+      }
+      ranges[k] = d.x;
+      retros[k] = d.y;
+      ++hitCount;
+    }
+  }
+
+  // group hits into echoes
+  float echoRange[SAMPLE_COUNT];
+  float echoRetro[SAMPLE_COUNT];
+  float echoSamples[SAMPLE_COUNT];
+  int echoCount = 0;
+  for (int s = 0; s < hitCount; ++s)
+  {
+    if (s == 0 || ranges[s] - ranges[s - 1] > p.separation)
+    {
+      echoRange[echoCount] = 0.0;
+      echoRetro[echoCount] = 0.0;
+      echoSamples[echoCount] = 0.0;
+      ++echoCount;
+    }
+    echoRange[echoCount - 1] += ranges[s];
+    echoRetro[echoCount - 1] += retros[s];
+    echoSamples[echoCount - 1] += 1.0;
+  }
+
+  // select the echo to output
+  int mode = int(p.returnMode);
+  int idx = -1;
+  if (echoCount > 0)
+  {
+    if (mode == 0)
+    {
+      idx = 0;
+    }
+    else if (mode == 1)
+    {
+      idx = echoCount - 1;
+    }
+    else if (mode == 2)
+    {
+      idx = 0;
+      for (int e = 1; e < echoCount; ++e)
+      {
+        if (echoRetro[e] > echoRetro[idx])
+          idx = e;
+      }
+    }
+    else if (echo < echoCount)
+    {
+      idx = echo;
+    }
+  }
+
+  float4 fragColor;
+  if (idx >= 0)
+  {
+    fragColor = float4(echoRange[idx] / echoSamples[idx],
+        echoRetro[idx] / float(SAMPLE_COUNT),
+        echoSamples[idx] / float(SAMPLE_COUNT), 1.0);
+  }
+  else if (echo == 0)
+  {
+    fragColor = float4(center.x, 0.0, 0.0, 1.0);
+  }
+  else
+  {
+    fragColor = float4(p.max, 0.0, 0.0, 1.0);
+  }
+  return fragColor;
+}
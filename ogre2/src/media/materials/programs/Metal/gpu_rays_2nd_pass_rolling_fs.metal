@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: gpu_rays_2nd_pass_rolling_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float4 startRot;
+  float4 endRot;
+  float3 startPos;
+  float3 endPos;
+  float duration;
+  float near;
+  float far;
+  float min;
+  float max;
+};
+
+#define ITERATIONS 3
+
+float3 toSensorFrame(float3 v)
+{
+  return float3(v.z, -v.x, v.y);
+}
+
+float3 toCubemapFrame(float3 v)
+{
+  return float3(-v.y, v.z, v.x);
+}
+
+float3 rotate(float4 q, float3 v)
+{
+  float3 t = 2.0 * cross(q.xyz, v);
+  return v + q.w * t + cross(q.xyz, t);
+}
+
+float4 slerp(float4 q0, float4 q1, float t)
+{
+  float d = dot(q0, q1);
+  if (d < 0.0)
+  {
+    q1 = -q1;
+    d = -d;
+  }
+  if (d > 0.9995)
+    return normalize(mix(q0, q1, t));
+  float theta = acos(d);
+  return (sin((1.0 - t) * theta) * q0 + sin(t * theta) * q1) / sin(theta);
+}
+
+struct CubeTextures
+{
+  texture2d<float> tex0;
+  texture2d<float> tex1;
+  texture2d<float> tex2;
+  texture2d<float> tex3;
+  texture2d<float> tex4;
+  texture2d<float> tex5;
+  sampler s;
+};
+
+float2 sampleCubemap(float3 v, thread const CubeTextures &c)
+{
+  float3 vAbs = abs(v);
+  float faceIdx;
+  float ma;
+  float2 uv;
+  if (vAbs.z >= vAbs.x && vAbs.z >= vAbs.y)
+  {
+    faceIdx = v.z < 0.0 ? 5.0 : 4.0;
+    ma = 0.5 / vAbs.z;
+    uv = float2(v.z < 0.0 ? -v.x : v.x, -v.y);
+  }
+  else if (vAbs.y >= vAbs.x)
+  {
+    faceIdx = v.y < 0.0 ? 3.0 : 2.0;
+    ma = 0.5 / vAbs.y;
+    uv = float2(v.x, v.y < 0.0 ? -v.z : v.z);
+  }
+  else
+  {
+    faceIdx = v.x < 0.0 ? 1.0 : 0.0;
+    ma = 0.5 / vAbs.x;
+    uv = float2(v.x < 0.0 ? v.z : -v.z, -v.y);
+  }
+  uv = uv * ma + 0.5;
+
+  float2 d = float2(0.0, 0.0);
+  if (faceIdx == 0)
+    d = c.tex0.sample(c.s, uv).xy;
+  else if (faceIdx == 1)
+    d = c.tex1.sample(c.s, uv).xy;
+  else if (faceIdx == 2)
+    d = c.tex2.sample(c.s, uv).xy;
+  else if (faceIdx == 3)
+    d = c.tex3.sample(c.s, uv).xy;
+  else if (faceIdx == 4)
+    d = c.tex4.sample(c.s, uv).xy;
+  else if (faceIdx == 5)
+    d = c.tex5.sample(c.s, uv).xy;
+  return d;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float>  cubeUVTex [[texture(0)]],
+  texture2d<float>  tex0      [[texture(1)]],
+  texture2d<float>  tex1      [[texture(2)]],
+  texture2d<float>  tex2      [[texture(3)]],
+  texture2d<float>  tex3      [[texture(4)]],
+  texture2d<float>  tex4      [[texture(5)]],
+  texture2d<float>  tex5      [[texture(6)]],
+  sampler cubeUVTexSampler    [[sampler(0)]],
+  sampler tex0Sampler         [[sampler(1)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  CubeTextures c = {tex0, tex1, tex2, tex3, tex4, tex5, tex0Sampler};
+
+  float4 data = cubeUVTex.sample(cubeUVTexSampler, inPs.uv0);
+  float t = data.w;
+
+  float4 q = slerp(p.startRot, p.endRot, t);
+  float3 origin = toCubemapFrame(mix(p.startPos, p.endPos, t));
+  float3 dir = toCubemapFrame(rotate(q, toSensorFrame(data.xyz)));
+
+  float2 d = sampleCubemap(dir, c);
+  float range = d.x;
+  for (int i = 0; i < ITERATIONS; ++i)
+  {
+    if (!(d.x > p.near && d.x < p.far))
+      break;
+    float3 pt = origin + dir * range;
+    float3 pDir = normalize(pt);
+    d = sampleCubemap(pDir, c);
+    range = dot(pDir * d.x - origin, dir);
+  }
+
+  if (!(d.x > p.near && d.x < p.far))
+    range = d.x;
+  else if (range > p.far)
+    range = p.max;
+  else if (range < p.near)
+    range = p.min;
+
+  return float4(range, d.y, t * p.duration, 1.0);
+}
@@ -35,6 +35,9 @@ struct Params
 
   int bitDepth;
   float resolution;
+
+  // emissivity of the surface, encoded as (1 - emissivity) in the blue channel
+  float emissivity = 1.0;
 };
 
 // map a temperature from the [min, max] range to the user defined
@@ -60,11 +63,11 @@ fragment float4 main_metal
 {
   float heat = renderTexture.sample(renderTextureSampler, inPs.uv0.xy).x;
 
-  // set g, b, a to 0. This will be used by thermal_camera_fs.glsl to determine
+  // set g, a to 0. This will be used by thermal_camera_fs.glsl to determine
   // if a particular fragment is a heat source or not
   float normalisedHeat = mapNormalized(
     heat, p.minTemp, p.maxTemp, p.resolution, p.bitDepth);
 
-  float4 fragColor(normalisedHeat, 0, 0, 0.0);
+  float4 fragColor(normalisedHeat, 0, 1.0 - p.emissivity, 0.0);
   return fragColor;
 }
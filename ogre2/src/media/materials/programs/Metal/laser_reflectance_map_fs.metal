@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: laser_reflectance_map_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float3 viewPos;
+  float3 viewNormal;
+  float2 uv0;
+};
+
+struct Params
+{
+  float4 inReflectance;
+};
+
+float cosIncidence(float3 n, float3 viewPos)
+{
+  if (dot(n, n) < 1e-12)
+    return 1.0;
+  return abs(dot(normalize(n), normalize(viewPos)));
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> reflectanceMap [[texture(0)]],
+  sampler reflectanceMapSampler [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float reflectance =
+      reflectanceMap.sample(reflectanceMapSampler, inPs.uv0).x;
+  return float4(reflectance, p.inReflectance.y,
+      cosIncidence(inPs.viewNormal, inPs.viewPos), 1.0);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: laser_reflectance_vs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct VS_INPUT
+{
+  float4 position [[attribute(VES_POSITION)]];
+  float3 normal   [[attribute(VES_NORMAL)]];
+  float2 uv0      [[attribute(VES_TEXTURE_COORDINATES0)]];
+};
+
+struct PS_INPUT
+{
+  float4 gl_Position [[position]];
+  float gl_ClipDistance [[clip_distance]] [1];
+  float3 viewPos;
+  float3 viewNormal;
+  float2 uv0;
+};
+
+struct Params
+{
+  float4x4 worldViewProj;
+  float4x4 worldView;
+  float4x4 worldViewIT;
+  float ignMinClipDistance;
+};
+
+vertex PS_INPUT main_metal
+(
+  VS_INPUT input [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  PS_INPUT outVs;
+  outVs.gl_Position = p.worldViewProj * input.position;
+  outVs.viewPos = (p.worldView * input.position).xyz;
+  outVs.viewNormal = (p.worldViewIT * float4(input.normal, 0.0)).xyz;
+  outVs.uv0 = input.uv0;
+
+  if (p.ignMinClipDistance > 0.0)
+    outVs.gl_ClipDistance[0] = length(outVs.viewPos) - p.ignMinClipDistance;
+  else
+    outVs.gl_ClipDistance[0] = 1.0;
+
+  return outVs;
+}
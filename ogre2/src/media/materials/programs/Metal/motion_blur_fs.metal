@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: motion_blur_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float4x4 reprojection;
+  float exposureFraction;
+  int sampleCount;
+};
+
+float2 motion(float2 uv, float4x4 reprojection)
+{
+  float4 clip = reprojection *
+      float4(uv.x * 2.0 - 1.0, 1.0 - uv.y * 2.0, 0.5, 1.0);
+  if (clip.w <= 0.0)
+    return float2(0.0, 0.0);
+  float2 ndc = clip.xy / clip.w;
+  float2 prevUv = float2(ndc.x * 0.5 + 0.5, 0.5 - ndc.y * 0.5);
+  return uv - prevUv;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  sampler rtSampler [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float2 m = motion(inPs.uv0, p.reprojection) * p.exposureFraction;
+  float4 color = float4(0.0);
+  for (int i = 0; i < p.sampleCount; ++i)
+  {
+    float t = (p.sampleCount > 1) ?
+        float(i) / float(p.sampleCount - 1) : 0.0;
+    color += RT.sample(rtSampler, inPs.uv0 - m * t);
+  }
+  return color / float(p.sampleCount);
+}
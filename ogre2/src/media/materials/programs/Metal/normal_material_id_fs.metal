@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: normal_material_id_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float3 viewPos;
+  float3 viewNormal;
+};
+
+struct Params
+{
+  float4 materialId;
+};
+
+float2 signNotZero(float2 v)
+{
+  return float2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+float2 octahedralEncode(float3 n)
+{
+  float2 p = n.xy / (abs(n.x) + abs(n.y) + abs(n.z));
+  if (n.z < 0.0)
+    p = (1.0 - abs(p.yx)) * signNotZero(p);
+  return p * 0.5 + 0.5;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float3 n = inPs.viewNormal;
+  if (length(n) < 1e-6)
+    n = -inPs.viewPos;
+  n = normalize(n);
+
+  if (dot(n, inPs.viewPos) > 0.0)
+    n = -n;
+
+  float3 cameraNormal = float3(-n.z, -n.x, n.y);
+
+  return float4(octahedralEncode(cameraNormal), p.materialId.x, 1.0);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: normal_material_id_vs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct VS_INPUT
+{
+  float4 position [[attribute(VES_POSITION)]];
+  float3 normal [[attribute(VES_NORMAL)]];
+};
+
+struct PS_INPUT
+{
+  float4 gl_Position [[position]];
+  float3 viewPos;
+  float3 viewNormal;
+};
+
+struct Params
+{
+  float4x4 worldViewProj;
+  float4x4 worldView;
+  float4x4 worldViewIT;
+};
+
+vertex PS_INPUT main_metal
+(
+  VS_INPUT input [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  PS_INPUT outVs;
+  outVs.gl_Position = p.worldViewProj * input.position;
+  outVs.viewPos = (p.worldView * input.position).xyz;
+  outVs.viewNormal = (p.worldViewIT * float4(input.normal, 0.0)).xyz;
+  return outVs;
+}
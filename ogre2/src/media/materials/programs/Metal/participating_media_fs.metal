@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: participating_media_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float2 projectionParams;
+  float2 invProjectionScale;
+  float4 mediaExtinction;
+  float3 mediaInscatter;
+  float4 mediaUp;
+  float mediaFalloff;
+};
+
+float mediaHeightIntegral(float z, float falloff)
+{
+  if (z <= 0.0 || falloff <= 0.0)
+    return z;
+  return (1.0 - exp(-falloff * z)) / falloff;
+}
+
+float mediaDensityLength(float3 viewPos, float4 up, float falloff)
+{
+  float l = length(viewPos);
+  float z0 = up.w;
+  float z1 = z0 + dot(viewPos, up.xyz);
+  if (abs(z1 - z0) < 1e-4)
+    return l * (z0 <= 0.0 ? 1.0 : exp(-falloff * z0));
+  return l * (mediaHeightIntegral(z1, falloff) -
+      mediaHeightIntegral(z0, falloff)) / (z1 - z0);
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  texture2d<float> depthTexture [[texture(1)]],
+  sampler rtSampler [[sampler(0)]],
+  sampler depthSampler [[sampler(1)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float4 color = RT.sample(rtSampler, inPs.uv0);
+
+  float fDepth = depthTexture.sample(depthSampler, inPs.uv0).x;
+  float d = p.projectionParams.y / (fDepth - p.projectionParams.x);
+  float2 ndc = float2(inPs.uv0.x * 2.0 - 1.0, 1.0 - inPs.uv0.y * 2.0);
+  float3 viewPos = float3(ndc * p.invProjectionScale * d, -d);
+
+  float3 transmittance = exp(-p.mediaExtinction.rgb *
+      mediaDensityLength(viewPos, p.mediaUp, p.mediaFalloff));
+  color.rgb = color.rgb * transmittance +
+      p.mediaInscatter * (float3(1.0) - transmittance);
+
+  return color;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: precipitation_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float2 projectionParams;
+  float2 invProjectionScale;
+  float farPlane;
+  float4 precipScatter;
+  float4 precipParticle;
+  float4 precipVelocity;
+  float4 precipUp;
+  float3 precipEast;
+};
+
+constant float3 precipColor = float3(0.8);
+
+constant int precipLayers = 4;
+constant float precipNearRadius = 1.0;
+
+float rand(float2 co)
+{
+  return fract(sin(dot(co, float2(12.9898, 78.233))) * 43758.5453);
+}
+
+float precipLayer(float3 worldDir, float radius, float dist,
+    float pixelAngle, float seed, constant Params &p)
+{
+  float horizontal = length(worldDir.xy);
+  if (horizontal < 1e-3)
+    return 0.0;
+
+  float t = radius / horizontal;
+  if (t > dist)
+    return 0.0;
+
+  float azimuth = atan2(worldDir.y, worldDir.x);
+  float2 pos = float2(azimuth * radius, worldDir.z * t);
+
+  float3 velocity = p.precipVelocity.xyz;
+  float vt = dot(velocity.xy, float2(-sin(azimuth), cos(azimuth)));
+  float vz = min(velocity.z, -0.1);
+  pos.x -= pos.y * vt / vz;
+  pos.y -= vz * p.precipVelocity.w;
+
+  float streak = p.precipParticle.y;
+  float2 cell = float2(0.02, 0.05) * radius;
+  cell.y = max(cell.y, 2.0 * streak);
+
+  float2 g = pos / cell;
+  float2 id = floor(g);
+  float2 key = id - 1024.0 * floor(id / 1024.0) + float2(seed);
+  if (rand(key) >= p.precipParticle.w)
+    return 0.0;
+
+  float2 center = 0.25 + 0.5 * float2(rand(key + 0.31), rand(key + 0.67));
+  float2 offset = (g - id - center) * cell;
+  float along = max(abs(offset.y) - 0.5 * streak, 0.0);
+  float d = length(float2(offset.x, along));
+
+  float radiusPx = max(p.precipParticle.x, 0.5 * t * pixelAngle);
+  float coverage = 1.0 - smoothstep(0.5 * radiusPx, radiusPx, d);
+  return coverage * p.precipParticle.x / radiusPx;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  texture2d<float> depthTexture [[texture(1)]],
+  sampler rtSampler [[sampler(0)]],
+  sampler depthSampler [[sampler(1)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float4 color = RT.sample(rtSampler, inPs.uv0);
+
+  float fDepth = depthTexture.sample(depthSampler, inPs.uv0).x;
+  float d = p.projectionParams.y / (fDepth - p.projectionParams.x);
+  float2 ndc = float2(inPs.uv0.x * 2.0 - 1.0, 1.0 - inPs.uv0.y * 2.0);
+  float3 viewPos = float3(ndc * p.invProjectionScale * d, -d);
+  float dist = length(viewPos);
+  float3 viewDir = viewPos / dist;
+
+  float3 normal = cross(dfdx(viewPos), dfdy(viewPos));
+  float pixelAngle = length(fwidth(viewDir));
+
+  if (d < p.farPlane * 0.999 && dot(normal, normal) > 0.0)
+  {
+    normal = normalize(normal);
+    if (dot(normal, viewPos) > 0.0)
+      normal = -normal;
+    float facingUp = clamp(dot(normal, p.precipUp.xyz), 0.0, 1.0);
+    color.rgb *= 1.0 - 0.5 * p.precipScatter.z * facingUp;
+  }
+
+  float transmittance = exp(-p.precipScatter.x * dist);
+  color.rgb = mix(precipColor, color.rgb, transmittance);
+
+  float3 north = cross(p.precipUp.xyz, p.precipEast);
+  float3 worldDir = float3(dot(viewDir, p.precipEast), dot(viewDir, north),
+      dot(viewDir, p.precipUp.xyz));
+  for (int i = precipLayers - 1; i >= 0; --i)
+  {
+    float radius = precipNearRadius * exp2(float(i));
+    float coverage = precipLayer(worldDir, radius, dist, pixelAngle,
+        float(i) * 7.31, p);
+    color.rgb = mix(color.rgb, precipColor, coverage * p.precipParticle.z);
+  }
+
+  return color;
+}
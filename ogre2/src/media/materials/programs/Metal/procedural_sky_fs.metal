@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: procedural_sky_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float3 cameraDir;
+};
+
+struct Params
+{
+  float3 sunDirection;
+  float3 betaR;
+  float3 betaM;
+  float sunE;
+  float mieG;
+  float exposure;
+  float cloudCover;
+  float2 cloudOffset;
+  float3 cloudColor;
+  float3 sunColor;
+};
+
+#define PI 3.14159265358979323846264
+
+constant float rayleighZenithLength = 8.4e3;
+constant float mieZenithLength = 1.25e3;
+constant float sunAngularDiameterCos = 0.99995667694644844;
+
+float rayleighPhase(float _cosTheta)
+{
+  return 3.0 / (16.0 * PI) * (1.0 + _cosTheta * _cosTheta);
+}
+
+float henyeyGreensteinPhase(float _cosTheta, float _g)
+{
+  float g2 = _g * _g;
+  float inverse = 1.0 / pow(1.0 - 2.0 * _g * _cosTheta + g2, 1.5);
+  return 1.0 / (4.0 * PI) * ((1.0 - g2) * inverse);
+}
+
+float hash(float2 _p)
+{
+  _p = fract(_p * float2(123.34, 456.21));
+  _p += dot(_p, _p + 45.32);
+  return fract(_p.x * _p.y);
+}
+
+float valueNoise(float2 _p)
+{
+  float2 i = floor(_p);
+  float2 f = fract(_p);
+  float2 u = f * f * (3.0 - 2.0 * f);
+  return mix(mix(hash(i), hash(i + float2(1.0, 0.0)), u.x),
+             mix(hash(i + float2(0.0, 1.0)), hash(i + float2(1.0, 1.0)), u.x),
+             u.y);
+}
+
+float fbm(float2 _p)
+{
+  float value = 0.0;
+  float amplitude = 0.5;
+  for (int i = 0; i < 5; ++i)
+  {
+    value += amplitude * valueNoise(_p);
+    _p *= 2.03;
+    amplitude *= 0.5;
+  }
+  return value;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float3 dir = normalize(inPs.cameraDir);
+
+  float zenithAngle = acos(max(0.0, dir.z));
+  float inverse = 1.0 / (cos(zenithAngle) + 0.15 *
+      pow(93.885 - zenithAngle * 180.0 / PI, -1.253));
+  float sR = rayleighZenithLength * inverse;
+  float sM = mieZenithLength * inverse;
+
+  float3 fex = exp(-(p.betaR * sR + p.betaM * sM));
+
+  float cosTheta = dot(dir, p.sunDirection);
+  float3 betaRTheta = p.betaR * rayleighPhase(cosTheta * 0.5 + 0.5);
+  float3 betaMTheta = p.betaM * henyeyGreensteinPhase(cosTheta, p.mieG);
+  float3 scatter = p.sunE * (betaRTheta + betaMTheta) / (p.betaR + p.betaM);
+  float3 lin = pow(scatter * (1.0 - fex), float3(1.5));
+  lin *= mix(float3(1.0), pow(scatter * fex, float3(0.5)),
+      clamp(pow(1.0 - p.sunDirection.z, 5.0), 0.0, 1.0));
+
+  float3 l0 = float3(0.1) * fex;
+  float sunDisc = smoothstep(sunAngularDiameterCos,
+      sunAngularDiameterCos + 0.00002, cosTheta);
+  l0 += p.sunE * 19000.0 * fex * sunDisc;
+
+  float3 radiance = (lin + l0) * 0.04 + float3(0.0, 0.0003, 0.00075);
+  float3 color = 1.0 - exp(-p.exposure * radiance);
+
+  if (p.cloudCover > 0.0 && dir.z > 0.01)
+  {
+    float2 uv = dir.xy / dir.z + p.cloudOffset;
+    float threshold = mix(0.75, 0.2, p.cloudCover);
+    float density = smoothstep(threshold, threshold + 0.2, fbm(uv * 2.0)) *
+        smoothstep(0.01, 0.15, dir.z);
+    float3 cloud = p.cloudColor +
+        p.sunColor * 0.5 * pow(max(cosTheta, 0.0), 8.0);
+    color = mix(color, min(cloud, float3(1.0)), density);
+  }
+
+  return float4(color, 1.0);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <metal_stdlib>
+using namespace metal;
+
+// Writes the label color of the object. Pixels inside the projection box
+// of a labeled decal that face the decal get the label color of the decal
+// instead, so only the visible surfaces the decal is projected on are
+// labeled.
+
+#define MAX_LABEL_DECALS 16
+
+struct PS_INPUT
+{
+  float3 worldPos;
+  float3 worldNormal;
+};
+
+struct Params
+{
+  float4 inColor;
+
+  // world to unit box transforms and label colors of the labeled decals
+  int numDecals;
+  float4x4 decalInvWorld[MAX_LABEL_DECALS];
+  float4 decalColor[MAX_LABEL_DECALS];
+};
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float4 color = p.inColor;
+  for (int i = 0; i < p.numDecals; ++i)
+  {
+    float4x4 m = p.decalInvWorld[i];
+    float3 pos = (m * float4(inPs.worldPos, 1.0)).xyz;
+
+    // like ogre decals, skip the surfaces that look away from the Y axis
+    // of the box, which is the projection direction. Geometry without
+    // normals faces the decal.
+    float3 decalDir = float3(m[0][1], m[1][1], m[2][1]);
+    bool facing = dot(decalDir, inPs.worldNormal) > 0.0 ||
+        length(inPs.worldNormal) < 1e-6;
+
+    if (facing && all(abs(pos) <= float3(0.5)))
+      color = p.decalColor[i];
+  }
+  return color;
+}
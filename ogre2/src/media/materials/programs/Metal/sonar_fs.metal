@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: sonar_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float beamCount;
+  float rangeBinCount;
+  float hfov;
+  float2 tanHalfFov;
+  float vfov;
+  float near;
+  float far;
+  float beamWidth;
+  float attenuation;
+  float speckle;
+  float3 offsets;
+};
+
+constant float kHalfPower = 1.39156;
+constant float kBeamSupport = 2.26;
+constant int kMaxColumns = 512;
+
+float rand(float2 co)
+{
+  float r = fract(sin(dot(co.xy, float2(12.9898,78.233))) * 43758.5453);
+  if(r == 0.0)
+    return 0.000000000001;
+  else
+    return r;
+}
+
+float sinc2(float x)
+{
+  if (abs(x) < 1e-4)
+    return 1.0;
+  float s = sin(x) / x;
+  return s * s;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> sourceTexture [[texture(0)]],
+  sampler sourceSampler [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float w = float(sourceTexture.get_width());
+  float h = float(sourceTexture.get_height());
+  float beam = min(floor(inPs.uv0.x * p.beamCount), p.beamCount - 1.0);
+  float bin = min(floor(inPs.uv0.y * p.rangeBinCount),
+      p.rangeBinCount - 1.0);
+
+  float beamAzimuth = 0.5 * p.hfov - (beam + 0.5) * p.hfov / p.beamCount;
+
+  float binSize = (p.far - p.near) / p.rangeBinCount;
+  float rMin = p.near + bin * binSize;
+  float rMax = rMin + binSize;
+
+  float support = kBeamSupport * p.beamWidth;
+  float azLeft = min(beamAzimuth + support, 0.5 * p.hfov);
+  float azRight = max(beamAzimuth - support, -0.5 * p.hfov);
+  int c0 = int(clamp(floor((-tan(azLeft) / p.tanHalfFov.x * 0.5 + 0.5) * w),
+      0.0, w - 1.0));
+  int c1 = int(clamp(ceil((-tan(azRight) / p.tanHalfFov.x * 0.5 + 0.5) * w),
+      0.0, w - 1.0));
+  c1 = min(c1, c0 + kMaxColumns - 1);
+
+  float pixelArea = 4.0 * p.tanHalfFov.x * p.tanHalfFov.y / (w * h);
+
+  float sum = 0.0;
+  for (int c = c0; c <= c1; ++c)
+  {
+    float x = ((float(c) + 0.5) / w * 2.0 - 1.0) * p.tanHalfFov.x;
+    float dAz = -atan(x) - beamAzimuth;
+    float horizontal = sinc2(kHalfPower * 2.0 * dAz / p.beamWidth);
+    for (int r = 0; r < int(h); ++r)
+    {
+      float2 s = sourceTexture.read(uint2(c, r)).xy;
+      float range = s.x;
+      if (range < rMin || range >= rMax || s.y <= 0.0)
+        continue;
+
+      float y = (1.0 - (float(r) + 0.5) / h * 2.0) * p.tanHalfFov.y;
+      float elevation = atan2(y, sqrt(1.0 + x * x));
+      float vertical = sinc2(kHalfPower * 2.0 * elevation / p.vfov);
+
+      float dist2 = 1.0 + x * x + y * y;
+      float solidAngle = pixelArea / (dist2 * sqrt(dist2));
+      float loss = pow(10.0, -0.2 * p.attenuation * range) / (range * range);
+      sum += s.y * horizontal * vertical * solidAngle * loss;
+    }
+  }
+
+  float u = rand(inPs.uv0 + p.offsets.xy);
+  sum *= mix(1.0, -log(u), p.speckle);
+
+  return float4(sum, 0.0, 0.0, 1.0);
+}
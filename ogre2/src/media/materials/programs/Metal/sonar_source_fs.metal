@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: sonar_source_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float3 viewPos;
+  float3 viewNormal;
+};
+
+struct Params
+{
+  float4 reflectivity;
+};
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float range = length(inPs.viewPos);
+  float3 toSensor = -inPs.viewPos / max(range, 1e-6);
+
+  float3 n = inPs.viewNormal;
+  if (length(n) < 1e-6)
+    n = toSensor;
+  n = normalize(n);
+
+  float cosIncidence = abs(dot(n, toSensor));
+
+  return float4(range, p.reflectivity.x * cosIncidence, 0.0, 1.0);
+}
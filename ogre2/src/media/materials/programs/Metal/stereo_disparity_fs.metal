@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: stereo_disparity_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float2 projectionParams;
+  float far;
+  float focalBaseline;
+};
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float>  depthTexture [[texture(0)]],
+  sampler depthSampler [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float fDepth = depthTexture.sample(depthSampler,
+      float2(inPs.uv0.x * 0.5, inPs.uv0.y)).x;
+  float z = p.far * p.projectionParams.y / (fDepth - p.projectionParams.x);
+
+  float disparity = 0.0;
+  if (z > 0.0 && z < p.far * (1.0 - 1e-4))
+    disparity = p.focalBaseline / z;
+
+  return float4(disparity, 0.0, 0.0, 1.0);
+}
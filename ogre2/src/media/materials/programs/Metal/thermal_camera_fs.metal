@@ -39,8 +39,35 @@ struct Params
   float ambient;
   int rgbToTemp;
   int bitDepth;
+  int radiometric;
+  float reflectedTemp;
+  float extinctionCoeff;
+  float4 mediaExtinction;
+  float4 mediaUp;
+  float mediaFalloff;
 };
 
+// see participating_media_fs.glsl for documentation on the media
+// functions
+
+float mediaHeightIntegral(float z, float falloff)
+{
+  if (z <= 0.0 || falloff <= 0.0)
+    return z;
+  return (1.0 - exp(-falloff * z)) / falloff;
+}
+
+float mediaDensityLength(float3 viewPos, float4 up, float falloff)
+{
+  float l = length(viewPos);
+  float z0 = up.w;
+  float z1 = z0 + dot(viewPos, up.xyz);
+  if (abs(z1 - z0) < 1e-4)
+    return l * (z0 <= 0.0 ? 1.0 : exp(-falloff * z0));
+  return l * (mediaHeightIntegral(z1, falloff) -
+      mediaHeightIntegral(z0, falloff)) / (z1 - z0);
+}
+
 float getDepth(
   float2 uv,
   texture2d<float> depthTexture,
@@ -76,13 +103,14 @@ fragment float4 main_metal
   // check for heat source
   // heat source are objects with uniform temperature or heat signature
   // The custom heat source / signature shaders stores heat data in
-  // a vec4 of [heat, 0, 0, 0] so we test to see if it is a heat
-  // source by checking gba == 0. This is more of a hack but the idea is to
+  // a vec4 of [heat, 0, 1 - emissivity, 0] so we test to see if it is a heat
+  // source by checking ga == 0. This is more of a hack but the idea is to
   // avoid having to render an extra pass to create a mask of heat source
   // objects
   float4 rgba = colorTexture.sample(colorSampler, inPs.uv0).rgba;
-  bool isHeatSource = (rgba.g == 0.0 && rgba.b == 0.0 && rgba.a == 0.0);
+  bool isHeatSource = (rgba.g == 0.0 && rgba.a == 0.0);
   float heat = rgba.r;
+  float emissivity = 1.0;
 
   if (isHeatSource)
   {
@@ -93,6 +121,8 @@ fragment float4 main_metal
 
     // set temperature variation for heat source
     heatRange = p.heatSourceTempRange;
+
+    emissivity = 1.0 - rgba.b;
   }
   else
   {
@@ -124,6 +154,42 @@ fragment float4 main_metal
   // simulate temp variations
   float delta = (1.0 - dNorm) * heatRange;
   temp = temp - heatRange / 2.0 + delta;
+
+  // infrared transmission through the participating media
+  float mediaTau = 1.0;
+  if (p.mediaExtinction.w > 0.0)
+  {
+    float3 viewSpacePos = inPs.cameraDir *
+        getDepth(inPs.uv0, depthTexture, depthSampler, p.projectionParams);
+    mediaTau = exp(-p.mediaExtinction.w *
+        mediaDensityLength(viewSpacePos, p.mediaUp, p.mediaFalloff));
+  }
+
+  if (p.radiometric == 1)
+  {
+    // distance from the sensor to the object
+    float d = getDepth(inPs.uv0, depthTexture, depthSampler, p.projectionParams);
+    float dist = length(inPs.cameraDir * d);
+
+    // atmospheric transmission over the distance
+    float tau = exp(-p.extinctionCoeff * dist) * mediaTau;
+
+    // total radiance received by the sensor, see thermal_camera_fs.glsl
+    float tObj = temp * 0.01;
+    float tRefl = p.reflectedTemp * 0.01;
+    float tAtm = p.ambient * 0.01;
+    float radiance = tau * (emissivity * pow(tObj, 4.0) +
+        (1.0 - emissivity) * pow(tRefl, 4.0)) +
+        (1.0 - tau) * pow(tAtm, 4.0);
+
+    // apparent temperature of a black body emitting the same radiance
+    temp = pow(radiance, 0.25) * 100.0;
+  }
+  else
+  {
+    temp = mix(p.ambient, temp, mediaTau);
+  }
+
   clamp(temp, p.min, p.max);
 
   // apply resolution factor
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float3 pos;
+  float3 normal;
+};
+
+struct Params
+{
+  float3 cameraPos;
+  float3 sunDirection;
+  float4 deepColor;
+  float4 skyColor;
+};
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float3 n = normalize(inPs.normal);
+  float3 v = normalize(p.cameraPos - inPs.pos);
+
+  // viewed from below the surface
+  if (dot(n, v) < 0.0)
+    n = -n;
+
+  // Schlick's approximation with the reflectance of water at normal incidence
+  float fresnel = 0.02 + 0.98 * pow(1.0 - max(dot(n, v), 0.0), 5.0);
+
+  float3 h = normalize(normalize(p.sunDirection) + v);
+  float specular = pow(max(dot(n, h), 0.0), 200.0);
+
+  float3 color = mix(p.deepColor.rgb, p.skyColor.rgb, fresnel) +
+      float3(specular);
+  return float4(color, 1.0);
+}
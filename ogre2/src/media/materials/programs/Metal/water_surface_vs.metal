@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <metal_stdlib>
+using namespace metal;
+
+// Keep in sync with GerstnerWaves::kMaxWaveCount and the wave function in
+// GerstnerWaves::Displacement
+#define MAX_WAVES 8
+
+struct VS_INPUT
+{
+  float4 position [[attribute(VES_POSITION)]];
+};
+
+struct PS_INPUT
+{
+  float4 gl_Position [[position]];
+  float3 pos;
+  float3 normal;
+};
+
+struct Params
+{
+  float4x4 worldViewProj;
+  float3 cameraPos;
+
+  // (half size x, half size y, grid snap distance, unused)
+  float4 gridParams;
+
+  int waveCount;
+  // (amplitude, wavenumber, angular frequency, steepness)
+  float4 waveParams[MAX_WAVES];
+  // (direction x, direction y, phase at current time, unused)
+  float4 waveDirs[MAX_WAVES];
+};
+
+vertex PS_INPUT main_metal
+(
+  VS_INPUT input [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  PS_INPUT outVs;
+
+  // move the grid with the camera in steps of the coarsest cell size so
+  // the vertices of all levels stay on their own grid and do not swim.
+  float2 halfSize = p.gridParams.xy;
+  float2 center = floor(p.cameraPos.xy / p.gridParams.z + 0.5) *
+      p.gridParams.z;
+  float2 x0 = clamp(input.position.xy + center, -halfSize, halfSize);
+
+  float3 pos = float3(x0, 0.0);
+  float3 b = float3(1.0, 0.0, 0.0);
+  float3 t = float3(0.0, 1.0, 0.0);
+  for (int i = 0; i < p.waveCount; ++i)
+  {
+    float a = p.waveParams[i].x;
+    float k = p.waveParams[i].y;
+    float q = p.waveParams[i].w;
+    float2 d = p.waveDirs[i].xy;
+    float theta = k * dot(d, x0) + p.waveDirs[i].z;
+    float s = sin(theta);
+    float c = cos(theta);
+
+    pos.xy -= q * a * d * s;
+    pos.z += a * c;
+
+    float qkac = q * k * a * c;
+    float kas = k * a * s;
+    b += float3(-qkac * d.x * d.x, -qkac * d.x * d.y, -kas * d.x);
+    t += float3(-qkac * d.x * d.y, -qkac * d.y * d.y, -kas * d.y);
+  }
+
+  outVs.gl_Position = p.worldViewProj * float4(pos, 1.0);
+  outVs.pos = pos;
+  outVs.normal = normalize(cross(b, t));
+
+  return outVs;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: wide_angle_remap_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float4 faceRot[6];
+  float4 invalidColor;
+  float nearest;
+  float rotatePoints;
+  float4 texResolution;
+};
+
+float4 sampleFace(texture2d<float> tex, sampler texSampler, float2 uv,
+    constant Params &p)
+{
+  if (p.nearest > 0.5)
+  {
+    uint2 texel = uint2(min(uv * p.texResolution.xy,
+        p.texResolution.xy - 1.0));
+    return tex.read(texel);
+  }
+  return tex.sample(texSampler, uv);
+}
+
+float3 rotate(float4 q, float3 v)
+{
+  float3 t = 2.0 * cross(q.xyz, v);
+  return v + q.w * t + cross(q.xyz, t);
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float>  lookupTex [[texture(0)]],
+  texture2d<float>  tex0      [[texture(1)]],
+  texture2d<float>  tex1      [[texture(2)]],
+  texture2d<float>  tex2      [[texture(3)]],
+  texture2d<float>  tex3      [[texture(4)]],
+  texture2d<float>  tex4      [[texture(5)]],
+  texture2d<float>  tex5      [[texture(6)]],
+  sampler lookupTexSampler    [[sampler(0)]],
+  sampler tex0Sampler         [[sampler(1)]],
+  sampler tex1Sampler         [[sampler(2)]],
+  sampler tex2Sampler         [[sampler(3)]],
+  sampler tex3Sampler         [[sampler(4)]],
+  sampler tex4Sampler         [[sampler(5)]],
+  sampler tex5Sampler         [[sampler(6)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float4 data = lookupTex.sample(lookupTexSampler, inPs.uv0);
+  if (data.w < 0.5)
+    return p.invalidColor;
+
+  int faceIdx = int(data.z + 0.5);
+  float2 uv = data.xy;
+  float4 color = float4(0.0);
+  if (faceIdx == 0)
+    color = sampleFace(tex0, tex0Sampler, uv, p);
+  else if (faceIdx == 1)
+    color = sampleFace(tex1, tex1Sampler, uv, p);
+  else if (faceIdx == 2)
+    color = sampleFace(tex2, tex2Sampler, uv, p);
+  else if (faceIdx == 3)
+    color = sampleFace(tex3, tex3Sampler, uv, p);
+  else if (faceIdx == 4)
+    color = sampleFace(tex4, tex4Sampler, uv, p);
+  else if (faceIdx == 5)
+    color = sampleFace(tex5, tex5Sampler, uv, p);
+
+  if (p.rotatePoints > 0.5 && !any(isinf(color.xyz)) &&
+      !any(isnan(color.xyz)))
+    color.xyz = rotate(p.faceRot[faceIdx], color.xyz);
+
+  return color;
+}
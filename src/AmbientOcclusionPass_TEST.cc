@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/AmbientOcclusionPass.hh"
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class AmbientOcclusionPassTest : public testing::Test,
+    public testing::WithParamInterface<const char*>
+{
+  /// \brief Test ambient occlusion pass properties
+  public: void AmbientOcclusion(const std::string &_renderEngine);
+
+  /// \brief Test that the pass darkens creases in camera images
+  public: void CameraImage(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void AmbientOcclusionPassTest::AmbientOcclusion(
+    const std::string &_renderEngine)
+{
+  // get engine
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // get the render pass system
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Render engine '" << _renderEngine << "' does not support "
+            << "render pass system" << std::endl;
+    return;
+  }
+  RenderPassPtr pass = rpSystem->Create<AmbientOcclusionPass>();
+  AmbientOcclusionPassPtr aoPass =
+      std::dynamic_pointer_cast<AmbientOcclusionPass>(pass);
+  ASSERT_NE(nullptr, aoPass);
+
+  // verify initial values
+  EXPECT_DOUBLE_EQ(0.5, aoPass->Radius());
+  EXPECT_EQ(16u, aoPass->SampleCount());
+  EXPECT_TRUE(aoPass->HalfResolution());
+  EXPECT_DOUBLE_EQ(1.0, aoPass->Intensity());
+
+  aoPass->SetRadius(0.2);
+  EXPECT_DOUBLE_EQ(0.2, aoPass->Radius());
+  aoPass->SetSampleCount(8u);
+  EXPECT_EQ(8u, aoPass->SampleCount());
+  aoPass->SetHalfResolution(false);
+  EXPECT_FALSE(aoPass->HalfResolution());
+  aoPass->SetIntensity(2.0);
+  EXPECT_DOUBLE_EQ(2.0, aoPass->Intensity());
+
+  // the sample count is clamped to [1, 64]
+  aoPass->SetSampleCount(0u);
+  EXPECT_EQ(1u, aoPass->SampleCount());
+  aoPass->SetSampleCount(100u);
+  EXPECT_EQ(64u, aoPass->SampleCount());
+
+  // invalid values are ignored
+  aoPass->SetRadius(0.0);
+  EXPECT_DOUBLE_EQ(0.2, aoPass->Radius());
+  aoPass->SetIntensity(-1.0);
+  EXPECT_DOUBLE_EQ(2.0, aoPass->Intensity());
+}
+
+/////////////////////////////////////////////////
+void AmbientOcclusionPassTest::CameraImage(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "AmbientOcclusionPass not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  ASSERT_NE(nullptr, rpSystem);
+
+  // a box standing on the ground, lit by ambient light only
+  ScenePtr scene = engine->CreateScene("scene");
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  scene->SetBackgroundColor(math::Color::Black);
+  VisualPtr root = scene->RootVisual();
+
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetAmbient(0.8, 0.8, 0.8);
+  material->SetDiffuse(0.8, 0.8, 0.8);
+
+  VisualPtr ground = scene->CreateVisual();
+  ground->AddGeometry(scene->CreatePlane());
+  ground->SetLocalScale(20.0, 20.0, 1.0);
+  ground->SetMaterial(material);
+  root->AddChild(ground);
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(0.0, 0.0, 0.5);
+  box->SetMaterial(material);
+  root->AddChild(box);
+
+  // camera looking down at the bottom edge of the box
+  CameraPtr camera = scene->CreateCamera("camera");
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetLocalPosition(-2.0, 0.0, 1.5);
+  camera->SetLocalRotation(0.0, 0.6, 0.0);
+  root->AddChild(camera);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  unsigned int size = 64u * 64u * 3u;
+  unsigned char *data = image.Data<unsigned char>();
+  unsigned int sum = 0u;
+  for (unsigned int i = 0; i < size; ++i)
+    sum += data[i];
+
+  // the occlusion darkens the image
+  RenderPassPtr pass = rpSystem->Create<AmbientOcclusionPass>();
+  AmbientOcclusionPassPtr aoPass =
+      std::dynamic_pointer_cast<AmbientOcclusionPass>(pass);
+  ASSERT_NE(nullptr, aoPass);
+  camera->AddRenderPass(aoPass);
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  unsigned int aoSum = 0u;
+  for (unsigned int i = 0; i < size; ++i)
+    aoSum += data[i];
+  EXPECT_LT(aoSum, sum);
+
+  // the occlusion can be evaluated at full resolution
+  aoPass->SetHalfResolution(false);
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  unsigned int fullSum = 0u;
+  for (unsigned int i = 0; i < size; ++i)
+    fullSum += data[i];
+  EXPECT_LT(fullSum, sum);
+
+  // the image is unchanged once the pass is disabled
+  aoPass->SetEnabled(false);
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  unsigned int disabledSum = 0u;
+  for (unsigned int i = 0; i < size; ++i)
+    disabledSum += data[i];
+  EXPECT_EQ(sum, disabledSum);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(AmbientOcclusionPassTest, AmbientOcclusion)
+{
+  AmbientOcclusion(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(AmbientOcclusionPassTest, CameraImage)
+{
+  CameraImage(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(AmbientOcclusion, AmbientOcclusionPassTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -147,6 +147,46 @@ void CameraTest::ViewProjectionMatrix(const std::string &_renderEngine)
   EXPECT_LT(static_cast<int>(width * 0.5), pos2d.X());
   EXPECT_LT(static_cast<int>(height * 0.5), pos2d.Y());
 
+  // fisheye projection
+  EXPECT_EQ(math::Vector4d::Zero, camera->ProjectionCoefficients());
+  math::Vector4d coefficients(-0.01, 0.002, 0.0, 0.0);
+  camera->SetProjectionCoefficients(coefficients);
+  EXPECT_EQ(coefficients, camera->ProjectionCoefficients());
+  camera->SetProjectionType(CameraProjectionType::CPT_KANNALA_BRANDT);
+
+  // ogre only renders perspective and orthographic projections
+  if (_renderEngine.compare("ogre") == 0)
+  {
+    EXPECT_EQ(CameraProjectionType::CPT_PERSPECTIVE,
+        camera->ProjectionType());
+    math::Angle hfov = camera->HFOV();
+    camera->SetHFOV(math::Angle(IGN_PI * 200.0 / 180.0));
+    EXPECT_EQ(hfov, camera->HFOV());
+
+    // Clean up
+    engine->DestroyScene(scene);
+    rendering::unloadEngine(engine->Name());
+    return;
+  }
+
+  EXPECT_EQ(CameraProjectionType::CPT_KANNALA_BRANDT,
+      camera->ProjectionType());
+  camera->SetImageHeight(width);
+  camera->SetHFOV(math::Angle(IGN_PI * 200.0 / 180.0));
+
+  pos2d = camera->Project(math::Vector3d(2.0, 0, 0));
+  EXPECT_EQ(static_cast<int>(width * 0.5), pos2d.X());
+  EXPECT_EQ(static_cast<int>(width * 0.5), pos2d.Y());
+
+  // points slightly behind the camera are visible
+  pos2d = camera->Project(math::Vector3d(-0.1, 1, 0));
+  EXPECT_LT(0, pos2d.X());
+  EXPECT_GT(static_cast<int>(width * 0.5), pos2d.X());
+  EXPECT_EQ(static_cast<int>(width * 0.5), pos2d.Y());
+
+  camera->SetProjectionType(CameraProjectionType::CPT_PERSPECTIVE);
+  camera->SetHFOV(math::Angle(IGN_PI * 0.5));
+
   // Clean up
   engine->DestroyScene(scene);
   rendering::unloadEngine(engine->Name());
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/ChromaticAberrationPass.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class ChromaticAberrationPassTest : public testing::Test,
+    public testing::WithParamInterface<const char*>
+{
+  /// \brief Test chromatic aberration pass properties
+  public: void ChromaticAberration(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void ChromaticAberrationPassTest::ChromaticAberration(
+    const std::string &_renderEngine)
+{
+  // get engine
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // get the render pass system
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Render engine '" << _renderEngine << "' does not support "
+            << "render pass system" << std::endl;
+    return;
+  }
+  RenderPassPtr pass = rpSystem->Create<ChromaticAberrationPass>();
+  ChromaticAberrationPassPtr caPass =
+      std::dynamic_pointer_cast<ChromaticAberrationPass>(pass);
+  ASSERT_NE(nullptr, caPass);
+
+  // verify initial values
+  EXPECT_DOUBLE_EQ(0.005, caPass->Strength());
+
+  // strength is clamped to [-0.5, 0.5]
+  caPass->SetStrength(-0.01);
+  EXPECT_DOUBLE_EQ(-0.01, caPass->Strength());
+  caPass->SetStrength(1.0);
+  EXPECT_DOUBLE_EQ(0.5, caPass->Strength());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ChromaticAberrationPassTest, ChromaticAberration)
+{
+  ChromaticAberration(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(ChromaticAberration, ChromaticAberrationPassTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Decal.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Light.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class DecalTest : public testing::Test,
+                  public testing::WithParamInterface<const char *>
+{
+  /// \brief Test decal properties
+  public: void Properties(const std::string &_renderEngine);
+
+  /// \brief Test that decals are projected onto surfaces in camera images
+  public: void CameraImage(const std::string &_renderEngine);
+
+  /// \brief Path to test media files.
+  public: const std::string TEST_MEDIA_PATH{
+        common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+        "test", "media", "materials", "textures")};
+};
+
+/////////////////////////////////////////////////
+void DecalTest::Properties(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Decal not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+
+  DecalPtr decal = scene->CreateDecal();
+  ASSERT_NE(nullptr, decal);
+
+  // default values
+  EXPECT_EQ(math::Vector3d::One, decal->Size());
+  EXPECT_TRUE(decal->DiffuseTexture().empty());
+  EXPECT_TRUE(decal->NormalTexture().empty());
+  EXPECT_TRUE(decal->EmissiveTexture().empty());
+  EXPECT_DOUBLE_EQ(1.0, decal->Roughness());
+  EXPECT_DOUBLE_EQ(0.0, decal->Metalness());
+
+  std::string texture = common::joinPaths(TEST_MEDIA_PATH, "texture.png");
+  std::string normal = common::joinPaths(TEST_MEDIA_PATH, "flat_normal.png");
+  decal->SetSize(math::Vector3d(2.0, 0.5, 0.1));
+  EXPECT_EQ(math::Vector3d(2.0, 0.5, 0.1), decal->Size());
+  decal->SetDiffuseTexture(texture);
+  EXPECT_EQ(texture, decal->DiffuseTexture());
+  decal->SetNormalTexture(normal);
+  EXPECT_EQ(normal, decal->NormalTexture());
+  decal->SetEmissiveTexture(texture);
+  EXPECT_EQ(texture, decal->EmissiveTexture());
+  decal->SetRoughness(0.3);
+  EXPECT_DOUBLE_EQ(0.3, decal->Roughness());
+  decal->SetMetalness(0.7);
+  EXPECT_DOUBLE_EQ(0.7, decal->Metalness());
+
+  // invalid values are ignored
+  decal->SetSize(math::Vector3d(0.0, 1.0, 1.0));
+  EXPECT_EQ(math::Vector3d(2.0, 0.5, 0.1), decal->Size());
+  decal->SetSize(math::Vector3d(1.0, 1.0, -1.0));
+  EXPECT_EQ(math::Vector3d(2.0, 0.5, 0.1), decal->Size());
+  decal->SetRoughness(1.5);
+  EXPECT_DOUBLE_EQ(0.3, decal->Roughness());
+  decal->SetMetalness(-0.1);
+  EXPECT_DOUBLE_EQ(0.7, decal->Metalness());
+
+  // decals are nodes that can be attached to visuals
+  VisualPtr visual = scene->CreateVisual();
+  scene->RootVisual()->AddChild(visual);
+  visual->AddChild(decal);
+  decal->SetLocalPosition(1.0, 2.0, 3.0);
+  EXPECT_EQ(math::Vector3d(1.0, 2.0, 3.0), decal->LocalPosition());
+  EXPECT_EQ(1u, visual->ChildCount());
+
+  // textures can be removed
+  decal->SetDiffuseTexture("");
+  EXPECT_TRUE(decal->DiffuseTexture().empty());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void DecalTest::CameraImage(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Decal not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  scene->SetAmbientLight(0.3, 0.3, 0.3);
+  VisualPtr root = scene->RootVisual();
+
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetDirection(0.0, 0.0, -1.0);
+  light->SetDiffuseColor(1.0, 1.0, 1.0);
+  root->AddChild(light);
+
+  // gray ground plane below the camera
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(0.5, 0.5, 0.5);
+  VisualPtr ground = scene->CreateVisual();
+  ground->AddGeometry(scene->CreatePlane());
+  ground->SetLocalScale(10.0, 10.0, 1.0);
+  ground->SetMaterial(material);
+  root->AddChild(ground);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetLocalPosition(0.0, 0.0, 2.0);
+  camera->SetLocalRotation(0.0, IGN_PI / 2.0, 0.0);
+  root->AddChild(camera);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  unsigned int center = (32u * 64u + 32u) * 3u;
+  std::vector<unsigned char> plain(image.Data<unsigned char>() + center,
+      image.Data<unsigned char>() + center + 3u);
+
+  // a decal covering the center of the image changes the ground color
+  DecalPtr decal = scene->CreateDecal();
+  ASSERT_NE(nullptr, decal);
+  decal->SetSize(math::Vector3d(2.0, 2.0, 0.5));
+  decal->SetDiffuseTexture(
+      common::joinPaths(TEST_MEDIA_PATH, "gray_texture.png"));
+  decal->SetEmissiveTexture(
+      common::joinPaths(TEST_MEDIA_PATH, "texture.png"));
+  root->AddChild(decal);
+  camera->Capture(image);
+  unsigned char *data = image.Data<unsigned char>();
+  int diff = std::abs(data[center] - plain[0]) +
+      std::abs(data[center + 1u] - plain[1]) +
+      std::abs(data[center + 2u] - plain[2]);
+  EXPECT_GT(diff, 0);
+
+  // surfaces outside of the box are not affected
+  decal->SetLocalPosition(0.0, 0.0, 5.0);
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  EXPECT_EQ(plain[0], data[center]);
+  EXPECT_EQ(plain[1], data[center + 1u]);
+  EXPECT_EQ(plain[2], data[center + 2u]);
+
+  // many decals can be rendered at once
+  std::vector<DecalPtr> decals;
+  for (unsigned int i = 0; i < 1000u; ++i)
+  {
+    DecalPtr d = scene->CreateDecal();
+    ASSERT_NE(nullptr, d);
+    d->SetLocalPosition(-4.5 + (i % 32u) * 0.3, -4.5 + (i / 32u) * 0.3, 0.0);
+    d->SetSize(math::Vector3d(0.2, 0.2, 0.2));
+    d->SetDiffuseTexture(
+        common::joinPaths(TEST_MEDIA_PATH, "gray_texture.png"));
+    root->AddChild(d);
+    decals.push_back(d);
+  }
+  camera->Capture(image);
+
+  // the textures are repacked once decals are destroyed
+  for (auto &d : decals)
+    d->Destroy();
+  decals.clear();
+  decal->Destroy();
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  EXPECT_EQ(plain[0], data[center]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(DecalTest, Properties)
+{
+  Properties(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(DecalTest, CameraImage)
+{
+  CameraImage(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Decal, DecalTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
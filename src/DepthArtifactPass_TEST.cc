@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/DepthArtifactPass.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class DepthArtifactPassTest : public testing::Test,
+    public testing::WithParamInterface<const char*>
+{
+  /// \brief Test depth artifact pass properties
+  public: void DepthArtifact(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void DepthArtifactPassTest::DepthArtifact(const std::string &_renderEngine)
+{
+  // get engine
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // get the render pass system
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Render engine '" << _renderEngine << "' does not support "
+            << "render pass system" << std::endl;
+    return;
+  }
+  RenderPassPtr pass = rpSystem->Create<DepthArtifactPass>();
+  DepthArtifactPassPtr artifactPass =
+      std::dynamic_pointer_cast<DepthArtifactPass>(pass);
+  ASSERT_NE(nullptr, artifactPass);
+
+  // verify initial values, all artifacts are disabled
+  EXPECT_DOUBLE_EQ(0.0, artifactPass->ProjectorBaseline());
+  EXPECT_DOUBLE_EQ(0.0, artifactPass->DisparityQuantization());
+  EXPECT_DOUBLE_EQ(0.0, artifactPass->FlyingPixelThreshold());
+  EXPECT_DOUBLE_EQ(0.0, artifactPass->MultipathStrength());
+  EXPECT_DOUBLE_EQ(0.0, artifactPass->MinReflectance());
+  EXPECT_DOUBLE_EQ(1.0, artifactPass->MaxReflectance());
+  EXPECT_DOUBLE_EQ(IGN_PI * 0.5, artifactPass->MaxIncidenceAngle().Radian());
+
+  // the projector can be on either side of the camera
+  artifactPass->SetProjectorBaseline(0.05);
+  EXPECT_DOUBLE_EQ(0.05, artifactPass->ProjectorBaseline());
+  artifactPass->SetProjectorBaseline(-0.05);
+  EXPECT_DOUBLE_EQ(-0.05, artifactPass->ProjectorBaseline());
+
+  artifactPass->SetDisparityQuantization(0.125);
+  EXPECT_DOUBLE_EQ(0.125, artifactPass->DisparityQuantization());
+  artifactPass->SetFlyingPixelThreshold(0.1);
+  EXPECT_DOUBLE_EQ(0.1, artifactPass->FlyingPixelThreshold());
+  artifactPass->SetMultipathStrength(0.3);
+  EXPECT_DOUBLE_EQ(0.3, artifactPass->MultipathStrength());
+
+  // negative values are ignored
+  artifactPass->SetDisparityQuantization(-1.0);
+  EXPECT_DOUBLE_EQ(0.125, artifactPass->DisparityQuantization());
+  artifactPass->SetFlyingPixelThreshold(-1.0);
+  EXPECT_DOUBLE_EQ(0.1, artifactPass->FlyingPixelThreshold());
+  artifactPass->SetMultipathStrength(-1.0);
+  EXPECT_DOUBLE_EQ(0.3, artifactPass->MultipathStrength());
+
+  // reflectance range is clamped to [0, 1] and invalid ranges are ignored
+  artifactPass->SetReflectanceRange(0.1, 0.9);
+  EXPECT_DOUBLE_EQ(0.1, artifactPass->MinReflectance());
+  EXPECT_DOUBLE_EQ(0.9, artifactPass->MaxReflectance());
+  artifactPass->SetReflectanceRange(0.8, 0.2);
+  EXPECT_DOUBLE_EQ(0.1, artifactPass->MinReflectance());
+  EXPECT_DOUBLE_EQ(0.9, artifactPass->MaxReflectance());
+  artifactPass->SetReflectanceRange(-1.0, 2.0);
+  EXPECT_DOUBLE_EQ(0.0, artifactPass->MinReflectance());
+  EXPECT_DOUBLE_EQ(1.0, artifactPass->MaxReflectance());
+
+  // incidence angle is clamped to [0, 90] degrees
+  artifactPass->SetMaxIncidenceAngle(math::Angle(1.2));
+  EXPECT_DOUBLE_EQ(1.2, artifactPass->MaxIncidenceAngle().Radian());
+  artifactPass->SetMaxIncidenceAngle(math::Angle(IGN_PI));
+  EXPECT_DOUBLE_EQ(IGN_PI * 0.5, artifactPass->MaxIncidenceAngle().Radian());
+}
+
+/////////////////////////////////////////////////
+TEST_P(DepthArtifactPassTest, DepthArtifact)
+{
+  DepthArtifact(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(DepthArtifact, DepthArtifactPassTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/EventCamera.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class EventCameraTest : public testing::Test,
+                        public testing::WithParamInterface<const char *>
+{
+  /// \brief Test basic api
+  public: void EventCamera(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void EventCameraTest::EventCamera(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports event cameras
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' doesn't support event cameras" << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' was unable to be retrieved" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  EventCameraPtr camera(scene->CreateEventCamera());
+  ASSERT_NE(nullptr, camera);
+
+  // thresholds
+  EXPECT_GT(camera->PositiveThreshold(), 0.0);
+  EXPECT_GT(camera->NegativeThreshold(), 0.0);
+  camera->SetPositiveThreshold(0.3);
+  camera->SetNegativeThreshold(0.4);
+  EXPECT_DOUBLE_EQ(0.3, camera->PositiveThreshold());
+  EXPECT_DOUBLE_EQ(0.4, camera->NegativeThreshold());
+  camera->SetPositiveThreshold(0.0);
+  camera->SetNegativeThreshold(-1.0);
+  EXPECT_DOUBLE_EQ(0.3, camera->PositiveThreshold());
+  EXPECT_DOUBLE_EQ(0.4, camera->NegativeThreshold());
+
+  // noise
+  EXPECT_DOUBLE_EQ(0.0, camera->ThresholdNoise());
+  camera->SetThresholdNoise(0.03);
+  EXPECT_DOUBLE_EQ(0.03, camera->ThresholdNoise());
+  camera->SetThresholdNoise(-0.03);
+  EXPECT_DOUBLE_EQ(0.03, camera->ThresholdNoise());
+
+  // refractory period
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      camera->RefractoryPeriod());
+  camera->SetRefractoryPeriod(std::chrono::microseconds(100));
+  EXPECT_EQ(std::chrono::microseconds(100), camera->RefractoryPeriod());
+  camera->SetRefractoryPeriod(std::chrono::microseconds(-100));
+  EXPECT_EQ(std::chrono::microseconds(100), camera->RefractoryPeriod());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(EventCameraTest, EventCamera)
+{
+  EventCamera(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(EventCamera, EventCameraTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/ExposurePass.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class ExposurePassTest : public testing::Test,
+    public testing::WithParamInterface<const char*>
+{
+  /// \brief Test exposure pass properties
+  public: void Exposure(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void ExposurePassTest::Exposure(const std::string &_renderEngine)
+{
+  // get engine
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // get the render pass system
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Render engine '" << _renderEngine << "' does not support "
+            << "render pass system" << std::endl;
+    return;
+  }
+  RenderPassPtr pass = rpSystem->Create<ExposurePass>();
+  ExposurePassPtr exposurePass =
+      std::dynamic_pointer_cast<ExposurePass>(pass);
+  ASSERT_NE(nullptr, exposurePass);
+
+  // verify initial values
+  EXPECT_DOUBLE_EQ(0.0, exposurePass->ExposureCompensation());
+  EXPECT_FALSE(exposurePass->AutoExposureEnabled());
+  EXPECT_DOUBLE_EQ(0.18, exposurePass->KeyValue());
+  EXPECT_DOUBLE_EQ(1.0 / 16.0, exposurePass->MinExposure());
+  EXPECT_DOUBLE_EQ(16.0, exposurePass->MaxExposure());
+  EXPECT_EQ(TMT_NONE, exposurePass->ToneMapping());
+
+  // exposure compensation
+  exposurePass->SetExposureCompensation(-1.5);
+  EXPECT_DOUBLE_EQ(-1.5, exposurePass->ExposureCompensation());
+
+  // auto exposure
+  exposurePass->SetAutoExposureEnabled(true);
+  EXPECT_TRUE(exposurePass->AutoExposureEnabled());
+
+  // key value must be in (0, 1]
+  exposurePass->SetKeyValue(0.3);
+  EXPECT_DOUBLE_EQ(0.3, exposurePass->KeyValue());
+  exposurePass->SetKeyValue(0.0);
+  EXPECT_DOUBLE_EQ(0.3, exposurePass->KeyValue());
+  exposurePass->SetKeyValue(1.5);
+  EXPECT_DOUBLE_EQ(0.3, exposurePass->KeyValue());
+
+  // exposure limits
+  exposurePass->SetExposureLimits(0.5, 4.0);
+  EXPECT_DOUBLE_EQ(0.5, exposurePass->MinExposure());
+  EXPECT_DOUBLE_EQ(4.0, exposurePass->MaxExposure());
+  exposurePass->SetExposureLimits(4.0, 0.5);
+  EXPECT_DOUBLE_EQ(0.5, exposurePass->MinExposure());
+  EXPECT_DOUBLE_EQ(4.0, exposurePass->MaxExposure());
+
+  // tone mapping
+  exposurePass->SetToneMapping(TMT_ACES);
+  EXPECT_EQ(TMT_ACES, exposurePass->ToneMapping());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ExposurePassTest, Exposure)
+{
+  Exposure(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Exposure, ExposurePassTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,498 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <FreeImage.h>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+
+#include "ignition/rendering/FrameEncoder.hh"
+
+namespace
+{
+/// \brief A frame waiting to be encoded
+struct Frame
+{
+  /// \brief Output file name
+  std::string filename;
+
+  /// \brief Copy of the pixel data
+  std::vector<unsigned char> data;
+
+  /// \brief Image width in pixels
+  unsigned int width = 0u;
+
+  /// \brief Image height in pixels
+  unsigned int height = 0u;
+
+  /// \brief Pixel format of the data
+  ignition::rendering::PixelFormat format =
+      ignition::rendering::PF_UNKNOWN;
+};
+}
+
+/// \brief Private data for the FrameEncoder class
+class ignition::rendering::FrameEncoderPrivate
+{
+  /// \brief Encoder thread loop
+  /// \param[in] _generation Generation of threads this thread belongs to
+  public: void Run(unsigned int _generation);
+
+  /// \brief Start the encoder threads if they are not running
+  public: void StartThreads();
+
+  /// \brief Stop the encoder threads once the queue is empty
+  public: void StopThreads();
+
+  /// \brief Protects the queue, the threads and the settings
+  public: mutable std::mutex mutex;
+
+  /// \brief Notified when a frame is queued or the threads should stop
+  public: std::condition_variable frameQueued;
+
+  /// \brief Notified when a frame is removed from the queue or written
+  public: std::condition_variable frameDone;
+
+  /// \brief Frames waiting to be encoded
+  public: std::deque<Frame> queue;
+
+  /// \brief Encoder threads
+  public: std::vector<std::thread> threads;
+
+  /// \brief Number of frames being encoded
+  public: unsigned int busyCount = 0u;
+
+  /// \brief Incremented to let the current threads exit once the queue is
+  /// empty
+  public: unsigned int generation = 0u;
+
+  /// \brief Number of encoder threads
+  public: unsigned int threadCount = 2u;
+
+  /// \brief Max number of queued frames
+  public: unsigned int queueSize = 16u;
+
+  /// \brief Behavior when the queue is full
+  public: FrameQueuePolicy policy = FQP_DROP;
+
+  /// \brief Directory of the last queued frame, known to exist
+  public: std::string directory;
+
+  /// \brief Number of frames written to file
+  public: std::atomic<uint64_t> encodedCount{0u};
+
+  /// \brief Number of frames dropped because the queue was full
+  public: std::atomic<uint64_t> droppedCount{0u};
+
+  /// \brief Number of frames that could not be written
+  public: std::atomic<uint64_t> failedCount{0u};
+};
+
+using namespace ignition;
+using namespace rendering;
+
+namespace
+{
+  /// \brief Get the lower case extension of a file name
+  /// \param[in] _filename File name
+  /// \return Extension including the dot, or an empty string
+  std::string Extension(const std::string &_filename)
+  {
+    std::string base = common::basename(_filename);
+    size_t idx = base.rfind('.');
+    if (idx == std::string::npos)
+      return std::string();
+    std::string ext = base.substr(idx);
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+        [](unsigned char _c) {return static_cast<char>(std::tolower(_c));});
+    return ext;
+  }
+
+  /// \brief Create the parent directory of a file if it does not exist
+  /// \param[in] _filename File name
+  /// \return True if the directory exists or was created
+  bool CreateParentDirectory(const std::string &_filename)
+  {
+    std::string dir = common::parentPath(_filename);
+    if (!dir.empty() && dir != _filename && !common::exists(dir) &&
+        !common::createDirectories(dir))
+    {
+      ignerr << "Unable to create directory: " << dir << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  /// \brief Write an image file with FreeImage. The file format is chosen
+  /// from the extension.
+  /// \param[in] _filename Output file name
+  /// \param[in] _data Pixel data
+  /// \param[in] _width Image width in pixels
+  /// \param[in] _height Image height in pixels
+  /// \param[in] _format Pixel format of the data
+  /// \return True if the file was written
+  bool WriteImage(const std::string &_filename, const unsigned char *_data,
+      unsigned int _width, unsigned int _height, PixelFormat _format)
+  {
+    unsigned int channels = PixelUtil::ChannelCount(_format);
+    unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(_format);
+    unsigned int outChannels = channels;
+
+    // fast compression keeps the encoder threads ahead of the cameras.
+    // EXR keeps full float precision rather than converting to half
+    FREE_IMAGE_FORMAT fif = FIF_PNG;
+    int flags = PNG_Z_BEST_SPEED;
+    std::string ext = Extension(_filename);
+    if (ext == ".exr")
+    {
+      fif = FIF_EXR;
+      flags = EXR_FLOAT | EXR_ZIP;
+    }
+    else if (ext == ".pfm")
+    {
+      // PFM has no alpha channel
+      fif = FIF_PFM;
+      flags = 0;
+      outChannels = channels == 1u ? 1u : 3u;
+    }
+
+    FREE_IMAGE_TYPE type = FIT_BITMAP;
+    if (_format == PF_L16)
+      type = FIT_UINT16;
+    else if (bytesPerChannel == 4u && outChannels == 1u)
+      type = FIT_FLOAT;
+    else if (bytesPerChannel == 4u && outChannels == 3u)
+      type = FIT_RGBF;
+    else if (bytesPerChannel == 4u)
+      type = FIT_RGBAF;
+
+    FIBITMAP *bitmap = FreeImage_AllocateT(type, static_cast<int>(_width),
+        static_cast<int>(_height),
+        static_cast<int>(8u * outChannels * bytesPerChannel));
+    if (!bitmap)
+      return false;
+
+    // FreeImage stores rows from bottom to top, and 8 bit color pixels in
+    // the byte order of the platform
+    size_t rowSize = static_cast<size_t>(_width) * channels * bytesPerChannel;
+    size_t outPixelSize = outChannels * bytesPerChannel;
+    bool bgr = _format == PF_B8G8R8;
+    for (unsigned int y = 0u; y < _height; ++y)
+    {
+      const unsigned char *src = _data + y * rowSize;
+      BYTE *dst = FreeImage_GetScanLine(bitmap,
+          static_cast<int>(_height - 1u - y));
+      if (type == FIT_BITMAP && channels >= 3u)
+      {
+        for (unsigned int x = 0u; x < _width; ++x)
+        {
+          const unsigned char *in = src + x * channels;
+          BYTE *out = dst + x * channels;
+          out[FI_RGBA_RED] = in[bgr ? 2u : 0u];
+          out[FI_RGBA_GREEN] = in[1u];
+          out[FI_RGBA_BLUE] = in[bgr ? 0u : 2u];
+          if (channels == 4u)
+            out[FI_RGBA_ALPHA] = in[3u];
+        }
+      }
+      else if (outChannels == channels)
+      {
+        std::memcpy(dst, src, rowSize);
+      }
+      else
+      {
+        for (unsigned int x = 0u; x < _width; ++x)
+        {
+          std::memcpy(dst + x * outPixelSize,
+              src + x * channels * bytesPerChannel, outPixelSize);
+        }
+      }
+    }
+
+    bool saved =
+        FreeImage_Save(fif, bitmap, _filename.c_str(), flags) != FALSE;
+    FreeImage_Unload(bitmap);
+    return saved;
+  }
+}
+
+//////////////////////////////////////////////////
+void FrameEncoderPrivate::Run(unsigned int _generation)
+{
+  while (true)
+  {
+    Frame frame;
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->frameQueued.wait(lock, [&]
+          {return this->generation != _generation || !this->queue.empty();});
+      if (this->queue.empty())
+        return;
+      frame = std::move(this->queue.front());
+      this->queue.pop_front();
+      ++this->busyCount;
+    }
+    this->frameDone.notify_all();
+
+    // the output directory was created by Enqueue
+    if (WriteImage(frame.filename, frame.data.data(), frame.width,
+        frame.height, frame.format))
+    {
+      ++this->encodedCount;
+    }
+    else
+    {
+      ++this->failedCount;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      --this->busyCount;
+    }
+    this->frameDone.notify_all();
+  }
+}
+
+//////////////////////////////////////////////////
+void FrameEncoderPrivate::StartThreads()
+{
+  // must be called with the mutex locked
+  if (!this->threads.empty())
+    return;
+
+  for (unsigned int i = 0u; i < this->threadCount; ++i)
+  {
+    this->threads.emplace_back(&FrameEncoderPrivate::Run, this,
+        this->generation);
+  }
+}
+
+//////////////////////////////////////////////////
+void FrameEncoderPrivate::StopThreads()
+{
+  std::vector<std::thread> running;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    ++this->generation;
+    running.swap(this->threads);
+  }
+  this->frameQueued.notify_all();
+  for (auto &thread : running)
+    thread.join();
+}
+
+//////////////////////////////////////////////////
+FrameEncoder::FrameEncoder()
+  : dataPtr(std::make_unique<FrameEncoderPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+FrameEncoder::~FrameEncoder()
+{
+  this->dataPtr->StopThreads();
+}
+
+//////////////////////////////////////////////////
+bool FrameEncoder::Enqueue(const std::string &_filename, const void *_data,
+    unsigned int _width, unsigned int _height, PixelFormat _format)
+{
+  if (!_data || _width == 0u || _height == 0u)
+  {
+    ignerr << "Unable to save frame '" << _filename << "'. No image data."
+           << std::endl;
+    return false;
+  }
+
+  if (!IsSupported(_filename, _format))
+  {
+    ignerr << "Unable to save frame '" << _filename << "'. Pixel format ["
+           << PixelUtil::Name(_format) << "] can not be written to this "
+           << "file type." << std::endl;
+    return false;
+  }
+
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->queue.size() >= this->dataPtr->queueSize)
+  {
+    if (this->dataPtr->policy == FQP_DROP)
+    {
+      ++this->dataPtr->droppedCount;
+      return false;
+    }
+    this->dataPtr->frameDone.wait(lock, [this]
+        {return this->dataPtr->queue.size() < this->dataPtr->queueSize;});
+  }
+
+  // create the output directory here rather than from every encoder thread.
+  // Frame sequences usually go to a single directory, so this is done once
+  std::string dir = common::parentPath(_filename);
+  if (dir != this->dataPtr->directory)
+  {
+    if (!CreateParentDirectory(_filename))
+      return false;
+    this->dataPtr->directory = dir;
+  }
+
+  Frame frame;
+  frame.filename = _filename;
+  frame.width = _width;
+  frame.height = _height;
+  frame.format = _format;
+  const unsigned char *data = static_cast<const unsigned char *>(_data);
+  frame.data.assign(data,
+      data + PixelUtil::MemorySize(_format, _width, _height));
+  this->dataPtr->queue.push_back(std::move(frame));
+
+  this->dataPtr->StartThreads();
+  lock.unlock();
+  this->dataPtr->frameQueued.notify_one();
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool FrameEncoder::Encode(const std::string &_filename, const void *_data,
+    unsigned int _width, unsigned int _height, PixelFormat _format)
+{
+  if (!_data || !IsSupported(_filename, _format))
+    return false;
+
+  if (!CreateParentDirectory(_filename))
+    return false;
+
+  return WriteImage(_filename, static_cast<const unsigned char *>(_data),
+      _width, _height, _format);
+}
+
+//////////////////////////////////////////////////
+bool FrameEncoder::IsSupported(const std::string &_filename,
+    PixelFormat _format)
+{
+  std::string ext = Extension(_filename);
+  if (ext == ".png")
+  {
+    return _format == PF_L8 || _format == PF_R8G8B8 ||
+        _format == PF_B8G8R8 || _format == PF_R8G8B8A8 || _format == PF_L16;
+  }
+  if (ext == ".exr" || ext == ".pfm")
+  {
+    return _format == PF_FLOAT32_R || _format == PF_FLOAT32_RGB ||
+        _format == PF_FLOAT32_RGBA;
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////
+void FrameEncoder::Flush()
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->frameDone.wait(lock, [this]
+      {return this->dataPtr->queue.empty() && this->dataPtr->busyCount == 0u;});
+}
+
+//////////////////////////////////////////////////
+void FrameEncoder::SetThreadCount(unsigned int _count)
+{
+  // let the current threads finish the queue, new threads are started with
+  // the next frame
+  this->dataPtr->StopThreads();
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->threadCount = std::max(1u, _count);
+}
+
+//////////////////////////////////////////////////
+unsigned int FrameEncoder::ThreadCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->threadCount;
+}
+
+//////////////////////////////////////////////////
+void FrameEncoder::SetQueueSize(unsigned int _size)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->queueSize = std::max(1u, _size);
+  }
+  // wake up callers blocked on a full queue
+  this->dataPtr->frameDone.notify_all();
+}
+
+//////////////////////////////////////////////////
+unsigned int FrameEncoder::QueueSize() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->queueSize;
+}
+
+//////////////////////////////////////////////////
+void FrameEncoder::SetQueuePolicy(FrameQueuePolicy _policy)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->policy = _policy;
+}
+
+//////////////////////////////////////////////////
+FrameQueuePolicy FrameEncoder::QueuePolicy() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->policy;
+}
+
+//////////////////////////////////////////////////
+unsigned int FrameEncoder::PendingFrameCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return static_cast<unsigned int>(this->dataPtr->queue.size());
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameEncoder::EncodedFrameCount() const
+{
+  return this->dataPtr->encodedCount;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameEncoder::DroppedFrameCount() const
+{
+  return this->dataPtr->droppedCount;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameEncoder::FailedFrameCount() const
+{
+  return this->dataPtr->failedCount;
+}
+
+//////////////////////////////////////////////////
+void FrameEncoder::ResetStats()
+{
+  this->dataPtr->encodedCount = 0u;
+  this->dataPtr->droppedCount = 0u;
+  this->dataPtr->failedCount = 0u;
+}
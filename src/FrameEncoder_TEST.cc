@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Filesystem.hh>
+#include <ignition/common/Image.hh>
+#include <ignition/math/Color.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/FrameEncoder.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Output directory of the test files
+const std::string kTestDir = common::joinPaths(
+    std::string(PROJECT_BUILD_PATH), "test", "frame_encoder");
+
+/////////////////////////////////////////////////
+TEST(FrameEncoderTest, IsSupported)
+{
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.png", PF_R8G8B8));
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.PNG", PF_B8G8R8));
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.png", PF_R8G8B8A8));
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.png", PF_L8));
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.png", PF_L16));
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.pfm", PF_FLOAT32_R));
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.pfm", PF_FLOAT32_RGBA));
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.exr", PF_FLOAT32_R));
+  EXPECT_TRUE(FrameEncoder::IsSupported("a.EXR", PF_FLOAT32_RGB));
+
+  EXPECT_FALSE(FrameEncoder::IsSupported("a.png", PF_FLOAT32_R));
+  EXPECT_FALSE(FrameEncoder::IsSupported("a.pfm", PF_R8G8B8));
+  EXPECT_FALSE(FrameEncoder::IsSupported("a.jpg", PF_R8G8B8));
+  EXPECT_FALSE(FrameEncoder::IsSupported("png", PF_R8G8B8));
+}
+
+/////////////////////////////////////////////////
+TEST(FrameEncoderTest, Png)
+{
+  const unsigned int width = 5u;
+  const unsigned int height = 3u;
+
+  // 8 bit color, red on the top row and blue below
+  std::vector<unsigned char> color(width * height * 3u, 0u);
+  for (unsigned int i = 0; i < width * height; ++i)
+    color[i * 3u + (i < width ? 0u : 2u)] = 255u;
+
+  std::string filename = common::joinPaths(kTestDir, "color.png");
+  EXPECT_TRUE(FrameEncoder::Encode(filename, color.data(), width, height,
+      PF_R8G8B8));
+  common::Image image;
+  ASSERT_EQ(0, image.Load(filename));
+  EXPECT_EQ(width, image.Width());
+  EXPECT_EQ(height, image.Height());
+  EXPECT_EQ(math::Color::Red, image.Pixel(0u, 0u));
+  EXPECT_EQ(math::Color::Blue, image.Pixel(0u, 1u));
+
+  // same data read as BGR swaps red and blue
+  filename = common::joinPaths(kTestDir, "color_bgr.png");
+  EXPECT_TRUE(FrameEncoder::Encode(filename, color.data(), width, height,
+      PF_B8G8R8));
+  ASSERT_EQ(0, image.Load(filename));
+  EXPECT_EQ(math::Color::Blue, image.Pixel(0u, 0u));
+  EXPECT_EQ(math::Color::Red, image.Pixel(0u, 1u));
+
+  // 16 bit grayscale
+  std::vector<uint16_t> depth(width * height);
+  for (unsigned int i = 0; i < depth.size(); ++i)
+    depth[i] = static_cast<uint16_t>(i * 1000u);
+  filename = common::joinPaths(kTestDir, "depth16.png");
+  EXPECT_TRUE(FrameEncoder::Encode(filename, depth.data(), width, height,
+      PF_L16));
+  ASSERT_EQ(0, image.Load(filename));
+  EXPECT_EQ(width, image.Width());
+  EXPECT_EQ(height, image.Height());
+  EXPECT_EQ(16u, image.BPP());
+
+  // unsupported format
+  EXPECT_FALSE(FrameEncoder::Encode(filename, depth.data(), width, height,
+      PF_FLOAT32_R));
+}
+
+/////////////////////////////////////////////////
+TEST(FrameEncoderTest, Float)
+{
+  const unsigned int width = 4u;
+  const unsigned int height = 2u;
+  std::vector<float> data(width * height * 4u);
+  for (unsigned int i = 0; i < data.size(); ++i)
+    data[i] = 0.5f * i;
+
+  // one channel and color, the alpha channel of PFM is dropped
+  for (const std::string &ext : {".exr", ".pfm"})
+  {
+    std::string filename = common::joinPaths(kTestDir, "depth" + ext);
+    EXPECT_TRUE(FrameEncoder::Encode(filename, data.data(), width, height,
+        PF_FLOAT32_R));
+    common::Image image;
+    ASSERT_EQ(0, image.Load(filename)) << filename;
+    EXPECT_EQ(width, image.Width());
+    EXPECT_EQ(height, image.Height());
+    EXPECT_EQ(32u, image.BPP());
+
+    filename = common::joinPaths(kTestDir, "color" + ext);
+    EXPECT_TRUE(FrameEncoder::Encode(filename, data.data(), width, height,
+        PF_FLOAT32_RGBA));
+    ASSERT_EQ(0, image.Load(filename)) << filename;
+    EXPECT_EQ(width, image.Width());
+    EXPECT_EQ(height, image.Height());
+    EXPECT_EQ(ext == ".exr" ? 128u : 96u, image.BPP());
+  }
+
+  // unsupported format
+  EXPECT_FALSE(FrameEncoder::Encode(common::joinPaths(kTestDir, "a.exr"),
+      data.data(), width, height, PF_L16));
+}
+
+/////////////////////////////////////////////////
+TEST(FrameEncoderTest, Queue)
+{
+  FrameEncoder encoder;
+  EXPECT_EQ(2u, encoder.ThreadCount());
+  EXPECT_EQ(16u, encoder.QueueSize());
+  EXPECT_EQ(FQP_DROP, encoder.QueuePolicy());
+  EXPECT_EQ(0u, encoder.PendingFrameCount());
+
+  encoder.SetThreadCount(0u);
+  EXPECT_EQ(1u, encoder.ThreadCount());
+  encoder.SetQueueSize(0u);
+  EXPECT_EQ(1u, encoder.QueueSize());
+
+  const unsigned int width = 64u;
+  const unsigned int height = 48u;
+  std::vector<unsigned char> data(width * height * 3u, 128u);
+
+  // invalid input
+  EXPECT_FALSE(encoder.Enqueue(common::joinPaths(kTestDir, "a.png"),
+      nullptr, width, height, PF_R8G8B8));
+  EXPECT_FALSE(encoder.Enqueue(common::joinPaths(kTestDir, "a.exr"),
+      data.data(), width, height, PF_R8G8B8));
+
+  // blocking policy never drops frames
+  encoder.SetQueuePolicy(FQP_BLOCK);
+  EXPECT_EQ(FQP_BLOCK, encoder.QueuePolicy());
+  const unsigned int count = 10u;
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    EXPECT_TRUE(encoder.Enqueue(common::joinPaths(kTestDir,
+        "block_" + std::to_string(i) + ".png"), data.data(), width, height,
+        PF_R8G8B8));
+  }
+  encoder.Flush();
+  EXPECT_EQ(0u, encoder.PendingFrameCount());
+  EXPECT_EQ(count, encoder.EncodedFrameCount());
+  EXPECT_EQ(0u, encoder.DroppedFrameCount());
+  EXPECT_EQ(0u, encoder.FailedFrameCount());
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    EXPECT_TRUE(common::isFile(common::joinPaths(kTestDir,
+        "block_" + std::to_string(i) + ".png")));
+  }
+
+  // dropping policy: every frame is either written or dropped
+  encoder.ResetStats();
+  EXPECT_EQ(0u, encoder.EncodedFrameCount());
+  encoder.SetQueuePolicy(FQP_DROP);
+  unsigned int queued = 0u;
+  for (unsigned int i = 0; i < 100u; ++i)
+  {
+    if (encoder.Enqueue(common::joinPaths(kTestDir, "drop.png"),
+        data.data(), width, height, PF_R8G8B8))
+    {
+      ++queued;
+    }
+  }
+  encoder.Flush();
+  EXPECT_EQ(queued, encoder.EncodedFrameCount());
+  EXPECT_EQ(100u - queued, encoder.DroppedFrameCount());
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <utility>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/GerstnerWaves.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+class ignition::rendering::GerstnerWavesPrivate
+{
+  /// \brief Wave components
+  public: std::vector<GerstnerWave> waves;
+
+  /// \brief Gravitational acceleration used by the dispersion relation
+  public: double gravity = 9.81;
+
+  /// \brief Max number of fixed point iterations used to find the
+  /// undisplaced point in height queries
+  public: const unsigned int kMaxIterations = 16u;
+
+  /// \brief Convergence tolerance of height queries in meters
+  public: const double kTolerance = 1e-9;
+};
+
+const unsigned int GerstnerWaves::kMaxWaveCount = 8u;
+
+//////////////////////////////////////////////////
+GerstnerWaves::GerstnerWaves()
+  : dataPtr(std::make_unique<GerstnerWavesPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+GerstnerWaves::GerstnerWaves(const GerstnerWaves &_waves)
+  : dataPtr(new GerstnerWavesPrivate(*_waves.dataPtr))
+{
+}
+
+//////////////////////////////////////////////////
+GerstnerWaves::GerstnerWaves(GerstnerWaves &&_waves)
+  : dataPtr(std::exchange(_waves.dataPtr,
+        std::make_unique<GerstnerWavesPrivate>()))
+{
+}
+
+//////////////////////////////////////////////////
+GerstnerWaves::~GerstnerWaves()
+{
+}
+
+//////////////////////////////////////////////////
+GerstnerWaves &GerstnerWaves::operator=(const GerstnerWaves &_waves)
+{
+  return *this = GerstnerWaves(_waves);
+}
+
+//////////////////////////////////////////////////
+GerstnerWaves &GerstnerWaves::operator=(GerstnerWaves &&_waves)
+{
+  std::swap(this->dataPtr, _waves.dataPtr);
+  return *this;
+}
+
+//////////////////////////////////////////////////
+bool GerstnerWaves::AddWave(const GerstnerWave &_wave)
+{
+  if (this->dataPtr->waves.size() >= kMaxWaveCount)
+  {
+    ignerr << "Unable to add wave. Max number of waves ["
+           << kMaxWaveCount << "] reached" << std::endl;
+    return false;
+  }
+
+  if (_wave.wavelength <= 0.0)
+  {
+    ignerr << "Unable to add wave. Wavelength must be positive" << std::endl;
+    return false;
+  }
+
+  GerstnerWave wave = _wave;
+  if (wave.direction == math::Vector2d::Zero)
+    wave.direction.Set(1.0, 0.0);
+  wave.direction.Normalize();
+  wave.steepness = math::clamp(wave.steepness, 0.0, 1.0);
+  this->dataPtr->waves.push_back(wave);
+  return true;
+}
+
+//////////////////////////////////////////////////
+unsigned int GerstnerWaves::WaveCount() const
+{
+  return static_cast<unsigned int>(this->dataPtr->waves.size());
+}
+
+//////////////////////////////////////////////////
+GerstnerWave GerstnerWaves::Wave(unsigned int _index) const
+{
+  if (_index >= this->dataPtr->waves.size())
+    return GerstnerWave();
+  return this->dataPtr->waves[_index];
+}
+
+//////////////////////////////////////////////////
+void GerstnerWaves::ClearWaves()
+{
+  this->dataPtr->waves.clear();
+}
+
+//////////////////////////////////////////////////
+void GerstnerWaves::SetGravity(double _gravity)
+{
+  this->dataPtr->gravity = _gravity;
+}
+
+//////////////////////////////////////////////////
+double GerstnerWaves::Gravity() const
+{
+  return this->dataPtr->gravity;
+}
+
+//////////////////////////////////////////////////
+double GerstnerWaves::Wavenumber(unsigned int _index) const
+{
+  if (_index >= this->dataPtr->waves.size())
+    return 0.0;
+  return 2.0 * IGN_PI / this->dataPtr->waves[_index].wavelength;
+}
+
+//////////////////////////////////////////////////
+double GerstnerWaves::AngularFrequency(unsigned int _index) const
+{
+  return std::sqrt(std::abs(this->dataPtr->gravity) *
+      this->Wavenumber(_index));
+}
+
+//////////////////////////////////////////////////
+math::Vector3d GerstnerWaves::Displacement(const math::Vector2d &_point,
+    double _time) const
+{
+  // see media/materials/programs/GLSL/water_surface_vs.glsl in ogre2
+  math::Vector3d displacement;
+  for (unsigned int i = 0; i < this->dataPtr->waves.size(); ++i)
+  {
+    const GerstnerWave &w = this->dataPtr->waves[i];
+    double k = this->Wavenumber(i);
+    double omega = this->AngularFrequency(i);
+    double theta = k * w.direction.Dot(_point) - omega * _time + w.phase;
+    double s = std::sin(theta);
+    double c = std::cos(theta);
+
+    displacement.X() -= w.steepness * w.amplitude * w.direction.X() * s;
+    displacement.Y() -= w.steepness * w.amplitude * w.direction.Y() * s;
+    displacement.Z() += w.amplitude * c;
+  }
+  return displacement;
+}
+
+//////////////////////////////////////////////////
+math::Vector3d GerstnerWaves::Normal(const math::Vector2d &_point,
+    double _time) const
+{
+  // partial derivatives of the displaced position with respect to the
+  // undisplaced x and y coordinates
+  math::Vector3d b(1, 0, 0);
+  math::Vector3d t(0, 1, 0);
+  for (unsigned int i = 0; i < this->dataPtr->waves.size(); ++i)
+  {
+    const GerstnerWave &w = this->dataPtr->waves[i];
+    double k = this->Wavenumber(i);
+    double omega = this->AngularFrequency(i);
+    double theta = k * w.direction.Dot(_point) - omega * _time + w.phase;
+    double ka = k * w.amplitude;
+    double qkac = w.steepness * ka * std::cos(theta);
+    double kas = ka * std::sin(theta);
+    double dx = w.direction.X();
+    double dy = w.direction.Y();
+
+    b += math::Vector3d(-qkac * dx * dx, -qkac * dx * dy, -kas * dx);
+    t += math::Vector3d(-qkac * dx * dy, -qkac * dy * dy, -kas * dy);
+  }
+  return b.Cross(t).Normalize();
+}
+
+//////////////////////////////////////////////////
+double GerstnerWaves::Height(const math::Vector2d &_point, double _time) const
+{
+  if (this->dataPtr->waves.empty())
+    return 0.0;
+
+  // find the undisplaced point x0 such that x0 + displacement(x0) = point
+  // using fixed point iteration. This converges as long as the waves do not
+  // form loops, i.e. sum(steepness * amplitude * k) < 1
+  math::Vector2d x0 = _point;
+  math::Vector3d d = this->Displacement(x0, _time);
+  for (unsigned int i = 0; i < this->dataPtr->kMaxIterations; ++i)
+  {
+    math::Vector2d err(x0.X() + d.X() - _point.X(),
+        x0.Y() + d.Y() - _point.Y());
+    if (err.SquaredLength() <
+        this->dataPtr->kTolerance * this->dataPtr->kTolerance)
+      break;
+    x0 -= err;
+    d = this->Displacement(x0, _time);
+  }
+  return d.Z();
+}
+
+//////////////////////////////////////////////////
+void GerstnerWaves::Heights(const std::vector<math::Vector2d> &_points,
+    double _time, std::vector<double> &_heights) const
+{
+  _heights.resize(_points.size());
+  for (unsigned int i = 0; i < _points.size(); ++i)
+    _heights[i] = this->Height(_points[i], _time);
+}
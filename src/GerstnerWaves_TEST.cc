@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <ignition/math/Helpers.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/GerstnerWaves.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(GerstnerWavesTest, Waves)
+{
+  GerstnerWaves waves;
+  EXPECT_EQ(0u, waves.WaveCount());
+  EXPECT_DOUBLE_EQ(9.81, waves.Gravity());
+
+  // flat surface
+  EXPECT_DOUBLE_EQ(0.0, waves.Height(math::Vector2d(1.0, 2.0), 3.0));
+  EXPECT_EQ(math::Vector3d::UnitZ,
+      waves.Normal(math::Vector2d(1.0, 2.0), 3.0));
+
+  // invalid wavelength
+  GerstnerWave wave;
+  wave.wavelength = 0.0;
+  EXPECT_FALSE(waves.AddWave(wave));
+  EXPECT_EQ(0u, waves.WaveCount());
+
+  // direction is normalized and steepness clamped
+  wave.amplitude = 0.5;
+  wave.wavelength = 10.0;
+  wave.direction.Set(2.0, 0.0);
+  wave.steepness = 2.0;
+  EXPECT_TRUE(waves.AddWave(wave));
+  EXPECT_EQ(1u, waves.WaveCount());
+  EXPECT_EQ(math::Vector2d(1.0, 0.0), waves.Wave(0u).direction);
+  EXPECT_DOUBLE_EQ(1.0, waves.Wave(0u).steepness);
+  EXPECT_DOUBLE_EQ(2.0 * IGN_PI / 10.0, waves.Wavenumber(0u));
+  EXPECT_DOUBLE_EQ(std::sqrt(9.81 * 2.0 * IGN_PI / 10.0),
+      waves.AngularFrequency(0u));
+
+  // out of range
+  EXPECT_DOUBLE_EQ(0.0, waves.Wave(1u).amplitude);
+  EXPECT_DOUBLE_EQ(0.0, waves.Wavenumber(1u));
+
+  // max wave count
+  for (unsigned int i = 1u; i < GerstnerWaves::kMaxWaveCount; ++i)
+    EXPECT_TRUE(waves.AddWave(wave));
+  EXPECT_FALSE(waves.AddWave(wave));
+  EXPECT_EQ(GerstnerWaves::kMaxWaveCount, waves.WaveCount());
+
+  waves.ClearWaves();
+  EXPECT_EQ(0u, waves.WaveCount());
+
+  // copy
+  waves.SetGravity(3.7);
+  EXPECT_TRUE(waves.AddWave(wave));
+  GerstnerWaves copy(waves);
+  EXPECT_EQ(1u, copy.WaveCount());
+  EXPECT_DOUBLE_EQ(3.7, copy.Gravity());
+  GerstnerWaves assigned;
+  assigned = copy;
+  EXPECT_EQ(1u, assigned.WaveCount());
+  EXPECT_DOUBLE_EQ(3.7, assigned.Gravity());
+
+  // move, the moved from object is still usable
+  GerstnerWaves moved(std::move(copy));
+  EXPECT_EQ(1u, moved.WaveCount());
+  EXPECT_DOUBLE_EQ(3.7, moved.Gravity());
+  EXPECT_EQ(0u, copy.WaveCount());
+  EXPECT_DOUBLE_EQ(9.81, copy.Gravity());
+  EXPECT_TRUE(copy.AddWave(wave));
+  EXPECT_EQ(1u, copy.WaveCount());
+}
+
+/////////////////////////////////////////////////
+TEST(GerstnerWavesTest, SineWaveHeight)
+{
+  // with zero steepness, points do not move horizontally and the height is
+  // a plain sine wave
+  GerstnerWaves waves;
+  GerstnerWave wave;
+  wave.amplitude = 0.3;
+  wave.wavelength = 8.0;
+  wave.direction.Set(0.0, 1.0);
+  wave.phase = 0.2;
+  EXPECT_TRUE(waves.AddWave(wave));
+
+  double k = waves.Wavenumber(0u);
+  double omega = waves.AngularFrequency(0u);
+  for (double t : {0.0, 0.5, 2.0})
+  {
+    for (double y = -5.0; y <= 5.0; y += 0.5)
+    {
+      math::Vector2d p(1.0, y);
+      double expected = wave.amplitude * std::cos(k * y - omega * t +
+          wave.phase);
+      EXPECT_NEAR(expected, waves.Height(p, t), 1e-9);
+      math::Vector3d d = waves.Displacement(p, t);
+      EXPECT_DOUBLE_EQ(0.0, d.X());
+      EXPECT_DOUBLE_EQ(0.0, d.Y());
+      EXPECT_NEAR(expected, d.Z(), 1e-9);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(GerstnerWavesTest, Heights)
+{
+  GerstnerWaves waves;
+  GerstnerWave wave;
+  wave.amplitude = 0.4;
+  wave.wavelength = 12.0;
+  wave.direction.Set(1.0, 0.5);
+  wave.steepness = 0.8;
+  EXPECT_TRUE(waves.AddWave(wave));
+
+  wave.amplitude = 0.1;
+  wave.wavelength = 3.0;
+  wave.direction.Set(-0.3, 1.0);
+  wave.steepness = 0.5;
+  wave.phase = 1.0;
+  EXPECT_TRUE(waves.AddWave(wave));
+
+  // the height at a displaced point must match the height of the vertex
+  // that was displaced there
+  const double t = 1.3;
+  std::vector<math::Vector2d> points;
+  std::vector<double> expected;
+  for (double x = -6.0; x <= 6.0; x += 1.5)
+  {
+    for (double y = -6.0; y <= 6.0; y += 1.5)
+    {
+      math::Vector2d x0(x, y);
+      math::Vector3d d = waves.Displacement(x0, t);
+      points.push_back(math::Vector2d(x + d.X(), y + d.Y()));
+      expected.push_back(d.Z());
+    }
+  }
+
+  std::vector<double> heights;
+  waves.Heights(points, t, heights);
+  ASSERT_EQ(points.size(), heights.size());
+  for (unsigned int i = 0; i < points.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], heights[i], 1e-6);
+    EXPECT_DOUBLE_EQ(waves.Height(points[i], t), heights[i]);
+  }
+
+  // normals point up
+  math::Vector3d n = waves.Normal(math::Vector2d(0.5, 0.5), t);
+  EXPECT_NEAR(1.0, n.Length(), 1e-9);
+  EXPECT_GT(n.Z(), 0.0);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <utility>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/IesProfile.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+class ignition::rendering::IesProfilePrivate
+{
+  /// \brief Find the angle after the peak intensity at which the
+  /// intensity drops below a fraction of the peak.
+  /// \param[in] _fraction Fraction of the peak intensity
+  /// \return Angle from the nadir in radians
+  public: double CutoffAngle(double _fraction) const;
+
+  /// \brief Vertical angles in radians, ascending
+  public: std::vector<double> angles;
+
+  /// \brief Candela values averaged over the horizontal planes, one per
+  /// vertical angle
+  public: std::vector<double> candela;
+
+  /// \brief Photometric type C as defined by LM-63
+  public: const int kTypeC = 1;
+
+  /// \brief Number of samples used to fit the spot falloff
+  public: const unsigned int kFalloffSamples = 32u;
+};
+
+//////////////////////////////////////////////////
+double IesProfilePrivate::CutoffAngle(double _fraction) const
+{
+  if (this->candela.empty())
+    return 0.0;
+
+  auto peak = std::max_element(this->candela.begin(), this->candela.end());
+  double threshold = *peak * _fraction;
+  for (auto i = static_cast<size_t>(peak - this->candela.begin()) + 1u;
+       i < this->candela.size(); ++i)
+  {
+    if (this->candela[i] < threshold)
+    {
+      // interpolate between the last angle above the threshold and this one
+      double c0 = this->candela[i - 1u];
+      double c1 = this->candela[i];
+      double t = (c0 - threshold) / (c0 - c1);
+      return this->angles[i - 1u] +
+          t * (this->angles[i] - this->angles[i - 1u]);
+    }
+  }
+  return this->angles.back();
+}
+
+//////////////////////////////////////////////////
+IesProfile::IesProfile()
+  : dataPtr(std::make_unique<IesProfilePrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+IesProfile::IesProfile(const IesProfile &_profile)
+  : dataPtr(new IesProfilePrivate(*_profile.dataPtr))
+{
+}
+
+//////////////////////////////////////////////////
+IesProfile::IesProfile(IesProfile &&_profile) noexcept
+  : dataPtr(std::exchange(_profile.dataPtr, nullptr))
+{
+}
+
+//////////////////////////////////////////////////
+IesProfile::~IesProfile()
+{
+}
+
+//////////////////////////////////////////////////
+IesProfile &IesProfile::operator=(const IesProfile &_profile)
+{
+  return *this = IesProfile(_profile);
+}
+
+//////////////////////////////////////////////////
+IesProfile &IesProfile::operator=(IesProfile &&_profile)
+{
+  std::swap(this->dataPtr, _profile.dataPtr);
+  return *this;
+}
+
+//////////////////////////////////////////////////
+bool IesProfile::Load(const std::string &_filename)
+{
+  std::ifstream file(_filename);
+  if (!file.is_open())
+  {
+    ignerr << "Unable to open IES file: " << _filename << std::endl;
+    return false;
+  }
+
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  if (!this->LoadFromString(buffer.str()))
+  {
+    ignerr << "Unable to parse IES file: " << _filename << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool IesProfile::LoadFromString(const std::string &_data)
+{
+  this->dataPtr->angles.clear();
+  this->dataPtr->candela.clear();
+
+  // skip the header and keywords, photometric data follows the TILT line
+  std::istringstream stream(_data);
+  std::string line;
+  std::string tilt;
+  while (std::getline(stream, line))
+  {
+    auto pos = line.find("TILT=");
+    if (pos != std::string::npos)
+    {
+      tilt = line.substr(pos + 5u);
+      tilt.erase(tilt.find_last_not_of(" \t\r") + 1u);
+      break;
+    }
+  }
+  if (tilt.empty())
+  {
+    ignerr << "IES data has no TILT line" << std::endl;
+    return false;
+  }
+
+  // values are separated by white space or commas
+  std::string rest((std::istreambuf_iterator<char>(stream)),
+      std::istreambuf_iterator<char>());
+  std::replace(rest.begin(), rest.end(), ',', ' ');
+  std::istringstream values(rest);
+
+  // tilt data only changes the output with the lamp orientation
+  if (tilt == "INCLUDE")
+  {
+    double geometry = 0.0;
+    int pairCount = 0;
+    values >> geometry >> pairCount;
+    double ignored = 0.0;
+    for (int i = 0; i < pairCount * 2 && values; ++i)
+      values >> ignored;
+  }
+
+  double lampCount = 0.0;
+  double lumens = 0.0;
+  double multiplier = 1.0;
+  int verticalCount = 0;
+  int horizontalCount = 0;
+  int photometricType = 0;
+  int unitsType = 0;
+  double width = 0.0;
+  double length = 0.0;
+  double height = 0.0;
+  double ballastFactor = 0.0;
+  double futureUse = 0.0;
+  double watts = 0.0;
+  values >> lampCount >> lumens >> multiplier >> verticalCount
+         >> horizontalCount >> photometricType >> unitsType
+         >> width >> length >> height >> ballastFactor >> futureUse >> watts;
+  if (!values || verticalCount <= 0 || horizontalCount <= 0)
+  {
+    ignerr << "Invalid IES photometric data" << std::endl;
+    return false;
+  }
+  if (photometricType != this->dataPtr->kTypeC)
+  {
+    ignerr << "Only type C IES photometry is supported" << std::endl;
+    return false;
+  }
+
+  std::vector<double> vertical(verticalCount);
+  for (auto &v : vertical)
+    values >> v;
+  std::vector<double> horizontal(horizontalCount);
+  for (auto &h : horizontal)
+    values >> h;
+
+  std::vector<double> candela(verticalCount, 0.0);
+  for (int h = 0; h < horizontalCount; ++h)
+  {
+    for (int v = 0; v < verticalCount; ++v)
+    {
+      double c = 0.0;
+      values >> c;
+      candela[v] += c * multiplier / horizontalCount;
+    }
+  }
+  if (!values)
+  {
+    ignerr << "IES data has fewer candela values than expected" << std::endl;
+    return false;
+  }
+  if (!std::is_sorted(vertical.begin(), vertical.end()))
+  {
+    ignerr << "IES vertical angles are not in ascending order" << std::endl;
+    return false;
+  }
+
+  for (auto &v : vertical)
+    v = IGN_DTOR(v);
+  this->dataPtr->angles = std::move(vertical);
+  this->dataPtr->candela = std::move(candela);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool IesProfile::Valid() const
+{
+  return !this->dataPtr->angles.empty();
+}
+
+//////////////////////////////////////////////////
+std::vector<double> IesProfile::VerticalAngles() const
+{
+  return this->dataPtr->angles;
+}
+
+//////////////////////////////////////////////////
+double IesProfile::Candela(double _angle) const
+{
+  const auto &angles = this->dataPtr->angles;
+  const auto &candela = this->dataPtr->candela;
+  if (angles.empty() || _angle < angles.front() || _angle > angles.back())
+    return 0.0;
+
+  auto it = std::lower_bound(angles.begin(), angles.end(), _angle);
+  auto i = static_cast<size_t>(it - angles.begin());
+  if (i == 0u || math::equal(*it, _angle))
+    return candela[i];
+
+  double t = (_angle - angles[i - 1u]) / (angles[i] - angles[i - 1u]);
+  return candela[i - 1u] + t * (candela[i] - candela[i - 1u]);
+}
+
+//////////////////////////////////////////////////
+double IesProfile::MaxCandela() const
+{
+  if (this->dataPtr->candela.empty())
+    return 0.0;
+  return *std::max_element(this->dataPtr->candela.begin(),
+      this->dataPtr->candela.end());
+}
+
+//////////////////////////////////////////////////
+math::Angle IesProfile::BeamAngle() const
+{
+  return math::Angle(2.0 * this->dataPtr->CutoffAngle(0.5));
+}
+
+//////////////////////////////////////////////////
+math::Angle IesProfile::FieldAngle() const
+{
+  return math::Angle(2.0 * this->dataPtr->CutoffAngle(0.1));
+}
+
+//////////////////////////////////////////////////
+double IesProfile::SpotFalloff() const
+{
+  // spot lights attenuate with
+  //   pow((cos(a) - cos(outer)) / (cos(inner) - cos(outer)), falloff)
+  // so fit the falloff to log(I(a) / I(inner)) = falloff * log(t)
+  double inner = this->dataPtr->CutoffAngle(0.5);
+  double outer = this->dataPtr->CutoffAngle(0.1);
+  double peak = this->Candela(inner);
+  double cosInner = std::cos(inner);
+  double cosOuter = std::cos(outer);
+  if (outer <= inner || peak <= 0.0)
+    return 1.0;
+
+  double num = 0.0;
+  double den = 0.0;
+  unsigned int samples = this->dataPtr->kFalloffSamples;
+  for (unsigned int i = 1u; i < samples; ++i)
+  {
+    double a = inner + (outer - inner) * i / samples;
+    double t = (std::cos(a) - cosOuter) / (cosInner - cosOuter);
+    double y = this->Candela(a) / peak;
+    if (t <= 0.0 || t >= 1.0 || y <= 0.0)
+      continue;
+    num += std::log(t) * std::log(y);
+    den += std::log(t) * std::log(t);
+  }
+  if (den <= 0.0)
+    return 1.0;
+  return std::max(0.0, num / den);
+}
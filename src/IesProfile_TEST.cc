@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+
+#include <ignition/common/Filesystem.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/IesProfile.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Path to test media files.
+static const std::string kTestMediaPath(
+    common::joinPaths(std::string(PROJECT_SOURCE_PATH), "test", "media"));
+
+/////////////////////////////////////////////////
+TEST(IesProfileTest, Load)
+{
+  IesProfile profile;
+  EXPECT_FALSE(profile.Valid());
+  EXPECT_DOUBLE_EQ(0.0, profile.MaxCandela());
+  EXPECT_DOUBLE_EQ(0.0, profile.Candela(0.0));
+
+  EXPECT_FALSE(profile.Load("invalid.ies"));
+  EXPECT_FALSE(profile.Valid());
+
+  EXPECT_TRUE(profile.Load(
+      common::joinPaths(kTestMediaPath, "ies", "spot.ies")));
+  EXPECT_TRUE(profile.Valid());
+  ASSERT_EQ(7u, profile.VerticalAngles().size());
+  EXPECT_DOUBLE_EQ(0.0, profile.VerticalAngles().front());
+  EXPECT_DOUBLE_EQ(IGN_DTOR(60.0), profile.VerticalAngles().back());
+
+  // copy
+  IesProfile copy(profile);
+  EXPECT_TRUE(copy.Valid());
+  EXPECT_DOUBLE_EQ(profile.MaxCandela(), copy.MaxCandela());
+}
+
+/////////////////////////////////////////////////
+TEST(IesProfileTest, Parse)
+{
+  IesProfile profile;
+
+  // missing TILT line
+  EXPECT_FALSE(profile.LoadFromString("IESNA:LM-63-2002\n1 1000 1"));
+
+  // type A photometry is not supported
+  EXPECT_FALSE(profile.LoadFromString(
+      "IESNA:LM-63-2002\nTILT=NONE\n"
+      "1 1000 1 2 1 3 2 0 0 0\n1 1 10\n0 90\n0\n100 0\n"));
+
+  // too few candela values
+  EXPECT_FALSE(profile.LoadFromString(
+      "IESNA:LM-63-2002\nTILT=NONE\n"
+      "1 1000 1 3 1 1 2 0 0 0\n1 1 10\n0 45 90\n0\n100 50\n"));
+  EXPECT_FALSE(profile.Valid());
+
+  // tilt data, comma separators, two horizontal planes and a multiplier
+  EXPECT_TRUE(profile.LoadFromString(
+      "IESNA:LM-63-2002\nTILT=INCLUDE\n1\n2\n0 90\n1 1\n"
+      "1 1000 2 3 2 1 2 0 0 0\n1 1 10\n0, 45, 90\n0, 180\n"
+      "100, 50, 0\n300, 150, 0\n"));
+  EXPECT_TRUE(profile.Valid());
+  EXPECT_DOUBLE_EQ(400.0, profile.MaxCandela());
+  EXPECT_DOUBLE_EQ(400.0, profile.Candela(0.0));
+  EXPECT_DOUBLE_EQ(200.0, profile.Candela(IGN_DTOR(45.0)));
+  EXPECT_DOUBLE_EQ(100.0, profile.Candela(IGN_DTOR(67.5)));
+  EXPECT_DOUBLE_EQ(0.0, profile.Candela(IGN_DTOR(100.0)));
+}
+
+/////////////////////////////////////////////////
+TEST(IesProfileTest, SpotFit)
+{
+  IesProfile profile;
+  ASSERT_TRUE(profile.Load(
+      common::joinPaths(kTestMediaPath, "ies", "spot.ies")));
+
+  // 50% of the peak between 20 and 30 degrees
+  EXPECT_NEAR(2.0 * (20.0 + 10.0 * 200.0 / 300.0),
+      profile.BeamAngle().Degree(), 1e-6);
+  // 10% of the peak between 40 and 50 degrees
+  EXPECT_NEAR(90.0, profile.FieldAngle().Degree(), 1e-6);
+  EXPECT_LT(profile.BeamAngle(), profile.FieldAngle());
+
+  double falloff = profile.SpotFalloff();
+  EXPECT_GT(falloff, 0.0);
+  EXPECT_LT(falloff, 2.0);
+
+  // the fitted spot light is within 20% of the peak intensity of the
+  // profile between the inner and outer angles
+  double inner = profile.BeamAngle().Radian() * 0.5;
+  double outer = profile.FieldAngle().Radian() * 0.5;
+  for (double a = inner; a < outer; a += 0.05)
+  {
+    double t = (std::cos(a) - std::cos(outer)) /
+        (std::cos(inner) - std::cos(outer));
+    double spot = profile.Candela(inner) * std::pow(t, falloff);
+    EXPECT_NEAR(profile.Candela(a), spot, 0.2 * profile.MaxCandela());
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -18,8 +18,11 @@
 #include <gtest/gtest.h>
 
 #include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
 
 #include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/IesProfile.hh"
 #include "ignition/rendering/Light.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/RenderingIface.hh"
@@ -33,6 +36,14 @@ class LightTest : public testing::Test,
 {
   /// \brief Test light APIs
   public: void Light(const std::string &_renderEngine);
+
+  /// \brief Test area light APIs
+  public: void AreaLight(const std::string &_renderEngine);
+
+  /// \brief Path to test media files.
+  public: const std::string TEST_MEDIA_PATH{
+        common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+        "test", "media")};
 };
 
 
@@ -129,6 +140,24 @@ void LightTest::Light(const std::string &_renderEngine)
   spotLight->SetFalloff(0.2);
   EXPECT_NEAR(0.2, spotLight->Falloff(), 1e-6);
 
+  // ies profile
+  EXPECT_TRUE(spotLight->IesProfile().empty());
+  EXPECT_FALSE(spotLight->SetIesProfile("invalid.ies"));
+  EXPECT_TRUE(spotLight->IesProfile().empty());
+  EXPECT_NEAR(0.2, spotLight->Falloff(), 1e-6);
+  std::string iesFile = common::joinPaths(TEST_MEDIA_PATH, "ies", "spot.ies");
+  EXPECT_TRUE(spotLight->SetIesProfile(iesFile));
+  EXPECT_EQ(iesFile, spotLight->IesProfile());
+  IesProfile profile;
+  ASSERT_TRUE(profile.Load(iesFile));
+  EXPECT_NEAR(profile.BeamAngle().Radian() * 0.5,
+      spotLight->InnerAngle().Radian(), 1e-6);
+  EXPECT_NEAR(profile.FieldAngle().Radian() * 0.5,
+      spotLight->OuterAngle().Radian(), 1e-6);
+  EXPECT_NEAR(profile.SpotFalloff(), spotLight->Falloff(), 1e-6);
+  EXPECT_TRUE(spotLight->SetIesProfile(""));
+  EXPECT_TRUE(spotLight->IesProfile().empty());
+
   // remove lights
   scene->DestroyLightById(light->Id());
   EXPECT_EQ(2u, scene->LightCount());
@@ -152,12 +181,102 @@ void LightTest::Light(const std::string &_renderEngine)
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void LightTest::AreaLight(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "AreaLight not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+           << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  AreaLightPtr light = scene->CreateAreaLight();
+  ASSERT_NE(nullptr, light);
+  EXPECT_EQ(1u, scene->LightCount());
+  EXPECT_TRUE(scene->HasLight(light));
+
+  // defaults
+  EXPECT_EQ(ALS_RECT, light->Shape());
+  EXPECT_EQ(math::Vector2d(1.0, 1.0), light->Size());
+  EXPECT_TRUE(light->Texture().empty());
+  EXPECT_EQ(math::Vector3d(0, 0, -1), light->Direction());
+  EXPECT_FALSE(light->CastShadows());
+
+  // area lights never cast shadows
+  light->SetCastShadows(true);
+  EXPECT_FALSE(light->CastShadows());
+
+  math::Vector3d dir = math::Vector3d(-0.2, -0.1, -0.9).Normalize();
+  light->SetDirection(dir.X(), dir.Y(), dir.Z());
+  EXPECT_EQ(dir, light->Direction());
+
+  light->SetShape(ALS_DISC);
+  EXPECT_EQ(ALS_DISC, light->Shape());
+
+  light->SetSize(math::Vector2d(2.0, 0.5));
+  EXPECT_EQ(math::Vector2d(2.0, 0.5), light->Size());
+  // invalid size
+  light->SetSize(math::Vector2d(0.0, 1.0));
+  EXPECT_EQ(math::Vector2d(2.0, 0.5), light->Size());
+
+  std::string texture = common::joinPaths(TEST_MEDIA_PATH, "materials",
+      "textures", "texture.png");
+  light->SetTexture(texture);
+  EXPECT_EQ(texture, light->Texture());
+
+  light->SetIntensity(2.0);
+  EXPECT_NEAR(2.0, light->Intensity(), 1e-6);
+
+  // create more area lights than can be shaded at once
+  for (unsigned int i = 0; i < 20u; ++i)
+  {
+    AreaLightPtr l = scene->CreateAreaLight();
+    ASSERT_NE(nullptr, l);
+    l->SetShape((i % 2u) ? ALS_DISC : ALS_RECT);
+    l->SetLocalPosition(i, 0, 2);
+  }
+  EXPECT_EQ(21u, scene->LightCount());
+
+  // masks and the area light budget are applied before rendering
+  CameraPtr camera = scene->CreateCamera("camera");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(32u);
+  camera->SetImageHeight(32u);
+  scene->RootVisual()->AddChild(camera);
+  camera->Update();
+
+  scene->DestroyLight(light);
+  EXPECT_EQ(20u, scene->LightCount());
+  camera->Update();
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(LightTest, Light)
 {
   Light(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(LightTest, AreaLight)
+{
+  AreaLight(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(Light, LightTest,
     RENDER_ENGINE_VALUES,
     ignition::rendering::PrintToStringParam());
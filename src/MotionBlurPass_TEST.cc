@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/MotionBlurPass.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class MotionBlurPassTest : public testing::Test,
+    public testing::WithParamInterface<const char*>
+{
+  /// \brief Test motion blur pass properties
+  public: void MotionBlur(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void MotionBlurPassTest::MotionBlur(const std::string &_renderEngine)
+{
+  // get engine
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // get the render pass system
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Render engine '" << _renderEngine << "' does not support "
+            << "render pass system" << std::endl;
+    return;
+  }
+  RenderPassPtr pass = rpSystem->Create<MotionBlurPass>();
+  MotionBlurPassPtr blurPass =
+      std::dynamic_pointer_cast<MotionBlurPass>(pass);
+  ASSERT_NE(nullptr, blurPass);
+
+  // verify initial values
+  EXPECT_DOUBLE_EQ(0.5, blurPass->ExposureFraction());
+  EXPECT_EQ(8u, blurPass->SampleCount());
+
+  // exposure fraction is clamped to [0, 1]
+  blurPass->SetExposureFraction(0.25);
+  EXPECT_DOUBLE_EQ(0.25, blurPass->ExposureFraction());
+  blurPass->SetExposureFraction(3.0);
+  EXPECT_DOUBLE_EQ(1.0, blurPass->ExposureFraction());
+
+  // sample count is clamped to [1, 32]
+  blurPass->SetSampleCount(16u);
+  EXPECT_EQ(16u, blurPass->SampleCount());
+  blurPass->SetSampleCount(0u);
+  EXPECT_EQ(1u, blurPass->SampleCount());
+  blurPass->SetSampleCount(100u);
+  EXPECT_EQ(32u, blurPass->SampleCount());
+}
+
+/////////////////////////////////////////////////
+TEST_P(MotionBlurPassTest, MotionBlur)
+{
+  MotionBlur(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(MotionBlur, MotionBlurPassTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
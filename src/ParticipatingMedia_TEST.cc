@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/ParticipatingMedia.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class ParticipatingMediaTest : public testing::Test,
+                               public testing::WithParamInterface<const char *>
+{
+  /// \brief Test participating media properties
+  public: void Properties(const std::string &_renderEngine);
+
+  /// \brief Test transmittance through uniform and height fog
+  public: void Transmittance(const std::string &_renderEngine);
+
+  /// \brief Test that the media are applied to camera images
+  public: void CameraImage(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void ParticipatingMediaTest::Properties(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "ParticipatingMedia not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+
+  ParticipatingMediaPtr media = scene->CreateParticipatingMedia();
+  ASSERT_NE(nullptr, media);
+
+  // only one participating media object per scene
+  EXPECT_EQ(nullptr, scene->CreateParticipatingMedia());
+
+  // default values
+  EXPECT_EQ(math::Vector3d::Zero, media->Absorption());
+  EXPECT_GT(media->Scattering().X(), 0.0);
+  EXPECT_DOUBLE_EQ(0.0, media->InfraredExtinction());
+  EXPECT_DOUBLE_EQ(0.0, media->HeightFalloff());
+  EXPECT_DOUBLE_EQ(0.0, media->BaseHeight());
+
+  media->SetAbsorption(math::Vector3d(0.3, 0.1, 0.05));
+  EXPECT_EQ(math::Vector3d(0.3, 0.1, 0.05), media->Absorption());
+  media->SetScattering(math::Vector3d(0.1, 0.2, 0.2));
+  EXPECT_EQ(math::Vector3d(0.1, 0.2, 0.2), media->Scattering());
+  media->SetColor(math::Color(0.0f, 0.3f, 0.4f));
+  EXPECT_EQ(math::Color(0.0f, 0.3f, 0.4f), media->Color());
+  media->SetInfraredExtinction(0.8);
+  EXPECT_DOUBLE_EQ(0.8, media->InfraredExtinction());
+  media->SetHeightFalloff(0.5);
+  EXPECT_DOUBLE_EQ(0.5, media->HeightFalloff());
+  media->SetBaseHeight(-2.0);
+  EXPECT_DOUBLE_EQ(-2.0, media->BaseHeight());
+
+  // invalid values are ignored
+  media->SetAbsorption(math::Vector3d(-1, 0, 0));
+  EXPECT_EQ(math::Vector3d(0.3, 0.1, 0.05), media->Absorption());
+  media->SetScattering(math::Vector3d(0, 0, -0.1));
+  EXPECT_EQ(math::Vector3d(0.1, 0.2, 0.2), media->Scattering());
+  media->SetInfraredExtinction(-0.1);
+  EXPECT_DOUBLE_EQ(0.8, media->InfraredExtinction());
+  media->SetHeightFalloff(-1.0);
+  EXPECT_DOUBLE_EQ(0.5, media->HeightFalloff());
+  media->SetBaseHeight(std::nan(""));
+  EXPECT_DOUBLE_EQ(-2.0, media->BaseHeight());
+
+  // new media can be created once the old ones are destroyed
+  media->Destroy();
+  media.reset();
+  media = scene->CreateParticipatingMedia();
+  EXPECT_NE(nullptr, media);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void ParticipatingMediaTest::Transmittance(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "ParticipatingMedia not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+
+  ParticipatingMediaPtr media = scene->CreateParticipatingMedia();
+  ASSERT_NE(nullptr, media);
+  media->SetAbsorption(math::Vector3d(0.1, 0.0, 0.0));
+  media->SetScattering(math::Vector3d(0.1, 0.1, 0.0));
+  media->SetInfraredExtinction(0.05);
+
+  // uniform media follow the Beer-Lambert law in each channel
+  math::Vector3d from(0, 0, 1);
+  math::Vector3d to(10, 0, 1);
+  math::Vector3d t = media->Transmittance(from, to);
+  EXPECT_NEAR(std::exp(-2.0), t.X(), 1e-6);
+  EXPECT_NEAR(std::exp(-1.0), t.Y(), 1e-6);
+  EXPECT_NEAR(1.0, t.Z(), 1e-6);
+  EXPECT_NEAR(std::exp(-0.5), media->InfraredTransmittance(from, to), 1e-6);
+  EXPECT_EQ(t, media->Transmittance(to, from));
+
+  // media get thinner above the base height
+  media->SetHeightFalloff(0.5);
+  EXPECT_NEAR(std::exp(-2.0), media->Transmittance(
+      math::Vector3d(0, 0, -1), math::Vector3d(10, 0, -1)).X(), 1e-6);
+  EXPECT_GT(media->Transmittance(
+      math::Vector3d(0, 0, 4), math::Vector3d(10, 0, 4)).X(),
+      media->Transmittance(from, to).X());
+
+  // a vertical ray through the height falloff integrates the density
+  // analytically: 2 m at full density and exp decay over 4 m above
+  double length = 2.0 + (1.0 - std::exp(-0.5 * 4.0)) / 0.5;
+  EXPECT_NEAR(std::exp(-0.2 * length), media->Transmittance(
+      math::Vector3d(0, 0, -2), math::Vector3d(0, 0, 4)).X(), 1e-6);
+  EXPECT_NEAR(media->InfraredTransmittance(
+      math::Vector3d(0, 0, -2), math::Vector3d(0, 0, 4)),
+      media->InfraredTransmittance(
+      math::Vector3d(0, 0, 4), math::Vector3d(0, 0, -2)), 1e-9);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void ParticipatingMediaTest::CameraImage(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "ParticipatingMedia not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  scene->SetBackgroundColor(math::Color::Black);
+  VisualPtr root = scene->RootVisual();
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetFarClipPlane(100.0);
+  root->AddChild(camera);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  unsigned char *data = image.Data<unsigned char>();
+  unsigned int center = (32u * 64u + 32u) * 3u;
+  EXPECT_EQ(0u, data[center]);
+
+  // dense white fog hides the black background
+  ParticipatingMediaPtr media = scene->CreateParticipatingMedia();
+  ASSERT_NE(nullptr, media);
+  media->SetScattering(math::Vector3d(1, 1, 1));
+  media->SetColor(math::Color::White);
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  EXPECT_GT(data[center], 200u);
+
+  // images are unchanged once the media are destroyed
+  media->Destroy();
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  EXPECT_EQ(0u, data[center]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ParticipatingMediaTest, Properties)
+{
+  Properties(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ParticipatingMediaTest, Transmittance)
+{
+  Transmittance(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ParticipatingMediaTest, CameraImage)
+{
+  CameraImage(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(ParticipatingMedia, ParticipatingMediaTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Precipitation.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class PrecipitationTest : public testing::Test,
+                          public testing::WithParamInterface<const char *>
+{
+  /// \brief Test precipitation properties
+  public: void Properties(const std::string &_renderEngine);
+
+  /// \brief Test the properties derived from the rate
+  public: void DerivedProperties(const std::string &_renderEngine);
+
+  /// \brief Test that the precipitation is applied to camera images
+  public: void CameraImage(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void PrecipitationTest::Properties(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Precipitation not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+
+  PrecipitationPtr precipitation = scene->CreatePrecipitation();
+  ASSERT_NE(nullptr, precipitation);
+
+  // only one precipitation per scene
+  EXPECT_EQ(nullptr, scene->CreatePrecipitation());
+
+  // default values
+  EXPECT_EQ(PT_RAIN, precipitation->Type());
+  EXPECT_GT(precipitation->Rate(), 0.0);
+  EXPECT_EQ(math::Vector3d::Zero, precipitation->WindVelocity());
+  EXPECT_DOUBLE_EQ(0.0, precipitation->LaserRetro());
+
+  precipitation->SetType(PT_SNOW);
+  EXPECT_EQ(PT_SNOW, precipitation->Type());
+  precipitation->SetRate(2.5);
+  EXPECT_DOUBLE_EQ(2.5, precipitation->Rate());
+  precipitation->SetWindVelocity(math::Vector3d(3, -1, 0));
+  EXPECT_EQ(math::Vector3d(3, -1, 0), precipitation->WindVelocity());
+  precipitation->SetLaserRetro(100.0);
+  EXPECT_DOUBLE_EQ(100.0, precipitation->LaserRetro());
+
+  // invalid values are ignored
+  precipitation->SetRate(-1.0);
+  EXPECT_DOUBLE_EQ(2.5, precipitation->Rate());
+  precipitation->SetRate(std::nan(""));
+  EXPECT_DOUBLE_EQ(2.5, precipitation->Rate());
+  precipitation->SetWindVelocity(math::Vector3d(INFINITY, 0, 0));
+  EXPECT_EQ(math::Vector3d(3, -1, 0), precipitation->WindVelocity());
+  precipitation->SetLaserRetro(-5.0);
+  EXPECT_DOUBLE_EQ(100.0, precipitation->LaserRetro());
+
+  // a new precipitation can be created once the old one is destroyed
+  precipitation->Destroy();
+  precipitation.reset();
+  precipitation = scene->CreatePrecipitation();
+  EXPECT_NE(nullptr, precipitation);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void PrecipitationTest::DerivedProperties(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Precipitation not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+
+  PrecipitationPtr precipitation = scene->CreatePrecipitation();
+  ASSERT_NE(nullptr, precipitation);
+
+  // no rain has no effect
+  precipitation->SetRate(0.0);
+  EXPECT_DOUBLE_EQ(0.0, precipitation->Extinction());
+  EXPECT_DOUBLE_EQ(0.0, precipitation->Wetness());
+
+  // moderate rain: drops of about 1.5 mm that fall at about 5 m/s
+  precipitation->SetRate(10.0);
+  double diameter = precipitation->ParticleDiameter();
+  EXPECT_NEAR(0.0015, diameter, 0.0002);
+  double fallSpeed = precipitation->FallSpeed();
+  EXPECT_NEAR(5.3, fallSpeed, 0.5);
+  double extinction = precipitation->Extinction();
+  EXPECT_GT(extinction, 0.0);
+  double wetness = precipitation->Wetness();
+  EXPECT_GT(wetness, 0.9);
+  EXPECT_LE(wetness, 1.0);
+
+  // heavier rain has larger drops, that fall faster and attenuate more
+  precipitation->SetRate(50.0);
+  EXPECT_GT(precipitation->ParticleDiameter(), diameter);
+  EXPECT_GT(precipitation->FallSpeed(), fallSpeed);
+  EXPECT_GT(precipitation->Extinction(), extinction);
+  EXPECT_GE(precipitation->Wetness(), wetness);
+
+  // snow flakes are larger and fall slower than rain drops, attenuate
+  // more and wet surfaces less for the same liquid water rate
+  precipitation->SetRate(10.0);
+  precipitation->SetType(PT_SNOW);
+  EXPECT_GT(precipitation->ParticleDiameter(), diameter);
+  EXPECT_LT(precipitation->FallSpeed(), 2.0);
+  EXPECT_GT(precipitation->Extinction(), extinction);
+  EXPECT_LT(precipitation->Wetness(), wetness);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void PrecipitationTest::CameraImage(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Precipitation not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  scene->SetBackgroundColor(math::Color::Black);
+  VisualPtr root = scene->RootVisual();
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetFarClipPlane(100.0);
+  root->AddChild(camera);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  unsigned char *data = image.Data<unsigned char>();
+  unsigned int center = (32u * 64u + 32u) * 3u;
+  EXPECT_EQ(0u, data[center]);
+
+  // heavy snow veils the black background and flakes show in front of it
+  PrecipitationPtr precipitation = scene->CreatePrecipitation();
+  ASSERT_NE(nullptr, precipitation);
+  precipitation->SetType(PT_SNOW);
+  precipitation->SetRate(5.0);
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  EXPECT_GT(data[center], 50u);
+
+  // images are unchanged once the precipitation is destroyed
+  precipitation->Destroy();
+  camera->Capture(image);
+  data = image.Data<unsigned char>();
+  EXPECT_EQ(0u, data[center]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(PrecipitationTest, Properties)
+{
+  Properties(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(PrecipitationTest, DerivedProperties)
+{
+  DerivedProperties(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(PrecipitationTest, CameraImage)
+{
+  CameraImage(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Precipitation, PrecipitationTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Light.hh"
+#include "ignition/rendering/ProceduralSky.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class ProceduralSkyTest : public testing::Test,
+                          public testing::WithParamInterface<const char *>
+{
+  /// \brief Test procedural sky properties
+  public: void Properties(const std::string &_renderEngine);
+
+  /// \brief Test sky, sun and ambient colors
+  public: void Colors(const std::string &_renderEngine);
+
+  /// \brief Test that the sky drives the scene lighting
+  public: void Lighting(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void ProceduralSkyTest::Properties(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "ProceduralSky not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+
+  ProceduralSkyPtr sky = scene->CreateProceduralSky();
+  ASSERT_NE(nullptr, sky);
+
+  // only one sky per scene
+  EXPECT_EQ(nullptr, scene->CreateProceduralSky());
+
+  // default values
+  EXPECT_DOUBLE_EQ(1.0, sky->SunDirection().Length());
+  EXPECT_GT(sky->SunDirection().Z(), 0.0);
+  EXPECT_DOUBLE_EQ(2.0, sky->Turbidity());
+  EXPECT_DOUBLE_EQ(0.0, sky->CloudCover());
+  EXPECT_EQ(math::Vector2d::Zero, sky->WindVelocity());
+  EXPECT_EQ(nullptr, sky->SunLight());
+
+  sky->SetSunDirection(math::Vector3d(0, 3, 4));
+  EXPECT_EQ(math::Vector3d(0, 0.6, 0.8), sky->SunDirection());
+  sky->SetTurbidity(6.0);
+  EXPECT_DOUBLE_EQ(6.0, sky->Turbidity());
+  sky->SetCloudCover(0.4);
+  EXPECT_DOUBLE_EQ(0.4, sky->CloudCover());
+  sky->SetWindVelocity(math::Vector2d(3, -1));
+  EXPECT_EQ(math::Vector2d(3, -1), sky->WindVelocity());
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  sky->SetSunLight(light);
+  EXPECT_EQ(light, sky->SunLight());
+
+  // cloud cover is clamped
+  sky->SetCloudCover(2.0);
+  EXPECT_DOUBLE_EQ(1.0, sky->CloudCover());
+  sky->SetCloudCover(-1.0);
+  EXPECT_DOUBLE_EQ(0.0, sky->CloudCover());
+
+  // invalid values are ignored
+  sky->SetSunDirection(math::Vector3d::Zero);
+  EXPECT_EQ(math::Vector3d(0, 0.6, 0.8), sky->SunDirection());
+  sky->SetTurbidity(0.5);
+  EXPECT_DOUBLE_EQ(6.0, sky->Turbidity());
+
+  // a new sky can be created once the old one is destroyed
+  sky->Destroy();
+  sky.reset();
+  sky = scene->CreateProceduralSky();
+  EXPECT_NE(nullptr, sky);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void ProceduralSkyTest::Colors(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "ProceduralSky not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+
+  ProceduralSkyPtr sky = scene->CreateProceduralSky();
+  ASSERT_NE(nullptr, sky);
+
+  // high sun: blue sky that is brighter towards the horizon
+  sky->SetSunDirection(math::Vector3d(1, 0, 1.7));
+  math::Color zenith = sky->SkyColor(math::Vector3d::UnitZ);
+  math::Color horizon = sky->SkyColor(math::Vector3d(-1, 0, 0.05));
+  EXPECT_GT(zenith.B(), zenith.R());
+  EXPECT_GT(horizon.R() + horizon.G() + horizon.B(),
+      zenith.R() + zenith.G() + zenith.B());
+  math::Color noonSun = sky->SunColor();
+  math::Color noonAmbient = sky->AmbientColor();
+  EXPECT_GT(noonSun.R(), 0.8f);
+  EXPECT_GT(noonAmbient.B(), noonAmbient.R());
+
+  // low sun: warmer and darker sun light and a darker sky
+  sky->SetSunDirection(math::Vector3d(1, 0, 0.1));
+  math::Color lowSun = sky->SunColor();
+  EXPECT_LT(lowSun.B() / lowSun.R(), noonSun.B() / noonSun.R());
+  EXPECT_LT(lowSun.B(), noonSun.B());
+  EXPECT_LT(sky->AmbientColor().B(), noonAmbient.B());
+  EXPECT_LT(sky->SkyColor(math::Vector3d::UnitZ).B(), zenith.B());
+
+  // haze makes the sky brighter
+  sky->SetSunDirection(math::Vector3d(1, 0, 1.7));
+  sky->SetTurbidity(10.0);
+  EXPECT_GT(sky->SkyColor(math::Vector3d::UnitZ).R(), zenith.R());
+  sky->SetTurbidity(2.0);
+
+  // clouds dim the sun and grey the ambient light
+  sky->SetCloudCover(1.0);
+  EXPECT_LT(sky->SunColor().R(), noonSun.R());
+  EXPECT_FLOAT_EQ(sky->AmbientColor().R(), sky->AmbientColor().B());
+  sky->SetCloudCover(0.0);
+
+  // no sun light at night
+  sky->SetSunDirection(math::Vector3d(1, 0, -0.2));
+  EXPECT_EQ(math::Color::Black, sky->SunColor());
+  math::Color night = sky->SkyColor(math::Vector3d::UnitZ);
+  EXPECT_LT(night.R() + night.G() + night.B(),
+      zenith.R() + zenith.G() + zenith.B());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void ProceduralSkyTest::Lighting(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "ProceduralSky not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  VisualPtr root = scene->RootVisual();
+
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  root->AddChild(light);
+
+  ProceduralSkyPtr sky = scene->CreateProceduralSky();
+  ASSERT_NE(nullptr, sky);
+  sky->SetSunLight(light);
+  sky->SetSunDirection(math::Vector3d(0, 0.6, 0.8));
+  sky->SetCloudCover(0.5);
+  sky->SetWindVelocity(math::Vector2d(5, 0));
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  root->AddChild(camera);
+
+  // lighting follows the sky once the scene is rendered
+  camera->Update();
+  EXPECT_EQ(math::Vector3d(0, -0.6, -0.8), light->Direction());
+  EXPECT_EQ(sky->SunColor(), light->DiffuseColor());
+  EXPECT_EQ(sky->SunColor(), light->SpecularColor());
+  EXPECT_EQ(sky->AmbientColor(), scene->AmbientLight());
+
+  // the sky renders behind the scene
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  unsigned char *data = image.Data<unsigned char>();
+  EXPECT_GT(data[2], 0u);
+
+  // moving the sun updates the lighting
+  sky->SetSunDirection(math::Vector3d(1, 0, 0.1));
+  camera->Update();
+  EXPECT_EQ(-sky->SunDirection(), light->Direction());
+  EXPECT_EQ(sky->SunColor(), light->DiffuseColor());
+  EXPECT_EQ(sky->AmbientColor(), scene->AmbientLight());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ProceduralSkyTest, Properties)
+{
+  Properties(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ProceduralSkyTest, Colors)
+{
+  Colors(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ProceduralSkyTest, Lighting)
+{
+  Lighting(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(ProceduralSky, ProceduralSkyTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/RadarSensor.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class RadarSensorTest : public testing::Test,
+                        public testing::WithParamInterface<const char *>
+{
+  /// \brief Test basic api
+  public: void RadarSensor(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void RadarSensorTest::RadarSensor(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports radar sensors
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' doesn't support radar sensors" << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' was unable to be retrieved" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  RadarSensorPtr radar(scene->CreateRadarSensor());
+  ASSERT_NE(nullptr, radar);
+
+  // range resolution
+  EXPECT_DOUBLE_EQ(0.5, radar->RangeResolution());
+  radar->SetRangeResolution(0.2);
+  EXPECT_DOUBLE_EQ(0.2, radar->RangeResolution());
+  radar->SetRangeResolution(0.0);
+  EXPECT_DOUBLE_EQ(0.2, radar->RangeResolution());
+
+  // angle resolution
+  EXPECT_DOUBLE_EQ(IGN_DTOR(2.0), radar->AngleResolution().Radian());
+  radar->SetAngleResolution(math::Angle(0.05));
+  EXPECT_DOUBLE_EQ(0.05, radar->AngleResolution().Radian());
+  radar->SetAngleResolution(math::Angle(-0.05));
+  EXPECT_DOUBLE_EQ(0.05, radar->AngleResolution().Radian());
+
+  // clutter
+  EXPECT_DOUBLE_EQ(0.0, radar->ClutterRate());
+  radar->SetClutterRate(3.0);
+  EXPECT_DOUBLE_EQ(3.0, radar->ClutterRate());
+  radar->SetClutterRate(-1.0);
+  EXPECT_DOUBLE_EQ(3.0, radar->ClutterRate());
+
+  // velocities
+  EXPECT_EQ(math::Vector3d::Zero, radar->LinearVelocity());
+  radar->SetLinearVelocity(math::Vector3d(1, 2, 3));
+  EXPECT_EQ(math::Vector3d(1, 2, 3), radar->LinearVelocity());
+  EXPECT_EQ(math::Vector3d::Zero, radar->VisualVelocity(10u));
+  radar->SetVisualVelocity(10u, math::Vector3d(-1, 0, 0));
+  EXPECT_EQ(math::Vector3d(-1, 0, 0), radar->VisualVelocity(10u));
+  radar->ClearVisualVelocities();
+  EXPECT_EQ(math::Vector3d::Zero, radar->VisualVelocity(10u));
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(RadarSensorTest, RadarSensor)
+{
+  RadarSensor(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(RadarSensor, RadarSensorTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/ReflectionProbe.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+using namespace std::chrono_literals;
+
+class ReflectionProbeTest : public testing::Test,
+                            public testing::WithParamInterface<const char *>
+{
+  /// \brief Test reflection probe properties
+  public: void Properties(const std::string &_renderEngine);
+
+  /// \brief Test when reflection probes are captured
+  public: void Capture(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void ReflectionProbeTest::Properties(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "ReflectionProbe not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+
+  ReflectionProbePtr probe = scene->CreateReflectionProbe();
+  ASSERT_NE(nullptr, probe);
+
+  // default values
+  EXPECT_EQ(math::Vector3d::Zero, probe->CapturePosition());
+  EXPECT_EQ(math::AxisAlignedBox(math::Vector3d(-5, -5, -5),
+      math::Vector3d(5, 5, 5)), probe->Area());
+  EXPECT_EQ(256u, probe->Resolution());
+  EXPECT_DOUBLE_EQ(0.1, probe->NearClipPlane());
+  EXPECT_DOUBLE_EQ(500.0, probe->FarClipPlane());
+  EXPECT_TRUE(probe->Static());
+  EXPECT_DOUBLE_EQ(0.0, probe->UpdateRate());
+  EXPECT_EQ(0u, probe->CaptureCount());
+
+  probe->SetCapturePosition(math::Vector3d(1, 2, 1.5));
+  EXPECT_EQ(math::Vector3d(1, 2, 1.5), probe->CapturePosition());
+  math::AxisAlignedBox area(math::Vector3d(-2, -3, 0),
+      math::Vector3d(4, 6, 3));
+  probe->SetArea(area);
+  EXPECT_EQ(area, probe->Area());
+  probe->SetResolution(128u);
+  EXPECT_EQ(128u, probe->Resolution());
+  probe->SetNearClipPlane(0.05);
+  EXPECT_DOUBLE_EQ(0.05, probe->NearClipPlane());
+  probe->SetFarClipPlane(50.0);
+  EXPECT_DOUBLE_EQ(50.0, probe->FarClipPlane());
+  probe->SetStatic(false);
+  EXPECT_FALSE(probe->Static());
+  probe->SetUpdateRate(5.0);
+  EXPECT_DOUBLE_EQ(5.0, probe->UpdateRate());
+
+  // invalid values are ignored
+  probe->SetArea(math::AxisAlignedBox(math::Vector3d(0, 0, 0),
+      math::Vector3d(1, 1, 0)));
+  EXPECT_EQ(area, probe->Area());
+  probe->SetResolution(0u);
+  EXPECT_EQ(128u, probe->Resolution());
+  probe->SetNearClipPlane(0.0);
+  EXPECT_DOUBLE_EQ(0.05, probe->NearClipPlane());
+  probe->SetNearClipPlane(60.0);
+  EXPECT_DOUBLE_EQ(0.05, probe->NearClipPlane());
+  probe->SetFarClipPlane(0.01);
+  EXPECT_DOUBLE_EQ(50.0, probe->FarClipPlane());
+  probe->SetUpdateRate(-1.0);
+  EXPECT_DOUBLE_EQ(5.0, probe->UpdateRate());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void ReflectionProbeTest::Capture(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "ReflectionProbe not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  VisualPtr root = scene->RootVisual();
+
+  // shiny box that picks up the probe
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetMetalness(1.0);
+  material->SetRoughness(0.1);
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetMaterial(material);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  camera->SetLocalPosition(-2.0, 0.0, 0.0);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  root->AddChild(camera);
+
+  ReflectionProbePtr probe = scene->CreateReflectionProbe();
+  ASSERT_NE(nullptr, probe);
+  probe->SetResolution(32u);
+
+  // static probe is captured once and then cached
+  camera->Update();
+  EXPECT_EQ(1u, probe->CaptureCount());
+  camera->Update();
+  EXPECT_EQ(1u, probe->CaptureCount());
+
+  // capture on demand
+  probe->Capture();
+  camera->Update();
+  EXPECT_EQ(2u, probe->CaptureCount());
+  camera->Update();
+  EXPECT_EQ(2u, probe->CaptureCount());
+
+  // dynamic probe is captured at most at the update rate
+  probe->SetStatic(false);
+  probe->SetUpdateRate(10.0);
+  scene->SetTime(50ms);
+  camera->Update();
+  EXPECT_EQ(2u, probe->CaptureCount());
+  scene->SetTime(100ms);
+  camera->Update();
+  EXPECT_EQ(3u, probe->CaptureCount());
+  scene->SetTime(150ms);
+  camera->Update();
+  EXPECT_EQ(3u, probe->CaptureCount());
+
+  // without an update rate it is captured every frame
+  probe->SetUpdateRate(0.0);
+  camera->Update();
+  EXPECT_EQ(4u, probe->CaptureCount());
+  camera->Update();
+  EXPECT_EQ(5u, probe->CaptureCount());
+
+  // materials stop using a probe when it is destroyed
+  probe->Destroy();
+  camera->Update();
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ReflectionProbeTest, Properties)
+{
+  Properties(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ReflectionProbeTest, Capture)
+{
+  Capture(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(ReflectionProbe, ReflectionProbeTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
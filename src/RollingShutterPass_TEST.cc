@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/RollingShutterPass.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class RollingShutterPassTest : public testing::Test,
+    public testing::WithParamInterface<const char*>
+{
+  /// \brief Test rolling shutter pass properties
+  public: void RollingShutter(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void RollingShutterPassTest::RollingShutter(const std::string &_renderEngine)
+{
+  // get engine
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // get the render pass system
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Render engine '" << _renderEngine << "' does not support "
+            << "render pass system" << std::endl;
+    return;
+  }
+  RenderPassPtr pass = rpSystem->Create<RollingShutterPass>();
+  RollingShutterPassPtr shutterPass =
+      std::dynamic_pointer_cast<RollingShutterPass>(pass);
+  ASSERT_NE(nullptr, shutterPass);
+
+  // verify initial values
+  EXPECT_DOUBLE_EQ(0.5, shutterPass->ReadoutFraction());
+
+  // readout fraction is clamped to [0, 1]
+  shutterPass->SetReadoutFraction(0.9);
+  EXPECT_DOUBLE_EQ(0.9, shutterPass->ReadoutFraction());
+  shutterPass->SetReadoutFraction(-0.5);
+  EXPECT_DOUBLE_EQ(0.0, shutterPass->ReadoutFraction());
+}
+
+/////////////////////////////////////////////////
+TEST_P(RollingShutterPassTest, RollingShutter)
+{
+  RollingShutter(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(RollingShutter, RollingShutterPassTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <mutex>
+#include <thread>
+
 #include <ignition/common/Console.hh>
 
 #include "test_config.h"  // NOLINT(build/include)
@@ -60,6 +63,9 @@ class SceneTest : public testing::Test,
 
   /// \brief Test enablng sky
   public: void Sky(const std::string &_renderEngine);
+
+  /// \brief Test scene thread ownership and the shared resource mutex
+  public: void OwnerThread(const std::string &_renderEngine);
 };
 
 /////////////////////////////////////////////////
@@ -781,6 +787,60 @@ void SceneTest::Sky(const std::string &_renderEngine)
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void SceneTest::OwnerThread(const std::string &_renderEngine)
+{
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // the thread that creates a scene owns it
+  EXPECT_EQ(std::this_thread::get_id(), scene->OwnerThread());
+
+  // hand the scene over to another thread and back
+  std::thread::id workerId;
+  std::thread worker([&]()
+  {
+    workerId = std::this_thread::get_id();
+  });
+  worker.join();
+  scene->SetOwnerThread(workerId);
+  EXPECT_EQ(workerId, scene->OwnerThread());
+  scene->SetOwnerThread(std::this_thread::get_id());
+  EXPECT_EQ(std::this_thread::get_id(), scene->OwnerThread());
+
+  // the owner thread may create objects while holding the shared resource
+  // mutex
+  {
+    std::lock_guard<std::recursive_mutex> lock(
+        engine->SharedResourceMutex());
+    VisualPtr visual = scene->CreateVisual("visual");
+    EXPECT_NE(nullptr, visual);
+  }
+
+  // the mutex is free again
+  std::recursive_mutex &mutex = engine->SharedResourceMutex();
+  bool locked = false;
+  std::thread other([&]()
+  {
+    locked = mutex.try_lock();
+    if (locked)
+      mutex.unlock();
+  });
+  other.join();
+  EXPECT_TRUE(locked);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(SceneTest, Scene)
 {
@@ -835,6 +895,12 @@ TEST_P(SceneTest, Sky)
   Sky(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(SceneTest, OwnerThread)
+{
+  OwnerThread(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(Scene, SceneTest,
     RENDER_ENGINE_VALUES,
     ignition::rendering::PrintToStringParam());
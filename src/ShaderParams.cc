@@ -164,3 +164,10 @@ void ShaderParams::ClearDirty()
 {
   this->dataPtr->isDirty = false;
 }
+
+//////////////////////////////////////////////////
+void ShaderParams::Clear()
+{
+  this->dataPtr->parameters.clear();
+  this->dataPtr->isDirty = true;
+}
@@ -47,6 +47,17 @@ TEST(ShaderParams, ClearDirty)
   EXPECT_FALSE(params.IsDirty());
 }
 
+/////////////////////////////////////////////////
+TEST(ShaderParams, Clear)
+{
+  ShaderParams params;
+  params["some_parameter"] = 4.0f;
+  params.ClearDirty();
+  params.Clear();
+  EXPECT_TRUE(params.IsDirty());
+  EXPECT_TRUE(params.begin() == params.end());
+}
+
 /////////////////////////////////////////////////
 TEST(ShaderParams, ConstAccessDoesNotDirty)
 {
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/ShaderParams.hh"
+#include "ignition/rendering/ShaderPass.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class ShaderPassTest : public testing::Test,
+    public testing::WithParamInterface<const char*>
+{
+  /// \brief Test user shader pass properties
+  public: void Shader(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void ShaderPassTest::Shader(const std::string &_renderEngine)
+{
+  // get engine
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // get the render pass system
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Render engine '" << _renderEngine << "' does not support "
+            << "render pass system" << std::endl;
+    return;
+  }
+  RenderPassPtr pass = rpSystem->Create<ShaderPass>();
+  ShaderPassPtr shaderPass =
+      std::dynamic_pointer_cast<ShaderPass>(pass);
+  ASSERT_NE(nullptr, shaderPass);
+
+  // verify initial values
+  EXPECT_TRUE(shaderPass->FragmentShader().empty());
+  EXPECT_NE(nullptr, shaderPass->FragmentShaderParams());
+  EXPECT_FALSE(shaderPass->DepthInputEnabled());
+
+  // invalid path is ignored
+  shaderPass->SetFragmentShader("invalid_path_fs.glsl");
+  EXPECT_TRUE(shaderPass->FragmentShader().empty());
+
+  // valid path
+  std::string fsPath = common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+      "test", "media", "materials", "programs", "simple_color_330_fs.glsl");
+  shaderPass->SetFragmentShader(fsPath);
+  EXPECT_EQ(fsPath, shaderPass->FragmentShader());
+
+  // params
+  ShaderParamsPtr params = shaderPass->FragmentShaderParams();
+  ASSERT_NE(nullptr, params);
+  (*params)["gain"] = 2.0f;
+  EXPECT_TRUE(params->IsDirty());
+  EXPECT_EQ(ShaderParam::PARAM_FLOAT, (*params)["gain"].Type());
+
+  // a new shader clears the params but keeps the same object
+  std::string fsPath2 = common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+      "test", "media", "materials", "programs", "shader_pass_swap_fs.glsl");
+  shaderPass->SetFragmentShader(fsPath2);
+  EXPECT_EQ(fsPath2, shaderPass->FragmentShader());
+  EXPECT_EQ(params, shaderPass->FragmentShaderParams());
+  EXPECT_TRUE(params->begin() == params->end());
+
+  // depth input
+  shaderPass->SetDepthInputEnabled(true);
+  EXPECT_TRUE(shaderPass->DepthInputEnabled());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ShaderPassTest, Shader)
+{
+  Shader(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Shader, ShaderPassTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/SonarSensor.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class SonarSensorTest : public testing::Test,
+                        public testing::WithParamInterface<const char *>
+{
+  /// \brief Test basic api
+  public: void SonarSensor(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void SonarSensorTest::SonarSensor(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports sonar sensors
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' doesn't support sonar sensors" << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' was unable to be retrieved" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  SonarSensorPtr sonar(scene->CreateSonarSensor());
+  ASSERT_NE(nullptr, sonar);
+
+  // beams and range bins
+  EXPECT_EQ(256u, sonar->BeamCount());
+  sonar->SetBeamCount(128u);
+  EXPECT_EQ(128u, sonar->BeamCount());
+  sonar->SetBeamCount(0u);
+  EXPECT_EQ(128u, sonar->BeamCount());
+
+  EXPECT_EQ(512u, sonar->RangeBinCount());
+  sonar->SetRangeBinCount(100u);
+  EXPECT_EQ(100u, sonar->RangeBinCount());
+  sonar->SetRangeBinCount(0u);
+  EXPECT_EQ(100u, sonar->RangeBinCount());
+
+  // apertures
+  EXPECT_DOUBLE_EQ(IGN_DTOR(20.0), sonar->VerticalFOV().Radian());
+  sonar->SetVerticalFOV(math::Angle(0.5));
+  EXPECT_DOUBLE_EQ(0.5, sonar->VerticalFOV().Radian());
+  sonar->SetVerticalFOV(math::Angle(IGN_PI));
+  EXPECT_DOUBLE_EQ(0.5, sonar->VerticalFOV().Radian());
+  sonar->SetVerticalFOV(math::Angle(0.0));
+  EXPECT_DOUBLE_EQ(0.5, sonar->VerticalFOV().Radian());
+
+  EXPECT_DOUBLE_EQ(IGN_DTOR(1.0), sonar->BeamWidth().Radian());
+  sonar->SetBeamWidth(math::Angle(0.05));
+  EXPECT_DOUBLE_EQ(0.05, sonar->BeamWidth().Radian());
+  sonar->SetBeamWidth(math::Angle(-0.05));
+  EXPECT_DOUBLE_EQ(0.05, sonar->BeamWidth().Radian());
+
+  // attenuation and noise
+  EXPECT_DOUBLE_EQ(0.0, sonar->Attenuation());
+  sonar->SetAttenuation(0.1);
+  EXPECT_DOUBLE_EQ(0.1, sonar->Attenuation());
+  sonar->SetAttenuation(-0.1);
+  EXPECT_DOUBLE_EQ(0.1, sonar->Attenuation());
+
+  EXPECT_DOUBLE_EQ(0.0, sonar->SpeckleNoise());
+  sonar->SetSpeckleNoise(0.5);
+  EXPECT_DOUBLE_EQ(0.5, sonar->SpeckleNoise());
+  sonar->SetSpeckleNoise(1.5);
+  EXPECT_DOUBLE_EQ(0.5, sonar->SpeckleNoise());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SonarSensorTest, SonarSensor)
+{
+  SonarSensor(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(SonarSensor, SonarSensorTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
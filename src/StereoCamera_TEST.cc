@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/StereoCamera.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class StereoCameraTest : public testing::Test,
+                         public testing::WithParamInterface<const char *>
+{
+  /// \brief Test basic api
+  public: void StereoCamera(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void StereoCameraTest::StereoCamera(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports stereo cameras
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' doesn't support stereo cameras" << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' was unable to be retrieved" << std::endl;
+    return;
+  }
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  StereoCameraPtr camera(scene->CreateStereoCamera());
+  ASSERT_NE(nullptr, camera);
+
+  // baseline
+  EXPECT_GT(camera->Baseline(), 0.0);
+  camera->SetBaseline(0.25);
+  EXPECT_DOUBLE_EQ(0.25, camera->Baseline());
+  camera->SetBaseline(-1.0);
+  EXPECT_DOUBLE_EQ(0.25, camera->Baseline());
+  camera->SetBaseline(0.0);
+  EXPECT_DOUBLE_EQ(0.0, camera->Baseline());
+
+  // disparity
+  EXPECT_FALSE(camera->DisparityEnabled());
+  EXPECT_EQ(nullptr, camera->DisparityData());
+  camera->SetDisparityEnabled(true);
+  EXPECT_TRUE(camera->DisparityEnabled());
+  EXPECT_EQ(nullptr, camera->DisparityData());
+
+  // focal length
+  camera->SetImageWidth(320u);
+  camera->SetHFOV(math::Angle(IGN_PI * 0.5));
+  EXPECT_NEAR(160.0, camera->FocalLength(), 1e-6);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(StereoCameraTest, StereoCamera)
+{
+  StereoCamera(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(StereoCamera, StereoCameraTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
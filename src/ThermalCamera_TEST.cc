@@ -72,6 +72,26 @@ void ThermalCameraTest::ThermalCamera(const std::string &_renderEngine)
   camera->SetLinearResolution(resolution);
   EXPECT_FLOAT_EQ(resolution, camera->LinearResolution());
 
+  // radiometric model
+  EXPECT_FALSE(camera->RadiometricModelEnabled());
+  camera->SetRadiometricModelEnabled(true);
+  EXPECT_TRUE(camera->RadiometricModelEnabled());
+
+  // reflected temperature defaults to ambient temperature
+  EXPECT_FLOAT_EQ(ambient, camera->ReflectedTemperature());
+  float reflectedTemp = 290.0f;
+  camera->SetReflectedTemperature(reflectedTemp);
+  EXPECT_FLOAT_EQ(reflectedTemp, camera->ReflectedTemperature());
+
+  EXPECT_FLOAT_EQ(0.0f, camera->AtmosphericExtinctionCoefficient());
+  float extinction = 0.01f;
+  camera->SetAtmosphericExtinctionCoefficient(extinction);
+  EXPECT_FLOAT_EQ(extinction, camera->AtmosphericExtinctionCoefficient());
+
+  // negative coefficients are not allowed
+  camera->SetAtmosphericExtinctionCoefficient(-1.0f);
+  EXPECT_FLOAT_EQ(0.0f, camera->AtmosphericExtinctionCoefficient());
+
   // Clean up
   engine->DestroyScene(scene);
   rendering::unloadEngine(engine->Name());
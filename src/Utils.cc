@@ -15,6 +15,8 @@
  *
 */
 
+#include <cmath>
+
 #ifdef __linux__
 #include <X11/Xlib.h>
 #include <X11/Xresource.h>
@@ -229,6 +231,52 @@ ignition::math::AxisAlignedBox transformAxisAlignedBox(
   }
   return ignition::math::AxisAlignedBox(min, max);
 }
+
+/////////////////////////////////////////////////
+uint32_t encodeOctahedralNormal(const math::Vector3d &_v)
+{
+  double l1 = std::abs(_v.X()) + std::abs(_v.Y()) + std::abs(_v.Z());
+  if (l1 <= 0.0)
+    return 0u;
+
+  double u = _v.X() / l1;
+  double v = _v.Y() / l1;
+
+  // fold the lower half of the octahedron over the upper half. This must
+  // match the encoding in the depth camera shaders
+  if (_v.Z() < 0.0)
+  {
+    double fu = (1.0 - std::abs(v)) * (u >= 0.0 ? 1.0 : -1.0);
+    double fv = (1.0 - std::abs(u)) * (v >= 0.0 ? 1.0 : -1.0);
+    u = fu;
+    v = fv;
+  }
+
+  auto quantize = [](double _x)
+  {
+    return static_cast<uint32_t>(
+        std::round(math::clamp(_x * 0.5 + 0.5, 0.0, 1.0) * 65535.0));
+  };
+  return quantize(u) | (quantize(v) << 16);
+}
+
+/////////////////////////////////////////////////
+math::Vector3d decodeOctahedralNormal(uint32_t _encoded)
+{
+  double u = (_encoded & 0xFFFF) / 65535.0 * 2.0 - 1.0;
+  double v = (_encoded >> 16 & 0xFFFF) / 65535.0 * 2.0 - 1.0;
+  double z = 1.0 - std::abs(u) - std::abs(v);
+
+  // unfold the lower half of the octahedron
+  if (z < 0.0)
+  {
+    double fu = (1.0 - std::abs(v)) * (u >= 0.0 ? 1.0 : -1.0);
+    double fv = (1.0 - std::abs(u)) * (v >= 0.0 ? 1.0 : -1.0);
+    u = fu;
+    v = fv;
+  }
+  return math::Vector3d(u, v, z).Normalized();
+}
 }
 }
 }
@@ -15,6 +15,8 @@
 */
 #include <gtest/gtest.h>
 
+#include <cmath>
+
 #include <ignition/common/Console.hh>
 
 #include "ignition/rendering/Camera.hh"
@@ -176,6 +178,39 @@ INSTANTIATE_TEST_CASE_P(ClickToScene, UtilTest,
     RENDER_ENGINE_VALUES,
     ignition::rendering::PrintToStringParam());
 
+/////////////////////////////////////////////////
+TEST(UtilTest, OctahedralNormal)
+{
+  // zero vector
+  EXPECT_EQ(0u, encodeOctahedralNormal(math::Vector3d::Zero));
+
+  // axes
+  for (const auto &axis : {math::Vector3d::UnitX, -math::Vector3d::UnitX,
+      math::Vector3d::UnitY, -math::Vector3d::UnitY,
+      math::Vector3d::UnitZ, -math::Vector3d::UnitZ})
+  {
+    math::Vector3d decoded = decodeOctahedralNormal(
+        encodeOctahedralNormal(axis));
+    EXPECT_NEAR(1.0, decoded.Dot(axis), 1e-9) << axis;
+  }
+
+  // round trip error is well below one degree on both hemispheres
+  for (double x = -1.0; x <= 1.0; x += 0.25)
+  {
+    for (double y = -1.0; y <= 1.0; y += 0.25)
+    {
+      for (double z : {-0.7, -0.1, 0.3, 0.9})
+      {
+        math::Vector3d v = math::Vector3d(x, y, z).Normalized();
+        math::Vector3d decoded = decodeOctahedralNormal(
+            encodeOctahedralNormal(v * 3.0));
+        EXPECT_NEAR(1.0, decoded.Length(), 1e-9);
+        EXPECT_GT(decoded.Dot(v), std::cos(IGN_DTOR(0.01))) << v;
+      }
+    }
+  }
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
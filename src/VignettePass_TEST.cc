@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/VignettePass.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class VignettePassTest : public testing::Test,
+    public testing::WithParamInterface<const char*>
+{
+  /// \brief Test vignette pass properties
+  public: void Vignette(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void VignettePassTest::Vignette(const std::string &_renderEngine)
+{
+  // get engine
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // get the render pass system
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Render engine '" << _renderEngine << "' does not support "
+            << "render pass system" << std::endl;
+    return;
+  }
+  RenderPassPtr pass = rpSystem->Create<VignettePass>();
+  VignettePassPtr vignettePass =
+      std::dynamic_pointer_cast<VignettePass>(pass);
+  ASSERT_NE(nullptr, vignettePass);
+
+  // verify initial values
+  EXPECT_DOUBLE_EQ(0.5, vignettePass->Intensity());
+  EXPECT_DOUBLE_EQ(0.5, vignettePass->Radius());
+  EXPECT_DOUBLE_EQ(0.5, vignettePass->Smoothness());
+
+  // intensity and radius are clamped to [0, 1]
+  vignettePass->SetIntensity(0.8);
+  EXPECT_DOUBLE_EQ(0.8, vignettePass->Intensity());
+  vignettePass->SetIntensity(2.0);
+  EXPECT_DOUBLE_EQ(1.0, vignettePass->Intensity());
+  vignettePass->SetRadius(-1.0);
+  EXPECT_DOUBLE_EQ(0.0, vignettePass->Radius());
+
+  // smoothness must be positive
+  vignettePass->SetSmoothness(0.2);
+  EXPECT_DOUBLE_EQ(0.2, vignettePass->Smoothness());
+  vignettePass->SetSmoothness(0.0);
+  EXPECT_DOUBLE_EQ(0.2, vignettePass->Smoothness());
+}
+
+/////////////////////////////////////////////////
+TEST_P(VignettePassTest, Vignette)
+{
+  Vignette(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Vignette, VignettePassTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
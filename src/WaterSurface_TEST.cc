@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+#include "ignition/rendering/WaterSurface.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class WaterSurfaceTest : public testing::Test,
+                         public testing::WithParamInterface<const char *>
+{
+  public: void WaterSurface(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void WaterSurfaceTest::WaterSurface(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "WaterSurface not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+           << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+
+  WaterSurfacePtr water = scene->CreateWaterSurface();
+  ASSERT_NE(nullptr, water);
+
+  // defaults
+  EXPECT_EQ(math::Vector2d(100.0, 100.0), water->Size());
+  EXPECT_DOUBLE_EQ(0.0, water->Time());
+  EXPECT_EQ(5u, water->LodLevels());
+  EXPECT_EQ(64u, water->Tessellation());
+  EXPECT_EQ(0u, water->Waves().WaveCount());
+
+  water->SetSize(math::Vector2d(20.0, 30.0));
+  EXPECT_EQ(math::Vector2d(20.0, 30.0), water->Size());
+  water->SetTime(2.5);
+  EXPECT_DOUBLE_EQ(2.5, water->Time());
+  water->SetLodLevels(3u);
+  EXPECT_EQ(3u, water->LodLevels());
+  water->SetLodLevels(0u);
+  EXPECT_EQ(1u, water->LodLevels());
+  water->SetLodLevels(4u);
+
+  // tessellation is rounded to a multiple of 4
+  water->SetTessellation(32u);
+  EXPECT_EQ(32u, water->Tessellation());
+  water->SetTessellation(30u);
+  EXPECT_EQ(28u, water->Tessellation());
+
+  GerstnerWaves waves;
+  GerstnerWave wave;
+  wave.amplitude = 0.25;
+  wave.wavelength = 5.0;
+  wave.direction.Set(1.0, 0.0);
+  EXPECT_TRUE(waves.AddWave(wave));
+  water->SetWaves(waves);
+  EXPECT_EQ(1u, water->Waves().WaveCount());
+
+  // heights are given in world coordinates
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(water);
+  visual->SetWorldPosition(0.0, 0.0, 2.0);
+  scene->RootVisual()->AddChild(visual);
+
+  std::vector<math::Vector3d> points = {
+      math::Vector3d(0.0, 0.0, 0.0),
+      math::Vector3d(1.3, -4.0, 10.0)};
+  std::vector<double> heights;
+  water->Heights(points, 0.5, heights);
+  ASSERT_EQ(points.size(), heights.size());
+  for (unsigned int i = 0; i < points.size(); ++i)
+  {
+    EXPECT_DOUBLE_EQ(2.0 + waves.Height(
+        math::Vector2d(points[i].X(), points[i].Y()), 0.5), heights[i]);
+  }
+
+  // rendering with a modified grid should not crash
+  water->PreRender();
+
+  // test cloning a water surface
+  auto clonedWater =
+      std::dynamic_pointer_cast<rendering::WaterSurface>(water->Clone());
+  ASSERT_NE(nullptr, clonedWater);
+  EXPECT_EQ(water->Size(), clonedWater->Size());
+  EXPECT_DOUBLE_EQ(water->Time(), clonedWater->Time());
+  EXPECT_EQ(water->LodLevels(), clonedWater->LodLevels());
+  EXPECT_EQ(water->Tessellation(), clonedWater->Tessellation());
+  EXPECT_EQ(water->Waves().WaveCount(), clonedWater->Waves().WaveCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(WaterSurfaceTest, WaterSurface)
+{
+  WaterSurface(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(WaterSurface, WaterSurfaceTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
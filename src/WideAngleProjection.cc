@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <ignition/math/Helpers.hh>
+
+#include "ignition/rendering/WideAngleProjection.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+class ignition::rendering::WideAngleProjectionPrivate
+{
+  /// \brief Map the angle between a ray and the optical axis to the
+  /// distance from the image center divided by the focal length
+  /// \param[in] _theta Angle from the optical axis in radians
+  /// \return Normalized distance from the image center
+  public: double Radius(double _theta) const;
+
+  /// \brief Inverse of Radius
+  /// \param[in] _radius Normalized distance from the image center
+  /// \param[out] _theta Angle from the optical axis in radians
+  /// \return False if no angle maps to the distance
+  public: bool Theta(double _radius, double &_theta) const;
+
+  /// \brief Get the largest angle from the optical axis that the
+  /// projection can map
+  /// \return Angle in radians
+  public: double MaxTheta() const;
+
+  /// \brief Projection type
+  public: CameraProjectionType type = CPT_PERSPECTIVE;
+
+  /// \brief Image width in pixels
+  public: unsigned int width = 1u;
+
+  /// \brief Image height in pixels
+  public: unsigned int height = 1u;
+
+  /// \brief Horizontal field of view
+  public: math::Angle hfov = math::Angle(IGN_PI * 0.5);
+
+  /// \brief Kannala-Brandt coefficients
+  public: math::Vector4d coefficients = math::Vector4d::Zero;
+
+  /// \brief Max number of Newton iterations used to invert the
+  /// Kannala-Brandt polynomial
+  public: const unsigned int kMaxIterations = 20u;
+
+  /// \brief Convergence tolerance of the Kannala-Brandt inversion
+  public: const double kTolerance = 1e-10;
+};
+
+//////////////////////////////////////////////////
+double WideAngleProjectionPrivate::Radius(double _theta) const
+{
+  switch (this->type)
+  {
+    case CPT_PERSPECTIVE:
+      return std::tan(_theta);
+    case CPT_EQUIDISTANT:
+      return _theta;
+    case CPT_EQUISOLID:
+      return 2.0 * std::sin(_theta * 0.5);
+    case CPT_STEREOGRAPHIC:
+      return 2.0 * std::tan(_theta * 0.5);
+    case CPT_KANNALA_BRANDT:
+    {
+      double t2 = _theta * _theta;
+      const math::Vector4d &k = this->coefficients;
+      return _theta * (1.0 + t2 * (k[0] + t2 * (k[1] + t2 * (k[2] +
+          t2 * k[3]))));
+    }
+    default:
+      return 0.0;
+  }
+}
+
+//////////////////////////////////////////////////
+bool WideAngleProjectionPrivate::Theta(double _radius, double &_theta) const
+{
+  switch (this->type)
+  {
+    case CPT_PERSPECTIVE:
+      _theta = std::atan(_radius);
+      return true;
+    case CPT_EQUIDISTANT:
+      _theta = _radius;
+      return true;
+    case CPT_EQUISOLID:
+      if (_radius > 2.0)
+        return false;
+      _theta = 2.0 * std::asin(_radius * 0.5);
+      return true;
+    case CPT_STEREOGRAPHIC:
+      _theta = 2.0 * std::atan(_radius * 0.5);
+      return true;
+    case CPT_KANNALA_BRANDT:
+    {
+      // Newton's method starting from the equidistant solution
+      const math::Vector4d &k = this->coefficients;
+      double theta = std::min(_radius, IGN_PI);
+      for (unsigned int i = 0; i < this->kMaxIterations; ++i)
+      {
+        double t2 = theta * theta;
+        double err = this->Radius(theta) - _radius;
+        double deriv = 1.0 + t2 * (3.0 * k[0] + t2 * (5.0 * k[1] +
+            t2 * (7.0 * k[2] + t2 * 9.0 * k[3])));
+        if (std::abs(err) < this->kTolerance)
+          break;
+        if (deriv <= 0.0)
+          return false;
+        theta -= err / deriv;
+      }
+      if (std::abs(this->Radius(theta) - _radius) > 1e-6 || theta < 0.0)
+        return false;
+      _theta = theta;
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+//////////////////////////////////////////////////
+double WideAngleProjectionPrivate::MaxTheta() const
+{
+  return this->type == CPT_PERSPECTIVE ? IGN_PI * 0.5 : IGN_PI;
+}
+
+//////////////////////////////////////////////////
+WideAngleProjection::WideAngleProjection()
+  : dataPtr(std::make_unique<WideAngleProjectionPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+WideAngleProjection::WideAngleProjection(CameraProjectionType _type,
+    unsigned int _width, unsigned int _height, const math::Angle &_hfov)
+  : dataPtr(std::make_unique<WideAngleProjectionPrivate>())
+{
+  this->SetType(_type);
+  this->SetImageSize(_width, _height);
+  this->SetHFOV(_hfov);
+}
+
+//////////////////////////////////////////////////
+WideAngleProjection::WideAngleProjection(
+    const WideAngleProjection &_projection)
+  : dataPtr(new WideAngleProjectionPrivate(*_projection.dataPtr))
+{
+}
+
+//////////////////////////////////////////////////
+WideAngleProjection::WideAngleProjection(
+    WideAngleProjection &&_projection) noexcept
+  : dataPtr(std::exchange(_projection.dataPtr, nullptr))
+{
+}
+
+//////////////////////////////////////////////////
+WideAngleProjection::~WideAngleProjection()
+{
+}
+
+//////////////////////////////////////////////////
+WideAngleProjection &WideAngleProjection::operator=(
+    const WideAngleProjection &_projection)
+{
+  return *this = WideAngleProjection(_projection);
+}
+
+//////////////////////////////////////////////////
+WideAngleProjection &WideAngleProjection::operator=(
+    WideAngleProjection &&_projection)
+{
+  std::swap(this->dataPtr, _projection.dataPtr);
+  return *this;
+}
+
+//////////////////////////////////////////////////
+bool WideAngleProjection::IsWideAngle(CameraProjectionType _type)
+{
+  return _type == CPT_EQUIDISTANT || _type == CPT_EQUISOLID ||
+      _type == CPT_STEREOGRAPHIC || _type == CPT_KANNALA_BRANDT ||
+      _type == CPT_EQUIRECTANGULAR;
+}
+
+//////////////////////////////////////////////////
+void WideAngleProjection::SetType(CameraProjectionType _type)
+{
+  this->dataPtr->type = _type;
+}
+
+//////////////////////////////////////////////////
+CameraProjectionType WideAngleProjection::Type() const
+{
+  return this->dataPtr->type;
+}
+
+//////////////////////////////////////////////////
+void WideAngleProjection::SetImageSize(unsigned int _width,
+    unsigned int _height)
+{
+  this->dataPtr->width = _width;
+  this->dataPtr->height = _height;
+}
+
+//////////////////////////////////////////////////
+unsigned int WideAngleProjection::ImageWidth() const
+{
+  return this->dataPtr->width;
+}
+
+//////////////////////////////////////////////////
+unsigned int WideAngleProjection::ImageHeight() const
+{
+  return this->dataPtr->height;
+}
+
+//////////////////////////////////////////////////
+void WideAngleProjection::SetHFOV(const math::Angle &_hfov)
+{
+  this->dataPtr->hfov = _hfov;
+}
+
+//////////////////////////////////////////////////
+math::Angle WideAngleProjection::HFOV() const
+{
+  return this->dataPtr->hfov;
+}
+
+//////////////////////////////////////////////////
+void WideAngleProjection::SetCoefficients(
+    const math::Vector4d &_coefficients)
+{
+  this->dataPtr->coefficients = _coefficients;
+}
+
+//////////////////////////////////////////////////
+math::Vector4d WideAngleProjection::Coefficients() const
+{
+  return this->dataPtr->coefficients;
+}
+
+//////////////////////////////////////////////////
+double WideAngleProjection::FocalLength() const
+{
+  double hfov = this->dataPtr->hfov.Radian();
+  if (hfov <= 0.0 || this->dataPtr->width == 0u)
+    return 0.0;
+
+  double halfWidth = this->dataPtr->width * 0.5;
+  if (this->dataPtr->type == CPT_EQUIRECTANGULAR)
+    return hfov > 2.0 * IGN_PI ? 0.0 : 2.0 * halfWidth / hfov;
+
+  if (this->dataPtr->type == CPT_ORTHOGRAPHIC ||
+      hfov * 0.5 >= this->dataPtr->MaxTheta())
+    return 0.0;
+
+  double radius = this->dataPtr->Radius(hfov * 0.5);
+  if (radius <= 0.0 || !std::isfinite(radius))
+    return 0.0;
+  return halfWidth / radius;
+}
+
+//////////////////////////////////////////////////
+bool WideAngleProjection::PixelToRay(const math::Vector2d &_pixel,
+    math::Vector3d &_ray) const
+{
+  double f = this->FocalLength();
+  if (f <= 0.0)
+    return false;
+
+  // offset from the image center with y pointing up
+  double dx = _pixel.X() - this->dataPtr->width * 0.5;
+  double dy = this->dataPtr->height * 0.5 - _pixel.Y();
+
+  if (this->dataPtr->type == CPT_EQUIRECTANGULAR)
+  {
+    double lon = dx / f;
+    double lat = dy / f;
+    if (std::abs(lon) > IGN_PI || std::abs(lat) > IGN_PI * 0.5)
+      return false;
+    _ray.Set(std::cos(lat) * std::cos(lon), -std::cos(lat) * std::sin(lon),
+        std::sin(lat));
+    return true;
+  }
+
+  double dist = std::sqrt(dx * dx + dy * dy);
+  double theta;
+  if (!this->dataPtr->Theta(dist / f, theta) ||
+      theta > this->dataPtr->MaxTheta())
+    return false;
+
+  if (dist <= 0.0)
+  {
+    _ray = math::Vector3d::UnitX;
+    return true;
+  }
+  double s = std::sin(theta);
+  _ray.Set(std::cos(theta), -s * dx / dist, s * dy / dist);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool WideAngleProjection::RayToPixel(const math::Vector3d &_ray,
+    math::Vector2d &_pixel) const
+{
+  double f = this->FocalLength();
+  double length = _ray.Length();
+  if (f <= 0.0 || length <= 0.0)
+    return false;
+
+  math::Vector3d ray = _ray / length;
+  double dx;
+  double dy;
+  if (this->dataPtr->type == CPT_EQUIRECTANGULAR)
+  {
+    dx = std::atan2(-ray.Y(), ray.X()) * f;
+    dy = std::asin(math::clamp(ray.Z(), -1.0, 1.0)) * f;
+  }
+  else
+  {
+    double dist = std::sqrt(ray.Y() * ray.Y() + ray.Z() * ray.Z());
+    double theta = std::atan2(dist, ray.X());
+    // the direction in the image of a ray pointing straight backwards is
+    // undefined
+    if (theta > this->dataPtr->MaxTheta() || (dist <= 0.0 && ray.X() < 0.0))
+      return false;
+    double radius = this->dataPtr->Radius(theta) * f;
+    if (!std::isfinite(radius))
+      return false;
+    dx = dist > 0.0 ? -radius * ray.Y() / dist : 0.0;
+    dy = dist > 0.0 ? radius * ray.Z() / dist : 0.0;
+  }
+
+  _pixel.Set(this->dataPtr->width * 0.5 + dx,
+      this->dataPtr->height * 0.5 - dy);
+  return _pixel.X() >= 0.0 && _pixel.X() <= this->dataPtr->width &&
+      _pixel.Y() >= 0.0 && _pixel.Y() <= this->dataPtr->height;
+}
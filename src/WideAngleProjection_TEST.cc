@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <ignition/math/Helpers.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/WideAngleProjection.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(WideAngleProjectionTest, Properties)
+{
+  WideAngleProjection projection;
+  EXPECT_EQ(CPT_PERSPECTIVE, projection.Type());
+  EXPECT_EQ(math::Vector4d::Zero, projection.Coefficients());
+
+  EXPECT_FALSE(WideAngleProjection::IsWideAngle(CPT_PERSPECTIVE));
+  EXPECT_FALSE(WideAngleProjection::IsWideAngle(CPT_ORTHOGRAPHIC));
+  EXPECT_TRUE(WideAngleProjection::IsWideAngle(CPT_EQUIDISTANT));
+  EXPECT_TRUE(WideAngleProjection::IsWideAngle(CPT_EQUISOLID));
+  EXPECT_TRUE(WideAngleProjection::IsWideAngle(CPT_STEREOGRAPHIC));
+  EXPECT_TRUE(WideAngleProjection::IsWideAngle(CPT_KANNALA_BRANDT));
+  EXPECT_TRUE(WideAngleProjection::IsWideAngle(CPT_EQUIRECTANGULAR));
+
+  projection.SetType(CPT_EQUISOLID);
+  projection.SetImageSize(640u, 480u);
+  projection.SetHFOV(math::Angle(IGN_PI));
+  projection.SetCoefficients(math::Vector4d(0.1, 0.2, 0.3, 0.4));
+  EXPECT_EQ(CPT_EQUISOLID, projection.Type());
+  EXPECT_EQ(640u, projection.ImageWidth());
+  EXPECT_EQ(480u, projection.ImageHeight());
+  EXPECT_DOUBLE_EQ(IGN_PI, projection.HFOV().Radian());
+  EXPECT_EQ(math::Vector4d(0.1, 0.2, 0.3, 0.4), projection.Coefficients());
+
+  // copy
+  WideAngleProjection copy(projection);
+  EXPECT_EQ(CPT_EQUISOLID, copy.Type());
+  WideAngleProjection assigned;
+  assigned = copy;
+  EXPECT_EQ(640u, assigned.ImageWidth());
+}
+
+/////////////////////////////////////////////////
+TEST(WideAngleProjectionTest, FocalLength)
+{
+  // the edges of the image are at half of the field of view
+  WideAngleProjection perspective(CPT_PERSPECTIVE, 200u, 100u,
+      math::Angle(IGN_PI * 0.5));
+  EXPECT_DOUBLE_EQ(100.0, perspective.FocalLength());
+
+  WideAngleProjection equidistant(CPT_EQUIDISTANT, 200u, 200u,
+      math::Angle(IGN_PI));
+  EXPECT_DOUBLE_EQ(100.0 / (IGN_PI * 0.5), equidistant.FocalLength());
+
+  WideAngleProjection equirect(CPT_EQUIRECTANGULAR, 360u, 180u,
+      math::Angle(2.0 * IGN_PI));
+  EXPECT_DOUBLE_EQ(360.0 / (2.0 * IGN_PI), equirect.FocalLength());
+
+  // invalid field of view
+  perspective.SetHFOV(math::Angle(IGN_PI));
+  EXPECT_DOUBLE_EQ(0.0, perspective.FocalLength());
+  math::Vector3d ray;
+  EXPECT_FALSE(perspective.PixelToRay(math::Vector2d(100, 50), ray));
+
+  WideAngleProjection ortho(CPT_ORTHOGRAPHIC, 200u, 100u,
+      math::Angle(IGN_PI * 0.5));
+  EXPECT_DOUBLE_EQ(0.0, ortho.FocalLength());
+}
+
+/////////////////////////////////////////////////
+TEST(WideAngleProjectionTest, Fisheye)
+{
+  const unsigned int size = 400u;
+  for (auto type : {CPT_EQUIDISTANT, CPT_EQUISOLID, CPT_STEREOGRAPHIC,
+      CPT_KANNALA_BRANDT})
+  {
+    WideAngleProjection projection(type, size, size,
+        math::Angle(IGN_PI * 190.0 / 180.0));
+    projection.SetCoefficients(math::Vector4d(-0.01, 0.002, 0.0, 0.0));
+
+    // optical axis goes through the image center
+    math::Vector3d ray;
+    EXPECT_TRUE(projection.PixelToRay(math::Vector2d(200, 200), ray));
+    EXPECT_EQ(math::Vector3d::UnitX, ray);
+
+    // edges of the image are at half of the field of view, which points
+    // slightly backwards
+    EXPECT_TRUE(projection.PixelToRay(math::Vector2d(size, 200), ray));
+    EXPECT_NEAR(std::cos(IGN_PI * 95.0 / 180.0), ray.X(), 1e-6);
+    EXPECT_LT(ray.Y(), 0.0);
+    EXPECT_NEAR(0.0, ray.Z(), 1e-9);
+    EXPECT_TRUE(projection.PixelToRay(math::Vector2d(200, 0), ray));
+    EXPECT_NEAR(std::cos(IGN_PI * 95.0 / 180.0), ray.X(), 1e-6);
+    EXPECT_GT(ray.Z(), 0.0);
+
+    // round trip
+    for (double x = 10.0; x < size; x += 45.0)
+    {
+      for (double y = 10.0; y < size; y += 45.0)
+      {
+        math::Vector2d pixel(x, y);
+        if (!projection.PixelToRay(pixel, ray))
+          continue;
+        EXPECT_NEAR(1.0, ray.Length(), 1e-9);
+        math::Vector2d result;
+        EXPECT_TRUE(projection.RayToPixel(ray, result));
+        EXPECT_NEAR(x, result.X(), 1e-6);
+        EXPECT_NEAR(y, result.Y(), 1e-6);
+      }
+    }
+
+    // a point straight behind the camera is not visible
+    math::Vector2d pixel;
+    EXPECT_FALSE(projection.RayToPixel(math::Vector3d(-1, 0, 0), pixel));
+  }
+
+  // equisolid projection can not map a radius larger than 2f
+  WideAngleProjection equisolid(CPT_EQUISOLID, size, size,
+      math::Angle(IGN_PI));
+  double f = equisolid.FocalLength();
+  math::Vector3d ray;
+  EXPECT_FALSE(equisolid.PixelToRay(
+      math::Vector2d(200.0 + 2.0 * f + 1.0, 200.0), ray));
+}
+
+/////////////////////////////////////////////////
+TEST(WideAngleProjectionTest, Equirectangular)
+{
+  WideAngleProjection projection(CPT_EQUIRECTANGULAR, 360u, 180u,
+      math::Angle(2.0 * IGN_PI));
+
+  math::Vector3d ray;
+  EXPECT_TRUE(projection.PixelToRay(math::Vector2d(180, 90), ray));
+  EXPECT_EQ(math::Vector3d::UnitX, ray);
+
+  // left edge looks backwards and the image center column on the right
+  // looks to the right
+  EXPECT_TRUE(projection.PixelToRay(math::Vector2d(0, 90), ray));
+  EXPECT_NEAR(-1.0, ray.X(), 1e-9);
+  EXPECT_TRUE(projection.PixelToRay(math::Vector2d(270, 90), ray));
+  EXPECT_NEAR(-1.0, ray.Y(), 1e-9);
+
+  // top row looks up
+  EXPECT_TRUE(projection.PixelToRay(math::Vector2d(180, 0), ray));
+  EXPECT_NEAR(1.0, ray.Z(), 1e-9);
+
+  math::Vector2d pixel;
+  EXPECT_TRUE(projection.RayToPixel(math::Vector3d(0, 2, 0), pixel));
+  EXPECT_NEAR(90.0, pixel.X(), 1e-9);
+  EXPECT_NEAR(90.0, pixel.Y(), 1e-9);
+  EXPECT_TRUE(projection.RayToPixel(math::Vector3d(1, 0, 1), pixel));
+  EXPECT_NEAR(180.0, pixel.X(), 1e-9);
+  EXPECT_NEAR(45.0, pixel.Y(), 1e-9);
+
+  // narrower panorama does not see behind
+  projection.SetHFOV(math::Angle(IGN_PI));
+  EXPECT_FALSE(projection.RayToPixel(math::Vector3d(-1, 0, 0), pixel));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
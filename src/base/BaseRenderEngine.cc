@@ -15,6 +15,8 @@
  *
  */
 
+#include <mutex>
+
 #include <ignition/common/Console.hh>
 
 #include "ignition/rendering/RenderPassSystem.hh"
@@ -94,6 +96,7 @@ bool BaseRenderEngine::IsEnabled() const
 //////////////////////////////////////////////////
 unsigned int BaseRenderEngine::SceneCount() const
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (scenes)
     return scenes->Size();
@@ -103,6 +106,7 @@ unsigned int BaseRenderEngine::SceneCount() const
 //////////////////////////////////////////////////
 bool BaseRenderEngine::HasScene(ConstScenePtr _scene) const
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (scenes)
     return scenes->Contains(_scene);
@@ -112,6 +116,7 @@ bool BaseRenderEngine::HasScene(ConstScenePtr _scene) const
 //////////////////////////////////////////////////
 bool BaseRenderEngine::HasSceneId(unsigned int _id) const
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (scenes)
     return scenes->ContainsId(_id);
@@ -121,6 +126,7 @@ bool BaseRenderEngine::HasSceneId(unsigned int _id) const
 //////////////////////////////////////////////////
 bool BaseRenderEngine::HasSceneName(const std::string &_name) const
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (scenes)
     return scenes->ContainsName(_name);
@@ -130,6 +136,7 @@ bool BaseRenderEngine::HasSceneName(const std::string &_name) const
 //////////////////////////////////////////////////
 ScenePtr BaseRenderEngine::SceneById(unsigned int _id) const
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (scenes)
     return scenes->GetById(_id);
@@ -139,6 +146,7 @@ ScenePtr BaseRenderEngine::SceneById(unsigned int _id) const
 //////////////////////////////////////////////////
 ScenePtr BaseRenderEngine::SceneByName(const std::string &_name) const
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (scenes)
     return scenes->GetByName(_name);
@@ -148,6 +156,7 @@ ScenePtr BaseRenderEngine::SceneByName(const std::string &_name) const
 //////////////////////////////////////////////////
 ScenePtr BaseRenderEngine::SceneByIndex(unsigned int _index) const
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (scenes)
     return scenes->GetByIndex(_index);
@@ -157,6 +166,7 @@ ScenePtr BaseRenderEngine::SceneByIndex(unsigned int _index) const
 //////////////////////////////////////////////////
 void BaseRenderEngine::DestroyScene(ScenePtr _scene)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (!scenes)
     return;
@@ -166,6 +176,7 @@ void BaseRenderEngine::DestroyScene(ScenePtr _scene)
 //////////////////////////////////////////////////
 void BaseRenderEngine::DestroySceneById(unsigned int _id)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (!scenes)
     return;
@@ -175,6 +186,7 @@ void BaseRenderEngine::DestroySceneById(unsigned int _id)
 //////////////////////////////////////////////////
 void BaseRenderEngine::DestroySceneByName(const std::string &_name)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (!scenes)
     return;
@@ -184,6 +196,7 @@ void BaseRenderEngine::DestroySceneByName(const std::string &_name)
 //////////////////////////////////////////////////
 void BaseRenderEngine::DestroySceneByIndex(unsigned int _index)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (!scenes)
     return;
@@ -193,6 +206,7 @@ void BaseRenderEngine::DestroySceneByIndex(unsigned int _index)
 //////////////////////////////////////////////////
 void BaseRenderEngine::DestroyScenes()
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   auto scenes = this->Scenes();
   if (!scenes)
     return;
@@ -210,6 +224,8 @@ ScenePtr BaseRenderEngine::CreateScene(const std::string &_name)
 ScenePtr BaseRenderEngine::CreateScene(unsigned int _id,
     const std::string &_name)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
+
   if (!this->IsInitialized())
   {
     ignerr << "Render-engine has not been initialized" << std::endl;
@@ -272,6 +288,7 @@ void BaseRenderEngine::PrepareScene(ScenePtr _scene)
 //////////////////////////////////////////////////
 unsigned int BaseRenderEngine::NextSceneId()
 {
+  std::lock_guard<std::recursive_mutex> lock(this->sharedResourceMutex);
   return this->nextSceneId--;
 }
 
@@ -286,3 +303,9 @@ RenderPassSystemPtr BaseRenderEngine::RenderPassSystem() const
   }
   return this->renderPassSystem;
 }
+
+//////////////////////////////////////////////////
+std::recursive_mutex &BaseRenderEngine::SharedResourceMutex() const
+{
+  return this->sharedResourceMutex;
+}
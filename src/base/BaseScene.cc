@@ -15,7 +15,9 @@
  *
  */
 
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include <ignition/math/Helpers.hh>
 
@@ -35,17 +37,27 @@
 #include "ignition/rendering/LightVisual.hh"
 #include "ignition/rendering/Camera.hh"
 #include "ignition/rendering/Capsule.hh"
+#include "ignition/rendering/Decal.hh"
 #include "ignition/rendering/DepthCamera.hh"
+#include "ignition/rendering/EventCamera.hh"
 #include "ignition/rendering/GizmoVisual.hh"
 #include "ignition/rendering/GpuRays.hh"
 #include "ignition/rendering/Grid.hh"
+#include "ignition/rendering/ParticipatingMedia.hh"
 #include "ignition/rendering/ParticleEmitter.hh"
+#include "ignition/rendering/Precipitation.hh"
+#include "ignition/rendering/ProceduralSky.hh"
+#include "ignition/rendering/RadarSensor.hh"
 #include "ignition/rendering/RayQuery.hh"
+#include "ignition/rendering/ReflectionProbe.hh"
 #include "ignition/rendering/RenderTarget.hh"
 #include "ignition/rendering/Text.hh"
 #include "ignition/rendering/ThermalCamera.hh"
 #include "ignition/rendering/SegmentationCamera.hh"
+#include "ignition/rendering/SonarSensor.hh"
+#include "ignition/rendering/StereoCamera.hh"
 #include "ignition/rendering/Visual.hh"
+#include "ignition/rendering/WaterSurface.hh"
 #include "ignition/rendering/base/BaseStorage.hh"
 #include "ignition/rendering/base/BaseScene.hh"
 
@@ -64,6 +76,7 @@ BaseScene::BaseScene(unsigned int _id, const std::string &_name) :
   loaded(false),
   initialized(false),
   nextObjectId(ignition::math::MAX_UI16),
+  ownerThread(std::this_thread::get_id()),
   nodes(nullptr)
 {
 }
@@ -742,6 +755,33 @@ SpotLightPtr BaseScene::CreateSpotLight(unsigned int _id,
   return (result) ? light : nullptr;
 }
 
+//////////////////////////////////////////////////
+AreaLightPtr BaseScene::CreateAreaLight()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateAreaLight(objId);
+}
+//////////////////////////////////////////////////
+AreaLightPtr BaseScene::CreateAreaLight(unsigned int _id)
+{
+  std::string objName = this->CreateObjectName(_id, "AreaLight");
+  return this->CreateAreaLight(_id, objName);
+}
+//////////////////////////////////////////////////
+AreaLightPtr BaseScene::CreateAreaLight(const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateAreaLight(objId, _name);
+}
+//////////////////////////////////////////////////
+AreaLightPtr BaseScene::CreateAreaLight(unsigned int _id,
+    const std::string &_name)
+{
+  AreaLightPtr light = this->CreateAreaLightImpl(_id, _name);
+  bool result = this->RegisterLight(light);
+  return (result) ? light : nullptr;
+}
+
 //////////////////////////////////////////////////
 CameraPtr BaseScene::CreateCamera()
 {
@@ -882,6 +922,66 @@ SegmentationCameraPtr BaseScene::CreateSegmentationCamera(
   return (result) ? camera : nullptr;
 }
 
+//////////////////////////////////////////////////
+StereoCameraPtr BaseScene::CreateStereoCamera()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateStereoCamera(objId);
+}
+
+//////////////////////////////////////////////////
+StereoCameraPtr BaseScene::CreateStereoCamera(const unsigned int _id)
+{
+  std::string objName = this->CreateObjectName(_id, "StereoCamera");
+  return this->CreateStereoCamera(_id, objName);
+}
+
+//////////////////////////////////////////////////
+StereoCameraPtr BaseScene::CreateStereoCamera(const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateStereoCamera(objId, _name);
+}
+
+//////////////////////////////////////////////////
+StereoCameraPtr BaseScene::CreateStereoCamera(const unsigned int _id,
+    const std::string &_name)
+{
+  StereoCameraPtr camera = this->CreateStereoCameraImpl(_id, _name);
+  bool result = this->RegisterSensor(camera);
+  return (result) ? camera : nullptr;
+}
+
+//////////////////////////////////////////////////
+EventCameraPtr BaseScene::CreateEventCamera()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateEventCamera(objId);
+}
+
+//////////////////////////////////////////////////
+EventCameraPtr BaseScene::CreateEventCamera(const unsigned int _id)
+{
+  std::string objName = this->CreateObjectName(_id, "EventCamera");
+  return this->CreateEventCamera(_id, objName);
+}
+
+//////////////////////////////////////////////////
+EventCameraPtr BaseScene::CreateEventCamera(const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateEventCamera(objId, _name);
+}
+
+//////////////////////////////////////////////////
+EventCameraPtr BaseScene::CreateEventCamera(const unsigned int _id,
+    const std::string &_name)
+{
+  EventCameraPtr camera = this->CreateEventCameraImpl(_id, _name);
+  bool result = this->RegisterSensor(camera);
+  return (result) ? camera : nullptr;
+}
+
 //////////////////////////////////////////////////
 GpuRaysPtr BaseScene::CreateGpuRays()
 {
@@ -909,6 +1009,66 @@ GpuRaysPtr BaseScene::CreateGpuRays(const unsigned int _id,
   return (result) ? gpuRays : nullptr;
 }
 
+//////////////////////////////////////////////////
+RadarSensorPtr BaseScene::CreateRadarSensor()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateRadarSensor(objId);
+}
+
+//////////////////////////////////////////////////
+RadarSensorPtr BaseScene::CreateRadarSensor(const unsigned int _id)
+{
+  std::string objName = this->CreateObjectName(_id, "RadarSensor");
+  return this->CreateRadarSensor(_id, objName);
+}
+
+//////////////////////////////////////////////////
+RadarSensorPtr BaseScene::CreateRadarSensor(const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateRadarSensor(objId, _name);
+}
+
+//////////////////////////////////////////////////
+RadarSensorPtr BaseScene::CreateRadarSensor(const unsigned int _id,
+    const std::string &_name)
+{
+  RadarSensorPtr radar = this->CreateRadarSensorImpl(_id, _name);
+  bool result = this->RegisterSensor(radar);
+  return (result) ? radar : nullptr;
+}
+
+//////////////////////////////////////////////////
+SonarSensorPtr BaseScene::CreateSonarSensor()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateSonarSensor(objId);
+}
+
+//////////////////////////////////////////////////
+SonarSensorPtr BaseScene::CreateSonarSensor(const unsigned int _id)
+{
+  std::string objName = this->CreateObjectName(_id, "SonarSensor");
+  return this->CreateSonarSensor(_id, objName);
+}
+
+//////////////////////////////////////////////////
+SonarSensorPtr BaseScene::CreateSonarSensor(const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateSonarSensor(objId, _name);
+}
+
+//////////////////////////////////////////////////
+SonarSensorPtr BaseScene::CreateSonarSensor(const unsigned int _id,
+    const std::string &_name)
+{
+  SonarSensorPtr sonar = this->CreateSonarSensorImpl(_id, _name);
+  bool result = this->RegisterSensor(sonar);
+  return (result) ? sonar : nullptr;
+}
+
 //////////////////////////////////////////////////
 VisualPtr BaseScene::CreateVisual()
 {
@@ -1219,6 +1379,23 @@ HeightmapPtr BaseScene::CreateHeightmap(const HeightmapDescriptor &_desc)
   return this->CreateHeightmapImpl(objId, objName, _desc);
 }
 
+//////////////////////////////////////////////////
+WaterSurfacePtr BaseScene::CreateWaterSurface()
+{
+  unsigned int objId = this->CreateObjectId();
+  std::string objName = this->CreateObjectName(objId, "WaterSurface");
+  return this->CreateWaterSurfaceImpl(objId, objName);
+}
+
+//////////////////////////////////////////////////
+WaterSurfacePtr BaseScene::CreateWaterSurfaceImpl(unsigned int /*_id*/,
+    const std::string &/*_name*/)
+{
+  ignerr << "Water surface not supported by: "
+         << this->Engine()->Name() << std::endl;
+  return WaterSurfacePtr();
+}
+
 //////////////////////////////////////////////////
 GridPtr BaseScene::CreateGrid()
 {
@@ -1341,6 +1518,46 @@ RayQueryPtr BaseScene::CreateRayQuery()
   return this->CreateRayQueryImpl(objId, objName);
 }
 
+//////////////////////////////////////////////////
+ReflectionProbePtr BaseScene::CreateReflectionProbe()
+{
+  unsigned int objId = this->CreateObjectId();
+  std::string objName = this->CreateObjectName(objId, "ReflectionProbe");
+  return this->CreateReflectionProbeImpl(objId, objName);
+}
+
+//////////////////////////////////////////////////
+ProceduralSkyPtr BaseScene::CreateProceduralSky()
+{
+  unsigned int objId = this->CreateObjectId();
+  std::string objName = this->CreateObjectName(objId, "ProceduralSky");
+  return this->CreateProceduralSkyImpl(objId, objName);
+}
+
+//////////////////////////////////////////////////
+ParticipatingMediaPtr BaseScene::CreateParticipatingMedia()
+{
+  unsigned int objId = this->CreateObjectId();
+  std::string objName = this->CreateObjectName(objId, "ParticipatingMedia");
+  return this->CreateParticipatingMediaImpl(objId, objName);
+}
+
+//////////////////////////////////////////////////
+PrecipitationPtr BaseScene::CreatePrecipitation()
+{
+  unsigned int objId = this->CreateObjectId();
+  std::string objName = this->CreateObjectName(objId, "Precipitation");
+  return this->CreatePrecipitationImpl(objId, objName);
+}
+
+//////////////////////////////////////////////////
+DecalPtr BaseScene::CreateDecal()
+{
+  unsigned int objId = this->CreateObjectId();
+  std::string objName = this->CreateObjectName(objId, "Decal");
+  return this->CreateDecalImpl(objId, objName);
+}
+
 //////////////////////////////////////////////////
 ParticleEmitterPtr BaseScene::CreateParticleEmitter()
 {
@@ -1392,12 +1609,15 @@ bool BaseScene::SkyEnabled() const
 //////////////////////////////////////////////////
 void BaseScene::PreRender()
 {
+  this->CheckThreadAccess("PreRender");
+
   this->RootVisual()->PreRender();
 }
 
 //////////////////////////////////////////////////
 void BaseScene::PostRender()
 {
+  this->CheckThreadAccess("PostRender");
 }
 
 //////////////////////////////////////////////////
@@ -1417,6 +1637,57 @@ bool BaseScene::LegacyAutoGpuFlush() const
   return true;
 }
 
+//////////////////////////////////////////////////
+void BaseScene::SetOwnerThread(std::thread::id _thread)
+{
+  this->ownerThread = _thread;
+}
+
+//////////////////////////////////////////////////
+std::thread::id BaseScene::OwnerThread() const
+{
+  return this->ownerThread;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::CheckThreadAccess(const char *_caller) const
+{
+#ifndef NDEBUG
+  bool owner = std::this_thread::get_id() == this->ownerThread;
+  if (!owner)
+  {
+    ignerr << "Scene::" << _caller << " called on scene [" << this->name
+           << "] from a thread other than its owner. See "
+           << "Scene::SetOwnerThread" << std::endl;
+  }
+  IGN_ASSERT(owner, "Scene used from a thread other than its owner");
+
+  // a recursive mutex can be locked again by the thread that holds it, so
+  // this only fails if another thread is rendering or editing its scene
+  RenderEngine *engine = this->Engine();
+  if (!engine)
+    return;
+
+  std::recursive_mutex &mutex = engine->SharedResourceMutex();
+  bool locked = mutex.try_lock();
+  if (locked)
+  {
+    mutex.unlock();
+  }
+  else
+  {
+    ignerr << "Scene::" << _caller << " called on scene [" << this->name
+           << "] while another thread holds the shared resource mutex. "
+           << "Lock RenderEngine::SharedResourceMutex before modifying a "
+           << "scene that renders concurrently with other scenes"
+           << std::endl;
+  }
+  IGN_ASSERT(locked, "Shared resource mutex held by another thread");
+#else
+  (void)_caller;
+#endif
+}
+
 //////////////////////////////////////////////////
 void BaseScene::Clear()
 {
@@ -1443,6 +1714,7 @@ void BaseScene::Destroy()
 //////////////////////////////////////////////////
 unsigned int BaseScene::CreateObjectId()
 {
+  this->CheckThreadAccess("CreateObjectId");
   return this->nextObjectId--;
 }
 
@@ -1450,6 +1722,7 @@ unsigned int BaseScene::CreateObjectId()
 std::string BaseScene::CreateObjectName(unsigned int _id,
     const std::string &_prefix)
 {
+  this->CheckThreadAccess("CreateObjectName");
   std::stringstream ss;
   ss << this->name << "::" << _prefix;
   ss << "(" << std::to_string(_id) << ")";
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Filesystem.hh>
 #include <ignition/common/Event.hh>
@@ -28,6 +30,7 @@
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/RenderingIface.hh"
 #include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Utils.hh"
 
 #define DEPTH_TOL 1e-4
 #define DOUBLE_TOL 1e-6
@@ -66,6 +69,10 @@ class DepthCameraTest: public testing::Test,
   // Compare depth camera image before and after adding particles
   // in the scene
   public: void DepthCameraParticles(const std::string &_renderEngine);
+
+  // Verify surface normals and material ids
+  public: void DepthCameraNormalsMaterialIds(
+      const std::string &_renderEngine);
 };
 
 void DepthCameraTest::DepthCameraBoxes(
@@ -785,6 +792,109 @@ void DepthCameraTest::DepthCameraParticles(
   ignition::rendering::unloadEngine(engine->Name());
 }
 
+void DepthCameraTest::DepthCameraNormalsMaterialIds(
+    const std::string &_renderEngine)
+{
+  unsigned int width = 64u;
+  unsigned int height = 64u;
+
+  // normals and material ids are only supported in ogre2
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support depth camera normals" << std::endl;
+    return;
+  }
+
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ignition::rendering::VisualPtr root = scene->RootVisual();
+
+  // box covering the left half of the image
+  ignition::rendering::MaterialPtr blue = scene->CreateMaterial("blue");
+  blue->SetDiffuse(0.0, 0.0, 1.0);
+  ignition::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 5.0, 0.0);
+  box->SetLocalScale(1.0, 10.0, 10.0);
+  box->SetMaterial(blue);
+  root->AddChild(box);
+
+  auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+  ASSERT_NE(depthCamera, nullptr);
+  depthCamera->SetImageWidth(width);
+  depthCamera->SetImageHeight(height);
+  depthCamera->SetAspectRatio(1.0);
+  depthCamera->SetHFOV(1.05);
+  depthCamera->SetNearClipPlane(0.1);
+  depthCamera->SetFarClipPlane(10.0);
+  depthCamera->CreateDepthTexture();
+  root->AddChild(depthCamera);
+
+  std::vector<uint32_t> normals;
+  std::vector<uint16_t> ids;
+  ignition::common::ConnectionPtr normalsConnection =
+      depthCamera->ConnectNewNormalsFrame(
+      [&normals](const uint32_t *_normals, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &_format)
+      {
+        EXPECT_EQ(1u, _channels);
+        EXPECT_EQ("UINT32", _format);
+        normals.assign(_normals, _normals + _width * _height);
+      });
+  ignition::common::ConnectionPtr idConnection =
+      depthCamera->ConnectNewMaterialIdFrame(
+      [&ids](const uint16_t *_ids, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &_format)
+      {
+        EXPECT_EQ(1u, _channels);
+        EXPECT_EQ("UINT16", _format);
+        ids.assign(_ids, _ids + _width * _height);
+      });
+
+  depthCamera->Update();
+  ASSERT_EQ(width * height, normals.size());
+  ASSERT_EQ(width * height, ids.size());
+
+  unsigned int mid = height / 2u * width;
+  unsigned int left = mid + 4u;
+  unsigned int right = mid + width - 4u;
+
+  // the box faces the camera
+  ignition::math::Vector3d normal =
+      ignition::rendering::decodeOctahedralNormal(normals[left]);
+  EXPECT_NEAR(-1.0, normal.X(), 1e-3);
+  EXPECT_NEAR(0.0, normal.Y(), 1e-3);
+  EXPECT_NEAR(0.0, normal.Z(), 1e-3);
+  EXPECT_NE(0u, ids[left]);
+  EXPECT_FALSE(depthCamera->MaterialName(ids[left]).empty());
+
+  // background
+  EXPECT_EQ(0u, normals[right]);
+  EXPECT_EQ(0u, ids[right]);
+  EXPECT_TRUE(depthCamera->MaterialName(0u).empty());
+
+  // ids stay the same between frames
+  uint16_t boxId = ids[left];
+  depthCamera->Update();
+  EXPECT_EQ(boxId, ids[left]);
+
+  normalsConnection.reset();
+  idConnection.reset();
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
 TEST_P(DepthCameraTest, DepthCameraBoxes)
 {
   DepthCameraBoxes(GetParam());
@@ -795,6 +905,11 @@ TEST_P(DepthCameraTest, DepthCameraParticles)
   DepthCameraParticles(GetParam());
 }
 
+TEST_P(DepthCameraTest, DepthCameraNormalsMaterialIds)
+{
+  DepthCameraNormalsMaterialIds(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(DepthCamera, DepthCameraTest,
     RENDER_ENGINE_VALUES, ignition::rendering::PrintToStringParam());
 
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/EventCamera.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+unsigned int g_eventCounter = 0;
+
+void OnNewEvents(std::vector<ignition::rendering::CameraEvent> *_dest,
+                  const ignition::rendering::CameraEvent *_events,
+                  unsigned int _count)
+{
+  _dest->assign(_events, _events + _count);
+  g_eventCounter++;
+}
+
+class EventCameraTest: public testing::Test,
+  public testing::WithParamInterface<const char *>
+{
+  // Change the color of a box in front of an event camera and check the
+  // events
+  public: void EventCameraBox(const std::string &_renderEngine);
+};
+
+//////////////////////////////////////////////////
+void EventCameraTest::EventCameraBox(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports event cameras
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support event cameras" << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+  scene->SetBackgroundColor(0.5, 0.5, 0.5);
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  ignition::rendering::VisualPtr root = scene->RootVisual();
+
+  // dark box in the center of the image
+  ignition::rendering::MaterialPtr mat = scene->CreateMaterial();
+  mat->SetAmbient(0.1, 0.1, 0.1);
+  mat->SetDiffuse(0.1, 0.1, 0.1);
+  mat->SetSpecular(0.0, 0.0, 0.0);
+  mat->SetEmissive(0.1, 0.1, 0.1);
+
+  ignition::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(3.0, 0.0, 0.0);
+  box->SetMaterial(mat, false);
+  root->AddChild(box);
+
+  {
+    unsigned int width = 64u;
+    unsigned int height = 64u;
+
+    auto camera = scene->CreateEventCamera("EventCamera");
+    ASSERT_NE(nullptr, camera);
+    camera->SetImageWidth(width);
+    camera->SetImageHeight(height);
+    camera->SetAspectRatio(1.0);
+    camera->SetHFOV(1.05);
+    camera->SetNearClipPlane(0.1);
+    camera->SetFarClipPlane(10.0);
+    camera->SetPositiveThreshold(0.2);
+    camera->SetNegativeThreshold(0.2);
+    root->AddChild(camera);
+
+    std::vector<ignition::rendering::CameraEvent> events;
+    ignition::common::ConnectionPtr connection =
+      camera->ConnectNewEvents(
+          std::bind(&::OnNewEvents, &events,
+            std::placeholders::_1, std::placeholders::_2));
+
+    // the first frame only initializes the reference
+    g_eventCounter = 0u;
+    std::chrono::steady_clock::duration t0 = std::chrono::milliseconds(100);
+    scene->SetTime(t0);
+    camera->Update();
+    EXPECT_EQ(1u, g_eventCounter);
+    EXPECT_TRUE(events.empty());
+
+    // nothing changed
+    std::chrono::steady_clock::duration t1 = std::chrono::milliseconds(110);
+    scene->SetTime(t1);
+    camera->Update();
+    EXPECT_EQ(2u, g_eventCounter);
+    EXPECT_TRUE(events.empty());
+
+    // brighten the box
+    mat->SetAmbient(0.9, 0.9, 0.9);
+    mat->SetDiffuse(0.9, 0.9, 0.9);
+    mat->SetEmissive(0.9, 0.9, 0.9);
+    std::chrono::steady_clock::duration t2 = std::chrono::milliseconds(120);
+    scene->SetTime(t2);
+    camera->Update();
+    EXPECT_EQ(3u, g_eventCounter);
+    ASSERT_FALSE(events.empty());
+
+    // all events are ON events of the box, timestamped between the frames
+    // and a pixel emits several events for a large change in brightness
+    unsigned int centerEvents = 0u;
+    for (const auto &event : events)
+    {
+      EXPECT_TRUE(event.polarity);
+      EXPECT_LT(event.x, width);
+      EXPECT_LT(event.y, height);
+      EXPECT_GE(event.time, t1);
+      EXPECT_LE(event.time, t2);
+      EXPECT_NE(0u, event.x);
+      EXPECT_NE(0u, event.y);
+      if (event.x == width / 2u && event.y == height / 2u)
+      {
+        centerEvents++;
+      }
+    }
+    EXPECT_GT(centerEvents, 1u);
+
+    // darken the box again with a refractory period longer than a frame.
+    // Each pixel reports at most one OFF event.
+    camera->SetRefractoryPeriod(std::chrono::milliseconds(50));
+    mat->SetAmbient(0.1, 0.1, 0.1);
+    mat->SetDiffuse(0.1, 0.1, 0.1);
+    mat->SetEmissive(0.1, 0.1, 0.1);
+    std::chrono::steady_clock::duration t3 = std::chrono::milliseconds(130);
+    scene->SetTime(t3);
+    camera->Update();
+    EXPECT_EQ(4u, g_eventCounter);
+    std::vector<unsigned int> perPixel(width * height, 0u);
+    for (const auto &event : events)
+    {
+      EXPECT_FALSE(event.polarity);
+      EXPECT_GE(event.time, t2);
+      EXPECT_LE(event.time, t3);
+      perPixel[event.y * width + event.x]++;
+    }
+    for (auto count : perPixel)
+      EXPECT_LE(count, 1u);
+  }
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
+//////////////////////////////////////////////////
+TEST_P(EventCameraTest, EventCameraBox)
+{
+  EventCameraBox(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(EventCamera, EventCameraTest,
+    RENDER_ENGINE_VALUES, ignition::rendering::PrintToStringParam());
+
+//////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
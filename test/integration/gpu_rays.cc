@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Image.hh>
 #include <ignition/common/Filesystem.hh>
@@ -70,6 +76,18 @@ class GpuRaysTest: public testing::Test,
 
   // Test and verify lidar visibilty mask and visual visibility flags
   public: void Visibility(const std::string &_renderEngine);
+
+  // Test multiple echoes from a single ray
+  public: void MultiReturn(const std::string &_renderEngine);
+
+  // Test rays defined by a table of directions
+  public: void RayDirections(const std::string &_renderEngine);
+
+  // Test sensor motion during a scan
+  public: void RollingScan(const std::string &_renderEngine);
+
+  // Test the physical intensity model
+  public: void IntensityModel(const std::string &_renderEngine);
 };
 
 /////////////////////////////////////////////////
@@ -161,6 +179,94 @@ void GpuRaysTest::Configure(const std::string &_renderEngine)
     gpuRays->SetVerticalResolution(-0.8);
     EXPECT_DOUBLE_EQ(2.4, gpuRays->HorizontalResolution());
     EXPECT_DOUBLE_EQ(0.8, gpuRays->VerticalResolution());
+
+    EXPECT_DOUBLE_EQ(0.0, gpuRays->BeamDivergence().Radian());
+    EXPECT_EQ(LRM_FIRST, gpuRays->ReturnMode());
+    EXPECT_EQ(1u, gpuRays->ReturnCount());
+    EXPECT_DOUBLE_EQ(0.1, gpuRays->ReturnSeparation());
+    EXPECT_EQ(3u, gpuRays->Channels());
+
+    gpuRays->SetBeamDivergence(-0.003);
+    EXPECT_DOUBLE_EQ(0.003, gpuRays->BeamDivergence().Radian());
+    gpuRays->SetReturnSeparation(0.5);
+    EXPECT_DOUBLE_EQ(0.5, gpuRays->ReturnSeparation());
+    gpuRays->SetReturnCount(0u);
+    EXPECT_EQ(1u, gpuRays->ReturnCount());
+    gpuRays->SetReturnCount(100u);
+    EXPECT_EQ(8u, gpuRays->ReturnCount());
+    gpuRays->SetReturnCount(3u);
+    EXPECT_EQ(3u, gpuRays->ReturnCount());
+    gpuRays->SetReturnMode(LRM_STRONGEST);
+    EXPECT_EQ(LRM_STRONGEST, gpuRays->ReturnMode());
+    gpuRays->SetReturnMode(LRM_ALL);
+    EXPECT_EQ(LRM_ALL, gpuRays->ReturnMode());
+    if (_renderEngine == "ogre2")
+      EXPECT_EQ(9u, gpuRays->Channels());
+
+    EXPECT_TRUE(gpuRays->RayDirections().empty());
+    std::vector<math::Vector2d> dirs(6u);
+    EXPECT_FALSE(gpuRays->SetRayDirections(dirs, 4u));
+    EXPECT_FALSE(gpuRays->SetRayDirections(dirs, 0u));
+    EXPECT_FALSE(gpuRays->SetRayDirections({}, 1u));
+    EXPECT_TRUE(gpuRays->RayDirections().empty());
+    EXPECT_FALSE(gpuRays->SetRayTimes(std::vector<double>(6u, 0.5)));
+    EXPECT_TRUE(gpuRays->SetRayDirections(dirs, 3u));
+    EXPECT_EQ(6u, gpuRays->RayDirections().size());
+    EXPECT_EQ(3, gpuRays->RangeCount());
+    EXPECT_EQ(2, gpuRays->VerticalRangeCount());
+    EXPECT_TRUE(gpuRays->RayTimes().empty());
+    EXPECT_FALSE(gpuRays->SetRayTimes(std::vector<double>(5u, 0.5)));
+    EXPECT_FALSE(gpuRays->SetRayTimes(std::vector<double>(6u, 1.5)));
+    EXPECT_TRUE(gpuRays->SetRayTimes(std::vector<double>(6u, 0.5)));
+    EXPECT_EQ(6u, gpuRays->RayTimes().size());
+    // times are kept with tables of the same size only
+    EXPECT_TRUE(gpuRays->SetRayDirections(dirs, 2u));
+    EXPECT_EQ(6u, gpuRays->RayTimes().size());
+    EXPECT_TRUE(gpuRays->SetRayDirections(
+        std::vector<math::Vector2d>(4u), 2u));
+    EXPECT_TRUE(gpuRays->RayTimes().empty());
+    EXPECT_TRUE(gpuRays->SetRayDirections(dirs, 3u));
+    EXPECT_TRUE(gpuRays->SetRayTimes(std::vector<double>(6u, 0.5)));
+    gpuRays->ClearRayDirections();
+    EXPECT_TRUE(gpuRays->RayDirections().empty());
+    EXPECT_TRUE(gpuRays->RayTimes().empty());
+    EXPECT_EQ(static_cast<int>(gpuRays->RayCount() *
+        gpuRays->HorizontalResolution()), gpuRays->RangeCount());
+
+    EXPECT_FALSE(gpuRays->RollingScanEnabled());
+    EXPECT_DOUBLE_EQ(0.1, gpuRays->ScanDuration());
+    EXPECT_EQ(math::Pose3d::Zero, gpuRays->ScanStartPose());
+    EXPECT_EQ(math::Pose3d::Zero, gpuRays->ScanEndPose());
+    gpuRays->SetRollingScanEnabled(true);
+    EXPECT_TRUE(gpuRays->RollingScanEnabled());
+    gpuRays->SetScanDuration(0.05);
+    EXPECT_DOUBLE_EQ(0.05, gpuRays->ScanDuration());
+    gpuRays->SetScanDuration(-1.0);
+    EXPECT_DOUBLE_EQ(0.0, gpuRays->ScanDuration());
+    math::Pose3d start(1, 2, 3, 0, 0, 0.1);
+    math::Pose3d end(2, 2, 3, 0, 0, 0.2);
+    gpuRays->SetScanPoses(start, end);
+    EXPECT_EQ(start, gpuRays->ScanStartPose());
+    EXPECT_EQ(end, gpuRays->ScanEndPose());
+
+    EXPECT_EQ(LIM_RETRO, gpuRays->IntensityModel());
+    EXPECT_DOUBLE_EQ(1.0, gpuRays->IntensityScale());
+    EXPECT_DOUBLE_EQ(10.0, gpuRays->IntensityReferenceRange());
+    EXPECT_DOUBLE_EQ(2.0, gpuRays->IntensityRangeExponent());
+    gpuRays->SetIntensityModel(LIM_PHYSICAL);
+    EXPECT_EQ(LIM_PHYSICAL, gpuRays->IntensityModel());
+    gpuRays->SetIntensityScale(100.0);
+    EXPECT_DOUBLE_EQ(100.0, gpuRays->IntensityScale());
+    gpuRays->SetIntensityScale(0.0);
+    EXPECT_DOUBLE_EQ(100.0, gpuRays->IntensityScale());
+    gpuRays->SetIntensityReferenceRange(20.0);
+    EXPECT_DOUBLE_EQ(20.0, gpuRays->IntensityReferenceRange());
+    gpuRays->SetIntensityReferenceRange(-1.0);
+    EXPECT_DOUBLE_EQ(20.0, gpuRays->IntensityReferenceRange());
+    gpuRays->SetIntensityRangeExponent(0.0);
+    EXPECT_DOUBLE_EQ(0.0, gpuRays->IntensityRangeExponent());
+    gpuRays->SetIntensityRangeExponent(-1.0);
+    EXPECT_DOUBLE_EQ(0.0, gpuRays->IntensityRangeExponent());
   }
 
   // Clean up
@@ -968,6 +1074,417 @@ void GpuRaysTest::Visibility(const std::string &_renderEngine)
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void GpuRaysTest::MultiReturn(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Multi-return GpuRays not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  // Test a single ray whose beam footprint partially hits the edge of a box
+  // and partially hits a wall behind it
+
+  const double minRange = 0.1;
+  const double maxRange = 10.0;
+  const int hRayCount = 1;
+  const int vRayCount = 1;
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetWorldPosition(0, 0, 0.5);
+  gpuRays->SetNearClipPlane(minRange);
+  gpuRays->SetFarClipPlane(maxRange);
+  gpuRays->SetAngleMin(0.0);
+  gpuRays->SetAngleMax(0.0);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalRayCount(vRayCount);
+  gpuRays->SetBeamDivergence(0.2);
+  gpuRays->SetReturnMode(LRM_ALL);
+  gpuRays->SetReturnCount(3u);
+  root->AddChild(gpuRays);
+
+  // box whose edge is slightly to the left of the center of the beam.
+  // The footprint has a radius of ~0.15m at the front face of the box
+  VisualPtr visualBox = scene->CreateVisual("box");
+  visualBox->AddGeometry(scene->CreateBox());
+  visualBox->SetWorldPosition(2.0, 0.55, 0.5);
+  root->AddChild(visualBox);
+
+  // wall behind the box
+  VisualPtr visualWall = scene->CreateVisual("wall");
+  visualWall->AddGeometry(scene->CreateBox());
+  visualWall->SetLocalScale(1.0, 10.0, 10.0);
+  visualWall->SetWorldPosition(5.5, 0.0, 0.5);
+  root->AddChild(visualWall);
+
+  // 3 returns per ray, 3 floats per return
+  unsigned int channels = gpuRays->Channels();
+  EXPECT_EQ(9u, channels);
+  float *scan = new float[hRayCount * vRayCount * channels];
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        std::bind(&::OnNewGpuRaysFrame, scan,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+
+  gpuRays->Update();
+
+  // first echo from the box, second echo from the wall and the third is
+  // not used
+  EXPECT_NEAR(1.5, scan[0], 0.05);
+  EXPECT_NEAR(5.0, scan[3], 0.05);
+  EXPECT_FLOAT_EQ(1.0f, scan[2] + scan[5]);
+  EXPECT_GT(scan[5], scan[2]);
+  EXPECT_FLOAT_EQ(ignition::math::INF_F, scan[6]);
+  EXPECT_FLOAT_EQ(0.0f, scan[7]);
+
+  c.reset();
+
+  delete [] scan;
+  scan = nullptr;
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void GpuRaysTest::RayDirections(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "GpuRays ray direction table not supported yet in rendering "
+           << "engine: " << _renderEngine << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  // rays that are not on a uniform grid
+  std::vector<math::Vector2d> dirs = {
+      {0.0, 0.0}, {IGN_PI * 0.5, 0.0}, {-IGN_PI * 0.5, 0.0}, {0.0, 0.3}};
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetNearClipPlane(0.1);
+  gpuRays->SetFarClipPlane(10.0);
+  EXPECT_TRUE(gpuRays->SetRayDirections(dirs, 4u));
+  root->AddChild(gpuRays);
+
+  // boxes in front, left, right and back of the sensor
+  std::vector<math::Vector3d> boxPositions = {
+      {2.0, 0.0, 0.0}, {0.0, 3.0, 0.0}, {0.0, -3.0, 0.0}, {-3.0, 0.0, 0.0}};
+  for (unsigned int i = 0; i < boxPositions.size(); ++i)
+  {
+    VisualPtr visualBox = scene->CreateVisual("box" + std::to_string(i));
+    visualBox->AddGeometry(scene->CreateBox());
+    visualBox->SetWorldPosition(boxPositions[i]);
+    root->AddChild(visualBox);
+  }
+
+  EXPECT_EQ(4, gpuRays->RangeCount());
+  EXPECT_EQ(1, gpuRays->VerticalRangeCount());
+  unsigned int channels = gpuRays->Channels();
+  float *scan = new float[4u * channels];
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        std::bind(&::OnNewGpuRaysFrame, scan,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+
+  gpuRays->Update();
+  EXPECT_NEAR(1.5, scan[0], LASER_TOL);
+  EXPECT_NEAR(2.5, scan[channels], LASER_TOL);
+  EXPECT_NEAR(2.5, scan[2 * channels], LASER_TOL);
+  EXPECT_NEAR(1.5 / std::cos(0.3), scan[3 * channels], 1e-3);
+
+  // same size and cubemap faces, only the sample texture is updated
+  std::swap(dirs[0], dirs[3]);
+  EXPECT_TRUE(gpuRays->SetRayDirections(dirs, 4u));
+  gpuRays->Update();
+  EXPECT_NEAR(1.5 / std::cos(0.3), scan[0], 1e-3);
+  EXPECT_NEAR(1.5, scan[3 * channels], LASER_TOL);
+
+  // looking backwards needs a new cubemap face
+  dirs[1].X() = IGN_PI;
+  EXPECT_TRUE(gpuRays->SetRayDirections(dirs, 4u));
+  gpuRays->Update();
+  EXPECT_NEAR(2.5, scan[channels], LASER_TOL);
+  EXPECT_NEAR(2.5, scan[2 * channels], LASER_TOL);
+
+  c.reset();
+
+  delete [] scan;
+  scan = nullptr;
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void GpuRaysTest::RollingScan(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "GpuRays rolling scan not supported yet in rendering "
+           << "engine: " << _renderEngine << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  const unsigned int hRayCount = 3u;
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetNearClipPlane(0.1);
+  gpuRays->SetFarClipPlane(10.0);
+  gpuRays->SetAngleMin(-0.01);
+  gpuRays->SetAngleMax(0.01);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalRayCount(1u);
+  root->AddChild(gpuRays);
+
+  // wall in front of the sensor, front face at x = 3
+  VisualPtr visualWall = scene->CreateVisual("wall");
+  visualWall->AddGeometry(scene->CreateBox());
+  visualWall->SetLocalScale(1.0, 10.0, 10.0);
+  visualWall->SetWorldPosition(3.5, 0.0, 0.0);
+  root->AddChild(visualWall);
+
+  unsigned int channels = gpuRays->Channels();
+  float *scan = new float[hRayCount * channels];
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        std::bind(&::OnNewGpuRaysFrame, scan,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+
+  // sensor moves 1m towards the wall during the scan
+  gpuRays->SetRollingScanEnabled(true);
+  gpuRays->SetScanDuration(0.1);
+  gpuRays->SetScanPoses(math::Pose3d::Zero, math::Pose3d(1, 0, 0, 0, 0, 0));
+  gpuRays->Update();
+
+  EXPECT_NEAR(3.0, scan[0], 0.01);
+  EXPECT_NEAR(2.5, scan[channels], 0.01);
+  EXPECT_NEAR(2.0, scan[2 * channels], 0.01);
+  EXPECT_FLOAT_EQ(0.0f, scan[2]);
+  EXPECT_FLOAT_EQ(0.05f, scan[channels + 2]);
+  EXPECT_FLOAT_EQ(0.1f, scan[2 * channels + 2]);
+
+  // rays of a table of ray directions measured in their own order
+  std::vector<math::Vector2d> dirs(hRayCount);
+  EXPECT_TRUE(gpuRays->SetRayDirections(dirs, hRayCount));
+  EXPECT_TRUE(gpuRays->SetRayTimes({1.0, 0.0, 0.5}));
+  gpuRays->Update();
+
+  EXPECT_NEAR(2.0, scan[0], 0.01);
+  EXPECT_NEAR(3.0, scan[channels], 0.01);
+  EXPECT_NEAR(2.5, scan[2 * channels], 0.01);
+  EXPECT_FLOAT_EQ(0.1f, scan[2]);
+  EXPECT_FLOAT_EQ(0.0f, scan[channels + 2]);
+  EXPECT_FLOAT_EQ(0.05f, scan[2 * channels + 2]);
+  gpuRays->ClearRayDirections();
+
+  // without rolling scan all rays see the wall from the sensor pose
+  gpuRays->SetRollingScanEnabled(false);
+  gpuRays->Update();
+  for (unsigned int i = 0; i < hRayCount; ++i)
+    EXPECT_NEAR(3.0, scan[i * channels], 0.01);
+
+  c.reset();
+
+  delete [] scan;
+  scan = nullptr;
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void GpuRaysTest::IntensityModel(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "GpuRays intensity model not supported yet in rendering "
+           << "engine: " << _renderEngine << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetNearClipPlane(0.1);
+  gpuRays->SetFarClipPlane(20.0);
+  gpuRays->SetAngleMin(-0.01);
+  gpuRays->SetAngleMax(0.01);
+  gpuRays->SetRayCount(1u);
+  gpuRays->SetVerticalRayCount(1u);
+  root->AddChild(gpuRays);
+
+  // wall in front of the sensor, front face at x = 3
+  VisualPtr visualWall = scene->CreateVisual("wall");
+  visualWall->AddGeometry(scene->CreateBox());
+  visualWall->SetLocalScale(1.0, 10.0, 10.0);
+  visualWall->SetWorldPosition(3.5, 0.0, 0.0);
+  visualWall->SetUserData("laser_retro", 100.0);
+  visualWall->SetUserData("nir_reflectance", 0.5);
+  root->AddChild(visualWall);
+
+  unsigned int channels = gpuRays->Channels();
+  float *scan = new float[channels];
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        std::bind(&::OnNewGpuRaysFrame, scan,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+
+  // the laser retro model is the default
+  gpuRays->Update();
+  EXPECT_NEAR(3.0, scan[0], 0.01);
+  EXPECT_NEAR(100.0, scan[1], 1.0);
+
+  // head on at the reference range the intensity is the reflectance. Clear
+  // the scan to make sure a frame is rendered with the physical model
+  std::fill(scan, scan + channels, 0.0f);
+  gpuRays->SetIntensityModel(LIM_PHYSICAL);
+  gpuRays->SetIntensityReferenceRange(3.0);
+  gpuRays->Update();
+  EXPECT_NEAR(3.0, scan[0], 0.01);
+  EXPECT_NEAR(0.5, scan[1], 0.01);
+
+  gpuRays->SetIntensityScale(10.0);
+  gpuRays->Update();
+  EXPECT_NEAR(5.0, scan[1], 0.1);
+
+  // range falloff
+  visualWall->SetWorldPosition(6.5, 0.0, 0.0);
+  gpuRays->Update();
+  EXPECT_NEAR(6.0, scan[0], 0.01);
+  EXPECT_NEAR(1.25, scan[1], 0.05);
+
+  gpuRays->SetIntensityRangeExponent(0.0);
+  gpuRays->Update();
+  EXPECT_NEAR(5.0, scan[1], 0.1);
+
+  // the intensity falls with the incidence angle
+  visualWall->SetWorldRotation(0.0, 0.0, IGN_PI / 3.0);
+  gpuRays->Update();
+  EXPECT_NEAR(2.5, scan[1], 0.1);
+
+  // retroreflectors stop reflecting beyond their entrance angle
+  visualWall->SetUserData("retroreflectivity", 10.0);
+  gpuRays->Update();
+  EXPECT_NEAR(2.5, scan[1], 0.1);
+
+  visualWall->SetWorldRotation(0.0, 0.0, 0.0);
+  gpuRays->Update();
+  EXPECT_NEAR(105.0, scan[1], 1.0);
+
+  // visuals without reflectance do not return any intensity
+  visualWall->SetUserData("retroreflectivity", 0.0);
+  visualWall->SetUserData("nir_reflectance", 0.0);
+  gpuRays->Update();
+  EXPECT_NEAR(6.0, scan[0], 0.01);
+  EXPECT_FLOAT_EQ(0.0f, scan[1]);
+
+  c.reset();
+
+  delete [] scan;
+  scan = nullptr;
+
+  // sensor that renders its first frame with the physical model
+  visualWall->SetUserData("nir_reflectance", 0.5);
+  const unsigned int rayCount = 5u;
+  GpuRaysPtr gpuRays2 = scene->CreateGpuRays("gpu_rays2");
+  gpuRays2->SetNearClipPlane(0.1);
+  gpuRays2->SetFarClipPlane(20.0);
+  gpuRays2->SetAngleMin(-0.1);
+  gpuRays2->SetAngleMax(0.1);
+  gpuRays2->SetRayCount(rayCount);
+  gpuRays2->SetVerticalRayCount(1u);
+  gpuRays2->SetIntensityModel(LIM_PHYSICAL);
+  gpuRays2->SetIntensityReferenceRange(6.0);
+  root->AddChild(gpuRays2);
+
+  channels = gpuRays2->Channels();
+  scan = new float[rayCount * channels];
+  std::fill(scan, scan + rayCount * channels, 0.0f);
+  c = gpuRays2->ConnectNewGpuRaysFrame(
+        std::bind(&::OnNewGpuRaysFrame, scan,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+  gpuRays2->Update();
+  for (unsigned int i = 0; i < rayCount; ++i)
+  {
+    EXPECT_LT(5.9, scan[i * channels]);
+    EXPECT_GT(6.2, scan[i * channels]);
+    EXPECT_LT(0.0f, scan[i * channels + 1]);
+    EXPECT_GE(0.51, scan[i * channels + 1]);
+  }
+  EXPECT_NEAR(0.5, scan[(rayCount / 2u) * channels + 1], 0.01);
+
+  c.reset();
+
+  delete [] scan;
+  scan = nullptr;
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(GpuRaysTest, Configure)
 {
@@ -1004,6 +1521,30 @@ TEST_P(GpuRaysTest, Visibility)
   Visibility(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, MultiReturn)
+{
+  MultiReturn(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, RayDirections)
+{
+  RayDirections(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, RollingScan)
+{
+  RollingScan(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, IntensityModel)
+{
+  IntensityModel(GetParam());
+}
+
 
 INSTANTIATE_TEST_CASE_P(GpuRays, GpuRaysTest,
     RENDER_ENGINE_VALUES,
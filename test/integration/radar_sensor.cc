@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/RadarSensor.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+unsigned int g_detectionCounter = 0;
+
+void OnNewDetections(std::vector<RadarDetection> *_dest,
+                     const RadarDetection *_detections, unsigned int _count)
+{
+  _dest->assign(_detections, _detections + _count);
+  g_detectionCounter++;
+}
+
+class RadarSensorTest: public testing::Test,
+  public testing::WithParamInterface<const char *>
+{
+  // Detect static and moving boxes in front of a radar sensor
+  public: void RadarSensorBoxes(const std::string &_renderEngine);
+};
+
+//////////////////////////////////////////////////
+void RadarSensorTest::RadarSensorBoxes(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports radar sensors
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support radar sensors" << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  VisualPtr root = scene->RootVisual();
+
+  const double maxRange = 20.0;
+  RadarSensorPtr radar = scene->CreateRadarSensor("radar");
+  ASSERT_NE(nullptr, radar);
+  radar->SetWorldPosition(0.0, 0.0, 0.5);
+  radar->SetNearClipPlane(0.2);
+  radar->SetFarClipPlane(maxRange);
+  radar->SetAngleMin(-IGN_PI / 3.0);
+  radar->SetAngleMax(IGN_PI / 3.0);
+  radar->SetRayCount(241);
+  radar->SetVerticalAngleMin(-IGN_DTOR(10.0));
+  radar->SetVerticalAngleMax(IGN_DTOR(10.0));
+  radar->SetVerticalRayCount(21);
+  radar->SetRangeResolution(0.5);
+  radar->SetAngleResolution(math::Angle(IGN_DTOR(4.0)));
+  root->AddChild(radar);
+
+  // static box in front of the radar
+  VisualPtr staticBox = scene->CreateVisual("static_box");
+  staticBox->AddGeometry(scene->CreateBox());
+  staticBox->SetWorldPosition(3.0, 0.0, 0.5);
+  staticBox->SetUserData("radar_cross_section", 10.0);
+  root->AddChild(staticBox);
+
+  // box moving away from the radar, to the left
+  VisualPtr movingBox = scene->CreateVisual("moving_box");
+  movingBox->AddGeometry(scene->CreateBox());
+  movingBox->SetWorldPosition(6.0, 4.0, 0.5);
+  movingBox->SetUserData("radar_cross_section", 50.0);
+  root->AddChild(movingBox);
+
+  // box with no radar cross section on the right is not detected
+  VisualPtr hiddenBox = scene->CreateVisual("hidden_box");
+  hiddenBox->AddGeometry(scene->CreateBox());
+  hiddenBox->SetWorldPosition(4.0, -4.0, 0.5);
+  root->AddChild(hiddenBox);
+
+  radar->SetVisualVelocity(movingBox->Id(), math::Vector3d(2.0, 0.0, 0.0));
+
+  std::vector<RadarDetection> detections;
+  common::ConnectionPtr connection = radar->ConnectNewDetections(
+      std::bind(&::OnNewDetections, &detections,
+        std::placeholders::_1, std::placeholders::_2));
+
+  g_detectionCounter = 0u;
+  radar->Update();
+  EXPECT_EQ(1u, g_detectionCounter);
+  ASSERT_FALSE(detections.empty());
+
+  // detections are sorted by range and the closest one is the front face
+  // of the static box
+  EXPECT_NEAR(2.5, detections.front().range, 0.3);
+  EXPECT_NEAR(0.0, detections.front().azimuth, IGN_DTOR(4.0));
+  EXPECT_NEAR(0.0, detections.front().radialVelocity, 1e-3);
+  EXPECT_NEAR(10.0, detections.front().rcs, 0.5);
+
+  bool staticFound = false;
+  bool movingFound = false;
+  for (const auto &detection : detections)
+  {
+    EXPECT_GE(detection.range, 0.2);
+    EXPECT_LT(detection.range, maxRange);
+    EXPECT_GE(detection.azimuth, -IGN_PI / 3.0 - 1e-3);
+    EXPECT_LE(detection.azimuth, IGN_PI / 3.0 + 1e-3);
+
+    // nothing on the right of the radar
+    EXPECT_GT(detection.azimuth, -IGN_DTOR(20.0));
+
+    if (detection.azimuth > IGN_DTOR(20.0))
+    {
+      // the moving box is seen receding at most at its own speed
+      movingFound = true;
+      EXPECT_NEAR(50.0, detection.rcs, 0.5);
+      EXPECT_GT(detection.radialVelocity, 1.0);
+      EXPECT_LE(detection.radialVelocity, 2.0 + 1e-3);
+    }
+    else
+    {
+      staticFound = true;
+      EXPECT_NEAR(10.0, detection.rcs, 0.5);
+      EXPECT_NEAR(0.0, detection.radialVelocity, 1e-3);
+    }
+  }
+  EXPECT_TRUE(staticFound);
+  EXPECT_TRUE(movingFound);
+
+  // a radar driving forward sees the static box approach
+  radar->SetLinearVelocity(math::Vector3d(1.0, 0.0, 0.0));
+  radar->Update();
+  EXPECT_EQ(2u, g_detectionCounter);
+  ASSERT_FALSE(detections.empty());
+  EXPECT_NEAR(2.5, detections.front().range, 0.3);
+  EXPECT_LT(detections.front().radialVelocity, -0.9);
+  unsigned int detectionCount = static_cast<unsigned int>(detections.size());
+
+  // clutter adds false detections
+  radar->SetClutterRate(100.0);
+  radar->Update();
+  EXPECT_EQ(3u, g_detectionCounter);
+  EXPECT_GT(detections.size(), detectionCount);
+  for (unsigned int i = 1u; i < detections.size(); ++i)
+    EXPECT_LE(detections[i - 1u].range, detections[i].range);
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
+//////////////////////////////////////////////////
+TEST_P(RadarSensorTest, RadarSensorBoxes)
+{
+  RadarSensorBoxes(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(RadarSensor, RadarSensorTest,
+    RENDER_ENGINE_VALUES, ignition::rendering::PrintToStringParam());
+
+//////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
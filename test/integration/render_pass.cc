@@ -23,15 +23,21 @@
 #include "test_config.h"  // NOLINT(build/include)
 
 #include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/ChromaticAberrationPass.hh"
 #include "ignition/rendering/DepthCamera.hh"
 #include "ignition/rendering/DistortionPass.hh"
+#include "ignition/rendering/ExposurePass.hh"
 #include "ignition/rendering/GaussianNoisePass.hh"
 #include "ignition/rendering/Image.hh"
+#include "ignition/rendering/MotionBlurPass.hh"
 #include "ignition/rendering/PixelFormat.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/RenderingIface.hh"
 #include "ignition/rendering/RenderPassSystem.hh"
 #include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/ShaderParams.hh"
+#include "ignition/rendering/ShaderPass.hh"
+#include "ignition/rendering/VignettePass.hh"
 
 #define DOUBLE_TOL 1e-6
 unsigned int g_pointCloudCounter = 0;
@@ -60,6 +66,10 @@ class RenderPassTest: public testing::Test,
 
   // Test and verify Distortion pass is applied to a camera
   public: void Distortion(const std::string &_renderEngine);
+
+  // Test and verify exposure, vignette, chromatic aberration and motion blur
+  // passes are applied to a camera
+  public: void CameraEffects(const std::string &_renderEngine);
 };
 
 /////////////////////////////////////////////////
@@ -545,6 +555,219 @@ void RenderPassTest::Distortion(const std::string &_renderEngine)
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void RenderPassTest::CameraEffects(const std::string &_renderEngine)
+{
+  // Only ogre2 implements these render passes
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Engine '" << _renderEngine
+           << "' doesn't support camera effect render passes" << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // add resources in build dir
+  engine->AddResourcePath(
+      common::joinPaths(std::string(PROJECT_BUILD_PATH), "src"));
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+  scene->SetAmbientLight(0.3, 0.3, 0.3);
+
+  // gray background so that darkened corners can be seen
+  scene->SetBackgroundColor(0.5, 0.5, 0.5);
+
+  VisualPtr root = scene->RootVisual();
+
+  unsigned int width = 100;
+  unsigned int height = 100;
+
+  // create  camera
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_TRUE(camera != nullptr);
+  camera->SetImageWidth(width);
+  camera->SetImageHeight(height);
+  root->AddChild(camera);
+
+  // create directional light
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetDirection(0.0, 0.0, -1);
+  light->SetDiffuseColor(0.5, 0.5, 0.5);
+  light->SetSpecularColor(0.5, 0.5, 0.5);
+  root->AddChild(light);
+
+  // create green material
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetDiffuse(0.0, 0.7, 0.0);
+  green->SetSpecular(0.5, 0.5, 0.5);
+
+  // create box
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(2.0, 0.0, 0.0);
+  box->SetMaterial(green);
+  root->AddChild(box);
+
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    ignwarn << "Engine '" << _renderEngine << "' does not support "
+            << "render pass  system" << std::endl;
+    return;
+  }
+
+  // capture original image (no effects)
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  unsigned char *data = image.Data<unsigned char>();
+
+  // sum of the color values of all pixels
+  auto colorSum = [&](const unsigned char *_data)
+  {
+    unsigned int sum = 0u;
+    for (unsigned int i = 0u; i < width * height * 3u; ++i)
+      sum += _data[i];
+    return sum;
+  };
+
+  // sum of the absolute differences between two images
+  auto diffSum = [&](const unsigned char *_data, const unsigned char *_data2)
+  {
+    unsigned int sum = 0u;
+    for (unsigned int i = 0u; i < width * height * 3u; ++i)
+      sum += std::abs(static_cast<int>(_data[i]) - _data2[i]);
+    return sum;
+  };
+
+  unsigned int center = ((height / 2u) * width + width / 2u) * 3u;
+  unsigned int corner = 0u;
+
+  // exposure compensation of +1 EV doubles the brightness
+  {
+    RenderPassPtr pass = rpSystem->Create<ExposurePass>();
+    ExposurePassPtr exposurePass =
+        std::dynamic_pointer_cast<ExposurePass>(pass);
+    ASSERT_NE(nullptr, exposurePass);
+    exposurePass->SetExposureCompensation(1.0);
+    camera->AddRenderPass(exposurePass);
+    Image imageExposure = camera->CreateImage();
+    camera->Capture(imageExposure);
+    camera->RemoveRenderPass(exposurePass);
+
+    unsigned char *dataExposure = imageExposure.Data<unsigned char>();
+    EXPECT_GT(colorSum(dataExposure), colorSum(data));
+    EXPECT_GT(dataExposure[corner], data[corner]);
+  }
+
+  // vignette darkens the corners but not the center
+  {
+    RenderPassPtr pass = rpSystem->Create<VignettePass>();
+    VignettePassPtr vignettePass =
+        std::dynamic_pointer_cast<VignettePass>(pass);
+    ASSERT_NE(nullptr, vignettePass);
+    vignettePass->SetIntensity(1.0);
+    camera->AddRenderPass(vignettePass);
+    Image imageVignette = camera->CreateImage();
+    camera->Capture(imageVignette);
+    camera->RemoveRenderPass(vignettePass);
+
+    unsigned char *dataVignette = imageVignette.Data<unsigned char>();
+    EXPECT_LT(colorSum(dataVignette), colorSum(data));
+    EXPECT_LT(dataVignette[corner], data[corner]);
+    EXPECT_NEAR(data[center + 1], dataVignette[center + 1], 2);
+  }
+
+  // chromatic aberration shifts the color channels at the edges of the box
+  // but not in the center of the image
+  {
+    RenderPassPtr pass = rpSystem->Create<ChromaticAberrationPass>();
+    ChromaticAberrationPassPtr aberrationPass =
+        std::dynamic_pointer_cast<ChromaticAberrationPass>(pass);
+    ASSERT_NE(nullptr, aberrationPass);
+    aberrationPass->SetStrength(0.02);
+    camera->AddRenderPass(aberrationPass);
+    Image imageAberration = camera->CreateImage();
+    camera->Capture(imageAberration);
+    camera->RemoveRenderPass(aberrationPass);
+
+    unsigned char *dataAberration = imageAberration.Data<unsigned char>();
+    EXPECT_NE(0u, diffSum(data, dataAberration));
+    for (unsigned int k = 0u; k < 3u; ++k)
+      EXPECT_NEAR(data[center + k], dataAberration[center + k], 2);
+  }
+
+  // motion blur smears the edges of the box when the camera rotates. The
+  // blurred image is compared with an image taken without the pass from
+  // the same orientation
+  {
+    RenderPassPtr pass = rpSystem->Create<MotionBlurPass>();
+    MotionBlurPassPtr motionBlurPass =
+        std::dynamic_pointer_cast<MotionBlurPass>(pass);
+    ASSERT_NE(nullptr, motionBlurPass);
+    motionBlurPass->SetExposureFraction(1.0);
+    camera->AddRenderPass(motionBlurPass);
+
+    // no blur while the camera does not move, apart from rounding
+    Image imageStill = camera->CreateImage();
+    camera->Capture(imageStill);
+    EXPECT_LT(diffSum(data, imageStill.Data<unsigned char>()),
+        width * height);
+
+    camera->SetLocalRotation(0.0, 0.0, 0.1);
+    Image imageBlur = camera->CreateImage();
+    camera->Capture(imageBlur);
+    camera->RemoveRenderPass(motionBlurPass);
+
+    Image imageRotated = camera->CreateImage();
+    camera->Capture(imageRotated);
+    unsigned char *dataBlur = imageBlur.Data<unsigned char>();
+    unsigned char *dataRotated = imageRotated.Data<unsigned char>();
+    EXPECT_GT(diffSum(dataRotated, dataBlur), width * height);
+    camera->SetLocalRotation(0.0, 0.0, 0.0);
+  }
+
+  // user shader that swaps the red and green channels, scaled by a gain
+  {
+    RenderPassPtr pass = rpSystem->Create<ShaderPass>();
+    ShaderPassPtr shaderPass = std::dynamic_pointer_cast<ShaderPass>(pass);
+    ASSERT_NE(nullptr, shaderPass);
+    std::string fsPath = common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+        "test", "media", "materials", "programs", "shader_pass_swap_fs.glsl");
+    shaderPass->SetFragmentShader(fsPath);
+    ShaderParamsPtr params = shaderPass->FragmentShaderParams();
+    (*params)["gain"] = 1.0f;
+    camera->AddRenderPass(shaderPass);
+    Image imageShader = camera->CreateImage();
+    camera->Capture(imageShader);
+
+    unsigned char *dataShader = imageShader.Data<unsigned char>();
+    EXPECT_NEAR(data[center + 1], dataShader[center], 2);
+    EXPECT_NEAR(data[center], dataShader[center + 1], 2);
+    EXPECT_NEAR(data[center + 2], dataShader[center + 2], 2);
+    EXPECT_NEAR(data[corner + 1], dataShader[corner], 2);
+
+    // params are applied to the next frame
+    (*params)["gain"] = 0.0f;
+    camera->Capture(imageShader);
+    dataShader = imageShader.Data<unsigned char>();
+    EXPECT_EQ(0u, colorSum(dataShader));
+    camera->RemoveRenderPass(shaderPass);
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(RenderPassTest, GaussianNoise)
 {
@@ -563,6 +786,12 @@ TEST_P(RenderPassTest, Distortion)
   Distortion(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(RenderPassTest, CameraEffects)
+{
+  CameraEffects(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(RenderPass, RenderPassTest,
     RENDER_ENGINE_VALUES,
     ignition::rendering::PrintToStringParam());
@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 
 #include "test_config.h"  // NOLINT(build/include)
@@ -45,6 +51,12 @@ class SceneTest: public testing::Test,
 
   // Test and verify camera tracking
   public: void VisualAt(const std::string &_renderEngine);
+
+  // Populate scenes from different threads and render them
+  public: void ConcurrentScenes(const std::string &_renderEngine);
+
+  // Render scenes from different threads in legacy gpu flush mode
+  public: void RenderFromThreads(const std::string &_renderEngine);
 };
 
 /////////////////////////////////////////////////
@@ -226,6 +238,263 @@ void SceneTest::VisualAt(const std::string &_renderEngine)
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void SceneTest::ConcurrentScenes(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 brackets frames with the shared resource mutex
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support concurrent scenes" << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // one scene per world, each with a box of its own color in front of a
+  // camera
+  const unsigned int sceneCount = 2u;
+  const unsigned int boxCount = 20u;
+  const math::Color colors[sceneCount] = {math::Color::Red,
+                                          math::Color::Blue};
+  std::vector<ScenePtr> scenes;
+  std::vector<CameraPtr> cameras;
+  for (unsigned int i = 0u; i < sceneCount; ++i)
+  {
+    ScenePtr scene = engine->CreateScene("scene" + std::to_string(i));
+    ASSERT_NE(nullptr, scene);
+    scene->SetCameraPassCountPerGpuFlush(6u);
+    scene->SetAmbientLight(1.0, 1.0, 1.0);
+
+    CameraPtr camera = scene->CreateCamera("camera");
+    ASSERT_NE(nullptr, camera);
+    camera->SetImageWidth(64);
+    camera->SetImageHeight(48);
+    camera->SetHFOV(IGN_PI / 2);
+    scene->RootVisual()->AddChild(camera);
+
+    MaterialPtr material = scene->CreateMaterial("box_material");
+    material->SetAmbient(colors[i]);
+    material->SetDiffuse(colors[i]);
+    material->SetEmissive(colors[i]);
+
+    scenes.push_back(scene);
+    cameras.push_back(camera);
+  }
+
+  // each world is populated by its own thread
+  std::vector<std::thread> workers;
+  for (unsigned int i = 0u; i < sceneCount; ++i)
+  {
+    workers.emplace_back([&, i]()
+    {
+      // take ownership before using the scene
+      ScenePtr scene = scenes[i];
+      scene->SetOwnerThread(std::this_thread::get_id());
+      for (unsigned int j = 0u; j < boxCount; ++j)
+      {
+        std::lock_guard<std::recursive_mutex> lock(
+            engine->SharedResourceMutex());
+        VisualPtr box = scene->CreateVisual("box" + std::to_string(j));
+        box->AddGeometry(scene->CreateBox());
+        box->SetMaterial(scene->Material("box_material"));
+        box->SetLocalPosition(2.0 + j * 0.1, 0.0, 0.0);
+        scene->RootVisual()->AddChild(box);
+      }
+    });
+  }
+  for (auto &worker : workers)
+    worker.join();
+
+  // scenes are rendered from the thread that owns the graphics context
+  for (unsigned int i = 0u; i < sceneCount; ++i)
+  {
+    scenes[i]->SetOwnerThread(std::this_thread::get_id());
+    for (unsigned int j = 0u; j < boxCount; ++j)
+      EXPECT_TRUE(scenes[i]->HasVisualName("box" + std::to_string(j)));
+
+    Image image = cameras[i]->CreateImage();
+    cameras[i]->Capture(image);
+    unsigned char *data = image.Data<unsigned char>();
+    unsigned int center = (24u * 64u + 32u) * 3u;
+    if (i == 0u)
+      EXPECT_GT(data[center], data[center + 2u]);
+    else
+      EXPECT_GT(data[center + 2u], data[center]);
+  }
+
+  for (auto &scene : scenes)
+    engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void SceneTest::RenderFromThreads(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 brackets frames with the shared resource mutex
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support concurrent scenes" << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // two scenes in the default, legacy gpu flush mode, each with a box of its
+  // own color in front of a camera
+  const unsigned int sceneCount = 2u;
+  const unsigned int frameCount = 20u;
+  const math::Color colors[sceneCount] = {math::Color::Red,
+                                          math::Color::Blue};
+  std::vector<ScenePtr> scenes;
+  std::vector<CameraPtr> cameras;
+  std::vector<VisualPtr> boxes;
+  for (unsigned int i = 0u; i < sceneCount; ++i)
+  {
+    ScenePtr scene = engine->CreateScene("scene" + std::to_string(i));
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(scene->LegacyAutoGpuFlush());
+    scene->SetAmbientLight(1.0, 1.0, 1.0);
+
+    CameraPtr camera = scene->CreateCamera("camera");
+    ASSERT_NE(nullptr, camera);
+    camera->SetImageWidth(64);
+    camera->SetImageHeight(48);
+    camera->SetHFOV(IGN_PI / 2);
+    scene->RootVisual()->AddChild(camera);
+
+    MaterialPtr material = scene->CreateMaterial("box_material");
+    material->SetAmbient(colors[i]);
+    material->SetDiffuse(colors[i]);
+    material->SetEmissive(colors[i]);
+
+    VisualPtr box = scene->CreateVisual("box");
+    box->AddGeometry(scene->CreateBox());
+    box->SetMaterial(material);
+    box->SetLocalPosition(2.0, 0.0, 0.0);
+    scene->RootVisual()->AddChild(box);
+
+    scenes.push_back(scene);
+    cameras.push_back(camera);
+    boxes.push_back(box);
+  }
+
+  // set if the frames or edits of the two threads overlap. The shared
+  // resource mutex must serialize them
+  std::atomic<int> activeCount{0};
+  std::atomic<bool> overlap{false};
+  auto exclusiveWork = [&]()
+  {
+    if (activeCount.fetch_add(1) != 0)
+      overlap = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    activeCount.fetch_sub(1);
+  };
+
+  // the new frame event is emitted inside the frame
+  std::vector<common::ConnectionPtr> connections;
+  for (auto &camera : cameras)
+  {
+    connections.push_back(camera->ConnectNewImageFrame(
+        [&](const void *, unsigned int, unsigned int, unsigned int,
+            const std::string &)
+        {
+          exclusiveWork();
+        }));
+  }
+
+  // renders a scene and checks that the center pixel has the color of its
+  // own box
+  std::atomic<unsigned int> wrongColorCount{0u};
+  auto renderScene = [&](unsigned int _index)
+  {
+    Image image = cameras[_index]->CreateImage();
+    cameras[_index]->Capture(image);
+    unsigned char *data = image.Data<unsigned char>();
+    unsigned int center = (24u * 64u + 32u) * 3u;
+    bool red = data[center] > data[center + 2u];
+    if (red != (_index == 0u))
+      ++wrongColorCount;
+  };
+
+  // with OpenGL, scenes can only be rendered from the thread the context is
+  // current on. The second thread then edits its scene while the first
+  // renders, and its scene is rendered once handed back.
+  bool renderFromAnyThread =
+      engine->GraphicsContextThread() == std::thread::id();
+
+  std::thread worker([&]()
+  {
+    scenes[1]->SetOwnerThread(std::this_thread::get_id());
+    for (unsigned int j = 0u; j < frameCount; ++j)
+    {
+      if (renderFromAnyThread)
+      {
+        renderScene(1u);
+      }
+      else
+      {
+        std::lock_guard<std::recursive_mutex> lock(
+            engine->SharedResourceMutex());
+        boxes[1]->SetLocalPosition(2.0 + j * 0.01, 0.0, 0.0);
+        exclusiveWork();
+      }
+    }
+  });
+
+  for (unsigned int j = 0u; j < frameCount; ++j)
+    renderScene(0u);
+  worker.join();
+
+  scenes[1]->SetOwnerThread(std::this_thread::get_id());
+  if (!renderFromAnyThread)
+  {
+    for (unsigned int j = 0u; j < frameCount; ++j)
+      renderScene(1u);
+  }
+
+  EXPECT_FALSE(overlap);
+  EXPECT_EQ(0u, wrongColorCount);
+
+  // legacy clients call PreRender without PostRender. The scene must hold
+  // the mutex from PreRender until the camera pass ends the frame
+  auto mutexFree = [&]()
+  {
+    bool locked = false;
+    std::thread other([&]()
+    {
+      locked = engine->SharedResourceMutex().try_lock();
+      if (locked)
+        engine->SharedResourceMutex().unlock();
+    });
+    other.join();
+    return locked;
+  };
+  scenes[0]->PreRender();
+  EXPECT_FALSE(mutexFree());
+  cameras[0]->Render();
+  cameras[0]->PostRender();
+  EXPECT_TRUE(mutexFree());
+
+  connections.clear();
+  for (auto &scene : scenes)
+    engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(SceneTest, AddRemoveVisuals)
 {
@@ -238,6 +507,18 @@ TEST_P(SceneTest, VisualAt)
   VisualAt(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(SceneTest, ConcurrentScenes)
+{
+  ConcurrentScenes(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneTest, RenderFromThreads)
+{
+  RenderFromThreads(GetParam());
+}
+
 // It doesn't suppot optix just yet
 INSTANTIATE_TEST_CASE_P(Scene, SceneTest,
     RENDER_ENGINE_VALUES,
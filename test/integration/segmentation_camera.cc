@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Filesystem.hh>
 #include <ignition/common/Event.hh>
@@ -25,6 +28,8 @@
 
 #include "test_config.h"  // NOLINT(build/include)
 
+#include "ignition/rendering/Decal.hh"
+#include "ignition/rendering/FrameEncoder.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/RenderingIface.hh"
 #include "ignition/rendering/Scene.hh"
@@ -39,6 +44,12 @@ class SegmentationCameraTest: public testing::Test,
 {
   public: void SegmentationCameraBoxes(const std::string &_renderEngine);
 
+  // Test saving frames without a segmentation frame listener
+  public: void SegmentationCameraSaveFrame(const std::string &_renderEngine);
+
+  // Test labeling the surfaces a decal is projected on
+  public: void SegmentationCameraDecal(const std::string &_renderEngine);
+
   // Documentation inherited
   protected: void SetUp() override
   {
@@ -242,11 +253,192 @@ void SegmentationCameraTest::SegmentationCameraBoxes(
   ignition::rendering::unloadEngine(engine->Name());
 }
 
+//////////////////////////////////////////////////
+void SegmentationCameraTest::SegmentationCameraSaveFrame(
+  const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports segmentation cameras
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' doesn't support segmentation cameras" << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' was unable to be retrieved" << std::endl;
+    return;
+  }
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  BuildScene(scene);
+
+  auto camera = scene->CreateSegmentationCamera("SegmentationCamera");
+  ASSERT_NE(camera, nullptr);
+
+  const unsigned int width = 320u;
+  const unsigned int height = 240u;
+  camera->SetAspectRatio(static_cast<double>(width) / height);
+  camera->SetImageWidth(width);
+  camera->SetImageHeight(height);
+  camera->SetHFOV(IGN_PI / 2);
+  camera->EnableColoredMap(true);
+  scene->RootVisual()->AddChild(camera);
+
+  std::string dir = common::joinPaths(
+      std::string(PROJECT_BUILD_PATH), "test", "segmentation_save_frame");
+  common::createDirectories(dir);
+  std::string filename = common::joinPaths(dir, "frame.png");
+  common::removeFile(filename);
+
+  // nothing rendered yet
+  EXPECT_FALSE(camera->SaveFrame(filename));
+
+  // no listener is connected, so the frame is only read back by SaveFrame
+  camera->Update();
+  EXPECT_TRUE(camera->SaveFrame(filename));
+  FrameEncoder::Instance()->Flush();
+  ASSERT_TRUE(common::exists(filename));
+
+  // check the size of the image in the png header
+  std::ifstream file(filename, std::ios::binary);
+  std::vector<unsigned char> header(24u);
+  file.read(reinterpret_cast<char *>(header.data()), header.size());
+  ASSERT_TRUE(file.good());
+  auto readBE32 = [&header](unsigned int _offset)
+  {
+    return (static_cast<unsigned int>(header[_offset]) << 24) |
+        (static_cast<unsigned int>(header[_offset + 1]) << 16) |
+        (static_cast<unsigned int>(header[_offset + 2]) << 8) |
+        static_cast<unsigned int>(header[_offset + 3]);
+  };
+  EXPECT_EQ(width, readBE32(16u));
+  EXPECT_EQ(height, readBE32(20u));
+
+  // Clean up
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
+//////////////////////////////////////////////////
+void SegmentationCameraTest::SegmentationCameraDecal(
+  const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports segmentation cameras
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' doesn't support segmentation cameras" << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    ignerr << "Engine '" << _renderEngine
+              << "' was unable to be retrieved" << std::endl;
+    return;
+  }
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  rendering::VisualPtr root = scene->RootVisual();
+
+  // wall facing the camera, its front face is at x = 2.5
+  rendering::VisualPtr wall = scene->CreateVisual("wall");
+  wall->AddGeometry(scene->CreateBox());
+  wall->SetLocalPosition(3, 0, 0);
+  wall->SetLocalScale(1, 2, 2);
+  wall->SetUserData("label", 2);
+  root->AddChild(wall);
+
+  // labeled decal projected on the middle of the front face of the wall
+  DecalPtr decal = scene->CreateDecal();
+  ASSERT_NE(nullptr, decal);
+  decal->SetSize(math::Vector3d(0.5, 0.5, 0.2));
+  decal->SetLocalPosition(2.5, 0, 0);
+  decal->SetLocalRotation(0, -IGN_PI / 2, 0);
+  decal->SetUserData("label", 5);
+  root->AddChild(decal);
+
+  // small box between the camera and the decal
+  rendering::VisualPtr occluder = scene->CreateVisual("occluder");
+  occluder->AddGeometry(scene->CreateBox());
+  occluder->SetLocalPosition(1.5, 0.15, 0);
+  occluder->SetLocalScale(0.1, 0.1, 0.1);
+  occluder->SetUserData("label", 3);
+  root->AddChild(occluder);
+
+  auto camera = scene->CreateSegmentationCamera("SegmentationCamera");
+  ASSERT_NE(camera, nullptr);
+
+  const unsigned int width = 320u;
+  const unsigned int height = 240u;
+  camera->SetAspectRatio(static_cast<double>(width) / height);
+  camera->SetImageWidth(width);
+  camera->SetImageHeight(height);
+  camera->SetHFOV(IGN_PI / 2);
+  camera->SetSegmentationType(SegmentationType::ST_SEMANTIC);
+  camera->EnableColoredMap(false);
+  root->AddChild(camera);
+
+  ignition::common::ConnectionPtr connection =
+      camera->ConnectNewSegmentationFrame(
+          std::bind(OnNewSegmentationFrame,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+  ASSERT_NE(nullptr, connection);
+
+  g_counter = 0;
+  camera->Update();
+  EXPECT_EQ(1, g_counter);
+
+  auto labelAt = [&](unsigned int _x, unsigned int _y)
+  {
+    return g_buffer[(_y * width + _x) * 3];
+  };
+
+  // the decal labels the surface it is projected on
+  EXPECT_EQ(5, labelAt(width / 2, height / 2));
+
+  // the occluder is in front of the decal and keeps its own label
+  EXPECT_EQ(3, labelAt(144, height / 2));
+
+  // the wall outside the decal keeps its own label
+  EXPECT_EQ(2, labelAt(120, height / 2));
+
+  // without the label, the decal keeps the label of the wall
+  decal->SetUserData("label", Variant());
+  g_counter = 0;
+  camera->Update();
+  EXPECT_EQ(1, g_counter);
+  EXPECT_EQ(2, labelAt(width / 2, height / 2));
+
+  // Clean up
+  connection.reset();
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
 TEST_P(SegmentationCameraTest, SegmentationCameraBoxes)
 {
   SegmentationCameraBoxes(GetParam());
 }
 
+TEST_P(SegmentationCameraTest, SegmentationCameraSaveFrame)
+{
+  SegmentationCameraSaveFrame(GetParam());
+}
+
+TEST_P(SegmentationCameraTest, SegmentationCameraDecal)
+{
+  SegmentationCameraDecal(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(SegmentationCamera, SegmentationCameraTest,
     RENDER_ENGINE_VALUES, ignition::rendering::PrintToStringParam());
 
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/SonarSensor.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+unsigned int g_sonarCounter = 0;
+
+void OnNewSonarFrame(std::vector<float> *_dest, const float *_data,
+                     unsigned int _beamCount, unsigned int _binCount)
+{
+  _dest->assign(_data, _data + _beamCount * _binCount);
+  g_sonarCounter++;
+}
+
+class SonarSensorTest: public testing::Test,
+  public testing::WithParamInterface<const char *>
+{
+  // Image boxes in front of a sonar sensor
+  public: void SonarSensorBoxes(const std::string &_renderEngine);
+};
+
+//////////////////////////////////////////////////
+void SonarSensorTest::SonarSensorBoxes(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports sonar sensors
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support sonar sensors" << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  VisualPtr root = scene->RootVisual();
+
+  const unsigned int beamCount = 64u;
+  const unsigned int binCount = 100u;
+  const double nearClip = 0.5;
+  const double farClip = 10.0;
+  const double binSize = (farClip - nearClip) / binCount;
+  SonarSensorPtr sonar = scene->CreateSonarSensor("sonar");
+  ASSERT_NE(nullptr, sonar);
+  sonar->SetWorldPosition(0.0, 0.0, 0.5);
+  sonar->SetNearClipPlane(nearClip);
+  sonar->SetFarClipPlane(farClip);
+  sonar->SetHFOV(IGN_PI / 2.0);
+  sonar->SetVerticalFOV(math::Angle(IGN_DTOR(20.0)));
+  sonar->SetImageWidth(256u);
+  sonar->SetImageHeight(64u);
+  sonar->SetBeamCount(beamCount);
+  sonar->SetRangeBinCount(binCount);
+  root->AddChild(sonar);
+
+  // reflective box in front of the sonar
+  VisualPtr box = scene->CreateVisual("box");
+  box->AddGeometry(scene->CreateBox());
+  box->SetWorldPosition(3.0, 0.0, 0.5);
+  box->SetUserData("acoustic_reflectivity", 0.8);
+  root->AddChild(box);
+
+  // box with no reflectivity on the right is not seen
+  VisualPtr hiddenBox = scene->CreateVisual("hidden_box");
+  hiddenBox->AddGeometry(scene->CreateBox());
+  hiddenBox->SetWorldPosition(4.0, -3.0, 0.5);
+  root->AddChild(hiddenBox);
+
+  std::vector<float> data;
+  common::ConnectionPtr connection = sonar->ConnectNewSonarFrame(
+      std::bind(&::OnNewSonarFrame, &data, std::placeholders::_1,
+        std::placeholders::_2, std::placeholders::_3));
+
+  g_sonarCounter = 0u;
+  sonar->Update();
+  EXPECT_EQ(1u, g_sonarCounter);
+  ASSERT_EQ(beamCount * binCount, data.size());
+
+  // the front face of the box is in the bin of its range in the center
+  // beams, with nothing in front of it
+  const unsigned int faceBin =
+      static_cast<unsigned int>((2.5 - nearClip) / binSize);
+  const unsigned int centerBeam = beamCount / 2u;
+  float faceIntensity = 0.0f;
+  for (unsigned int bin = faceBin; bin <= faceBin + 1u; ++bin)
+    faceIntensity += data[bin * beamCount + centerBeam];
+  EXPECT_GT(faceIntensity, 0.0f);
+  for (unsigned int bin = 0u; bin + 1u < faceBin; ++bin)
+    EXPECT_FLOAT_EQ(0.0f, data[bin * beamCount + centerBeam]);
+
+  // beams on the right only see the hidden box
+  for (unsigned int bin = 0u; bin < binCount; ++bin)
+  {
+    for (unsigned int beam = 48u; beam < beamCount; ++beam)
+      EXPECT_FLOAT_EQ(0.0f, data[bin * beamCount + beam]);
+  }
+
+  // intensities are never negative
+  for (float value : data)
+    EXPECT_GE(value, 0.0f);
+
+  // absorption of the water attenuates the returns
+  sonar->SetAttenuation(0.5);
+  sonar->Update();
+  EXPECT_EQ(2u, g_sonarCounter);
+  ASSERT_EQ(beamCount * binCount, data.size());
+  float attenuatedIntensity = 0.0f;
+  for (unsigned int bin = faceBin; bin <= faceBin + 1u; ++bin)
+    attenuatedIntensity += data[bin * beamCount + centerBeam];
+  EXPECT_GT(attenuatedIntensity, 0.0f);
+  EXPECT_LT(attenuatedIntensity, faceIntensity);
+
+  // speckle does not add returns where there are none
+  sonar->SetSpeckleNoise(1.0);
+  sonar->Update();
+  EXPECT_EQ(3u, g_sonarCounter);
+  ASSERT_EQ(beamCount * binCount, data.size());
+  for (unsigned int bin = 0u; bin + 1u < faceBin; ++bin)
+    EXPECT_FLOAT_EQ(0.0f, data[bin * beamCount + centerBeam]);
+
+  // the polar image follows the beam and range bin counts
+  sonar->SetBeamCount(32u);
+  sonar->SetRangeBinCount(50u);
+  sonar->Update();
+  EXPECT_EQ(4u, g_sonarCounter);
+  EXPECT_EQ(32u * 50u, data.size());
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
+//////////////////////////////////////////////////
+TEST_P(SonarSensorTest, SonarSensorBoxes)
+{
+  SonarSensorBoxes(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(SonarSensor, SonarSensorTest,
+    RENDER_ENGINE_VALUES, ignition::rendering::PrintToStringParam());
+
+//////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2022 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/StereoCamera.hh"
+
+#define DOUBLE_TOL 1e-6
+
+unsigned int g_stereoCounter = 0;
+unsigned int g_disparityCounter = 0;
+
+void OnNewStereoFrame(std::vector<unsigned char> *_leftDest,
+                  std::vector<unsigned char> *_rightDest,
+                  const unsigned char *_left, const unsigned char *_right,
+                  unsigned int _width, unsigned int _height,
+                  unsigned int _channels,
+                  const std::string &/*_format*/)
+{
+  unsigned int size = _width * _height * _channels;
+  _leftDest->assign(_left, _left + size);
+  _rightDest->assign(_right, _right + size);
+  g_stereoCounter++;
+}
+
+void OnNewDisparityFrame(float *_dest, const float *_data,
+                  unsigned int _width, unsigned int _height,
+                  unsigned int _channels,
+                  const std::string &/*_format*/)
+{
+  memcpy(_dest, _data, _width * _height * _channels * sizeof(float));
+  g_disparityCounter++;
+}
+
+/// \brief Get the first column of a row that is blue
+/// \param[in] _image RGB image
+/// \param[in] _width Image width
+/// \param[in] _row Row to search
+/// \return Column index or -1 if no pixel is blue
+int FirstBlueColumn(const std::vector<unsigned char> &_image,
+    unsigned int _width, unsigned int _row)
+{
+  for (unsigned int i = 0; i < _width; ++i)
+  {
+    unsigned int idx = (_row * _width + i) * 3u;
+    if (_image[idx + 2] > _image[idx])
+      return static_cast<int>(i);
+  }
+  return -1;
+}
+
+class StereoCameraTest: public testing::Test,
+  public testing::WithParamInterface<const char *>
+{
+  // Render a box in front of a stereo camera and check the disparity map
+  // and the offset between the left and right images
+  public: void StereoCameraBox(const std::string &_renderEngine);
+};
+
+//////////////////////////////////////////////////
+void StereoCameraTest::StereoCameraBox(const std::string &_renderEngine)
+{
+  // Currently, only ogre2 supports stereo cameras
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support stereo cameras" << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+
+  // red background
+  scene->SetBackgroundColor(1.0, 0.0, 0.0);
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  ignition::rendering::VisualPtr root = scene->RootVisual();
+
+  // create blue material
+  ignition::rendering::MaterialPtr blue = scene->CreateMaterial();
+  blue->SetAmbient(0.0, 0.0, 1.0);
+  blue->SetDiffuse(0.0, 0.0, 1.0);
+  blue->SetSpecular(0.0, 0.0, 1.0);
+
+  // unit box whose front face is 2 m in front of the left eye
+  ignition::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(2.5, 0.0, 0.0);
+  box->SetMaterial(blue);
+  root->AddChild(box);
+
+  {
+    unsigned int width = 256u;
+    unsigned int height = 256u;
+    double baseline = 0.1;
+
+    auto camera = scene->CreateStereoCamera("StereoCamera");
+    ASSERT_NE(nullptr, camera);
+    camera->SetImageWidth(width);
+    camera->SetImageHeight(height);
+    camera->SetAspectRatio(1.0);
+    camera->SetHFOV(1.05);
+    camera->SetNearClipPlane(0.1);
+    camera->SetFarClipPlane(10.0);
+    camera->SetBaseline(baseline);
+    EXPECT_NEAR(baseline, camera->Baseline(), DOUBLE_TOL);
+    camera->SetDisparityEnabled(true);
+    EXPECT_TRUE(camera->DisparityEnabled());
+    root->AddChild(camera);
+
+    std::vector<unsigned char> left;
+    std::vector<unsigned char> right;
+    ignition::common::ConnectionPtr connection =
+      camera->ConnectNewStereoFrame(
+          std::bind(&::OnNewStereoFrame, &left, &right,
+            std::placeholders::_1, std::placeholders::_2,
+            std::placeholders::_3, std::placeholders::_4,
+            std::placeholders::_5, std::placeholders::_6));
+
+    std::vector<float> disparity(width * height);
+    ignition::common::ConnectionPtr connection2 =
+      camera->ConnectNewDisparityFrame(
+          std::bind(&::OnNewDisparityFrame, disparity.data(),
+            std::placeholders::_1, std::placeholders::_2,
+            std::placeholders::_3, std::placeholders::_4,
+            std::placeholders::_5));
+
+    g_stereoCounter = 0u;
+    g_disparityCounter = 0u;
+    camera->Update();
+    EXPECT_EQ(1u, g_stereoCounter);
+    EXPECT_EQ(1u, g_disparityCounter);
+    ASSERT_EQ(width * height * 3u, left.size());
+    ASSERT_EQ(width * height * 3u, right.size());
+
+    // disparity of the box face in the center of the left image
+    double expectedDisparity = camera->FocalLength() * baseline / 2.0;
+    unsigned int mid = height / 2u * width + width / 2u;
+    EXPECT_NEAR(expectedDisparity, disparity[mid], 0.05);
+    ASSERT_NE(nullptr, camera->DisparityData());
+    EXPECT_FLOAT_EQ(disparity[mid], camera->DisparityData()[mid]);
+
+    // background has no disparity
+    EXPECT_FLOAT_EQ(0.0f, disparity[0]);
+    EXPECT_FLOAT_EQ(0.0f, disparity[width * height - 1u]);
+
+    // the box appears shifted to the left in the right image
+    int leftEdge = FirstBlueColumn(left, width, height / 2u);
+    int rightEdge = FirstBlueColumn(right, width, height / 2u);
+    ASSERT_GT(leftEdge, 0);
+    ASSERT_GT(rightEdge, 0);
+    EXPECT_NEAR(expectedDisparity, leftEdge - rightEdge, 1.0);
+
+    // disable disparity output
+    camera->SetDisparityEnabled(false);
+    camera->Update();
+    EXPECT_EQ(2u, g_stereoCounter);
+    EXPECT_EQ(1u, g_disparityCounter);
+    EXPECT_EQ(nullptr, camera->DisparityData());
+  }
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
+//////////////////////////////////////////////////
+TEST_P(StereoCameraTest, StereoCameraBox)
+{
+  StereoCameraBox(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(StereoCamera, StereoCameraTest,
+    RENDER_ENGINE_VALUES, ignition::rendering::PrintToStringParam());
+
+//////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -17,6 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <fstream>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Filesystem.hh>
 #include <ignition/common/Event.hh>
@@ -26,6 +30,7 @@
 
 #include "test_config.h"  // NOLINT(build/include)
 
+#include "ignition/rendering/FrameEncoder.hh"
 #include "ignition/rendering/ParticleEmitter.hh"
 #include "ignition/rendering/PixelFormat.hh"
 #include "ignition/rendering/RenderEngine.hh"
@@ -70,6 +75,17 @@ class ThermalCameraTest: public testing::Test,
   // Test that particles do not appear in thermal camera image
   public: void ThermalCameraParticles(const std::string &_renderEngine);
 
+  // Test saving frames without a thermal frame listener
+  public: void ThermalCameraSaveFrame(const std::string &_renderEngine);
+
+  // Test the radiometric model with non-default emissivity
+  public: void ThermalCameraRadiometric(const std::string &_renderEngine);
+
+  // Test that items with the same heat signature share a material, and
+  // that materials are evicted once no item uses them
+  public: void ThermalCameraHeatSignatureSharing(
+              const std::string &_renderEngine);
+
   // Path to test textures
   public: const std::string TEST_MEDIA_PATH =
           ignition::common::joinPaths(std::string(PROJECT_SOURCE_PATH),
@@ -629,6 +645,334 @@ void ThermalCameraTest::ThermalCameraParticles(
   ignition::rendering::unloadEngine(engine->Name());
 }
 
+//////////////////////////////////////////////////
+void ThermalCameraTest::ThermalCameraSaveFrame(
+    const std::string &_renderEngine)
+{
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support saving thermal frames" << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ignition::rendering::VisualPtr root = scene->RootVisual();
+
+  ignition::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 0.0, 0.0);
+  box->SetUserData("temperature", 310.0f);
+  root->AddChild(box);
+
+  const unsigned int width = 40u;
+  const unsigned int height = 30u;
+  auto thermalCamera = scene->CreateThermalCamera("ThermalCamera");
+  ASSERT_NE(thermalCamera, nullptr);
+  thermalCamera->SetImageWidth(width);
+  thermalCamera->SetImageHeight(height);
+  thermalCamera->SetAspectRatio(static_cast<double>(width) / height);
+  thermalCamera->SetHFOV(1.05);
+  root->AddChild(thermalCamera);
+
+  std::string dir = ignition::common::joinPaths(
+      std::string(PROJECT_BUILD_PATH), "test", "thermal_save_frame");
+  ignition::common::createDirectories(dir);
+  std::string filename = ignition::common::joinPaths(dir, "frame.png");
+  ignition::common::removeFile(filename);
+
+  // nothing rendered yet
+  EXPECT_FALSE(thermalCamera->SaveFrame(filename));
+
+  // no listener is connected, so the frame is only read back by SaveFrame
+  thermalCamera->Update();
+  EXPECT_TRUE(thermalCamera->SaveFrame(filename));
+  ignition::rendering::FrameEncoder::Instance()->Flush();
+  ASSERT_TRUE(ignition::common::exists(filename));
+
+  // check the size of the image in the png header
+  std::ifstream file(filename, std::ios::binary);
+  std::vector<unsigned char> header(24u);
+  file.read(reinterpret_cast<char *>(header.data()), header.size());
+  ASSERT_TRUE(file.good());
+  auto readBE32 = [&header](unsigned int _offset)
+  {
+    return (static_cast<unsigned int>(header[_offset]) << 24) |
+        (static_cast<unsigned int>(header[_offset + 1]) << 16) |
+        (static_cast<unsigned int>(header[_offset + 2]) << 8) |
+        static_cast<unsigned int>(header[_offset + 3]);
+  };
+  EXPECT_EQ(width, readBE32(16u));
+  EXPECT_EQ(height, readBE32(20u));
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
+//////////////////////////////////////////////////
+void ThermalCameraTest::ThermalCameraRadiometric(
+    const std::string &_renderEngine)
+{
+  int imgWidth = 50;
+  int imgHeight = 50;
+
+  // Only ogre2 supports the radiometric model
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support the radiometric thermal model"
+              << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ignition::rendering::VisualPtr root = scene->RootVisual();
+
+  // box with a front face 1.3 m away from the camera
+  ignition::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 0.0, 0.0);
+  float boxTemp = 310.0f;
+  float emissivity = 0.5f;
+  box->SetUserData("temperature", boxTemp);
+  box->SetUserData("emissivity", emissivity);
+  root->AddChild(box);
+
+  auto thermalCamera = scene->CreateThermalCamera("ThermalCamera");
+  ASSERT_NE(thermalCamera, nullptr);
+  thermalCamera->SetImageWidth(imgWidth);
+  thermalCamera->SetImageHeight(imgHeight);
+  thermalCamera->SetAspectRatio(1.0);
+  thermalCamera->SetHFOV(1.05);
+  thermalCamera->SetNearClipPlane(0.15);
+  thermalCamera->SetFarClipPlane(10.0);
+
+  float ambientTemp = 296.0f;
+  float ambientTempRange = 4.0f;
+  float boxTempRange = 3.0f;
+  float linearResolution = 0.01f;
+  float reflectedTemp = 250.0f;
+  thermalCamera->SetAmbientTemperature(ambientTemp);
+  thermalCamera->SetAmbientTemperatureRange(ambientTempRange);
+  thermalCamera->SetHeatSourceTemperatureRange(boxTempRange);
+  thermalCamera->SetLinearResolution(linearResolution);
+  root->AddChild(thermalCamera);
+
+  uint16_t *thermalData = new uint16_t[imgHeight * imgWidth];
+  ignition::common::ConnectionPtr connection =
+    thermalCamera->ConnectNewThermalFrame(
+        std::bind(&::OnNewThermalFrame, thermalData,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+  EXPECT_NE(nullptr, connection);
+
+  int midWidth = static_cast<int>(thermalCamera->ImageWidth() * 0.5);
+  int midHeight = static_cast<int>(thermalCamera->ImageHeight() * 0.5);
+  int mid = midHeight * thermalCamera->ImageWidth() + midWidth -1;
+  int left = midHeight * thermalCamera->ImageWidth();
+
+  // the emissivity is ignored without the radiometric model
+  thermalCamera->Update();
+  EXPECT_NEAR(boxTemp, thermalData[mid] * linearResolution, boxTempRange);
+
+  // the apparent temperature mixes the box and reflected temperatures
+  thermalCamera->SetRadiometricModelEnabled(true);
+  EXPECT_TRUE(thermalCamera->RadiometricModelEnabled());
+  thermalCamera->SetReflectedTemperature(reflectedTemp);
+  EXPECT_FLOAT_EQ(reflectedTemp, thermalCamera->ReflectedTemperature());
+  thermalCamera->Update();
+  float apparentTemp = std::pow(
+      emissivity * std::pow(boxTemp, 4.0f) +
+      (1.0f - emissivity) * std::pow(reflectedTemp, 4.0f), 0.25f);
+  EXPECT_NEAR(apparentTemp, thermalData[mid] * linearResolution,
+      boxTempRange);
+  EXPECT_LT(thermalData[mid] * linearResolution, boxTemp - boxTempRange);
+
+  // the background is not a heat source, so it is not affected
+  EXPECT_NEAR(ambientTemp, thermalData[left] * linearResolution,
+      ambientTempRange);
+
+  // a black body is not affected by the reflected temperature
+  box->SetUserData("emissivity", 1.0f);
+  thermalCamera->Update();
+  EXPECT_NEAR(boxTemp, thermalData[mid] * linearResolution, boxTempRange);
+
+  // the atmosphere pulls the apparent temperature towards ambient
+  float extinction = 0.5f;
+  thermalCamera->SetAtmosphericExtinctionCoefficient(extinction);
+  EXPECT_FLOAT_EQ(extinction,
+      thermalCamera->AtmosphericExtinctionCoefficient());
+  thermalCamera->Update();
+  float tau = std::exp(-extinction * 1.3f);
+  apparentTemp = std::pow(tau * std::pow(boxTemp, 4.0f) +
+      (1.0f - tau) * std::pow(ambientTemp, 4.0f), 0.25f);
+  EXPECT_NEAR(apparentTemp, thermalData[mid] * linearResolution,
+      boxTempRange);
+
+  // Clean up
+  connection.reset();
+  delete [] thermalData;
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
+//////////////////////////////////////////////////
+void ThermalCameraTest::ThermalCameraHeatSignatureSharing(
+    const std::string &_renderEngine)
+{
+  int imgWidth = 50;
+  int imgHeight = 50;
+  double hfov = 1.05;
+
+  // Only ogre2 supports heat signatures
+  if (_renderEngine.compare("ogre2") != 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support heat signatures" << std::endl;
+    return;
+  }
+
+  // Setup ign-rendering with an empty scene
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ignition::rendering::VisualPtr root = scene->RootVisual();
+
+  // the heat signature is a texture of gray pixels, so boxes are midway
+  // between their min and max temperatures
+  std::string textureName =
+    ignition::common::joinPaths(TEST_MEDIA_PATH, "gray_texture.png");
+  auto createBox = [&](double _y, float _minTemp, float _maxTemp)
+  {
+    ignition::rendering::VisualPtr box = scene->CreateVisual();
+    box->AddGeometry(scene->CreateBox());
+    box->SetLocalPosition(3.0, _y, 0.0);
+    box->SetUserData("temperature", textureName);
+    box->SetUserData("minTemp", _minTemp);
+    box->SetUserData("maxTemp", _maxTemp);
+    root->AddChild(box);
+    return box;
+  };
+
+  // the left and right boxes share a heat signature, the middle box uses
+  // the same texture with another temperature range
+  ignition::rendering::VisualPtr leftBox = createBox(1.0, 100.0f, 200.0f);
+  ignition::rendering::VisualPtr rightBox = createBox(-1.0, 100.0f, 200.0f);
+  ignition::rendering::VisualPtr midBox = createBox(0.0, 200.0f, 300.0f);
+
+  auto thermalCamera = scene->CreateThermalCamera("ThermalCamera");
+  ASSERT_NE(thermalCamera, nullptr);
+  thermalCamera->SetImageWidth(imgWidth);
+  thermalCamera->SetImageHeight(imgHeight);
+  thermalCamera->SetAspectRatio(1.0);
+  thermalCamera->SetHFOV(hfov);
+  thermalCamera->SetNearClipPlane(0.15);
+  thermalCamera->SetFarClipPlane(10.0);
+
+  float ambientTemp = 296.0f;
+  float ambientTempRange = 4.0f;
+  float boxTempRange = 3.0f;
+  float linearResolution = 0.01f;
+  thermalCamera->SetAmbientTemperature(ambientTemp);
+  thermalCamera->SetAmbientTemperatureRange(ambientTempRange);
+  thermalCamera->SetHeatSourceTemperatureRange(boxTempRange);
+  thermalCamera->SetLinearResolution(linearResolution);
+  root->AddChild(thermalCamera);
+
+  uint16_t *thermalData = new uint16_t[imgHeight * imgWidth];
+  ignition::common::ConnectionPtr connection =
+    thermalCamera->ConnectNewThermalFrame(
+        std::bind(&::OnNewThermalFrame, thermalData,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+  EXPECT_NE(nullptr, connection);
+
+  // index of the pixel in the middle row that sees the point at _y on the
+  // front faces of the boxes
+  auto index = [&](double _y)
+  {
+    double x = imgWidth * 0.5 * (1.0 - _y / 2.5 / std::tan(hfov * 0.5));
+    int midHeight = imgHeight / 2;
+    return midHeight * imgWidth + static_cast<int>(x);
+  };
+  int left = index(1.0);
+  int right = index(-1.0);
+  int mid = index(0.0);
+  auto tempAt = [&](int _index)
+  {
+    return thermalData[_index] * linearResolution;
+  };
+
+  thermalCamera->Update();
+  EXPECT_NEAR(150.0f, tempAt(left), boxTempRange);
+  EXPECT_NEAR(150.0f, tempAt(right), boxTempRange);
+  EXPECT_NEAR(250.0f, tempAt(mid), boxTempRange);
+
+  // the right box keeps the shared material after the left box is removed
+  scene->DestroyVisual(leftBox);
+  leftBox.reset();
+  thermalCamera->Update();
+  EXPECT_NEAR(ambientTemp, tempAt(left), ambientTempRange);
+  EXPECT_NEAR(150.0f, tempAt(right), boxTempRange);
+  EXPECT_NEAR(250.0f, tempAt(mid), boxTempRange);
+
+  // changing the heat signature of the middle box moves it to the shared
+  // material and evicts its previous one
+  midBox->SetUserData("minTemp", 100.0f);
+  midBox->SetUserData("maxTemp", 200.0f);
+  thermalCamera->Update();
+  EXPECT_NEAR(150.0f, tempAt(right), boxTempRange);
+  EXPECT_NEAR(150.0f, tempAt(mid), boxTempRange);
+
+  // remove all boxes so that all materials are evicted
+  scene->DestroyVisual(rightBox);
+  scene->DestroyVisual(midBox);
+  rightBox.reset();
+  midBox.reset();
+  thermalCamera->Update();
+  EXPECT_NEAR(ambientTemp, tempAt(right), ambientTempRange);
+  EXPECT_NEAR(ambientTemp, tempAt(mid), ambientTempRange);
+
+  // evicted heat signatures are created again when needed
+  leftBox = createBox(1.0, 100.0f, 200.0f);
+  midBox = createBox(0.0, 200.0f, 300.0f);
+  thermalCamera->Update();
+  EXPECT_NEAR(150.0f, tempAt(left), boxTempRange);
+  EXPECT_NEAR(250.0f, tempAt(mid), boxTempRange);
+
+  // Clean up
+  connection.reset();
+  delete [] thermalData;
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
 // See: https://github.com/gazebosim/gz-rendering/issues/654
 TEST_P(ThermalCameraTest,
        IGN_UTILS_TEST_DISABLED_ON_MAC(ThermalCameraBoxesUniformTemp))
@@ -651,6 +995,21 @@ TEST_P(ThermalCameraTest, ThermalCameraParticles)
   ThermalCameraParticles(GetParam());
 }
 
+TEST_P(ThermalCameraTest, ThermalCameraSaveFrame)
+{
+  ThermalCameraSaveFrame(GetParam());
+}
+
+TEST_P(ThermalCameraTest, ThermalCameraRadiometric)
+{
+  ThermalCameraRadiometric(GetParam());
+}
+
+TEST_P(ThermalCameraTest, ThermalCameraHeatSignatureSharing)
+{
+  ThermalCameraHeatSignatureSharing(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(ThermalCamera, ThermalCameraTest,
     RENDER_ENGINE_VALUES, ignition::rendering::PrintToStringParam());
 